@@ -144,4 +144,7 @@ DEFINE_ALERT_WITH_SHAPE(BOPAlgo_AlertShapeIsNotPeriodic)
 //! Unable to make closed edge on face (to make a seam)
 DEFINE_ALERT_WITH_SHAPE(BOPAlgo_AlertUnableToMakeClosedEdgeOnFace)
 
+//! Unable to make closed wires of the slice of the shape
+DEFINE_ALERT_WITH_SHAPE(BOPAlgo_AlertUnableToMakeClosedSlice)
+
 #endif // _BOPAlgo_Alerts_HeaderFile
@@ -26,6 +26,7 @@
 #include <BRep_Builder.hxx>
 #include <BRep_Tool.hxx>
 #include <NCollection_DataMap.hxx>
+#include <Standard_ArenaScope.hxx>
 #include <TopAbs_ShapeEnum.hxx>
 #include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
@@ -354,6 +355,7 @@ void BOPAlgo_BOP::BuildResult(const TopAbs_ShapeEnum theType)
 //=======================================================================
 void BOPAlgo_BOP::Perform(const Message_ProgressRange& theRange)
 {
+  Standard_ArenaScope anArenaScope (myUseArena);
   Handle(NCollection_BaseAllocator) aAllocator;
   BOPAlgo_PaveFiller* pPF;
   TopTools_ListIteratorOfListOfShape aItLS;
@@ -392,6 +394,7 @@ void BOPAlgo_BOP::Perform(const Message_ProgressRange& theRange)
   pPF->SetNonDestructive(myNonDestructive);
   pPF->SetGlue(myGlue);
   pPF->SetUseOBB(myUseOBB);
+  pPF->SetUseArena(myUseArena);
   //
   pPF->Perform(aPS.Next(9));
   //
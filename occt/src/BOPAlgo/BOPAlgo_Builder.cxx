@@ -26,6 +26,7 @@
 #include <BOPTools_AlgoTools.hxx>
 #include <BRep_Builder.hxx>
 #include <IntTools_Context.hxx>
+#include <Standard_ArenaScope.hxx>
 #include <Standard_ErrorHandler.hxx>
 #include <Standard_Failure.hxx>
 #include <TopExp.hxx>
@@ -178,6 +179,7 @@ void BOPAlgo_Builder::Prepare()
 //=======================================================================
 void BOPAlgo_Builder::Perform(const Message_ProgressRange& theRange)
 {
+  Standard_ArenaScope anArenaScope (myUseArena);
   GetReport()->Clear();
   //
   if (myEntryPoint==1) {
@@ -199,6 +201,7 @@ void BOPAlgo_Builder::Perform(const Message_ProgressRange& theRange)
   pPF->SetNonDestructive(myNonDestructive);
   pPF->SetGlue(myGlue);
   pPF->SetUseOBB(myUseOBB);
+  pPF->SetUseArena(myUseArena);
   //
   pPF->Perform(aPS.Next(9));
   //
@@ -217,6 +220,8 @@ void BOPAlgo_Builder::PerformWithFiller(const BOPAlgo_PaveFiller& theFiller, con
   myFuzzyValue = theFiller.FuzzyValue();
   myGlue = theFiller.Glue();
   myUseOBB = theFiller.UseOBB();
+  myUseArena = theFiller.UseArena();
+  Standard_ArenaScope anArenaScope (myUseArena);
   PerformInternal(theFiller, theRange);
 }
 //=======================================================================
@@ -21,6 +21,7 @@
 #include <BOPDS_DS.hxx>
 #include <BOPTools_AlgoTools.hxx>
 #include <BRepPrimAPI_MakeBox.hxx>
+#include <Standard_ArenaScope.hxx>
 #include <TopExp_Explorer.hxx>
 #include <TopoDS_Solid.hxx>
 #include <TopTools_ListOfShape.hxx>
@@ -49,6 +50,7 @@ void BOPAlgo_MakerVolume::CheckData()
 //=======================================================================
 void BOPAlgo_MakerVolume::Perform(const Message_ProgressRange& theRange)
 {
+  Standard_ArenaScope anArenaScope (myUseArena);
   Message_ProgressScope aPS(theRange, "Performing MakeVolume operation", 10);
   Standard_Real anInterPart = myIntersect ? 9 : 0.5;
   Standard_Real aBuildPart = 10. - anInterPart;
@@ -93,6 +95,7 @@ void BOPAlgo_MakerVolume::Perform(const Message_ProgressRange& theRange)
   pPF->SetNonDestructive(myNonDestructive);
   pPF->SetGlue(myGlue);
   pPF->SetUseOBB(myUseOBB);
+  pPF->SetUseArena(myUseArena);
   pPF->Perform(aPS.Next(anInterPart));
   //
   myEntryPoint = 1;
@@ -52,7 +52,8 @@ BOPAlgo_Options::BOPAlgo_Options()
   myReport(new Message_Report),
   myRunParallel(myGlobalRunParallel),
   myFuzzyValue(Precision::Confusion()),
-  myUseOBB(Standard_False)
+  myUseOBB(Standard_False),
+  myUseArena(Standard_False)
 {
   BOPAlgo_LoadMessages();
 }
@@ -68,7 +69,8 @@ BOPAlgo_Options::BOPAlgo_Options
   myReport(new Message_Report),
   myRunParallel(myGlobalRunParallel),
   myFuzzyValue(Precision::Confusion()),
-  myUseOBB(Standard_False)
+  myUseOBB(Standard_False),
+  myUseArena(Standard_False)
 {
   BOPAlgo_LoadMessages();
 }
@@ -165,6 +165,30 @@ public:
     return myUseOBB;
   }
 
+public:
+  //!@name Usage of arena allocation
+
+  //! Enables/Disables the arena allocation of the temporary data of the algorithm.
+  //! When enabled, the small memory blocks allocated by the algorithm in the calling
+  //! thread are taken from the arena (see Standard_ArenaScope) and released in bulk.
+  //! Note that the freed blocks are not reused, and the chunks shared with the data structure
+  //! of the algorithm are not released while the algorithm is alive, so that the peak memory
+  //! approaches the total size of the allocations (e.g. about 230 MB instead of 35 MB for the cut
+  //! of a plate by 361 cylinders); the chunks shared with the result (and its history) are retained
+  //! after the algorithm is destroyed (about 9 MB for the same result taking 150 KB in the heap).
+  //! The command "busearena -retained" of DRAW reports the retained size.
+  //! Disabled by default.
+  void SetUseArena(const Standard_Boolean theUseArena)
+  {
+    myUseArena = theUseArena;
+  }
+
+  //! Returns the flag defining usage of arena allocation
+  Standard_Boolean UseArena() const
+  {
+    return myUseArena;
+  }
+
 protected:
 
   //! Adds error to the report if the break signal was caught. Returns true in this case, false otherwise.
@@ -177,6 +201,7 @@ protected:
   Standard_Boolean myRunParallel;
   Standard_Real myFuzzyValue;
   Standard_Boolean myUseOBB;
+  Standard_Boolean myUseArena;
 
 };
 
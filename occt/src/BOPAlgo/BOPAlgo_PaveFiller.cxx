@@ -23,6 +23,7 @@
 #include <BOPDS_Iterator.hxx>
 #include <IntTools_Context.hxx>
 #include <NCollection_BaseAllocator.hxx>
+#include <Standard_ArenaScope.hxx>
 #include <Standard_ErrorHandler.hxx>
 #include <Standard_Failure.hxx>
 
@@ -240,6 +241,7 @@ void BOPAlgo_PaveFiller::Init (const Message_ProgressRange& theRange)
 //=======================================================================
 void BOPAlgo_PaveFiller::Perform (const Message_ProgressRange& theRange)
 {
+  Standard_ArenaScope anArenaScope (myUseArena);
   try {
     OCC_CATCH_SIGNALS
       //
@@ -16,6 +16,7 @@
 #include <BOPAlgo_Splitter.hxx>
 #include <BOPAlgo_PaveFiller.hxx>
 #include <BOPAlgo_Alerts.hxx>
+#include <Standard_ArenaScope.hxx>
 
 #include <TopoDS_Iterator.hxx>
 
@@ -64,6 +65,7 @@ void BOPAlgo_Splitter::CheckData()
 //=======================================================================
 void BOPAlgo_Splitter::Perform(const Message_ProgressRange& theRange)
 {
+  Standard_ArenaScope anArenaScope (myUseArena);
   GetReport()->Clear();
   //
   if (myEntryPoint == 1) {
@@ -94,6 +96,7 @@ void BOPAlgo_Splitter::Perform(const Message_ProgressRange& theRange)
   pPF->SetNonDestructive(myNonDestructive);
   pPF->SetGlue(myGlue);
   pPF->SetUseOBB(myUseOBB);
+  pPF->SetUseArena(myUseArena);
   //
   Message_ProgressScope aPS(theRange, "Performing Split operation", 10);
   pPF->Perform(aPS.Next(9));
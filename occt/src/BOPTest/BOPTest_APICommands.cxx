@@ -20,9 +20,15 @@
 #include <BRepAlgoAPI_Cut.hxx>
 #include <BRepAlgoAPI_Fuse.hxx>
 #include <BRepAlgoAPI_Section.hxx>
+#include <BRepAlgoAPI_Slicer.hxx>
 #include <BRepAlgoAPI_Splitter.hxx>
 #include <BRepTest_Objects.hxx>
+#include <BRep_Builder.hxx>
 #include <DBRep.hxx>
+#include <Draw.hxx>
+#include <TColStd_Array1OfReal.hxx>
+#include <TColStd_SequenceOfReal.hxx>
+#include <TopoDS_Compound.hxx>
 #include <TopoDS_Shape.hxx>
 #include <TopTools_ListOfShape.hxx>
 
@@ -33,6 +39,7 @@
 static Standard_Integer bapibuild(Draw_Interpretor&, Standard_Integer, const char**);
 static Standard_Integer bapibop  (Draw_Interpretor&, Standard_Integer, const char**);
 static Standard_Integer bapisplit(Draw_Interpretor&, Standard_Integer, const char**);
+static Standard_Integer bapislice(Draw_Interpretor&, Standard_Integer, const char**);
 
 //=======================================================================
 //function : APICommands
@@ -68,6 +75,17 @@ void BOPTest::APICommands(Draw_Interpretor& theCommands)
                   "\t\tObjects for the operation are added using commands baddobjects and baddtools.\n"
                   "\t\tUsage: bapisplit result",
                   __FILE__, bapisplit, g);
+
+  theCommands.Add("bapislice", "Slices the shape by the set of parallel planes.\n"
+                  "\t\tUsage: bapislice result shape dx dy dz {h1 [h2 ...] | -range hmin hmax nb} [-mesh]\n"
+                  "\t\tWhere:\n"
+                  "\t\tresult - name of the result, the compound of slices each being the compound of wires;\n"
+                  "\t\tdx dy dz - normal direction of the planes;\n"
+                  "\t\th1 h2 ... - heights of the planes along the direction;\n"
+                  "\t\t-range - slices by nb planes evenly distributed from hmin to hmax;\n"
+                  "\t\t-mesh - uses the triangulations of the faces if all faces have them.\n"
+                  "\t\tThe parallel mode and the fuzzy value are defined by brunparallel and bfuzzyvalue commands.",
+                  __FILE__, bapislice, g);
 }
 //=======================================================================
 //function : bapibop
@@ -144,6 +162,7 @@ Standard_Integer bapibop(Draw_Interpretor& di,
   pBuilder->SetGlue(aGlue);
   pBuilder->SetCheckInverted(BOPTest_Objects::CheckInverted());
   pBuilder->SetUseOBB(BOPTest_Objects::UseOBB());
+  pBuilder->SetUseArena(BOPTest_Objects::UseArena());
   pBuilder->SetToFillHistory(BRepTest_Objects::IsHistoryNeeded());
   //
   Handle(Draw_ProgressIndicator) aProgress = new Draw_ProgressIndicator(di, 1);
@@ -212,6 +231,7 @@ Standard_Integer bapibuild(Draw_Interpretor& di,
   aBuilder.SetGlue(aGlue);
   aBuilder.SetCheckInverted(BOPTest_Objects::CheckInverted());
   aBuilder.SetUseOBB(BOPTest_Objects::UseOBB());
+  aBuilder.SetUseArena(BOPTest_Objects::UseArena());
   aBuilder.SetToFillHistory(BRepTest_Objects::IsHistoryNeeded());
   //
   Handle(Draw_ProgressIndicator) aProgress = new Draw_ProgressIndicator(di, 1);
@@ -272,6 +292,7 @@ Standard_Integer bapisplit(Draw_Interpretor& di,
   aSplitter.SetGlue(BOPTest_Objects::Glue());
   aSplitter.SetCheckInverted(BOPTest_Objects::CheckInverted());
   aSplitter.SetUseOBB(BOPTest_Objects::UseOBB());
+  aSplitter.SetUseArena(BOPTest_Objects::UseArena());
   aSplitter.SetToFillHistory(BRepTest_Objects::IsHistoryNeeded());
   //
   // performing operation
@@ -310,3 +331,102 @@ Standard_Integer bapisplit(Draw_Interpretor& di,
   DBRep::Set(a[1], aR);
   return 0;
 }
+
+//=======================================================================
+//function : bapislice
+//purpose  : 
+//=======================================================================
+Standard_Integer bapislice(Draw_Interpretor& di,
+                           Standard_Integer n,
+                           const char** a)
+{
+  if (n < 7) {
+    di.PrintHelp(a[0]);
+    return 1;
+  }
+  //
+  TopoDS_Shape aS = DBRep::Get(a[2]);
+  if (aS.IsNull()) {
+    di << "Error: " << a[2] << " is a null shape\n";
+    return 1;
+  }
+  //
+  gp_Vec aDir(Draw::Atof(a[3]), Draw::Atof(a[4]), Draw::Atof(a[5]));
+  if (aDir.SquareMagnitude() < gp::Resolution()) {
+    di << "Error: null direction\n";
+    return 1;
+  }
+  //
+  Standard_Boolean bUseMesh = Standard_False;
+  TColStd_SequenceOfReal aHeights;
+  for (Standard_Integer i = 6; i < n; ++i) {
+    if (!strcmp(a[i], "-mesh")) {
+      bUseMesh = Standard_True;
+    }
+    else if (!strcmp(a[i], "-range")) {
+      if (i + 3 >= n) {
+        di.PrintHelp(a[0]);
+        return 1;
+      }
+      Standard_Real aHMin = Draw::Atof(a[++i]);
+      Standard_Real aHMax = Draw::Atof(a[++i]);
+      Standard_Integer aNb = Draw::Atoi(a[++i]);
+      for (Standard_Integer j = 0; j < aNb; ++j) {
+        aHeights.Append(aNb > 1 ? aHMin + (aHMax - aHMin) * j / (aNb - 1) : aHMin);
+      }
+    }
+    else {
+      aHeights.Append(Draw::Atof(a[i]));
+    }
+  }
+  if (aHeights.IsEmpty()) {
+    di << "Error: no heights are given\n";
+    return 1;
+  }
+  //
+  TColStd_Array1OfReal anArrHeights(1, aHeights.Length());
+  for (Standard_Integer i = 1; i <= aHeights.Length(); ++i) {
+    anArrHeights(i) = aHeights(i);
+  }
+  //
+  BRepAlgoAPI_Slicer aSlicer;
+  aSlicer.SetShape(aS);
+  aSlicer.SetDirection(aDir);
+  aSlicer.SetHeights(anArrHeights);
+  aSlicer.SetUseTriangulation(bUseMesh);
+  aSlicer.SetRunParallel(BOPTest_Objects::RunParallel());
+  aSlicer.SetFuzzyValue(BOPTest_Objects::FuzzyValue());
+  //
+  Handle(Draw_ProgressIndicator) aProgress = new Draw_ProgressIndicator(di, 1);
+  aSlicer.Perform(aProgress->Start());
+  //
+  // check warning status
+  if (aSlicer.HasWarnings()) {
+    Standard_SStream aSStream;
+    aSlicer.DumpWarnings(aSStream);
+    di << aSStream;
+  }
+  // checking error status
+  if (aSlicer.HasErrors()) {
+    Standard_SStream aSStream;
+    aSlicer.DumpErrors(aSStream);
+    di << aSStream;
+    return 0;
+  }
+  //
+  BRep_Builder aBB;
+  TopoDS_Compound aR;
+  aBB.MakeCompound(aR);
+  Standard_Integer aNbWires = 0;
+  for (Standard_Integer i = 1; i <= aSlicer.NbSlices(); ++i) {
+    const TopoDS_Shape& aSlice = aSlicer.Slice(i);
+    aBB.Add(aR, aSlice);
+    aNbWires += aSlice.NbChildren();
+  }
+  //
+  di << "Slices: " << aSlicer.NbSlices() << ", wires: " << aNbWires
+     << ", intersected face/plane pairs: " << aSlicer.NbIntersectedPairs()
+     << (aSlicer.IsMeshUsed() ? ", mesh is used" : "") << "\n";
+  DBRep::Set(a[1], aR);
+  return 0;
+}
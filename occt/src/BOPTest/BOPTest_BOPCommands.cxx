@@ -159,6 +159,7 @@ Standard_Integer bop(Draw_Interpretor& di,
   pPF->SetNonDestructive(bNonDestructive);
   pPF->SetGlue(aGlue);
   pPF->SetUseOBB(BOPTest_Objects::UseOBB());
+  pPF->SetUseArena(BOPTest_Objects::UseArena());
   //
   pPF->Perform(aProgress->Start());
   BOPTest::ReportAlerts(pPF->GetReport());
@@ -444,6 +445,7 @@ Standard_Integer  bsection(Draw_Interpretor& di,
   aSec.SetNonDestructive(bNonDestructive);
   aSec.SetGlue(aGlue);
   aSec.SetUseOBB(BOPTest_Objects::UseOBB());
+  aSec.SetUseArena(BOPTest_Objects::UseArena());
   //
   aSec.Build(aProgress->Start());  
   // Store the history of Section operation into the session
@@ -512,6 +514,7 @@ Standard_Integer bsmt (Draw_Interpretor& di,
   aBOP.SetNonDestructive(BOPTest_Objects::NonDestructive());
   aBOP.SetRunParallel(BOPTest_Objects::RunParallel());
   aBOP.SetUseOBB(BOPTest_Objects::UseOBB());
+  aBOP.SetUseArena(BOPTest_Objects::UseArena());
   aBOP.SetCheckInverted(BOPTest_Objects::CheckInverted());
   aBOP.SetToFillHistory(BRepTest_Objects::IsHistoryNeeded());
   //
@@ -829,6 +832,7 @@ Standard_Integer mkvolume(Draw_Interpretor& di, Standard_Integer n, const char**
   aMV.SetAvoidInternalShapes(bAvoidInternal);
   aMV.SetGlue(aGlue);
   aMV.SetUseOBB(BOPTest_Objects::UseOBB());
+  aMV.SetUseArena(BOPTest_Objects::UseArena());
   aMV.SetToFillHistory(BRepTest_Objects::IsHistoryNeeded());
   //
   Handle(Draw_ProgressIndicator) aProgress = new Draw_ProgressIndicator(di, 1);
@@ -116,6 +116,7 @@ Standard_Integer bcbuild(Draw_Interpretor& di,
   aCBuilder.SetGlue(aGlue);
   aCBuilder.SetCheckInverted(BOPTest_Objects::CheckInverted());
   aCBuilder.SetUseOBB(BOPTest_Objects::UseOBB());
+  aCBuilder.SetUseArena(BOPTest_Objects::UseArena());
   aCBuilder.SetToFillHistory(BRepTest_Objects::IsHistoryNeeded());
   //
   Handle(Draw_ProgressIndicator) aProgress = new Draw_ProgressIndicator(di, 1);
@@ -24,14 +24,20 @@
 #include <BRep_Builder.hxx>
 #include <BRepAlgoAPI_Check.hxx>
 #include <BRepBuilderAPI_Copy.hxx>
+#include <BRepCheck.hxx>
+#include <BRepCheck_IncrementalAnalyzer.hxx>
 #include <DBRep.hxx>
 #include <Draw.hxx>
 #include <Draw_ProgressIndicator.hxx>
+#include <NCollection_Array1.hxx>
 #include <OSD_Timer.hxx>
 #include <TCollection_AsciiString.hxx>
+#include <TopAbs.hxx>
+#include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
 #include <TopoDS_Compound.hxx>
 #include <TopoDS_Shape.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
 #include <TopTools_ListOfShape.hxx>
 #include <TopTools_MapOfShape.hxx>
 #include <TopTools_ShapeMapHasher.hxx>
@@ -55,6 +61,7 @@ static Standard_Integer bopargcheck(Draw_Interpretor&, Standard_Integer, const c
 static Standard_Integer bopapicheck(Draw_Interpretor&, Standard_Integer, const char** );
 static Standard_Integer xdistef(Draw_Interpretor&, Standard_Integer, const char** );
 static Standard_Integer checkcurveonsurf (Draw_Interpretor&, Standard_Integer, const char**);
+static Standard_Integer bopinccheck(Draw_Interpretor&, Standard_Integer, const char** );
 
 //=======================================================================
 //function : CheckCommands
@@ -92,6 +99,16 @@ void  BOPTest::CheckCommands(Draw_Interpretor& theCommands)
                   "\t\t-se - disables the check of the shapes on small edges;\n"
                   "\t\t-si - disables the check of the shapes on self-interference.\n",
                   __FILE__, bopapicheck, g);
+  theCommands.Add("bopinccheck",
+                  "Checks the validity of the shape reusing the results of the previous checks of its sub-shapes.\n"
+                  "\t\tUsage: bopinccheck s [-si] [-clear]\n"
+                  "\t\tOptions:\n"
+                  "\t\t-si - disables the check of the shape on self-interference;\n"
+                  "\t\t-clear - clears the results of the previous checks.\n"
+                  "\t\tThe result is the list: valid <0|1> analyzed <n> reused <n> faults {{status type index [type index]} ...},\n"
+                  "\t\twhere the sub-shapes are numbered by their type in the checked shape.\n"
+                  "\t\tThe parallel mode is defined by brunparallel command.\n",
+                  __FILE__, bopinccheck, g);
 }
 //=======================================================================
 //class    : BOPTest_Interf
@@ -1239,3 +1256,145 @@ void MakeShapeForFullOutput (const TCollection_AsciiString & aBaseName,
   //
   DBRep::Set(name, cmp);
 }
+
+//=======================================================================
+//function : AppendSubShape
+//purpose  : Appends the type and index of the sub-shape to the string
+//=======================================================================
+static void AppendSubShape(const TopoDS_Shape& theSubShape,
+                           NCollection_Array1<TopTools_IndexedMapOfShape>& theMaps,
+                           const TopoDS_Shape& theShape,
+                           TCollection_AsciiString& theString)
+{
+  const TopAbs_ShapeEnum aType = theSubShape.ShapeType();
+  TopTools_IndexedMapOfShape& aMap = theMaps(aType);
+  if (aMap.IsEmpty())
+  {
+    TopExp::MapShapes(theShape, aType, aMap);
+  }
+  theString += " ";
+  theString += TopAbs::ShapeTypeToString(aType);
+  theString += " ";
+  theString += aMap.FindIndex(theSubShape);
+}
+
+//=======================================================================
+//function : CheckStatusName
+//purpose  : Returns the name of the status of the check of arguments
+//=======================================================================
+static Standard_CString CheckStatusName(const BOPAlgo_CheckStatus theStatus)
+{
+  switch (theStatus)
+  {
+    case BOPAlgo_BadType:                 return "BOPAlgo_BadType";
+    case BOPAlgo_SelfIntersect:           return "BOPAlgo_SelfIntersect";
+    case BOPAlgo_TooSmallEdge:            return "BOPAlgo_TooSmallEdge";
+    case BOPAlgo_NonRecoverableFace:      return "BOPAlgo_NonRecoverableFace";
+    case BOPAlgo_IncompatibilityOfVertex: return "BOPAlgo_IncompatibilityOfVertex";
+    case BOPAlgo_IncompatibilityOfEdge:   return "BOPAlgo_IncompatibilityOfEdge";
+    case BOPAlgo_IncompatibilityOfFace:   return "BOPAlgo_IncompatibilityOfFace";
+    case BOPAlgo_OperationAborted:        return "BOPAlgo_OperationAborted";
+    case BOPAlgo_GeomAbs_C0:              return "BOPAlgo_GeomAbs_C0";
+    case BOPAlgo_InvalidCurveOnSurface:   return "BOPAlgo_InvalidCurveOnSurface";
+    case BOPAlgo_NotValid:                return "BOPAlgo_NotValid";
+    default:                              break;
+  }
+  return "BOPAlgo_CheckUnknown";
+}
+
+//=======================================================================
+//function : bopinccheck
+//purpose  : 
+//=======================================================================
+Standard_Integer bopinccheck(Draw_Interpretor& di,
+                             Standard_Integer n,
+                             const char** a)
+{
+  if (n < 2)
+  {
+    di.PrintHelp(a[0]);
+    return 1;
+  }
+
+  TopoDS_Shape aS = DBRep::Get(a[1]);
+  if (aS.IsNull())
+  {
+    di << "Error: " << a[1] << " is a null shape\n";
+    return 1;
+  }
+
+  // The analyzer keeps the results between the calls of the command
+  static Handle(BRepCheck_IncrementalAnalyzer) anAnalyzer = new BRepCheck_IncrementalAnalyzer();
+
+  Standard_Boolean bTestSI = Standard_True;
+  for (Standard_Integer i = 2; i < n; ++i)
+  {
+    if (!strcmp(a[i], "-si"))
+    {
+      bTestSI = Standard_False;
+    }
+    else if (!strcmp(a[i], "-clear"))
+    {
+      anAnalyzer->Clear();
+    }
+    else
+    {
+      di << "Invalid key: " << a[i] << ". Skipped.\n";
+    }
+  }
+
+  BRepAlgoAPI_Check aChecker;
+  aChecker.SetData(aS, Standard_False, bTestSI);
+  aChecker.SetRunParallel(BOPTest_Objects::RunParallel());
+  aChecker.SetIncrementalAnalyzer(anAnalyzer);
+  aChecker.Perform();
+
+  NCollection_Array1<TopTools_IndexedMapOfShape> aMaps(TopAbs_COMPOUND, TopAbs_SHAPE);
+  TCollection_AsciiString aFaults;
+
+  // Topological faults
+  BRepCheck_IncrementalAnalyzer::ListOfFault::Iterator itT(anAnalyzer->Faults());
+  for (; itT.More(); itT.Next())
+  {
+    const BRepCheck_IncrementalAnalyzer::Fault& aFault = itT.Value();
+    Standard_SStream aSStream;
+    BRepCheck::Print(aFault.Status, aSStream);
+    TCollection_AsciiString aStatus(aSStream.str().c_str());
+    aStatus.RightAdjust();
+
+    aFaults += aFaults.IsEmpty() ? "{" : " {";
+    aFaults += aStatus;
+    AppendSubShape(aFault.Shape, aMaps, aS, aFaults);
+    if (!aFault.Context.IsNull())
+    {
+      AppendSubShape(aFault.Context, aMaps, aS, aFaults);
+    }
+    aFaults += "}";
+  }
+
+  // Faults of the other checks, the topological ones are reported above
+  BOPAlgo_ListIteratorOfListOfCheckResult itF(aChecker.Result());
+  for (; itF.More(); itF.Next())
+  {
+    const BOPAlgo_CheckResult& aResult = itF.Value();
+    if (aResult.GetCheckStatus() == BOPAlgo_NotValid)
+    {
+      continue;
+    }
+
+    aFaults += aFaults.IsEmpty() ? "{" : " {";
+    aFaults += CheckStatusName(aResult.GetCheckStatus());
+    TopTools_ListIteratorOfListOfShape itS(aResult.GetFaultyShapes1());
+    for (; itS.More(); itS.Next())
+    {
+      AppendSubShape(itS.Value(), aMaps, aS, aFaults);
+    }
+    aFaults += "}";
+  }
+
+  di << "valid " << (aChecker.IsValid() ? 1 : 0)
+     << " analyzed " << anAnalyzer->NbAnalyzed()
+     << " reused " << anAnalyzer->NbReused()
+     << " faults {" << aFaults << "}";
+  return 0;
+}
@@ -108,6 +108,7 @@ class BOPTest_Session {
     myDrawWarnShapes = Standard_False;
     myCheckInverted = Standard_True;
     myUseOBB = Standard_False;
+    myUseArena = Standard_False;
     myUnifyEdges = Standard_False;
     myUnifyFaces = Standard_False;
     myAngTol = Precision::Angular();
@@ -168,6 +169,14 @@ class BOPTest_Session {
   Standard_Boolean UseOBB() const {
     return myUseOBB;
   };
+  //
+  void SetUseArena(const Standard_Boolean bUse) {
+    myUseArena = bUse;
+  };
+  //
+  Standard_Boolean UseArena() const {
+    return myUseArena;
+  };
 
   // Controls the Unification of Edges after BOP
   void SetUnifyEdges(const Standard_Boolean bUE) { myUnifyEdges = bUE; }
@@ -204,6 +213,7 @@ protected:
   Standard_Boolean myDrawWarnShapes;
   Standard_Boolean myCheckInverted;
   Standard_Boolean myUseOBB;
+  Standard_Boolean myUseArena;
   Standard_Boolean myUnifyEdges;
   Standard_Boolean myUnifyFaces;
   Standard_Real myAngTol;
@@ -457,6 +467,22 @@ Standard_Boolean BOPTest_Objects::UseOBB()
   return GetSession().UseOBB();
 }
 //=======================================================================
+//function : SetUseArena
+//purpose  : 
+//=======================================================================
+void BOPTest_Objects::SetUseArena(const Standard_Boolean bUseArena)
+{
+  GetSession().SetUseArena(bUseArena);
+}
+//=======================================================================
+//function : UseArena
+//purpose  : 
+//=======================================================================
+Standard_Boolean BOPTest_Objects::UseArena()
+{
+  return GetSession().UseArena();
+}
+//=======================================================================
 //function : SetUnifyEdges
 //purpose  : 
 //=======================================================================
@@ -94,6 +94,10 @@ public:
 
   Standard_EXPORT static Standard_Boolean UseOBB();
 
+  Standard_EXPORT static void SetUseArena(const Standard_Boolean bUseArena);
+
+  Standard_EXPORT static Standard_Boolean UseArena();
+
   Standard_EXPORT static void SetUnifyEdges(const Standard_Boolean bUE);
   Standard_EXPORT static Standard_Boolean UnifyEdges();
 
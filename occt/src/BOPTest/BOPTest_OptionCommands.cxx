@@ -18,6 +18,7 @@
 #include <DBRep.hxx>
 #include <Draw.hxx>
 #include <BOPAlgo_GlueEnum.hxx>
+#include <Standard_ArenaScope.hxx>
 
 #include <string.h>
 static Standard_Integer boptions (Draw_Interpretor&, Standard_Integer, const char**); 
@@ -28,6 +29,7 @@ static Standard_Integer bGlue(Draw_Interpretor&, Standard_Integer, const char**)
 static Standard_Integer bdrawwarnshapes(Draw_Interpretor&, Standard_Integer, const char**);
 static Standard_Integer bcheckinverted(Draw_Interpretor&, Standard_Integer, const char**);
 static Standard_Integer buseobb(Draw_Interpretor&, Standard_Integer, const char**);
+static Standard_Integer busearena(Draw_Interpretor&, Standard_Integer, const char**);
 static Standard_Integer bsimplify(Draw_Interpretor&, Standard_Integer, const char**);
 
 //=======================================================================
@@ -75,6 +77,11 @@ void BOPTest::OptionCommands(Draw_Interpretor& theCommands)
                              "\t\tUsage: buseobb 0 (off) / 1 (on)",
                   __FILE__, buseobb, g);
 
+  theCommands.Add("busearena", "Enables/disables the arena allocation of temporary data in BOP algorithms\n"
+                               "\t\tUsage: busearena 0 (off) / 1 (on)\n"
+                               "\t\t       busearena -retained - prints the size (in KB) of the arena memory still retained",
+                  __FILE__, busearena, g);
+
   theCommands.Add("bsimplify", "Enables/Disables the result simplification after BOP\n"
                                "\t\tUsage: bsimplify [-e 0/1] [-f 0/1] [-a tol]\n"
                                "\t\t-e 0/1 - enables/disables edges unification\n"
@@ -134,6 +141,9 @@ Standard_Integer boptions(Draw_Interpretor& di,
   Sprintf(buf, " Use OBB: %s \t\t\t(%s)\n", BOPTest_Objects::UseOBB() ? "Yes" : "No",
                "use \"buseobb\" command to change");
   di << buf;
+  Sprintf(buf, " Use Arena: %s \t\t(%s)\n", BOPTest_Objects::UseArena() ? "Yes" : "No",
+               "use \"busearena\" command to change");
+  di << buf;
   Sprintf(buf, " Unify Edges: %s \t\t(%s)\n", BOPTest_Objects::UnifyEdges() ? "Yes" : "No",
                "use \"bsimplify -e\" command to change");
   di << buf;
@@ -285,6 +295,31 @@ Standard_Integer buseobb(Draw_Interpretor& di,
   return 0;
 }
 
+//=======================================================================
+//function : busearena
+//purpose  : 
+//=======================================================================
+Standard_Integer busearena(Draw_Interpretor& di,
+                           Standard_Integer n,
+                           const char** a)
+{
+  if (n != 2)
+  {
+    di.PrintHelp(a[0]);
+    return 1;
+  }
+
+  if (!strcmp(a[1], "-retained"))
+  {
+    di << (Standard_Integer)(Standard_ArenaScope::RetainedSize() / 1024);
+    return 0;
+  }
+
+  Standard_Integer iUse = Draw::Atoi(a[1]);
+  BOPTest_Objects::SetUseArena(iUse != 0);
+  return 0;
+}
+
 //=======================================================================
 //function : bsimplify
 //purpose  : 
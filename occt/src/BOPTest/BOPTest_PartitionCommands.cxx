@@ -166,6 +166,7 @@ Standard_Integer bfillds(Draw_Interpretor& di,
   aPF.SetFuzzyValue(aTol);
   aPF.SetGlue(aGlue);
   aPF.SetUseOBB(BOPTest_Objects::UseOBB());
+  aPF.SetUseArena(BOPTest_Objects::UseArena());
   //
   OSD_Timer aTimer;
   aTimer.Start();
@@ -52,6 +52,8 @@ public:
   using BOPAlgo_Options::ClearWarnings;
   using BOPAlgo_Options::GetReport;
   using BOPAlgo_Options::SetUseOBB;
+  using BOPAlgo_Options::SetUseArena;
+  using BOPAlgo_Options::UseArena;
 
 protected:
 
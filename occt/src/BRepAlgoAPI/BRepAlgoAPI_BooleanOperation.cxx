@@ -26,6 +26,7 @@
 
 #include <OSD_Environment.hxx>
 #include <OSD_File.hxx>
+#include <Standard_ArenaScope.hxx>
 #include <TCollection_AsciiString.hxx>
 
 #include <stdio.h>
@@ -140,6 +141,7 @@ BRepAlgoAPI_BooleanOperation::BRepAlgoAPI_BooleanOperation
 //=======================================================================
 void BRepAlgoAPI_BooleanOperation::Build(const Message_ProgressRange& theRange)
 {
+  Standard_ArenaScope anArenaScope (myUseArena);
   // Set Not Done status by default
   NotDone();
   // Clear from previous runs
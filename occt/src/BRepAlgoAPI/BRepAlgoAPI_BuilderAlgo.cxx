@@ -19,6 +19,7 @@
 #include <BOPAlgo_PaveFiller.hxx>
 #include <BOPDS_DS.hxx>
 #include <ShapeUpgrade_UnifySameDomain.hxx>
+#include <Standard_ArenaScope.hxx>
 #include <TopoDS_Shape.hxx>
 
 //=======================================================================
@@ -89,6 +90,7 @@ void BRepAlgoAPI_BuilderAlgo::Clear()
 //=======================================================================
 void BRepAlgoAPI_BuilderAlgo::Build(const Message_ProgressRange& theRange)
 {
+  Standard_ArenaScope anArenaScope (myUseArena);
   // Setting not done status
   NotDone();
   // Destroy the tools if necessary
@@ -130,6 +132,7 @@ void BRepAlgoAPI_BuilderAlgo::IntersectShapes(const TopTools_ListOfShape& theArg
   myDSFiller->SetNonDestructive(myNonDestructive);
   myDSFiller->SetGlue(myGlue);
   myDSFiller->SetUseOBB(myUseOBB);
+  myDSFiller->SetUseArena(myUseArena);
   // Set Face/Face intersection options to the intersection algorithm
   SetAttributes();
   // Perform intersection
@@ -19,6 +19,26 @@
 #include <BOPAlgo_ArgumentAnalyzer.hxx>
 #include <BRepCheck_Analyzer.hxx>
 
+//=======================================================================
+//function : IsValidShape
+//purpose  : Checks the topological validity of the shape; the faults found
+//           by the incremental analyzer are added to the ones of the previous shapes
+//=======================================================================
+static Standard_Boolean IsValidShape(const TopoDS_Shape& theS,
+                                     const Handle(BRepCheck_IncrementalAnalyzer)& theAnalyzer,
+                                     const Standard_Boolean theToAppend,
+                                     const Standard_Boolean theRunParallel)
+{
+  if (theAnalyzer.IsNull())
+  {
+    return theS.IsNull() || BRepCheck_Analyzer(theS, Standard_True, theRunParallel).IsValid();
+  }
+  const Standard_Integer aNbFaults = theToAppend ? theAnalyzer->Faults().Extent() : 0;
+  theAnalyzer->SetParallel(theRunParallel);
+  theAnalyzer->Perform(theS, theToAppend);
+  return theAnalyzer->Faults().Extent() == aNbFaults;
+}
+
 //=======================================================================
 //function : BRepAlgoAPI_Check
 //purpose  : 
@@ -108,11 +128,8 @@ void BRepAlgoAPI_Check::Perform(const Message_ProgressRange& theRange)
   myFaultyShapes = anAnalyzer.GetCheckResult();
 
   // Check the topological validity of the shapes
-  Standard_Boolean isValidS1 = !myS1.IsNull() ?
-    BRepCheck_Analyzer(myS1).IsValid() : Standard_True;
-
-  Standard_Boolean isValidS2 = !myS2.IsNull() ?
-    BRepCheck_Analyzer(myS2).IsValid() : Standard_True;
+  Standard_Boolean isValidS1 = IsValidShape(myS1, myIncAnalyzer, Standard_False, myRunParallel);
+  Standard_Boolean isValidS2 = IsValidShape(myS2, myIncAnalyzer, Standard_True,  myRunParallel);
 
   if (!isValidS1 || !isValidS2) {
     BOPAlgo_CheckResult aRes;
@@ -23,6 +23,7 @@
 #include <BOPAlgo_ListOfCheckResult.hxx>
 #include <BOPAlgo_Operation.hxx>
 #include <BOPAlgo_Options.hxx>
+#include <BRepCheck_IncrementalAnalyzer.hxx>
 #include <TopoDS_Shape.hxx>
 #include <Message_ProgressRange.hxx>
 
@@ -45,6 +46,12 @@
 //! aCh.Perform();
 //! Standard_Boolean isValid = aCh.IsValid();
 //!
+//! The topological validity of the shapes may be checked incrementally
+//! by the analyzer set with SetIncrementalAnalyzer(), which keeps the
+//! results of the checks of the sub-shapes between the calls.
+//! The self-interference check and the incremental topological check
+//! are performed in parallel threads if the parallel mode is on.
+//!
 class BRepAlgoAPI_Check : public BOPAlgo_Options
 {
 public:
@@ -141,6 +148,25 @@ public: //! @name Initializing the algorithm
   }
 
 
+public: //! @name Incremental check
+
+  //! Sets the analyzer used for the check of the topological validity of the shapes.
+  //! The same analyzer may be shared by several checks to reuse
+  //! the results for the sub-shapes which have been checked already.
+  //! If the analyzer is null, the shapes are checked by BRepCheck_Analyzer.
+  //! After the check, the analyzer keeps the faults found in both shapes.
+  void SetIncrementalAnalyzer(const Handle(BRepCheck_IncrementalAnalyzer)& theAnalyzer)
+  {
+    myIncAnalyzer = theAnalyzer;
+  }
+
+  //! Returns the analyzer used for the check of the topological validity of the shapes.
+  const Handle(BRepCheck_IncrementalAnalyzer)& IncrementalAnalyzer() const
+  {
+    return myIncAnalyzer;
+  }
+
+
 public: //! @name Performing the operation
 
   //! Performs the check.
@@ -170,6 +196,7 @@ protected: //! @name Fields
   Standard_Boolean myTestSE;                //!< Flag defining whether to look for small edges in the given shapes or not
   Standard_Boolean myTestSI;                //!< Flag defining whether to check the input edges on self-interference or not
   BOPAlgo_Operation myOperation;            //!< Type of Boolean operation for which the validity of input shapes should be checked
+  Handle(BRepCheck_IncrementalAnalyzer) myIncAnalyzer; //!< Analyzer of the topological validity keeping the results between the checks
 
   // Results
   BOPAlgo_ListOfCheckResult myFaultyShapes; //!< Found faulty shapes
@@ -0,0 +1,621 @@
+// Created on: 2026-10-18
+//
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BRepAlgoAPI_Slicer.hxx>
+
+#include <BOPAlgo_Alerts.hxx>
+#include <BOPAlgo_Tools.hxx>
+#include <Bnd_Box.hxx>
+#include <BRep_Builder.hxx>
+#include <BRep_Tool.hxx>
+#include <BRepAlgoAPI_Section.hxx>
+#include <BRepBndLib.hxx>
+#include <BRepBuilderAPI_CellFilter.hxx>
+#include <BRepBuilderAPI_MakeFace.hxx>
+#include <BRepBuilderAPI_MakePolygon.hxx>
+#include <BRepBuilderAPI_VertexInspector.hxx>
+#include <gp_Ax3.hxx>
+#include <gp_Pln.hxx>
+#include <Message_ProgressScope.hxx>
+#include <NCollection_Vector.hxx>
+#include <OSD_Parallel.hxx>
+#include <Poly_Triangulation.hxx>
+#include <Precision.hxx>
+#include <Standard_ErrorHandler.hxx>
+#include <TColStd_ListOfInteger.hxx>
+#include <TopExp.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Compound.hxx>
+#include <TopoDS_Face.hxx>
+#include <TopoDS_Iterator.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+
+#include <algorithm>
+
+namespace
+{
+  //! Face of the shape prepared for slicing
+  struct SliceFace
+  {
+    TopoDS_Face                       Face;
+    Standard_Real                     DMin;  //!< minimal height of the face along the direction
+    Standard_Real                     DMax;  //!< maximal height of the face along the direction
+    NCollection_Array1<gp_XYZ>        Nodes; //!< nodes of the triangulation in global coordinates
+    NCollection_Array1<Standard_Real> Dist;  //!< heights of the nodes along the direction
+    Handle(Poly_Triangulation)        Triangulation;
+  };
+
+  //! Result of the slicing by one plane
+  struct SliceResult
+  {
+    SliceResult() : IsFailed (Standard_False) {}
+
+    TopoDS_Compound  Wires;
+    TopoDS_Compound  OpenWires;
+    Standard_Boolean IsFailed;
+  };
+
+  //! Comparator of the indices of values
+  class IndexComparator
+  {
+  public:
+    IndexComparator (const NCollection_Array1<Standard_Real>& theValues)
+    : myValues (theValues) {}
+
+    bool operator() (const Standard_Integer theIndex1, const Standard_Integer theIndex2) const
+    {
+      return myValues (theIndex1) < myValues (theIndex2);
+    }
+
+  private:
+    const NCollection_Array1<Standard_Real>& myValues;
+  };
+
+  //=======================================================================
+  //function : AddWire
+  //purpose  : Adds the wire to the slice according to its closure
+  //=======================================================================
+  void AddWire (const TopoDS_Shape& theWire,
+                SliceResult& theResult)
+  {
+    BRep_Builder aBB;
+    aBB.Add (theResult.Wires, theWire);
+    if (!BRep_Tool::IsClosed (theWire))
+    {
+      if (theResult.OpenWires.IsNull())
+      {
+        aBB.MakeCompound (theResult.OpenWires);
+      }
+      aBB.Add (theResult.OpenWires, theWire);
+    }
+  }
+
+  //=======================================================================
+  //function : SliceExact
+  //purpose  : Sections the faces by the plane and connects the section edges into wires
+  //=======================================================================
+  void SliceExact (const NCollection_Array1<SliceFace>& theFaces,
+                   const TColStd_ListOfInteger& theFaceIndices,
+                   const TopoDS_Face& thePlane,
+                   const Standard_Real theFuzzyValue,
+                   SliceResult& theResult)
+  {
+    BRep_Builder aBB;
+    TopoDS_Compound aFaces;
+    aBB.MakeCompound (aFaces);
+    for (TColStd_ListOfInteger::Iterator anIt (theFaceIndices); anIt.More(); anIt.Next())
+    {
+      aBB.Add (aFaces, theFaces (anIt.Value()).Face);
+    }
+
+    // the faces are shared between the slices processed in parallel threads,
+    // thus they should not be modified by the intersection
+    BRepAlgoAPI_Section aSection (aFaces, thePlane, Standard_False);
+    aSection.SetRunParallel (Standard_False);
+    aSection.SetNonDestructive (Standard_True);
+    aSection.SetFuzzyValue (theFuzzyValue);
+    aSection.Build();
+    if (aSection.HasErrors())
+    {
+      theResult.IsFailed = Standard_True;
+      return;
+    }
+
+    TopoDS_Shape aWires;
+    if (BOPAlgo_Tools::EdgesToWires (aSection.Shape(), aWires, Standard_True) != 0)
+    {
+      return;
+    }
+    for (TopoDS_Iterator anIt (aWires); anIt.More(); anIt.Next())
+    {
+      AddWire (anIt.Value(), theResult);
+    }
+  }
+
+  //=======================================================================
+  //function : SliceMesh
+  //purpose  : Intersects the triangulations of the faces with the plane
+  //           and connects the intersection segments into polygons
+  //=======================================================================
+  void SliceMesh (const NCollection_Array1<SliceFace>& theFaces,
+                  const TColStd_ListOfInteger& theFaceIndices,
+                  const Standard_Real theHeight,
+                  const Standard_Real theTol,
+                  SliceResult& theResult)
+  {
+    // Intersection points merged with the tolerance
+    BRepBuilderAPI_CellFilter      aFilter (theTol);
+    BRepBuilderAPI_VertexInspector anInspector (theTol);
+    NCollection_Vector<gp_XYZ>     aPoints;
+    // Intersection segments as pairs of indices of points (starting from 1)
+    NCollection_Vector<Standard_Integer> aSegments;
+
+    Standard_Integer anEdgePoints[2] = {0, 0};
+    for (TColStd_ListOfInteger::Iterator anIt (theFaceIndices); anIt.More(); anIt.Next())
+    {
+      const SliceFace& aFace = theFaces (anIt.Value());
+      const Handle(Poly_Triangulation)& aTriangulation = aFace.Triangulation;
+      for (Standard_Integer aTriIt = 1; aTriIt <= aTriangulation->NbTriangles(); ++aTriIt)
+      {
+        Standard_Integer aNodes[3];
+        aTriangulation->Triangle (aTriIt).Get (aNodes[0], aNodes[1], aNodes[2]);
+
+        // the nodes on the plane are considered as lying above it,
+        // so that each crossed triangle has exactly two crossed links
+        Standard_Integer aNbCrossed = 0;
+        for (Standard_Integer aLinkIt = 0; aLinkIt < 3; ++aLinkIt)
+        {
+          const Standard_Integer aN1 = aNodes[aLinkIt];
+          const Standard_Integer aN2 = aNodes[(aLinkIt + 1) % 3];
+          const Standard_Real aD1 = aFace.Dist (aN1) - theHeight;
+          const Standard_Real aD2 = aFace.Dist (aN2) - theHeight;
+          if ((aD1 >= 0.0) == (aD2 >= 0.0))
+          {
+            continue;
+          }
+
+          const Standard_Real aT = aD1 / (aD1 - aD2);
+          const gp_XYZ aPnt = aFace.Nodes (aN1) + (aFace.Nodes (aN2) - aFace.Nodes (aN1)) * aT;
+
+          anInspector.ClearResList();
+          anInspector.SetCurrent (aPnt);
+          aFilter.Inspect (anInspector.Shift (aPnt, -theTol), anInspector.Shift (aPnt, theTol), anInspector);
+          Standard_Integer aPntIndex = 0;
+          if (anInspector.ResInd().IsEmpty())
+          {
+            aPoints.Append (aPnt);
+            aPntIndex = aPoints.Length();
+            anInspector.Add (aPnt);
+            aFilter.Add (aPntIndex, aPnt);
+          }
+          else
+          {
+            aPntIndex = anInspector.ResInd().First();
+          }
+          anEdgePoints[aNbCrossed++] = aPntIndex;
+        }
+
+        if (aNbCrossed == 2 && anEdgePoints[0] != anEdgePoints[1])
+        {
+          aSegments.Append (anEdgePoints[0]);
+          aSegments.Append (anEdgePoints[1]);
+        }
+      }
+    }
+
+    const Standard_Integer aNbPoints   = aPoints.Length();
+    const Standard_Integer aNbSegments = aSegments.Length() / 2;
+    if (aNbSegments == 0)
+    {
+      return;
+    }
+
+    // Connectivity of the points
+    NCollection_Array1<TColStd_ListOfInteger> aPointSegments (1, aNbPoints);
+    for (Standard_Integer aSegIt = 0; aSegIt < aNbSegments; ++aSegIt)
+    {
+      aPointSegments (aSegments (2 * aSegIt)).Append (aSegIt);
+      aPointSegments (aSegments (2 * aSegIt + 1)).Append (aSegIt);
+    }
+
+    NCollection_Array1<Standard_Boolean> isUsed (0, aNbSegments - 1);
+    isUsed.Init (Standard_False);
+
+    // The chains are started from the points of non-manifold connection first
+    // and then from any point of the remaining loops
+    for (Standard_Integer aPass = 0; aPass < 2; ++aPass)
+    {
+      for (Standard_Integer aPntIt = 1; aPntIt <= aNbPoints; ++aPntIt)
+      {
+        if (aPass == 0 && aPointSegments (aPntIt).Extent() == 2)
+        {
+          continue;
+        }
+
+        for (TColStd_ListOfInteger::Iterator aStartIt (aPointSegments (aPntIt)); aStartIt.More(); aStartIt.Next())
+        {
+          if (isUsed (aStartIt.Value()))
+          {
+            continue;
+          }
+
+          BRepBuilderAPI_MakePolygon aPolygon;
+          aPolygon.Add (gp_Pnt (aPoints (aPntIt - 1)));
+
+          Standard_Integer aCurPnt = aPntIt;
+          Standard_Integer aCurSeg = aStartIt.Value();
+          Standard_Boolean isClosed = Standard_False;
+          Standard_Integer aNbPolygonPoints = 1;
+          while (aCurSeg >= 0)
+          {
+            isUsed (aCurSeg) = Standard_True;
+            const Standard_Integer aNextPnt = aSegments (2 * aCurSeg) == aCurPnt
+                                            ? aSegments (2 * aCurSeg + 1)
+                                            : aSegments (2 * aCurSeg);
+            if (aNextPnt == aPntIt)
+            {
+              isClosed = Standard_True;
+              break;
+            }
+
+            aPolygon.Add (gp_Pnt (aPoints (aNextPnt - 1)));
+            ++aNbPolygonPoints;
+            aCurPnt = aNextPnt;
+            aCurSeg = -1;
+            if (aPointSegments (aCurPnt).Extent() == 2)
+            {
+              for (TColStd_ListOfInteger::Iterator aSegIt (aPointSegments (aCurPnt)); aSegIt.More(); aSegIt.Next())
+              {
+                if (!isUsed (aSegIt.Value()))
+                {
+                  aCurSeg = aSegIt.Value();
+                }
+              }
+            }
+          }
+
+          if (isClosed)
+          {
+            if (aNbPolygonPoints < 3)
+            {
+              // degenerated loop of the plane touching the mesh
+              continue;
+            }
+            aPolygon.Close();
+          }
+          if (aPolygon.IsDone())
+          {
+            AddWire (aPolygon.Wire(), theResult);
+          }
+        }
+      }
+    }
+  }
+
+  //=======================================================================
+  //class    : SliceFunctor
+  //purpose  : Computes the slices by the planes
+  //=======================================================================
+  class SliceFunctor
+  {
+  public:
+
+    SliceFunctor (const NCollection_Array1<SliceFace>& theFaces,
+                  const NCollection_Array1<TColStd_ListOfInteger>& thePlaneFaces,
+                  const NCollection_Array1<Standard_Real>& theHeights,
+                  const gp_Ax3& thePosition,
+                  const Standard_Real theUMin, const Standard_Real theUMax,
+                  const Standard_Real theVMin, const Standard_Real theVMax,
+                  const Standard_Boolean theUseMesh,
+                  const Standard_Real theFuzzyValue,
+                  NCollection_Array1<SliceResult>& theResults)
+    : myFaces (theFaces),
+      myPlaneFaces (thePlaneFaces),
+      myHeights (theHeights),
+      myPosition (thePosition),
+      myUMin (theUMin), myUMax (theUMax),
+      myVMin (theVMin), myVMax (theVMax),
+      myUseMesh (theUseMesh),
+      myFuzzyValue (theFuzzyValue),
+      myResults (theResults)
+    {}
+
+    void operator() (const Standard_Integer theIndex) const
+    {
+      SliceResult& aResult = myResults (theIndex);
+      BRep_Builder().MakeCompound (aResult.Wires);
+
+      const TColStd_ListOfInteger& aFaceIndices = myPlaneFaces (theIndex);
+      if (aFaceIndices.IsEmpty())
+      {
+        return;
+      }
+
+      const Standard_Real aHeight = myHeights (theIndex);
+      try
+      {
+        OCC_CATCH_SIGNALS
+        if (myUseMesh)
+        {
+          SliceMesh (myFaces, aFaceIndices, aHeight,
+                     Max (myFuzzyValue, Precision::Confusion()), aResult);
+        }
+        else
+        {
+          gp_Ax3 aPosition = myPosition;
+          aPosition.SetLocation (gp_Pnt (myPosition.Direction().XYZ() * aHeight));
+          const TopoDS_Face aPlane = BRepBuilderAPI_MakeFace (gp_Pln (aPosition),
+                                                              myUMin, myUMax, myVMin, myVMax);
+          SliceExact (myFaces, aFaceIndices, aPlane, myFuzzyValue, aResult);
+        }
+      }
+      catch (Standard_Failure const&)
+      {
+        BRep_Builder().MakeCompound (aResult.Wires);
+        aResult.OpenWires.Nullify();
+        aResult.IsFailed = Standard_True;
+      }
+    }
+
+  private:
+
+    SliceFunctor& operator= (const SliceFunctor&);
+
+  private:
+
+    const NCollection_Array1<SliceFace>&             myFaces;
+    const NCollection_Array1<TColStd_ListOfInteger>& myPlaneFaces;
+    const NCollection_Array1<Standard_Real>&         myHeights;
+    gp_Ax3                                           myPosition;
+    Standard_Real                                    myUMin;
+    Standard_Real                                    myUMax;
+    Standard_Real                                    myVMin;
+    Standard_Real                                    myVMax;
+    Standard_Boolean                                 myUseMesh;
+    Standard_Real                                    myFuzzyValue;
+    NCollection_Array1<SliceResult>&                 myResults;
+  };
+}
+
+//=======================================================================
+//function : BRepAlgoAPI_Slicer
+//purpose  :
+//=======================================================================
+BRepAlgoAPI_Slicer::BRepAlgoAPI_Slicer()
+:
+  BOPAlgo_Options(),
+  myDir(gp::DZ()),
+  myUseTriangulation(Standard_False),
+  myIsMeshUsed(Standard_False),
+  myNbPairs(0)
+{
+}
+
+//=======================================================================
+//function : SetHeights
+//purpose  :
+//=======================================================================
+void BRepAlgoAPI_Slicer::SetHeights(const TColStd_Array1OfReal& theHeights)
+{
+  myHeights.Resize(theHeights.Lower(), theHeights.Upper(), Standard_False);
+  for (Standard_Integer i = theHeights.Lower(); i <= theHeights.Upper(); ++i)
+  {
+    myHeights(i) = theHeights(i);
+  }
+}
+
+//=======================================================================
+//function : Perform
+//purpose  :
+//=======================================================================
+void BRepAlgoAPI_Slicer::Perform(const Message_ProgressRange& theRange)
+{
+  GetReport()->Clear();
+  NCollection_Array1<TopoDS_Shape> anEmptySlices;
+  mySlices.Move(anEmptySlices);
+  myIsMeshUsed = Standard_False;
+  myNbPairs = 0;
+
+  if (myShape.IsNull())
+  {
+    AddError(new BOPAlgo_AlertNullInputShapes);
+    return;
+  }
+  if (myHeights.IsEmpty())
+  {
+    AddError(new BOPAlgo_AlertTooFewArguments);
+    return;
+  }
+  mySlices.Resize(myHeights.Lower(), myHeights.Upper(), Standard_False);
+
+  Message_ProgressScope aPS(theRange, "Slicing the shape", 10);
+
+  // Prepare the faces
+  TopTools_IndexedMapOfShape aFaceMap;
+  TopExp::MapShapes(myShape, TopAbs_FACE, aFaceMap);
+  const Standard_Integer aNbFaces = aFaceMap.Extent();
+
+  myIsMeshUsed = myUseTriangulation && aNbFaces > 0;
+  for (Standard_Integer i = 1; myIsMeshUsed && i <= aNbFaces; ++i)
+  {
+    TopLoc_Location aLoc;
+    myIsMeshUsed = !BRep_Tool::Triangulation(TopoDS::Face(aFaceMap(i)), aLoc).IsNull();
+  }
+
+  const gp_XYZ& aDir = myDir.XYZ();
+  const gp_Ax3 aPosition(gp::Origin(), myDir);
+  Bnd_Box aShapeBox;
+
+  NCollection_Array1<SliceFace> aFaces;
+  NCollection_Array1<Standard_Real> aFaceDMin;
+  if (aNbFaces > 0)
+  {
+    aFaces.Resize(1, aNbFaces, Standard_False);
+    aFaceDMin.Resize(1, aNbFaces, Standard_False);
+  }
+  for (Standard_Integer i = 1; i <= aNbFaces; ++i)
+  {
+    SliceFace& aFace = aFaces(i);
+    aFace.Face = TopoDS::Face(aFaceMap(i));
+    aFace.DMin = Precision::Infinite();
+    aFace.DMax = -Precision::Infinite();
+
+    if (myIsMeshUsed)
+    {
+      TopLoc_Location aLoc;
+      aFace.Triangulation = BRep_Tool::Triangulation(aFace.Face, aLoc);
+      const Standard_Integer aNbNodes = aFace.Triangulation->NbNodes();
+      aFace.Nodes.Resize(1, aNbNodes, Standard_False);
+      aFace.Dist.Resize(1, aNbNodes, Standard_False);
+      for (Standard_Integer aNodeIt = 1; aNodeIt <= aNbNodes; ++aNodeIt)
+      {
+        const gp_Pnt aNode = aFace.Triangulation->Node(aNodeIt).Transformed(aLoc.Transformation());
+        aFace.Nodes(aNodeIt) = aNode.XYZ();
+        aFace.Dist(aNodeIt) = aNode.XYZ().Dot(aDir);
+        aFace.DMin = Min(aFace.DMin, aFace.Dist(aNodeIt));
+        aFace.DMax = Max(aFace.DMax, aFace.Dist(aNodeIt));
+      }
+    }
+    else
+    {
+      Bnd_Box aBox;
+      BRepBndLib::Add(aFace.Face, aBox, Standard_False);
+      if (!aBox.IsVoid())
+      {
+        aBox.Enlarge(myFuzzyValue);
+        Standard_Real aXMin, aYMin, aZMin, aXMax, aYMax, aZMax;
+        aBox.Get(aXMin, aYMin, aZMin, aXMax, aYMax, aZMax);
+        for (Standard_Integer aCorner = 0; aCorner < 8; ++aCorner)
+        {
+          const gp_XYZ aPnt((aCorner & 1) ? aXMax : aXMin,
+                            (aCorner & 2) ? aYMax : aYMin,
+                            (aCorner & 4) ? aZMax : aZMin);
+          aFace.DMin = Min(aFace.DMin, aPnt.Dot(aDir));
+          aFace.DMax = Max(aFace.DMax, aPnt.Dot(aDir));
+        }
+        aShapeBox.Add(aBox);
+      }
+    }
+    aFaceDMin(i) = aFace.DMin;
+  }
+  aPS.Next();
+  if (UserBreak(aPS))
+  {
+    return;
+  }
+
+  // Sort the faces and the planes along the direction and distribute
+  // each face to the planes crossing its extent
+  const Standard_Integer aNbPlanes = myHeights.Length();
+  NCollection_Array1<Standard_Real> aHeights(1, aNbPlanes);
+  NCollection_Array1<Standard_Integer> aPlaneOrder(1, aNbPlanes);
+  for (Standard_Integer i = 1; i <= aNbPlanes; ++i)
+  {
+    aHeights(i) = myHeights(myHeights.Lower() + i - 1);
+    aPlaneOrder(i) = i;
+  }
+  std::sort(&aPlaneOrder.ChangeFirst(), &aPlaneOrder.ChangeFirst() + aNbPlanes, IndexComparator(aHeights));
+
+  NCollection_Array1<Standard_Real> aSortedHeights(1, aNbPlanes);
+  for (Standard_Integer i = 1; i <= aNbPlanes; ++i)
+  {
+    aSortedHeights(i) = aHeights(aPlaneOrder(i));
+  }
+
+  NCollection_Array1<Standard_Integer> aFaceOrder;
+  if (aNbFaces > 0)
+  {
+    aFaceOrder.Resize(1, aNbFaces, Standard_False);
+    for (Standard_Integer i = 1; i <= aNbFaces; ++i)
+    {
+      aFaceOrder(i) = i;
+    }
+    std::sort(&aFaceOrder.ChangeFirst(), &aFaceOrder.ChangeFirst() + aNbFaces, IndexComparator(aFaceDMin));
+  }
+
+  const Standard_Real* aHeightsBegin = &aSortedHeights.First();
+  const Standard_Real* aHeightsEnd   = aHeightsBegin + aNbPlanes;
+  NCollection_Array1<TColStd_ListOfInteger> aPlaneFaces(1, aNbPlanes);
+  for (Standard_Integer i = 1; i <= aNbFaces; ++i)
+  {
+    const SliceFace& aFace = aFaces(aFaceOrder(i));
+    if (aFace.DMin > aFace.DMax)
+    {
+      continue;
+    }
+    const Standard_Real* aFirst = std::lower_bound(aHeightsBegin, aHeightsEnd, aFace.DMin);
+    const Standard_Real* aLast  = std::upper_bound(aHeightsBegin, aHeightsEnd, aFace.DMax);
+    for (const Standard_Real* aHeight = aFirst; aHeight != aLast; ++aHeight)
+    {
+      aPlaneFaces(1 + static_cast<Standard_Integer>(aHeight - aHeightsBegin)).Append(aFaceOrder(i));
+      ++myNbPairs;
+    }
+  }
+
+  // Parametric bounds of the slicing planes covering the shape
+  Standard_Real aUMin = -1., aUMax = 1., aVMin = -1., aVMax = 1.;
+  if (!aShapeBox.IsVoid())
+  {
+    const Standard_Real anOffset = Sqrt(aShapeBox.SquareExtent()) * 0.1 + Precision::Confusion();
+    Standard_Real aXMin, aYMin, aZMin, aXMax, aYMax, aZMax;
+    aShapeBox.Get(aXMin, aYMin, aZMin, aXMax, aYMax, aZMax);
+    aUMin = aVMin = Precision::Infinite();
+    aUMax = aVMax = -Precision::Infinite();
+    for (Standard_Integer aCorner = 0; aCorner < 8; ++aCorner)
+    {
+      const gp_XYZ aPnt((aCorner & 1) ? aXMax : aXMin,
+                        (aCorner & 2) ? aYMax : aYMin,
+                        (aCorner & 4) ? aZMax : aZMin);
+      const Standard_Real aU = aPnt.Dot(aPosition.XDirection().XYZ());
+      const Standard_Real aV = aPnt.Dot(aPosition.YDirection().XYZ());
+      aUMin = Min(aUMin, aU - anOffset);
+      aUMax = Max(aUMax, aU + anOffset);
+      aVMin = Min(aVMin, aV - anOffset);
+      aVMax = Max(aVMax, aV + anOffset);
+    }
+  }
+
+  // Compute the slices
+  NCollection_Array1<SliceResult> aResults(1, aNbPlanes);
+  SliceFunctor aFunctor(aFaces, aPlaneFaces, aSortedHeights, aPosition,
+                        aUMin, aUMax, aVMin, aVMax, myIsMeshUsed, myFuzzyValue, aResults);
+  OSD_Parallel::For(1, aNbPlanes + 1, aFunctor, !myRunParallel);
+  aPS.Next(9);
+  if (UserBreak(aPS))
+  {
+    return;
+  }
+
+  for (Standard_Integer i = 1; i <= aNbPlanes; ++i)
+  {
+    const SliceResult& aResult = aResults(i);
+    mySlices(myHeights.Lower() + aPlaneOrder(i) - 1) = aResult.Wires;
+    if (aResult.IsFailed)
+    {
+      TopoDS_Compound aFailed;
+      BRep_Builder aBB;
+      aBB.MakeCompound(aFailed);
+      for (TColStd_ListOfInteger::Iterator anIt(aPlaneFaces(i)); anIt.More(); anIt.Next())
+      {
+        aBB.Add(aFailed, aFaces(anIt.Value()).Face);
+      }
+      AddWarning(new BOPAlgo_AlertIntersectionOfPairOfShapesFailed(aFailed));
+    }
+    if (!aResult.OpenWires.IsNull())
+    {
+      AddWarning(new BOPAlgo_AlertUnableToMakeClosedSlice(aResult.OpenWires));
+    }
+  }
+}
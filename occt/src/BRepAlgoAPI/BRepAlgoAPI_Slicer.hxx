@@ -0,0 +1,147 @@
+// Created on: 2026-10-18
+//
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BRepAlgoAPI_Slicer_HeaderFile
+#define _BRepAlgoAPI_Slicer_HeaderFile
+
+#include <Standard.hxx>
+#include <Standard_DefineAlloc.hxx>
+#include <Standard_Handle.hxx>
+
+#include <BOPAlgo_Options.hxx>
+#include <gp_Dir.hxx>
+#include <Message_ProgressRange.hxx>
+#include <NCollection_Array1.hxx>
+#include <TColStd_Array1OfReal.hxx>
+#include <TopoDS_Shape.hxx>
+
+//! The class Slicer computes the sections of the shape by the set of
+//! parallel planes. The planes are normal to the given direction and
+//! located at the given heights, measured along the direction from the
+//! origin of the global coordinate system.
+//!
+//! The faces of the shape are sorted by their extent along the direction
+//! and each face is intersected only with the planes crossing its bounding box.
+//! The slices are computed in parallel threads if the parallel mode is on.
+//!
+//! Two methods of computation are available:
+//! - exact (default): the faces crossed by the plane are sectioned by the
+//!   plane with BRepAlgoAPI_Section and the section edges are connected into wires;
+//! - mesh: the triangulations of the faces are intersected with the planes
+//!   and the intersection segments are connected into polygonal wires.
+//!   The method is used only if all faces of the shape have triangulations,
+//!   otherwise the exact method is used.
+//!
+//! Each slice is the compound of wires. The wires which could not be closed
+//! are also put into the slice, the warning BOPAlgo_AlertUnableToMakeClosedSlice
+//! is given in this case.
+//!
+//! Usage:
+//! BRepAlgoAPI_Slicer aSlicer;
+//! aSlicer.SetShape(theSolid);
+//! aSlicer.SetDirection(gp::DZ());
+//! aSlicer.SetHeights(theHeights);
+//! aSlicer.SetRunParallel(Standard_True);
+//! aSlicer.Perform();
+//! for (Standard_Integer i = theHeights.Lower(); i <= theHeights.Upper(); ++i)
+//! {
+//!   const TopoDS_Shape& aWires = aSlicer.Slice(i);
+//! }
+class BRepAlgoAPI_Slicer : public BOPAlgo_Options
+{
+public:
+
+  DEFINE_STANDARD_ALLOC
+
+public: //! @name Constructors
+
+  //! Empty constructor.
+  Standard_EXPORT BRepAlgoAPI_Slicer();
+
+public: //! @name Setting the data
+
+  //! Sets the shape to slice.
+  void SetShape(const TopoDS_Shape& theShape)
+  {
+    myShape = theShape;
+  }
+
+  //! Sets the normal direction of the slicing planes.
+  void SetDirection(const gp_Dir& theDir)
+  {
+    myDir = theDir;
+  }
+
+  //! Sets the heights of the slicing planes.
+  //! The slices are indexed as the given heights.
+  Standard_EXPORT void SetHeights(const TColStd_Array1OfReal& theHeights);
+
+  //! Sets the flag of using the triangulations of the faces for slicing.
+  void SetUseTriangulation(const Standard_Boolean theUseTriangulation)
+  {
+    myUseTriangulation = theUseTriangulation;
+  }
+
+  //! Returns the flag of using the triangulations of the faces for slicing.
+  Standard_Boolean UseTriangulation() const
+  {
+    return myUseTriangulation;
+  }
+
+public: //! @name Performing the operation
+
+  //! Computes the slices.
+  Standard_EXPORT void Perform(const Message_ProgressRange& theRange = Message_ProgressRange());
+
+public: //! @name Getting the results
+
+  //! Returns the number of slices.
+  Standard_Integer NbSlices() const
+  {
+    return mySlices.Length();
+  }
+
+  //! Returns the compound of wires of the slice with the given index
+  //! (in the range of the array of heights).
+  const TopoDS_Shape& Slice(const Standard_Integer theIndex) const
+  {
+    return mySlices(theIndex);
+  }
+
+  //! Returns TRUE if the triangulations of the faces have been used for slicing.
+  Standard_Boolean IsMeshUsed() const
+  {
+    return myIsMeshUsed;
+  }
+
+  //! Returns the number of the pairs of face and plane intersected during the operation.
+  Standard_Integer NbIntersectedPairs() const
+  {
+    return myNbPairs;
+  }
+
+protected: //! @name Fields
+
+  TopoDS_Shape                      myShape;            //!< Shape to slice
+  gp_Dir                            myDir;              //!< Normal direction of the planes
+  NCollection_Array1<Standard_Real> myHeights;          //!< Heights of the planes
+  Standard_Boolean                  myUseTriangulation; //!< Flag of using the triangulations
+  NCollection_Array1<TopoDS_Shape>  mySlices;           //!< Computed slices
+  Standard_Boolean                  myIsMeshUsed;       //!< Flag indicating that the triangulations have been used
+  Standard_Integer                  myNbPairs;          //!< Number of intersected pairs of face and plane
+
+};
+
+#endif // _BRepAlgoAPI_Slicer_HeaderFile
@@ -16,6 +16,7 @@
 
 #include <BOPAlgo_Alerts.hxx>
 #include <BOPAlgo_Splitter.hxx>
+#include <Standard_ArenaScope.hxx>
 
 //=======================================================================
 // function: Empty constructor
@@ -37,6 +38,7 @@ BRepAlgoAPI_Splitter::BRepAlgoAPI_Splitter(const BOPAlgo_PaveFiller& thePF)
 //=======================================================================
 void BRepAlgoAPI_Splitter::Build(const Message_ProgressRange& theRange)
 {
+  Standard_ArenaScope anArenaScope (myUseArena);
   // Set Not Done status by default
   NotDone();
   // Clear the contents
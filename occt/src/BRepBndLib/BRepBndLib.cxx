@@ -44,6 +44,7 @@
 #include <Geom_Plane.hxx>
 #include <Extrema_ExtSS.hxx>
 #include <GeomAdaptor_Surface.hxx>
+#include <gp_XYZBatch.hxx>
 //
 static Standard_Boolean CanUseEdges(const Adaptor3d_Surface& BS);
 //
@@ -66,6 +67,35 @@ static Standard_Boolean IsModifySize(const BRepAdaptor_Surface& theBS,
                                      const BRepTopAdaptor_FClass2d& theFClass,
                                      const Standard_Real theTolU, const Standard_Real theTolV);
 
+//=======================================================================
+//function : AddPoints
+//purpose  : Adds the transformed points to the box processing them in batch
+//=======================================================================
+static void AddPoints (const TColgp_Array1OfPnt& thePoints,
+                       const TopLoc_Location& theLoc,
+                       Bnd_Box& theBox)
+{
+  // the allocation of the batch does not pay off for short polygons
+  const Standard_Integer aMinBatchSize = 32;
+  if (thePoints.Length() < aMinBatchSize)
+  {
+    for (Standard_Integer i = thePoints.Lower(); i <= thePoints.Upper(); i++)
+    {
+      if (theLoc.IsIdentity()) theBox.Add (thePoints (i));
+      else theBox.Add (thePoints (i).Transformed (theLoc));
+    }
+    return;
+  }
+
+  gp_XYZBatch aPoints (thePoints);
+  aPoints.Transform (theLoc.Transformation());
+  gp_XYZ aMin, aMax;
+  if (aPoints.BoundingBox (aMin, aMax))
+  {
+    theBox.Update (aMin.X(), aMin.Y(), aMin.Z(), aMax.X(), aMax.Y(), aMax.Z());
+  }
+}
+
 //
 //=======================================================================
 //function : Add
@@ -130,13 +160,7 @@ void BRepBndLib::Add(const TopoDS_Shape& S, Bnd_Box& B, Standard_Boolean useTria
     Handle(Poly_Polygon3D) P3d = BRep_Tool::Polygon3D(E, l);
     if (!P3d.IsNull() && P3d->NbNodes() > 0)
     {
-      const TColgp_Array1OfPnt& Nodes = P3d->Nodes();
-      nbNodes = P3d->NbNodes();
-      for (i = 1; i <= nbNodes; i++)
-      {
-        if (l.IsIdentity()) B.Add(Nodes[i]);
-        else B.Add(Nodes[i].Transformed(l));
-      }
+      AddPoints (P3d->Nodes(), l, B);
       //       B.Enlarge(P3d->Deflection());
       B.Enlarge(P3d->Deflection() + BRep_Tool::Tolerance(E));
     }
@@ -325,13 +349,7 @@ void BRepBndLib::AddOptimal(const TopoDS_Shape& S, Bnd_Box& B,
     Handle(Poly_Polygon3D) P3d = BRep_Tool::Polygon3D(E, l);
     if (useTriangulation && !P3d.IsNull() && P3d->NbNodes() > 0)
     {
-      const TColgp_Array1OfPnt& Nodes = P3d->Nodes();
-      nbNodes = P3d->NbNodes();
-      for (i = 1; i <= nbNodes; i++)
-      {
-        if (l.IsIdentity()) aLocBox.Add(Nodes[i]);
-        else aLocBox.Add(Nodes[i].Transformed(l));
-      }
+      AddPoints (P3d->Nodes(), l, aLocBox);
       Standard_Real Tol = useShapeTolerance?  BRep_Tool::Tolerance(E) : 0.;
       aLocBox.Enlarge(P3d->Deflection() + Tol);
     }
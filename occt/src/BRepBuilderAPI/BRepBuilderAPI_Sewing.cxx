@@ -43,6 +43,8 @@
 
 
 #include <Bnd_Box2d.hxx>
+#include <BVH_BoxSet.hxx>
+#include <BVH_Traverse.hxx>
 #include <BndLib_Add2dCurve.hxx>
 #include <BndLib_Add3dCurve.hxx>
 #include <BRep_Builder.hxx>
@@ -51,7 +53,6 @@
 #include <BRep_Tool.hxx>
 #include <BRep_TEdge.hxx>
 #include <BRep_TVertex.hxx>
-#include <BRepBuilderAPI_BndBoxTreeSelector.hxx>
 #include <BRepBuilderAPI_CellFilter.hxx>
 #include <BRepBuilderAPI_Sewing.hxx>
 #include <BRepBuilderAPI_VertexInspector.hxx>
@@ -75,12 +76,15 @@
 #include <gp_Pnt.hxx>
 #include <gp_Vec.hxx>
 #include <Message_ProgressScope.hxx>
-#include <NCollection_UBTreeFiller.hxx>
+#include <NCollection_Array1.hxx>
+#include <NCollection_Vector.hxx>
+#include <OSD_Parallel.hxx>
 #include <Precision.hxx>
 #include <Standard_Failure.hxx>
 #include <Standard_NoSuchObject.hxx>
 #include <Standard_OutOfRange.hxx>
 #include <Standard_Type.hxx>
+#include <TColgp_Array1OfPnt.hxx>
 #include <TColgp_Array1OfVec.hxx>
 #include <TColgp_SequenceOfPnt.hxx>
 #include <TColStd_Array1OfReal.hxx>
@@ -107,6 +111,8 @@
 #include <TopTools_MapOfShape.hxx>
 #include <TopTools_SequenceOfShape.hxx>
 
+#include <algorithm>
+
 IMPLEMENT_STANDARD_RTTIEXT(BRepBuilderAPI_Sewing,Standard_Transient)
 
 //#include <LocalAnalysis_SurfaceContinuity.hxx>
@@ -1737,6 +1743,7 @@ void BRepBuilderAPI_Sewing::Init(const Standard_Real tolerance,
   //myCuttingFloatingEdgesMode = Standard_False; //gka
   mySameParameterMode  = Standard_True;
   myLocalToleranceMode = Standard_False;
+  myRunParallel        = Standard_False;
   mySewedShape.Nullify();
   // Load empty shape
   Load(TopoDS_Shape());
@@ -3593,6 +3600,154 @@ Standard_Boolean BRepBuilderAPI_Sewing::MergedNearestEdges(const TopoDS_Shape& e
   return success;
 }
 
+//! Set of vertex boxes for the search of cutting candidates.
+typedef BVH_BoxSet<Standard_Real, 3, Standard_Integer> BRepBuilderAPI_VertexBoxSet;
+
+//! Selector of the vertices with boxes overlapping the given box.
+class BRepBuilderAPI_VertexBoxSelector :
+  public BVH_Traverse <Standard_Real, 3, BRepBuilderAPI_VertexBoxSet, Standard_Boolean>
+{
+public:
+
+  //! Sets the box
+  void SetBox (const BVH_Box<Standard_Real, 3>& theBox)
+  {
+    myBox = theBox;
+  }
+
+  //! Returns the indices of accepted vertices
+  std::vector<Standard_Integer>& ChangeIndices()
+  {
+    return myIndices;
+  }
+
+  //! Checks if the node should be rejected
+  virtual Standard_Boolean RejectNode (const BVH_Vec3d& theCMin,
+                                       const BVH_Vec3d& theCMax,
+                                       Standard_Boolean& theIsInside) const Standard_OVERRIDE
+  {
+    Standard_Boolean hasOverlap;
+    theIsInside = myBox.Contains (theCMin, theCMax, hasOverlap);
+    return !hasOverlap;
+  }
+
+  //! Checks if the metric of the node may be accepted
+  virtual Standard_Boolean AcceptMetric (const Standard_Boolean& theIsInside) const Standard_OVERRIDE
+  {
+    return theIsInside;
+  }
+
+  //! Accepts the element with the given index
+  virtual Standard_Boolean Accept (const Standard_Integer theIndex,
+                                   const Standard_Boolean& theIsInside) Standard_OVERRIDE
+  {
+    if (theIsInside || !myBox.IsOut (myBVHSet->Box (theIndex)))
+    {
+      myIndices.push_back (myBVHSet->Element (theIndex));
+      return Standard_True;
+    }
+    return Standard_False;
+  }
+
+private:
+  BVH_Box<Standard_Real, 3>     myBox;
+  std::vector<Standard_Integer> myIndices;
+};
+
+//! Cutting candidates of a boundary with their projections on its curve.
+struct BRepBuilderAPI_BoundCutting
+{
+  TopoDS_Vertex              V1;
+  TopoDS_Vertex              V2;
+  TopTools_IndexedMapOfShape Candidates;
+  TColStd_Array1OfReal       Dist;
+  TColStd_Array1OfReal       Para;
+  TColgp_Array1OfPnt         Proj;
+};
+
+//! Functor searching the cutting candidates of boundaries.
+//! Only reads the sewing data, thus can be executed in parallel.
+class BRepBuilderAPI_SewingCuttingFunctor
+{
+public:
+  BRepBuilderAPI_SewingCuttingFunctor (const BRepBuilderAPI_Sewing& theSewing,
+                                       BRepBuilderAPI_VertexBoxSet& theBoxSet,
+                                       const NCollection_Vector<TopoDS_Edge>& theBounds,
+                                       NCollection_Array1<BRepBuilderAPI_BoundCutting>& theCuttings)
+  : mySewing (theSewing),
+    myBoxSet (theBoxSet),
+    myBounds (theBounds),
+    myCuttings (theCuttings)
+  {
+    //
+  }
+
+  void operator() (const Standard_Integer theIndex) const
+  {
+    const TopoDS_Edge& bound = myBounds (theIndex);
+    BRepBuilderAPI_BoundCutting& aCutting = myCuttings.ChangeValue (theIndex);
+
+    // Obtain bound curve
+    TopLoc_Location loc;
+    Standard_Real first, last;
+    Handle(Geom_Curve) c3d = BRep_Tool::Curve(bound, loc, first, last);
+    if (c3d.IsNull()) return;
+    if (!loc.IsIdentity()) {
+      c3d = Handle(Geom_Curve)::DownCast(c3d->Copy());
+      c3d->Transform(loc.Transformation());
+    }
+
+    // Create bounding box around curve
+    Bnd_Box aGlobalBox;
+    GeomAdaptor_Curve adptC(c3d,first,last);
+    BndLib_Add3dCurve::Add(adptC,mySewing.myTolerance,aGlobalBox);
+    if (aGlobalBox.IsVoid()) return;
+    Standard_Real aXmin, aYmin, aZmin, aXmax, aYmax, aZmax;
+    aGlobalBox.Get (aXmin, aYmin, aZmin, aXmax, aYmax, aZmax);
+
+    // Sort vertices to find candidates
+    BRepBuilderAPI_VertexBoxSelector aSelector;
+    aSelector.SetBVHSet (&myBoxSet);
+    aSelector.SetBox (BVH_Box<Standard_Real, 3> (BVH_Vec3d (aXmin, aYmin, aZmin),
+                                                 BVH_Vec3d (aXmax, aYmax, aZmax)));
+    aSelector.Select();
+    // Skip bound if no node is in the boundind box
+    std::vector<Standard_Integer>& anIndices = aSelector.ChangeIndices();
+    if (anIndices.empty()) return;
+
+    // Keep the order of vertices independent on the tree structure
+    std::sort (anIndices.begin(), anIndices.end());
+
+    // Retrieve bound nodes
+    TopExp::Vertices(bound,aCutting.V1,aCutting.V2);
+    const TopoDS_Shape& Node1 = mySewing.myVertexNode.FindFromKey(aCutting.V1);
+    const TopoDS_Shape& Node2 = mySewing.myVertexNode.FindFromKey(aCutting.V2);
+    // Fill map of candidate vertices
+    for (std::vector<Standard_Integer>::const_iterator anIt = anIndices.begin(); anIt != anIndices.end(); ++anIt) {
+      const TopoDS_Shape& Node = mySewing.myVertexNode.FindFromIndex(*anIt);
+      if (!Node.IsSame(Node1) && !Node.IsSame(Node2))
+        aCutting.Candidates.Add(mySewing.myVertexNode.FindKey(*anIt));
+    }
+    Standard_Integer nbCandidates = aCutting.Candidates.Extent();
+    if (!nbCandidates) return;
+
+    // Project vertices on curve
+    TColgp_Array1OfPnt arrPnt(1,nbCandidates);
+    for (Standard_Integer j = 1; j <= nbCandidates; j++)
+      arrPnt(j) = BRep_Tool::Pnt(TopoDS::Vertex(aCutting.Candidates(j)));
+    aCutting.Dist.Resize (1, nbCandidates, Standard_False);
+    aCutting.Para.Resize (1, nbCandidates, Standard_False);
+    aCutting.Proj.Resize (1, nbCandidates, Standard_False);
+    mySewing.ProjectPointsOnCurve(arrPnt,c3d,first,last,aCutting.Dist,aCutting.Para,aCutting.Proj,Standard_True);
+  }
+
+private:
+  const BRepBuilderAPI_Sewing&                     mySewing;
+  BRepBuilderAPI_VertexBoxSet&                     myBoxSet;
+  const NCollection_Vector<TopoDS_Edge>&           myBounds;
+  NCollection_Array1<BRepBuilderAPI_BoundCutting>& myCuttings;
+};
+
 //=======================================================================
 //function : Cutting
 //purpose  : Modifies :
@@ -3607,81 +3762,47 @@ void BRepBuilderAPI_Sewing::Cutting(const Message_ProgressRange& theProgress)
   if (!nbVertices) return;
   // Create a box tree with vertices
   Standard_Real eps = myTolerance*0.5;
-  BRepBuilderAPI_BndBoxTree aTree;
-  NCollection_UBTreeFiller <Standard_Integer, Bnd_Box> aTreeFiller (aTree);
-  BRepBuilderAPI_BndBoxTreeSelector aSelector;
+  BRepBuilderAPI_VertexBoxSet aBoxSet;
+  aBoxSet.SetSize (nbVertices);
   for (i = 1; i <= nbVertices; i++) {
     gp_Pnt pt = BRep_Tool::Pnt(TopoDS::Vertex(myVertexNode.FindKey(i)));
-    Bnd_Box aBox;
-    aBox.Set(pt);
-    aBox.Enlarge(eps);
-    aTreeFiller.Add (i, aBox);
+    BVH_Vec3d aMin (pt.X() - eps, pt.Y() - eps, pt.Z() - eps);
+    BVH_Vec3d aMax (pt.X() + eps, pt.Y() + eps, pt.Z() + eps);
+    aBoxSet.Add (i, BVH_Box<Standard_Real, 3> (aMin, aMax));
   }
-  aTreeFiller.Fill();
+  aBoxSet.Build();
 
-  Handle(Geom_Curve) c3d;
-  TopLoc_Location loc;
-  Standard_Real first, last;
-  // Iterate on all boundaries
-  Standard_Integer nbBounds = myBoundFaces.Extent();
-  Message_ProgressScope aPS (theProgress, "Cutting bounds", nbBounds);
+  // Collect boundaries to be cut, floating edges are not cut
+  NCollection_Vector<TopoDS_Edge> aBounds;
   TopTools_IndexedDataMapOfShapeListOfShape::Iterator anIterB(myBoundFaces);
-  for (; anIterB.More() && aPS.More(); anIterB.Next(), aPS.Next()) {
-    const TopoDS_Edge& bound = TopoDS::Edge(anIterB.Key());
-    // Do not cut floating edges
-    if (!anIterB.Value().Extent()) continue;
-    // Obtain bound curve
-    c3d = BRep_Tool::Curve(bound, loc, first, last);
-    if (c3d.IsNull()) continue;
-    if (!loc.IsIdentity()) {
-      c3d = Handle(Geom_Curve)::DownCast(c3d->Copy());
-      c3d->Transform(loc.Transformation());
-    }
+  for (; anIterB.More(); anIterB.Next()) {
+    if (anIterB.Value().Extent())
+      aBounds.Append (TopoDS::Edge(anIterB.Key()));
+  }
+
+  Message_ProgressScope aPS (theProgress, "Cutting bounds", 2);
+
+  // Find cutting candidates and project them on boundaries;
+  // boundaries are processed independently so that it can be done in parallel
+  NCollection_Array1<BRepBuilderAPI_BoundCutting> aCuttings (0, Max (aBounds.Length() - 1, 0));
+  BRepBuilderAPI_SewingCuttingFunctor aFunctor (*this, aBoxSet, aBounds, aCuttings);
+  OSD_Parallel::For (0, aBounds.Length(), aFunctor, !myRunParallel);
+  aPS.Next();
+
+  // Create cutting sections in the order of boundaries
+  Message_ProgressScope aPSSections (aPS.Next(), "Creating sections", aBounds.Length());
+  for (i = 0; i < aBounds.Length() && aPSSections.More(); i++, aPSSections.Next()) {
+    const TopoDS_Edge& bound = aBounds (i);
+    const BRepBuilderAPI_BoundCutting& aCutting = aCuttings (i);
+    if (aCutting.Candidates.IsEmpty()) continue;
     // Create cutting sections
     TopTools_ListOfShape listSections;
     { //szv: Use brackets to destroy local variables
-      // Obtain candidate vertices
-      TopoDS_Vertex V1, V2;
-      TopTools_IndexedMapOfShape CandidateVertices;
-      { //szv: Use brackets to destroy local variables
-        // Create bounding box around curve
-        Bnd_Box aGlobalBox;
-        GeomAdaptor_Curve adptC(c3d,first,last);
-        BndLib_Add3dCurve::Add(adptC,myTolerance,aGlobalBox);
-        // Sort vertices to find candidates
-        aSelector.SetCurrent (aGlobalBox);
-        aTree.Select (aSelector); 
-        // Skip bound if no node is in the boundind box
-        if (!aSelector.ResInd().Extent()) continue;
-        // Retrieve bound nodes
-        TopExp::Vertices(bound,V1,V2);
-        const TopoDS_Shape& Node1 = myVertexNode.FindFromKey(V1);
-        const TopoDS_Shape& Node2 = myVertexNode.FindFromKey(V2);
-        // Fill map of candidate vertices
-        TColStd_ListIteratorOfListOfInteger itl(aSelector.ResInd());
-        for (; itl.More(); itl.Next()) {
-          const Standard_Integer index = itl.Value();
-          const TopoDS_Shape& Node = myVertexNode.FindFromIndex(index);
-          if (!Node.IsSame(Node1) && !Node.IsSame(Node2)) {
-            TopoDS_Shape vertex = myVertexNode.FindKey(index);
-            CandidateVertices.Add(vertex);
-          }
-        }
-        aSelector.ClearResList();
-      }
-      Standard_Integer nbCandidates = CandidateVertices.Extent();
-      if (!nbCandidates) continue;
-      // Project vertices on curve
-      TColStd_Array1OfReal arrPara(1,nbCandidates), arrDist(1,nbCandidates);
-      TColgp_Array1OfPnt arrPnt(1,nbCandidates), arrProj(1,nbCandidates);
-      for (Standard_Integer j = 1; j <= nbCandidates; j++)
-        arrPnt(j) = BRep_Tool::Pnt(TopoDS::Vertex(CandidateVertices(j)));
-      ProjectPointsOnCurve(arrPnt,c3d,first,last,arrDist,arrPara,arrProj,Standard_True);
       // Create cutting nodes
       TopTools_SequenceOfShape seqNode;
       TColStd_SequenceOfReal seqPara;
-      CreateCuttingNodes(CandidateVertices,bound,
-        V1,V2,arrDist,arrPara,arrProj,seqNode,seqPara);
+      CreateCuttingNodes(aCutting.Candidates,bound,aCutting.V1,aCutting.V2,
+        aCutting.Dist,aCutting.Para,aCutting.Proj,seqNode,seqPara);
       if (!seqPara.Length()) continue;
       // Create cutting sections
       CreateSections(bound, seqNode, seqPara, listSections);
@@ -3715,7 +3836,7 @@ void BRepBuilderAPI_Sewing::Cutting(const Message_ProgressRange& theProgress)
     }
   }
 #ifdef OCCT_DEBUG
-  std::cout << "From " << nbBounds << " bounds " << myBoundSections.Extent()
+  std::cout << "From " << myBoundFaces.Extent() << " bounds " << myBoundSections.Extent()
     << " were cut into " << mySectionBound.Extent() << " sections" << std::endl;
 #endif
 }
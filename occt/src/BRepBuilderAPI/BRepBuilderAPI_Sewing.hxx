@@ -229,10 +229,20 @@ public:
     void SetNonManifoldMode (const Standard_Boolean theNonManifoldMode);
   
   //! Gets mode for non-manifold sewing.
-  //!
-  //! INTERNAL FUNCTIONS ---
     Standard_Boolean NonManifoldMode() const;
 
+  //! Sets mode for multi-threaded processing, by default - false.
+  //! The search of cutting vertices for free boundaries is performed
+  //! in parallel threads, the result does not depend on this mode.
+  //! The detection of free boundaries, the merging of sections and
+  //! the SameParameter computation remain sequential.
+    void SetRunParallel (const Standard_Boolean theIsParallel);
+
+  //! Returns mode for multi-threaded processing.
+    Standard_Boolean RunParallel() const;
+
+  //! INTERNAL FUNCTIONS ---
+
 
 
 
@@ -362,11 +372,13 @@ protected:
 
 private:
 
+  friend class BRepBuilderAPI_SewingCuttingFunctor;
 
   Standard_Boolean myFaceMode;
   Standard_Boolean myFloatingEdgesMode;
   Standard_Boolean mySameParameterMode;
   Standard_Boolean myLocalToleranceMode;
+  Standard_Boolean myRunParallel;
   Standard_Real myMinTolerance;
   Standard_Real myMaxTolerance;
   TopTools_MapOfShape myMergedEdges;
@@ -0,0 +1,391 @@
+// Created on: 2026-10-18
+//
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BRepCheck_IncrementalAnalyzer.hxx>
+
+#include <BRepCheck_Analyzer.hxx>
+#include <BRepCheck_ListOfStatus.hxx>
+#include <BRepCheck_Result.hxx>
+#include <BRepCheck_Shell.hxx>
+#include <BRepCheck_Solid.hxx>
+#include <NCollection_Array1.hxx>
+#include <OSD_Parallel.hxx>
+#include <Standard_ErrorHandler.hxx>
+#include <Standard_Failure.hxx>
+#include <TopExp.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Iterator.hxx>
+#include <TopoDS_TShape.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+#include <TopTools_MapOfShape.hxx>
+
+IMPLEMENT_STANDARD_RTTIEXT(BRepCheck_IncrementalAnalyzer, Standard_Transient)
+
+namespace
+{
+  //=======================================================================
+  //function : AppendFaults
+  //purpose  : Appends the faults of the list of statuses
+  //=======================================================================
+  void AppendFaults (const TopoDS_Shape& theShape,
+                     const TopoDS_Shape& theContext,
+                     const BRepCheck_ListOfStatus& theStatuses,
+                     BRepCheck_IncrementalAnalyzer::ListOfFault& theFaults)
+  {
+    for (BRepCheck_ListIteratorOfListOfStatus anIt (theStatuses); anIt.More(); anIt.Next())
+    {
+      if (anIt.Value() != BRepCheck_NoError)
+      {
+        BRepCheck_IncrementalAnalyzer::Fault aFault;
+        aFault.Shape   = theShape;
+        aFault.Context = theContext;
+        aFault.Status  = anIt.Value();
+        theFaults.Append (aFault);
+      }
+    }
+  }
+
+  //=======================================================================
+  //function : AppendResultFaults
+  //purpose  : Appends the faults of the result of the check of the shape,
+  //           own ones and the ones in the context of other shapes
+  //=======================================================================
+  void AppendResultFaults (const TopoDS_Shape& theShape,
+                           const Handle(BRepCheck_Result)& theResult,
+                           BRepCheck_IncrementalAnalyzer::ListOfFault& theFaults)
+  {
+    AppendFaults (theShape, TopoDS_Shape(), theResult->Status(), theFaults);
+    for (theResult->InitContextIterator(); theResult->MoreShapeInContext(); theResult->NextShapeInContext())
+    {
+      if (!theResult->ContextualShape().IsSame (theShape))
+      {
+        AppendFaults (theShape, theResult->ContextualShape(), theResult->StatusOnShape(), theFaults);
+      }
+    }
+  }
+
+  //=======================================================================
+  //function : AnalyzeUnit
+  //purpose  : Checks the unit of the shape and collects its faults
+  //=======================================================================
+  void AnalyzeUnit (const TopoDS_Shape& theUnit,
+                    const Standard_Boolean theGeomControls,
+                    const Standard_Boolean theIsExact,
+                    BRepCheck_IncrementalAnalyzer::ListOfFault& theFaults)
+  {
+    try
+    {
+      OCC_CATCH_SIGNALS
+      switch (theUnit.ShapeType())
+      {
+        case TopAbs_SOLID:
+        {
+          // the solid and its shells in the context of the solid,
+          // as done by BRepCheck_Analyzer
+          Handle(BRepCheck_Solid) aSolidRes = new BRepCheck_Solid (TopoDS::Solid (theUnit));
+          AppendFaults (theUnit, TopoDS_Shape(), aSolidRes->Status(), theFaults);
+
+          TopTools_MapOfShape aShells;
+          for (TopExp_Explorer anExp (theUnit, TopAbs_SHELL); anExp.More(); anExp.Next())
+          {
+            const TopoDS_Shape& aShell = anExp.Current();
+            if (!aShells.Add (aShell))
+            {
+              continue;
+            }
+            Handle(BRepCheck_Shell) aShellRes = new BRepCheck_Shell (TopoDS::Shell (aShell));
+            aShellRes->InContext (theUnit);
+            if (aShellRes->IsStatusOnShape (theUnit))
+            {
+              AppendFaults (aShell, theUnit, aShellRes->StatusOnShape (theUnit), theFaults);
+            }
+          }
+          break;
+        }
+        case TopAbs_SHELL:
+        {
+          Handle(BRepCheck_Shell) aShellRes = new BRepCheck_Shell (TopoDS::Shell (theUnit));
+          AppendFaults (theUnit, TopoDS_Shape(), aShellRes->Status(), theFaults);
+          break;
+        }
+        default:
+        {
+          // the face, wire, edge or vertex with all its sub-shapes
+          BRepCheck_Analyzer anAnalyzer (theUnit, theGeomControls, Standard_False, theIsExact);
+          TopTools_IndexedMapOfShape aSubShapes;
+          TopExp::MapShapes (theUnit, aSubShapes);
+          for (TopTools_IndexedMapOfShape::Iterator anIt (aSubShapes); anIt.More(); anIt.Next())
+          {
+            const Handle(BRepCheck_Result)& aResult = anAnalyzer.Result (anIt.Value());
+            if (!aResult.IsNull())
+            {
+              AppendResultFaults (anIt.Value(), aResult, theFaults);
+            }
+          }
+          break;
+        }
+      }
+    }
+    catch (Standard_Failure const&)
+    {
+      theFaults.Clear();
+      BRepCheck_IncrementalAnalyzer::Fault aFault;
+      aFault.Shape  = theUnit;
+      aFault.Status = BRepCheck_CheckFail;
+      theFaults.Append (aFault);
+    }
+  }
+
+  //=======================================================================
+  //function : CollectUnits
+  //purpose  : Splits the shape on the units checked independently
+  //=======================================================================
+  void CollectUnits (const TopoDS_Shape& theShape,
+                     TopTools_IndexedMapOfShape& theUnits)
+  {
+    TopExp::MapShapes (theShape, TopAbs_SOLID, theUnits);
+    TopExp::MapShapes (theShape, TopAbs_SHELL, theUnits);
+    TopExp::MapShapes (theShape, TopAbs_FACE,  theUnits);
+
+    // sub-shapes not checked within the units of higher level
+    for (TopExp_Explorer anExp (theShape, TopAbs_WIRE, TopAbs_FACE); anExp.More(); anExp.Next())
+    {
+      theUnits.Add (anExp.Current());
+    }
+    for (TopExp_Explorer anExp (theShape, TopAbs_EDGE, TopAbs_WIRE); anExp.More(); anExp.Next())
+    {
+      theUnits.Add (anExp.Current());
+    }
+    for (TopExp_Explorer anExp (theShape, TopAbs_VERTEX, TopAbs_EDGE); anExp.More(); anExp.Next())
+    {
+      theUnits.Add (anExp.Current());
+    }
+  }
+
+  //=======================================================================
+  //function : IsUnchanged
+  //purpose  : Returns true if the shape and all its sub-shapes have not been
+  //           modified since they have been marked as checked
+  //=======================================================================
+  Standard_Boolean IsUnchanged (const TopoDS_Shape& theShape)
+  {
+    if (theShape.Modified())
+    {
+      return Standard_False;
+    }
+    for (TopoDS_Iterator anIt (theShape, Standard_False, Standard_False); anIt.More(); anIt.Next())
+    {
+      if (!IsUnchanged (anIt.Value()))
+      {
+        return Standard_False;
+      }
+    }
+    return Standard_True;
+  }
+
+  //=======================================================================
+  //function : MarkChecked
+  //purpose  : Marks the shape and all its sub-shapes as checked
+  //           by resetting their Modified flag
+  //=======================================================================
+  void MarkChecked (const TopoDS_Shape& theShape)
+  {
+    for (TopoDS_Iterator anIt (theShape, Standard_False, Standard_False); anIt.More(); anIt.Next())
+    {
+      MarkChecked (anIt.Value());
+    }
+    theShape.TShape()->Modified (Standard_False);
+  }
+
+  //=======================================================================
+  //class    : UnitAnalyzerFunctor
+  //purpose  : Checks the units not found in the cache
+  //=======================================================================
+  class UnitAnalyzerFunctor
+  {
+  public:
+
+    UnitAnalyzerFunctor (const NCollection_Array1<TopoDS_Shape>& theUnits,
+                         NCollection_Array1<BRepCheck_IncrementalAnalyzer::ListOfFault>& theFaults,
+                         const Standard_Boolean theGeomControls,
+                         const Standard_Boolean theIsExact)
+    : myUnits (theUnits),
+      myFaults (theFaults),
+      myGeomControls (theGeomControls),
+      myIsExact (theIsExact)
+    {}
+
+    void operator() (const Standard_Integer theIndex) const
+    {
+      AnalyzeUnit (myUnits (theIndex), myGeomControls, myIsExact, myFaults (theIndex));
+    }
+
+  private:
+
+    UnitAnalyzerFunctor& operator= (const UnitAnalyzerFunctor&);
+
+  private:
+
+    const NCollection_Array1<TopoDS_Shape>&                          myUnits;
+    NCollection_Array1<BRepCheck_IncrementalAnalyzer::ListOfFault>& myFaults;
+    Standard_Boolean                                                 myGeomControls;
+    Standard_Boolean                                                 myIsExact;
+  };
+}
+
+//=======================================================================
+//function : BRepCheck_IncrementalAnalyzer
+//purpose  :
+//=======================================================================
+BRepCheck_IncrementalAnalyzer::BRepCheck_IncrementalAnalyzer (const Standard_Boolean theGeomControls,
+                                                              const Standard_Boolean theIsExact)
+: myNbAnalyzed   (0),
+  myNbReused     (0),
+  myGeomControls (theGeomControls),
+  myIsExact      (theIsExact),
+  myIsParallel   (Standard_False)
+{
+}
+
+//=======================================================================
+//function : SetGeometricControls
+//purpose  :
+//=======================================================================
+void BRepCheck_IncrementalAnalyzer::SetGeometricControls (const Standard_Boolean theGeomControls)
+{
+  if (myGeomControls != theGeomControls)
+  {
+    myCache.Clear();
+    myGeomControls = theGeomControls;
+  }
+}
+
+//=======================================================================
+//function : SetExactMethod
+//purpose  :
+//=======================================================================
+void BRepCheck_IncrementalAnalyzer::SetExactMethod (const Standard_Boolean theIsExact)
+{
+  if (myIsExact != theIsExact)
+  {
+    myCache.Clear();
+    myIsExact = theIsExact;
+  }
+}
+
+//=======================================================================
+//function : Perform
+//purpose  :
+//=======================================================================
+void BRepCheck_IncrementalAnalyzer::Perform (const TopoDS_Shape&    theShape,
+                                             const Standard_Boolean theToAppend)
+{
+  if (!theToAppend)
+  {
+    myFaults.Clear();
+    myNbAnalyzed = 0;
+    myNbReused   = 0;
+  }
+  if (theShape.IsNull())
+  {
+    return;
+  }
+
+  TopTools_IndexedMapOfShape aUnits;
+  CollectUnits (theShape, aUnits);
+
+  // the units absent in the cache or containing the sub-shapes modified since the check
+  NCollection_List<TopoDS_Shape> aNewUnitList;
+  for (TopTools_IndexedMapOfShape::Iterator anIt (aUnits); anIt.More(); anIt.Next())
+  {
+    if (!myCache.IsBound (anIt.Value())
+     || !IsUnchanged (anIt.Value()))
+    {
+      aNewUnitList.Append (anIt.Value());
+    }
+  }
+
+  const Standard_Integer aNbNew = aNewUnitList.Extent();
+  if (aNbNew > 0)
+  {
+    NCollection_Array1<TopoDS_Shape> aNewUnits (1, aNbNew);
+    Standard_Integer anInd = 0;
+    for (NCollection_List<TopoDS_Shape>::Iterator anIt (aNewUnitList); anIt.More(); anIt.Next())
+    {
+      aNewUnits (++anInd) = anIt.Value();
+    }
+
+    NCollection_Array1<ListOfFault> aNewFaults (1, aNbNew);
+    UnitAnalyzerFunctor aFunctor (aNewUnits, aNewFaults, myGeomControls, myIsExact);
+    OSD_Parallel::For (1, aNbNew + 1, aFunctor, !myIsParallel || aNbNew == 1);
+
+    // the flags are set out of the parallel loop since the units share sub-shapes
+    for (anInd = 1; anInd <= aNbNew; ++anInd)
+    {
+      myCache.Bind (aNewUnits (anInd), aNewFaults (anInd));
+      MarkChecked (aNewUnits (anInd));
+    }
+  }
+  myNbAnalyzed += aNbNew;
+  myNbReused   += aUnits.Extent() - aNbNew;
+
+  // gather the faults in the order of the units
+  for (TopTools_IndexedMapOfShape::Iterator anIt (aUnits); anIt.More(); anIt.Next())
+  {
+    for (ListOfFault::Iterator aFaultIt (myCache.Find (anIt.Value())); aFaultIt.More(); aFaultIt.Next())
+    {
+      myFaults.Append (aFaultIt.Value());
+    }
+  }
+}
+
+//=======================================================================
+//function : RemoveUnused
+//purpose  :
+//=======================================================================
+void BRepCheck_IncrementalAnalyzer::RemoveUnused (const TopoDS_Shape& theShape)
+{
+  TopTools_IndexedMapOfShape aUnits;
+  if (!theShape.IsNull())
+  {
+    CollectUnits (theShape, aUnits);
+  }
+
+  NCollection_List<TopoDS_Shape> anUnused;
+  for (DataMapOfShapeFaults::Iterator anIt (myCache); anIt.More(); anIt.Next())
+  {
+    if (!aUnits.Contains (anIt.Key()))
+    {
+      anUnused.Append (anIt.Key());
+    }
+  }
+  for (NCollection_List<TopoDS_Shape>::Iterator anIt (anUnused); anIt.More(); anIt.Next())
+  {
+    myCache.UnBind (anIt.Value());
+  }
+}
+
+//=======================================================================
+//function : Clear
+//purpose  :
+//=======================================================================
+void BRepCheck_IncrementalAnalyzer::Clear()
+{
+  myCache.Clear();
+  myFaults.Clear();
+  myNbAnalyzed = 0;
+  myNbReused   = 0;
+}
@@ -0,0 +1,135 @@
+// Created on: 2026-10-18
+//
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BRepCheck_IncrementalAnalyzer_HeaderFile
+#define _BRepCheck_IncrementalAnalyzer_HeaderFile
+
+#include <BRepCheck_Status.hxx>
+#include <NCollection_DataMap.hxx>
+#include <NCollection_List.hxx>
+#include <Standard_Transient.hxx>
+#include <TopoDS_Shape.hxx>
+#include <TopTools_ShapeMapHasher.hxx>
+
+//! Checks the topological validity of shapes keeping the results
+//! of the previous checks to reuse them for the unchanged sub-shapes.
+//!
+//! The shape is split on the units which are checked independently:
+//! - faces, checked together with their wires, edges and vertices;
+//! - wires, edges and vertices not belonging to any face;
+//! - shells;
+//! - solids, checked together with their shells in the context of the solid.
+//! The faults found for each unit are cached by the unit (TShape and location),
+//! so that on repeated checks of a locally modified shape only the new units
+//! are analyzed. The new units are analyzed in parallel threads if requested.
+//!
+//! The shape is considered valid by this class if and only if it is valid
+//! for BRepCheck_Analyzer created with the same options.
+//!
+//! The Modified flag of the TShapes of the sub-shapes of the analyzed units is reset.
+//! The modification of a sub-shape in place by BRep_Builder or TopoDS_Builder
+//! (update of geometry or tolerance, addition or removal of sub-shapes) sets the flag again,
+//! so that the units containing the modified sub-shape are analyzed again.
+//! The modifications bypassing the builders are not detected; the cache should be cleared after them.
+//! Since the flag is shared, several analyzers checking the same shapes should not
+//! be used at the same time: the check by one analyzer hides the modification from the others.
+class BRepCheck_IncrementalAnalyzer : public Standard_Transient
+{
+public:
+
+  //! Fault detected on the sub-shape.
+  struct Fault
+  {
+    TopoDS_Shape     Shape;   //!< faulty sub-shape
+    TopoDS_Shape     Context; //!< shape in the context of which the fault is detected (null if none)
+    BRepCheck_Status Status;  //!< detected fault
+  };
+
+  typedef NCollection_List<Fault> ListOfFault;
+
+public:
+
+  //! Creates an empty analyzer.
+  //! @param theGeomControls [in] flag to perform the geometrical controls (see BRepCheck_Analyzer)
+  //! @param theIsExact      [in] flag to use the exact method of the check of the edges
+  Standard_EXPORT BRepCheck_IncrementalAnalyzer (const Standard_Boolean theGeomControls = Standard_True,
+                                                 const Standard_Boolean theIsExact = Standard_False);
+
+  //! Sets the flag of parallel analysis of the new units.
+  void SetParallel (const Standard_Boolean theIsParallel) { myIsParallel = theIsParallel; }
+
+  //! Returns the flag of parallel analysis of the new units.
+  Standard_Boolean IsParallel() const { return myIsParallel; }
+
+  //! Sets the flag of geometrical controls. The cache is cleared if the flag is changed.
+  Standard_EXPORT void SetGeometricControls (const Standard_Boolean theGeomControls);
+
+  //! Returns the flag of geometrical controls.
+  Standard_Boolean GeometricControls() const { return myGeomControls; }
+
+  //! Sets the method of the check of the edges. The cache is cleared if the method is changed.
+  Standard_EXPORT void SetExactMethod (const Standard_Boolean theIsExact);
+
+  //! Returns true if exact method is selected.
+  Standard_Boolean IsExactMethod() const { return myIsExact; }
+
+  //! Checks the shape analyzing only the units absent in the cache or modified since their check.
+  //! @param theShape    [in] shape to check
+  //! @param theToAppend [in] flag to add the faults and the statistics of the check to the ones
+  //!                         of the previous checks instead of replacing them
+  Standard_EXPORT void Perform (const TopoDS_Shape&    theShape,
+                                const Standard_Boolean theToAppend = Standard_False);
+
+  //! Returns true if no fault has been detected on the checked shapes.
+  Standard_Boolean IsValid() const { return myFaults.IsEmpty(); }
+
+  //! Returns the faults detected on the checked shapes.
+  const ListOfFault& Faults() const { return myFaults; }
+
+  //! Returns the number of units analyzed during the check.
+  Standard_Integer NbAnalyzed() const { return myNbAnalyzed; }
+
+  //! Returns the number of units taken from the cache during the check.
+  Standard_Integer NbReused() const { return myNbReused; }
+
+  //! Returns the number of cached units.
+  Standard_Integer Extent() const { return myCache.Extent(); }
+
+  //! Removes the cached units not contained in the given shape.
+  Standard_EXPORT void RemoveUnused (const TopoDS_Shape& theShape);
+
+  //! Removes all cached units.
+  Standard_EXPORT void Clear();
+
+  DEFINE_STANDARD_RTTIEXT(BRepCheck_IncrementalAnalyzer, Standard_Transient)
+
+private:
+
+  typedef NCollection_DataMap<TopoDS_Shape, ListOfFault, TopTools_ShapeMapHasher> DataMapOfShapeFaults;
+
+private:
+
+  DataMapOfShapeFaults myCache;
+  ListOfFault          myFaults;
+  Standard_Integer     myNbAnalyzed;
+  Standard_Integer     myNbReused;
+  Standard_Boolean     myGeomControls;
+  Standard_Boolean     myIsExact;
+  Standard_Boolean     myIsParallel;
+};
+
+DEFINE_STANDARD_HANDLE(BRepCheck_IncrementalAnalyzer, Standard_Transient)
+
+#endif // _BRepCheck_IncrementalAnalyzer_HeaderFile
@@ -28,7 +28,7 @@
 #include <TopoDS_Face.hxx>
 #include <TopoDS_Shape.hxx>
 #include <TopoDS_Shell.hxx>
-#include <TopTools_DataMapOfShapeInteger.hxx>
+#include <TopTools_FlatDataMapOfShapeInteger.hxx>
 #include <TopTools_IndexedDataMapOfShapeListOfShape.hxx>
 #include <TopTools_ListOfShape.hxx>
 #include <TopTools_MapOfShape.hxx>
@@ -474,7 +474,7 @@ BRepCheck_Status BRepCheck_Shell::Orientation(const Standard_Boolean Update)
 // First the orientation of each face in relation to the shell is found.
 // It is used to check BRepCheck_RedundantFace
 
-  TopTools_DataMapOfShapeInteger MapOfShapeOrientation;
+  TopTools_FlatDataMapOfShapeInteger MapOfShapeOrientation;
   TopExp_Explorer exp,ede;
 
   for (exp.Init(myShape,TopAbs_FACE); exp.More(); exp.Next()) {
@@ -491,7 +491,7 @@ BRepCheck_Status BRepCheck_Shell::Orientation(const Standard_Boolean Update)
 
 #ifdef OCCT_DEBUG
   if (BRepCheck_Trace(0) > 1) {
-    TopTools_DataMapIteratorOfDataMapOfShapeInteger itt(MapOfShapeOrientation);
+    TopTools_FlatDataMapIteratorOfFlatDataMapOfShapeInteger itt(MapOfShapeOrientation);
     Standard_Integer upper = MapOfShapeOrientation.NbBuckets();
     std::cout << "La map shape Orientation :" << std::endl;
     for (; itt.More(); itt.Next()) {
@@ -0,0 +1,391 @@
+// Created on: 2026-10-18
+//
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BRepClass3d_BatchClassifier.hxx>
+
+#include <BRep_Tool.hxx>
+#include <BRepClass3d_SolidClassifier.hxx>
+#include <BVH_Tools.hxx>
+#include <BVH_Traverse.hxx>
+#include <OSD_Parallel.hxx>
+#include <Poly_Triangulation.hxx>
+#include <Precision.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+
+typedef BRepClass3d_BatchClassifier::BRepClass3d_TriangleSet BRepClass3d_TriangleSet;
+
+namespace
+{
+  //! Number of rays cast from the point before falling back to the exact classification.
+  static const Standard_Integer THE_NB_RAYS = 3;
+
+  //! Returns the direction of the ray with the given index.
+  //! The directions are not aligned with the coordinate axes to reduce the
+  //! probability of passing through the edges of regular triangulations.
+  static BVH_Vec3d rayDirection (const Standard_Integer theIndex)
+  {
+    switch (theIndex)
+    {
+      case 0:  return BVH_Vec3d ( 0.5773502691896258,  0.5773502691896257,  0.5773502691896259);
+      case 1:  return BVH_Vec3d (-0.2672612419124244,  0.8017837257372732, -0.5345224838248488);
+      default: return BVH_Vec3d ( 0.8164965809277261, -0.4082482904638630, -0.4082482904638631);
+    }
+  }
+
+  //! Checks if the point is closer to the triangulation than the given distance.
+  class BRepClass3d_NearSelector : public BVH_Traverse<Standard_Real, 3, BRepClass3d_TriangleSet>
+  {
+  public:
+
+    BRepClass3d_NearSelector (const BVH_Vec3d& thePoint, const Standard_Real theDist)
+    : myPoint    (thePoint),
+      mySqDist   (theDist * theDist),
+      myIsNear   (Standard_False)
+    {}
+
+    //! Returns TRUE if a triangle closer than the given distance has been found.
+    Standard_Boolean IsNear() const { return myIsNear; }
+
+    virtual Standard_Boolean RejectNode (const BVH_Vec3d& theCMin,
+                                         const BVH_Vec3d& theCMax,
+                                         Standard_Real& theMetric) const Standard_OVERRIDE
+    {
+      theMetric = BVH_Tools<Standard_Real, 3>::PointBoxSquareDistance (myPoint, theCMin, theCMax);
+      return theMetric > mySqDist;
+    }
+
+    virtual Standard_Boolean Accept (const Standard_Integer theIndex,
+                                     const Standard_Real&) Standard_OVERRIDE
+    {
+      const BVH_Vec4i& aTri = myBVHSet->Elements[theIndex];
+      const Standard_Real aSqDist = BVH_Tools<Standard_Real, 3>::PointTriangleSquareDistance (myPoint,
+        myBVHSet->Vertices[aTri.x()], myBVHSet->Vertices[aTri.y()], myBVHSet->Vertices[aTri.z()]);
+      if (aSqDist <= mySqDist)
+      {
+        myIsNear = Standard_True;
+      }
+      return myIsNear;
+    }
+
+    virtual Standard_Boolean Stop() const Standard_OVERRIDE { return myIsNear; }
+
+  private:
+    BVH_Vec3d        myPoint;
+    Standard_Real    mySqDist;
+    Standard_Boolean myIsNear;
+  };
+
+  //! Counts the intersections of the ray with the triangles bounding the solid.
+  class BRepClass3d_RaySelector : public BVH_Traverse<Standard_Real, 3, BRepClass3d_TriangleSet>
+  {
+  public:
+
+    BRepClass3d_RaySelector (const BVH_Vec3d& theOrigin, const BVH_Vec3d& theDir)
+    : myOrigin      (theOrigin),
+      myDir         (theDir),
+      myNbHits      (0),
+      myIsAmbiguous (Standard_False)
+    {}
+
+    //! Returns the number of intersections.
+    Standard_Integer NbHits() const { return myNbHits; }
+
+    //! Returns TRUE if the ray passes through an edge or a node of the triangulation
+    //! or lies in the plane of a triangle, so the parity of intersections is not reliable.
+    Standard_Boolean IsAmbiguous() const { return myIsAmbiguous; }
+
+    virtual Standard_Boolean RejectNode (const BVH_Vec3d& theCMin,
+                                         const BVH_Vec3d& theCMax,
+                                         Standard_Real&) const Standard_OVERRIDE
+    {
+      Standard_Real aTimeEnter = 0.0, aTimeLeave = 0.0;
+      return !BVH_Tools<Standard_Real, 3>::RayBoxIntersection (myOrigin, myDir, theCMin, theCMax,
+                                                                aTimeEnter, aTimeLeave);
+    }
+
+    virtual Standard_Boolean Accept (const Standard_Integer theIndex,
+                                     const Standard_Real&) Standard_OVERRIDE
+    {
+      const BVH_Vec4i& aTri = myBVHSet->Elements[theIndex];
+      if (aTri.w() == 0)
+      {
+        // triangle of the face not bounding the volume
+        return Standard_False;
+      }
+
+      const BVH_Vec3d& aP0 = myBVHSet->Vertices[aTri.x()];
+      const BVH_Vec3d  anEdge1 = myBVHSet->Vertices[aTri.y()] - aP0;
+      const BVH_Vec3d  anEdge2 = myBVHSet->Vertices[aTri.z()] - aP0;
+      const BVH_Vec3d  aPVec = BVH_Vec3d::Cross (myDir, anEdge2);
+      const BVH_Vec3d  aTVec = myOrigin - aP0;
+      const Standard_Real aDet = anEdge1.Dot (aPVec);
+      const Standard_Real aNormLen = BVH_Vec3d::Cross (anEdge1, anEdge2).Modulus();
+      if (Abs (aDet) <= Precision::Confusion() * aNormLen)
+      {
+        // the ray is parallel to the triangle
+        if (Abs (BVH_Vec3d::Cross (anEdge1, anEdge2).Dot (aTVec)) <= Precision::Confusion() * aNormLen)
+        {
+          myIsAmbiguous = Standard_True;
+        }
+        return Standard_False;
+      }
+
+      const Standard_Real anInvDet = 1.0 / aDet;
+      const Standard_Real anU = aTVec.Dot (aPVec) * anInvDet;
+      const BVH_Vec3d     aQVec = BVH_Vec3d::Cross (aTVec, anEdge1);
+      const Standard_Real aV = myDir.Dot (aQVec) * anInvDet;
+      const Standard_Real aT = anEdge2.Dot (aQVec) * anInvDet;
+      const Standard_Real aTol = Precision::Confusion();
+      if (aT <= 0.0
+       || anU < -aTol || aV < -aTol || anU + aV > 1.0 + aTol)
+      {
+        return Standard_False;
+      }
+      if (anU < aTol || aV < aTol || anU + aV > 1.0 - aTol)
+      {
+        myIsAmbiguous = Standard_True;
+        return Standard_False;
+      }
+
+      ++myNbHits;
+      return Standard_True;
+    }
+
+    virtual Standard_Boolean Stop() const Standard_OVERRIDE { return myIsAmbiguous; }
+
+  private:
+    BVH_Vec3d        myOrigin;
+    BVH_Vec3d        myDir;
+    Standard_Integer myNbHits;
+    Standard_Boolean myIsAmbiguous;
+  };
+
+  //! Classifies the point by the triangulation.
+  //! Returns TopAbs_UNKNOWN if the exact classification is required.
+  static TopAbs_State classifyByMesh (BRepClass3d_TriangleSet* theTriangles,
+                                      const Standard_Real      theBand,
+                                      const gp_Pnt&            thePoint)
+  {
+    const BVH_Vec3d aPnt (thePoint.X(), thePoint.Y(), thePoint.Z());
+    BRepClass3d_NearSelector aNearSelector (aPnt, theBand);
+    aNearSelector.SetBVHSet (theTriangles);
+    aNearSelector.Select();
+    if (aNearSelector.IsNear())
+    {
+      return TopAbs_UNKNOWN;
+    }
+
+    for (Standard_Integer aRayIt = 0; aRayIt < THE_NB_RAYS; ++aRayIt)
+    {
+      BRepClass3d_RaySelector aRaySelector (aPnt, rayDirection (aRayIt));
+      aRaySelector.SetBVHSet (theTriangles);
+      aRaySelector.Select();
+      if (!aRaySelector.IsAmbiguous())
+      {
+        return (aRaySelector.NbHits() % 2) != 0 ? TopAbs_IN : TopAbs_OUT;
+      }
+    }
+    return TopAbs_UNKNOWN;
+  }
+}
+
+//! Functor classifying the points of one chunk of the array.
+//! Each chunk uses its own exact classifier, loaded on demand.
+class BRepClass3d_BatchClassifierFunctor
+{
+public:
+
+  BRepClass3d_BatchClassifierFunctor (BRepClass3d_BatchClassifier&          theClassifier,
+                                      const TColgp_Array1OfPnt&             thePoints,
+                                      const Standard_Integer                theNbChunks,
+                                      NCollection_Array1<Standard_Integer>& theNbExact)
+  : myClassifier (theClassifier),
+    myPoints     (thePoints),
+    myNbChunks   (theNbChunks),
+    myNbExact    (theNbExact)
+  {}
+
+  void operator() (const Standard_Integer theChunk) const
+  {
+    const Standard_Size aNbPoints = static_cast<Standard_Size> (myPoints.Length());
+    const Standard_Integer aFirst = myPoints.Lower()
+      + static_cast<Standard_Integer> (aNbPoints * theChunk / myNbChunks);
+    const Standard_Integer aLast = myPoints.Lower()
+      + static_cast<Standard_Integer> (aNbPoints * (theChunk + 1) / myNbChunks) - 1;
+
+    BRepClass3d_SolidClassifier anExactClassifier;
+    Standard_Boolean isLoaded = Standard_False;
+    Standard_Integer aNbExact = 0;
+    for (Standard_Integer aPntIt = aFirst; aPntIt <= aLast; ++aPntIt)
+    {
+      const gp_Pnt& aPnt = myPoints.Value (aPntIt);
+      TopAbs_State aState = TopAbs_UNKNOWN;
+      if (!myClassifier.myTriangles.IsNull())
+      {
+        aState = classifyByMesh (myClassifier.myTriangles.get(), myClassifier.myBand, aPnt);
+      }
+      if (aState == TopAbs_UNKNOWN)
+      {
+        if (!isLoaded)
+        {
+          anExactClassifier.Load (myClassifier.myShape);
+          isLoaded = Standard_True;
+        }
+        anExactClassifier.Perform (aPnt, myClassifier.myTol);
+        aState = anExactClassifier.State();
+        ++aNbExact;
+      }
+      myClassifier.myStates.ChangeValue (aPntIt) = static_cast<Standard_Byte> (aState);
+    }
+    myNbExact.ChangeValue (theChunk) = aNbExact;
+  }
+
+private:
+  BRepClass3d_BatchClassifierFunctor& operator= (const BRepClass3d_BatchClassifierFunctor&);
+
+private:
+  BRepClass3d_BatchClassifier&          myClassifier;
+  const TColgp_Array1OfPnt&             myPoints;
+  Standard_Integer                      myNbChunks;
+  NCollection_Array1<Standard_Integer>& myNbExact;
+};
+
+//=======================================================================
+//function : BRepClass3d_BatchClassifier
+//purpose  :
+//=======================================================================
+BRepClass3d_BatchClassifier::BRepClass3d_BatchClassifier()
+: myTol (0.0),
+  myBand (0.0),
+  myNbExactPoints (0)
+{
+}
+
+//=======================================================================
+//function : BRepClass3d_BatchClassifier
+//purpose  :
+//=======================================================================
+BRepClass3d_BatchClassifier::BRepClass3d_BatchClassifier (const TopoDS_Shape& theShape,
+                                                          const Standard_Real theTol)
+: myTol (0.0),
+  myBand (0.0),
+  myNbExactPoints (0)
+{
+  Load (theShape, theTol);
+}
+
+//=======================================================================
+//function : Load
+//purpose  :
+//=======================================================================
+void BRepClass3d_BatchClassifier::Load (const TopoDS_Shape& theShape,
+                                        const Standard_Real theTol)
+{
+  myShape = theShape;
+  myTol   = theTol;
+  myBand  = 0.0;
+  myTriangles.Nullify();
+
+  // the parity of intersections is meaningful for closed shells only
+  TopExp_Explorer anExp (theShape, TopAbs_SHELL);
+  if (!anExp.More())
+  {
+    return;
+  }
+  for (; anExp.More(); anExp.Next())
+  {
+    if (!BRep_Tool::IsClosed (anExp.Current()))
+    {
+      return;
+    }
+  }
+
+  opencascade::handle<BRepClass3d_TriangleSet> aTriangles = new BRepClass3d_TriangleSet();
+  Standard_Real aMaxDeflection = 0.0;
+  for (anExp.Init (theShape, TopAbs_FACE); anExp.More(); anExp.Next())
+  {
+    const TopoDS_Face& aFace = TopoDS::Face (anExp.Current());
+    TopLoc_Location aLoc;
+    const Handle(Poly_Triangulation)& aTri = BRep_Tool::Triangulation (aFace, aLoc);
+    if (aTri.IsNull() || aTri->NbTriangles() == 0)
+    {
+      // the triangulation does not cover the solid
+      return;
+    }
+
+    aMaxDeflection = Max (aMaxDeflection, aTri->Deflection());
+    const Standard_Integer aNodeOffset = static_cast<Standard_Integer> (aTriangles->Vertices.size()) - 1;
+    const gp_Trsf& aTrsf = aLoc.Transformation();
+    for (Standard_Integer aNodeIt = 1; aNodeIt <= aTri->NbNodes(); ++aNodeIt)
+    {
+      gp_Pnt aNode = aTri->Node (aNodeIt);
+      if (!aLoc.IsIdentity())
+      {
+        aNode.Transform (aTrsf);
+      }
+      aTriangles->Vertices.push_back (BVH_Vec3d (aNode.X(), aNode.Y(), aNode.Z()));
+    }
+
+    // the triangles of internal and external faces are used only to detect the points near them
+    const TopAbs_Orientation anOri = aFace.Orientation();
+    const Standard_Integer isBounding = (anOri == TopAbs_FORWARD || anOri == TopAbs_REVERSED) ? 1 : 0;
+    for (Standard_Integer aTriIt = 1; aTriIt <= aTri->NbTriangles(); ++aTriIt)
+    {
+      Standard_Integer aN1 = 0, aN2 = 0, aN3 = 0;
+      aTri->Triangle (aTriIt).Get (aN1, aN2, aN3);
+      aTriangles->Elements.push_back (BVH_Vec4i (aNodeOffset + aN1, aNodeOffset + aN2, aNodeOffset + aN3, isBounding));
+    }
+  }
+
+  // the points closer to the triangulation than its deviation from the
+  // exact surfaces (taking into account the tolerances) are classified exactly
+  myBand = 2.0 * (aMaxDeflection + BRep_Tool::MaxTolerance (theShape, TopAbs_VERTEX)) + theTol;
+
+  // build the tree before sharing it between threads
+  aTriangles->MarkDirty();
+  aTriangles->BVH();
+  myTriangles = aTriangles;
+}
+
+//=======================================================================
+//function : Perform
+//purpose  :
+//=======================================================================
+void BRepClass3d_BatchClassifier::Perform (const TColgp_Array1OfPnt& thePoints,
+                                           const Standard_Boolean theIsParallel)
+{
+  myNbExactPoints = 0;
+  if (thePoints.IsEmpty())
+  {
+    NCollection_Array1<Standard_Byte> anEmptyStates;
+    myStates.Move (anEmptyStates);
+    return;
+  }
+  myStates.Resize (thePoints.Lower(), thePoints.Upper(), Standard_False);
+
+  const Standard_Integer aNbChunks = !theIsParallel ? 1
+    : Min (thePoints.Length(), 4 * OSD_Parallel::NbLogicalProcessors());
+  NCollection_Array1<Standard_Integer> aNbExact (0, aNbChunks - 1);
+  aNbExact.Init (0);
+  OSD_Parallel::For (0, aNbChunks,
+                     BRepClass3d_BatchClassifierFunctor (*this, thePoints, aNbChunks, aNbExact),
+                     !theIsParallel);
+
+  for (Standard_Integer aChunkIt = 0; aChunkIt < aNbChunks; ++aChunkIt)
+  {
+    myNbExactPoints += aNbExact (aChunkIt);
+  }
+}
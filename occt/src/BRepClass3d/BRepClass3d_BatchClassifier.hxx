@@ -0,0 +1,101 @@
+// Created on: 2026-10-18
+//
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BRepClass3d_BatchClassifier_HeaderFile
+#define _BRepClass3d_BatchClassifier_HeaderFile
+
+#include <BVH_Triangulation.hxx>
+#include <NCollection_Array1.hxx>
+#include <TColgp_Array1OfPnt.hxx>
+#include <TopAbs_State.hxx>
+#include <TopoDS_Shape.hxx>
+
+//! Classifies a large set of points relatively to a solid.
+//!
+//! The classifier is prepared once for the solid. If all faces of the solid
+//! have triangulations and all its shells are closed, a BVH is built over the
+//! triangles and the points located far enough from the triangulation are
+//! classified by the parity of the number of intersections of a ray with it.
+//! The points close to the boundary of the solid (relatively to the deflection
+//! of the triangulation and the tolerance), as well as the points for which the
+//! ray hits the triangulation ambiguously, are classified by the exact
+//! BRepClass3d_SolidClassifier. Without the triangulation all points are
+//! classified by the exact algorithm.
+//!
+//! The points are processed in parallel threads. The states are stored
+//! in a packed array with one byte per point.
+class BRepClass3d_BatchClassifier
+{
+public:
+
+  DEFINE_STANDARD_ALLOC
+
+  typedef BVH_Triangulation<Standard_Real, 3> BRepClass3d_TriangleSet;
+
+public:
+
+  //! Empty constructor.
+  Standard_EXPORT BRepClass3d_BatchClassifier();
+
+  //! Constructor preparing the classifier for the given solid.
+  Standard_EXPORT BRepClass3d_BatchClassifier (const TopoDS_Shape& theShape,
+                                               const Standard_Real theTol);
+
+  //! Prepares the classifier for the given solid.
+  //! @param theShape [in] the solid
+  //! @param theTol   [in] the tolerance of classification
+  Standard_EXPORT void Load (const TopoDS_Shape& theShape,
+                             const Standard_Real theTol);
+
+  //! Returns TRUE if the triangulation of the solid is used for classification.
+  Standard_Boolean IsMeshUsed() const { return !myTriangles.IsNull(); }
+
+  //! Classifies the points.
+  //! @param thePoints     [in] the points to classify
+  //! @param theIsParallel [in] flag to classify the points in parallel threads
+  Standard_EXPORT void Perform (const TColgp_Array1OfPnt& thePoints,
+                                const Standard_Boolean theIsParallel = Standard_True);
+
+  //! Returns the number of classified points.
+  Standard_Integer NbPoints() const { return myStates.Length(); }
+
+  //! Returns the state of the point with the given index
+  //! (in the range of the array passed to Perform()).
+  TopAbs_State State (const Standard_Integer theIndex) const
+  {
+    return static_cast<TopAbs_State> (myStates.Value (theIndex));
+  }
+
+  //! Returns the packed array of states of the points.
+  const NCollection_Array1<Standard_Byte>& States() const { return myStates; }
+
+  //! Returns the number of points classified by the exact algorithm.
+  Standard_Integer NbExactPoints() const { return myNbExactPoints; }
+
+private:
+
+  friend class BRepClass3d_BatchClassifierFunctor;
+
+private:
+
+  TopoDS_Shape                                  myShape;
+  Standard_Real                                 myTol;
+  Standard_Real                                 myBand;          //!< distance to the triangulation requiring exact classification
+  opencascade::handle<BRepClass3d_TriangleSet>  myTriangles;
+  NCollection_Array1<Standard_Byte>             myStates;
+  Standard_Integer                              myNbExactPoints;
+};
+
+#endif // _BRepClass3d_BatchClassifier_HeaderFile
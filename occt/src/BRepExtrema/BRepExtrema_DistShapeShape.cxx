@@ -36,6 +36,9 @@
 #include <NCollection_Vector.hxx>
 #include <OSD_Parallel.hxx>
 #include <StdFail_NotDone.hxx>
+#include <BVH_BoxSet.hxx>
+#include <BVH_Tools.hxx>
+#include <BVH_Traverse.hxx>
 
 #include <algorithm>
 namespace
@@ -99,7 +102,36 @@ namespace
   static Standard_Boolean BRepExtrema_CheckPair_Comparator (const BRepExtrema_CheckPair& theLeft,
                                                             const BRepExtrema_CheckPair& theRight)
   {
-    return (theLeft.Distance < theRight.Distance);
+    if (theLeft.Distance != theRight.Distance)
+    {
+      return (theLeft.Distance < theRight.Distance);
+    }
+    return theLeft.Index1 < theRight.Index1
+       || (theLeft.Index1 == theRight.Index1 && theLeft.Index2 < theRight.Index2);
+  }
+
+  //! Set of indices of sub-shapes with their bounding boxes.
+  typedef BVH_BoxSet<Standard_Real, 3, Standard_Integer> BRepExtrema_BoxSet;
+
+  //! Builds the BVH tree over non-void boxes of sub-shapes.
+  static opencascade::handle<BRepExtrema_BoxSet> buildBoxSet (const Bnd_Array1OfBox& theLBox)
+  {
+    opencascade::handle<BRepExtrema_BoxSet> aBoxSet = new BRepExtrema_BoxSet();
+    aBoxSet->SetSize (theLBox.Size());
+    for (Standard_Integer anIdx = theLBox.Lower(); anIdx <= theLBox.Upper(); ++anIdx)
+    {
+      const Bnd_Box& aBox = theLBox.Value (anIdx);
+      if (aBox.IsVoid())
+      {
+        continue;
+      }
+      const gp_Pnt aMin = aBox.CornerMin();
+      const gp_Pnt aMax = aBox.CornerMax();
+      aBoxSet->Add (anIdx, BVH_Box<Standard_Real, 3> (BVH_Vec3d (aMin.X(), aMin.Y(), aMin.Z()),
+                                                      BVH_Vec3d (aMax.X(), aMax.Y(), aMax.Z())));
+    }
+    aBoxSet->Build();
+    return aBoxSet;
   }
 }
 
@@ -315,7 +347,8 @@ struct DistanceFunctor
     Scope(theRange, "Shapes distances calculating", theArrayOfArrays->Size()),
     Ranges(0, theArrayOfArrays->Size() - 1),
     Eps(Precision::Confusion()),
-    StartDist(0.0)
+    StartDist(0.0),
+    BestDist(0.0)
   {
     for (Standard_Integer i = 0; i < theArrayOfArrays->Size(); ++i)
     {
@@ -323,6 +356,23 @@ struct DistanceFunctor
     }
   }
 
+  //! Returns the minimal distance found by all tasks.
+  Standard_Real bestDistance() const
+  {
+    Standard_Mutex::Sentry aLock(Mutex.get());
+    return BestDist;
+  }
+
+  //! Shares the distance found by the task with other tasks.
+  void updateBestDistance (const Standard_Real theDist) const
+  {
+    Standard_Mutex::Sentry aLock(Mutex.get());
+    if (theDist < BestDist)
+    {
+      BestDist = theDist;
+    }
+  }
+
   void operator() (const Standard_Integer theIndex) const
   {
     Message_ProgressScope aScope(Ranges[theIndex], NULL, ArrayOfArrays->Value(theIndex).Size());
@@ -335,7 +385,9 @@ struct DistanceFunctor
       }
       aScope.Next();
       const BRepExtrema_CheckPair& aPair = ArrayOfArrays->Value(theIndex).Value(i);
-      if (aPair.Distance > Solution.Dist[theIndex] + Eps)
+      // the pairs farther than the distance found by any task cannot give the solution
+      const Standard_Real aDistRef = Min (Solution.Dist[theIndex], bestDistance());
+      if (aPair.Distance > aDistRef + Eps)
       {
         break; // early search termination
       }
@@ -343,10 +395,11 @@ struct DistanceFunctor
       const Bnd_Box& aBox2 = LBox2->Value(aPair.Index2);
       const TopoDS_Shape& aShape1 = Map1->FindKey(aPair.Index1);
       const TopoDS_Shape& aShape2 = Map2->FindKey(aPair.Index2);
-      BRepExtrema_DistanceSS aDistTool(aShape1, aShape2, aBox1, aBox2, Solution.Dist[theIndex], Eps);
+      BRepExtrema_DistanceSS aDistTool(aShape1, aShape2, aBox1, aBox2, aDistRef, Eps);
       const Standard_Real aDist = aDistTool.DistValue();
       if (aDistTool.IsDone())
       {
+        updateBestDistance (aDist);
         if (aDist < Solution.Dist[theIndex] - Eps)
         {
           Solution.Shape1[theIndex].Clear();
@@ -386,83 +439,70 @@ struct DistanceFunctor
   NCollection_Array1<Message_ProgressRange> Ranges;
   Standard_Real                             Eps;
   Standard_Real                             StartDist;
+  mutable Standard_Real                     BestDist;  //!< minimal distance shared between tasks
+  Handle(Standard_HMutex)                   Mutex;
 };
 
 
 //=======================================================================
-//struct   : DistancePairFunctor
-//purpose  : 
+//class    : BRepExtrema_BoxPairSelector
+//purpose  : Collects the pairs of sub-shapes with the distance between
+//           bounding boxes less than the reference one by the dual-tree
+//           traversal of BVH trees of the boxes
 //=======================================================================
-struct DistancePairFunctor
+class BRepExtrema_BoxPairSelector : public BVH_PairTraverse<Standard_Real, 3, BRepExtrema_BoxSet>
 {
-  DistancePairFunctor(NCollection_Array1<IndexBand>* theBandArray,
-                      const Message_ProgressRange& theRange):
-    BandArray(theBandArray),
-    PairList(0, theBandArray->Size() - 1),
-    LBox1(NULL),
-    LBox2(NULL),
-    Scope(theRange, "Boxes distances calculating", theBandArray->Size()),
-    Ranges(0, theBandArray->Size() - 1),
-    DistRef(0),
-    Eps(Precision::Confusion())
+public:
+
+  BRepExtrema_BoxPairSelector (const Bnd_Array1OfBox&                   theLBox1,
+                               const Bnd_Array1OfBox&                   theLBox2,
+                               const Standard_Real                      theDistRef,
+                               const Standard_Real                      theEps,
+                               NCollection_Vector<BRepExtrema_CheckPair>& thePairs)
+  : myLBox1 (theLBox1),
+    myLBox2 (theLBox2),
+    myDistRef (theDistRef),
+    myEps (theEps),
+    mySqMaxDist ((theDistRef + theEps) * (theDistRef + theEps)),
+    myPairs (thePairs)
+  {}
+
+  //! Rejects the pair of nodes which boxes are too far from each other.
+  virtual Standard_Boolean RejectNode (const BVH_Vec3d& theCornerMin1,
+                                       const BVH_Vec3d& theCornerMax1,
+                                       const BVH_Vec3d& theCornerMin2,
+                                       const BVH_Vec3d& theCornerMax2,
+                                       Standard_Real&) const Standard_OVERRIDE
   {
-    for (Standard_Integer i = 0; i < theBandArray->Size(); ++i)
-    {
-      Ranges.SetValue(i, Scope.Next());
-    }
+    return BVH_Tools<Standard_Real, 3>::BoxBoxSquareDistance (theCornerMin1, theCornerMax1,
+                                                              theCornerMin2, theCornerMax2) > mySqMaxDist;
   }
 
-  void operator() (const Standard_Integer theIndex) const
+  //! Checks the distance between the boxes of sub-shapes.
+  virtual Standard_Boolean Accept (const Standard_Integer theIndex1,
+                                   const Standard_Integer theIndex2) Standard_OVERRIDE
   {
-    const Standard_Integer aFirst = BandArray->Value(theIndex).First;
-    const Standard_Integer aLast  = BandArray->Value(theIndex).Last;
-
-    Message_ProgressScope aScope(Ranges[theIndex], NULL, (double) aLast - aFirst);
-
-    for (Standard_Integer anIdx1 = aFirst; anIdx1 <= aLast; ++anIdx1)
+    const Standard_Integer anIdx1 = myBVHSet1->Element (theIndex1);
+    const Standard_Integer anIdx2 = myBVHSet2->Element (theIndex2);
+    const Standard_Real aDist = myLBox1.Value (anIdx1).Distance (myLBox2.Value (anIdx2));
+    if (aDist - myDistRef < myEps)
     {
-      if (!aScope.More())
-      {
-        break;
-      }
-      aScope.Next();
-
-      for (Standard_Integer anIdx2 = 1; anIdx2 <= LBox2->Size(); ++anIdx2)
-      {
-        const Bnd_Box& aBox1 = LBox1->Value(anIdx1);
-        const Bnd_Box& aBox2 = LBox2->Value(anIdx2);
-        if (aBox1.IsVoid() || aBox2.IsVoid())
-        {
-          continue;
-        }
-
-        const Standard_Real aDist = aBox1.Distance(aBox2);       
-        if (aDist - DistRef < Eps)
-        {
-          PairList[theIndex].Append(BRepExtrema_CheckPair(anIdx1, anIdx2, aDist));
-        }
-      }
+      myPairs.Append (BRepExtrema_CheckPair (anIdx1, anIdx2, aDist));
+      return Standard_True;
     }
+    return Standard_False;
   }
 
-  Standard_Integer ListSize()
-  {
-    Standard_Integer aSize(0);
-    for (Standard_Integer anI = PairList.Lower(); anI <= PairList.Upper(); ++anI)
-    {
-      aSize += PairList[anI].Size();
-    }
-    return aSize;
-  }
+private:
+  BRepExtrema_BoxPairSelector& operator= (const BRepExtrema_BoxPairSelector&);
 
-  NCollection_Array1<IndexBand>*             BandArray;
-  mutable NCollection_Array1<NCollection_Vector<BRepExtrema_CheckPair> > PairList;
-  const Bnd_Array1OfBox*                     LBox1;
-  const Bnd_Array1OfBox*                     LBox2;
-  Message_ProgressScope                      Scope;
-  NCollection_Array1<Message_ProgressRange>  Ranges;
-  Standard_Real                              DistRef;
-  Standard_Real                              Eps;
+private:
+  const Bnd_Array1OfBox&                     myLBox1;
+  const Bnd_Array1OfBox&                     myLBox2;
+  Standard_Real                              myDistRef;
+  Standard_Real                              myEps;
+  Standard_Real                              mySqMaxDist;
+  NCollection_Vector<BRepExtrema_CheckPair>& myPairs;
 };
 
 //=======================================================================
@@ -486,59 +526,43 @@ Standard_Boolean BRepExtrema_DistShapeShape::DistanceMapMap (const TopTools_Inde
 
   Message_ProgressScope aTwinScope(theRange, NULL, 1.0);
 
-  const Handle(OSD_ThreadPool)& aThreadPool = OSD_ThreadPool::DefaultPool();
-  const Standard_Integer aNbThreads = aThreadPool->NbThreads();
-  const Standard_Integer aMinPairTaskSize = aCount1 < 10 ? aCount1 : 10;
-  Standard_Integer aNbPairTasks = aNbThreads;
-  Standard_Integer aPairTaskSize = (Standard_Integer) Ceiling((double) aCount1 / aNbPairTasks);
-  if (aPairTaskSize < aMinPairTaskSize)
+  // collect the pairs of sub-shapes with close bounding boxes
+  NCollection_Vector<BRepExtrema_CheckPair> aPairVector;
   {
-    aPairTaskSize = aMinPairTaskSize;
-    aNbPairTasks = (Standard_Integer) Ceiling((double) aCount1 / aPairTaskSize);
-  }
-
-  Standard_Integer aFirstIndex(1);
-  NCollection_Array1<IndexBand> aBandArray(0, aNbPairTasks - 1);
-
-  for (Standard_Integer anI = 0; anI < aBandArray.Size(); ++anI)
-  {
-    if (aCount1 < aFirstIndex + aPairTaskSize - 1)
+    opencascade::handle<BRepExtrema_BoxSet> aBoxSet1 = buildBoxSet (theLBox1);
+    opencascade::handle<BRepExtrema_BoxSet> aBoxSet2 = buildBoxSet (theLBox2);
+    if (aBoxSet1->Size() == 0 || aBoxSet2->Size() == 0)
     {
-      aPairTaskSize = aCount1 - aFirstIndex + 1;
+      return Standard_True;
     }
-    aBandArray.SetValue(anI, IndexBand(aFirstIndex, aFirstIndex + aPairTaskSize - 1));
-    aFirstIndex += aPairTaskSize;
-  }
-
-  aTwinScope.Next(0.15);
-  DistancePairFunctor aPairFunctor(&aBandArray, aTwinScope.Next(0.15));
-  aPairFunctor.LBox1 = &theLBox1;
-  aPairFunctor.LBox2 = &theLBox2;
-  aPairFunctor.DistRef = myDistRef;
-  aPairFunctor.Eps = myEps;
 
-  OSD_Parallel::For(0, aNbPairTasks, aPairFunctor, !myIsMultiThread);
+    BRepExtrema_BoxPairSelector aPairSelector (theLBox1, theLBox2, myDistRef, myEps, aPairVector);
+    aPairSelector.SetBVHSets (aBoxSet1.get(), aBoxSet2.get());
+    aPairSelector.Select();
+  }
+  aTwinScope.Next(0.3);
   if (!aTwinScope.More())
   {
     return Standard_False;
   }
-  Standard_Integer aListSize = aPairFunctor.ListSize();
-  if(aListSize == 0)
+  if (aPairVector.IsEmpty())
   {
     return Standard_True;
   }
-  NCollection_Array1<BRepExtrema_CheckPair> aPairList(0, aListSize-1);
+
+  const Handle(OSD_ThreadPool)& aThreadPool = OSD_ThreadPool::DefaultPool();
+  const Standard_Integer aNbThreads = aThreadPool->NbThreads();
+
+  NCollection_Array1<BRepExtrema_CheckPair> aPairList(0, aPairVector.Size() - 1);
   Standard_Integer aListIndex(0);
-  for (Standard_Integer anI = 0; anI < aPairFunctor.PairList.Size(); ++anI)
+  for (NCollection_Vector<BRepExtrema_CheckPair>::Iterator anIt (aPairVector); anIt.More(); anIt.Next(), ++aListIndex)
   {
-    for (Standard_Integer aJ = 0; aJ < aPairFunctor.PairList[anI].Size(); ++aJ)
-    {
-      aPairList[aListIndex] = aPairFunctor.PairList[anI][aJ];
-      ++aListIndex;
-    }
+    aPairList[aListIndex] = anIt.Value();
   }
 
-  std::stable_sort(aPairList.begin(), aPairList.end(), BRepExtrema_CheckPair_Comparator);
+  // the order of traversal is not defined, so the pairs are sorted by indices
+  // in addition to distances to get the same order for any tree
+  std::sort(aPairList.begin(), aPairList.end(), BRepExtrema_CheckPair_Comparator);
 
   const Standard_Integer aMapSize = aPairList.Size();
   Standard_Integer aNbTasks = aMapSize < aNbThreads ? aMapSize : aNbThreads;
@@ -583,6 +607,11 @@ Standard_Boolean BRepExtrema_DistShapeShape::DistanceMapMap (const TopTools_Inde
   aFunctor.LBox2 = &theLBox2;
   aFunctor.Eps = myEps;
   aFunctor.StartDist = myDistRef;
+  aFunctor.BestDist = myDistRef;
+  if (myIsMultiThread)
+  {
+    aFunctor.Mutex.reset(new Standard_HMutex());
+  }
 
   OSD_Parallel::For(0, aNbTasks, aFunctor, !myIsMultiThread);
   if (!aTwinScope.More())
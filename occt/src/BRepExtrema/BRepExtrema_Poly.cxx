@@ -23,6 +23,7 @@
 #include <Precision.hxx>
 #include <Poly_Triangulation.hxx>
 #include <TColgp_Array1OfPnt.hxx>
+#include <gp_XYZBatch.hxx>
 
 //=======================================================================
 //function : Distance
@@ -106,20 +107,18 @@ Standard_Boolean BRepExtrema_Poly::Distance (const TopoDS_Shape& S1, const TopoD
     }
   }
 
-  Standard_Integer i1,i2;
+  // the nearest node of the second shape is searched in batch
+  const gp_XYZBatch aBatch2 (TP2);
+  Standard_Integer i1, i2;
   for (i1 = 1; i1 <= nbn1; i1++)
   {
     const gp_Pnt& PP1 = TP1(i1);
-    for (i2 = 1; i2 <= nbn2; i2++)
+    const Standard_Real dCur = Sqrt (aBatch2.MinSquareDistance (PP1.XYZ(), i2));
+    if (dist > dCur)
     {
-      const gp_Pnt& PP2 = TP2(i2);
-      const Standard_Real dCur = PP1.Distance(PP2);
-      if (dist > dCur)
-      {
-        P1 = PP1;
-        P2 = PP2;
-        dist = dCur;
-      }
+      P1 = PP1;
+      P2 = TP2(i2 + 1);
+      dist = dCur;
     }
   }
   return Standard_True;
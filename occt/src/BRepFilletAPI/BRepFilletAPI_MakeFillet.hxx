@@ -73,6 +73,13 @@ public:
   //! and support'faces.
   Standard_EXPORT void SetContinuity (const GeomAbs_Shape InternalContinuity, const Standard_Real AngularTolerance);
   
+  //! Sets the flag of parallel processing of the  fillets
+  //! (see ChFi3d_Builder::SetRunParallel()).
+  void SetRunParallel (const Standard_Boolean theIsParallel) { myBuilder.SetRunParallel (theIsParallel); }
+  
+  //! Returns the flag of parallel processing.
+  Standard_Boolean RunParallel() const { return myBuilder.RunParallel(); }
+  
   //! Adds a  fillet contour in  the  builder  (builds a
   //! contour  of tangent edges).
   //! The Radius must be set after.
@@ -27,6 +27,8 @@
 #include <BRep_Tool.hxx>  
 #include <TopTools_MapOfShape.hxx>
 #include <BRepCheck_Shell.hxx>
+#include <NCollection_Vector.hxx>
+#include <OSD_Parallel.hxx>
 
 #ifdef OCCT_DEBUG
 static Standard_Integer AffichEps = 0;
@@ -110,195 +112,224 @@ void  BRepGProp::LinearProperties(const TopoDS_Shape& S, GProp_GProps& SProps, c
   }
 }
 
-static Standard_Real surfaceProperties(const TopoDS_Shape& S, GProp_GProps& Props, const Standard_Real Eps, const Standard_Boolean SkipShared,
-                                       const Standard_Boolean UseTriangulation)
+namespace
 {
-  Standard_Integer i;
-#ifdef OCCT_DEBUG
-  Standard_Integer iErrorMax = 0;
-#endif
-  Standard_Real ErrorMax = 0.0, Error;
-  TopExp_Explorer ex; 
-  gp_Pnt P(roughBaryCenter(S));
-  BRepGProp_Sinert G;  G.SetLocation(P);
-  BRepGProp_MeshProps MG(BRepGProp_MeshProps::Sinert);  
-  MG.SetLocation(P);
-
-  BRepGProp_Face   BF;
-  BRepGProp_Domain BD;
-  TopTools_MapOfShape aFMap;
-  TopLoc_Location aLocDummy;
+  //! Face to be integrated and its partial properties.
+  struct BRepGProp_FaceItem
+  {
+    TopoDS_Face      Face;
+    GProp_GProps     Props;
+    Standard_Real    Error;
+    Standard_Boolean IsDone;
+    Standard_Boolean IsCached;
+  };
+
+  typedef NCollection_Vector<BRepGProp_FaceItem> BRepGProp_VectorOfFaceItem;
+
+  //! Integrates the face by the exact geometry with the inertia tool
+  //! BRepGProp_Sinert or BRepGProp_Vinert.
+  template<class TheInertTool>
+  Standard_Real integrateFace (const TopoDS_Face&  theFace,
+                               const gp_Pnt&       theLoc,
+                               const Standard_Real theEps,
+                               GProp_GProps&       theProps)
+  {
+    BRepGProp_Face   aPropFace (theFace);
+    BRepGProp_Domain aPropDomain;
+    const Standard_Boolean isNatRestr = (theFace.NbChildren() == 0);
+    if (!isNatRestr)
+    {
+      aPropDomain.Init (theFace);
+    }
 
-  for (ex.Init(S, TopAbs_FACE), i = 1; ex.More(); ex.Next(), i++) {
-    const TopoDS_Face& F = TopoDS::Face(ex.Current());
-    if (SkipShared && !aFMap.Add(F))
+    TheInertTool anInert;
+    anInert.SetLocation (theLoc);
+    Standard_Real anError = 0.0;
+    if (theEps < 1.0)
     {
-      continue;
+      anInert.Perform (aPropFace, aPropDomain, theEps);
+      anError = anInert.GetEpsilon();
     }
+    else if (isNatRestr)
+    {
+      anInert.Perform (aPropFace);
+    }
+    else
+    {
+      anInert.Perform (aPropFace, aPropDomain);
+    }
+    theProps = anInert;
+    return anError;
+  }
 
-    Standard_Boolean NoSurf = Standard_False, NoTri = Standard_False;
+  //! Computes the surface or volume properties of the face relatively to the point theLoc.
+  //! Returns FALSE if the face has neither surface nor triangulation.
+  Standard_Boolean faceProperties (const TopoDS_Face& theFace,
+                                   const BRepGProp_MeshProps::BRepGProp_MeshObjType theType,
+                                   const gp_Pnt&          theLoc,
+                                   const Standard_Real    theEps,
+                                   const Standard_Boolean theUseTriangulation,
+                                   GProp_GProps&          theProps,
+                                   Standard_Real&         theError)
+  {
+    TopLoc_Location aLoc;
+    const Standard_Boolean isNoSurf = BRep_Tool::Surface (theFace, aLoc).IsNull();
+    const Handle(Poly_Triangulation)& aTri = BRep_Tool::Triangulation (theFace, aLoc);
+    const Standard_Boolean isNoTri = aTri.IsNull() || aTri->NbNodes() == 0 || aTri->NbTriangles() == 0;
+    if (isNoTri && isNoSurf)
     {
-      const Handle(Geom_Surface)& aSurf = BRep_Tool::Surface(F, aLocDummy);
-      if (aSurf.IsNull())
-      {
-        NoSurf = Standard_True;
-      }
-      const Handle(Poly_Triangulation)& aTri = BRep_Tool::Triangulation(F, aLocDummy);
-      if (aTri.IsNull() || aTri->NbNodes() == 0 || aTri->NbTriangles() == 0)
-      {
-        NoTri = Standard_True;
-      }
-      if (NoTri && NoSurf)
-      {
-        continue;
-      }
+      return Standard_False;
     }
 
-    if ((UseTriangulation && !NoTri) || (NoSurf && !NoTri))
+    theError = 0.0;
+    if ((theUseTriangulation || isNoSurf) && !isNoTri)
+    {
+      BRepGProp_MeshProps aMeshProps (theType);
+      aMeshProps.SetLocation (theLoc);
+      aMeshProps.Perform (aTri, aLoc, theFace.Orientation());
+      theProps = aMeshProps;
+    }
+    else if (theType == BRepGProp_MeshProps::Vinert)
     {
-      TopAbs_Orientation anOri = F.Orientation();
-      const Handle(Poly_Triangulation)& aTri = BRep_Tool::Triangulation(F, aLocDummy);
-      MG.Perform(aTri, aLocDummy, anOri);
-      Props.Add(MG);
+      theError = integrateFace<BRepGProp_Vinert> (theFace, theLoc, theEps, theProps);
     }
     else
     {
-      BF.Load(F);
-      Standard_Boolean IsNatRestr = (F.NbChildren() == 0);
-      if (!IsNatRestr) BD.Init(F);
-      if (Eps < 1.0) {
-        G.Perform(BF, BD, Eps);
-        Error = G.GetEpsilon();
-        if (ErrorMax < Error) {
-          ErrorMax = Error;
-#ifdef OCCT_DEBUG
-          iErrorMax = i;
-#endif
-        }
-      }
-      else {
-        if (IsNatRestr) G.Perform(BF);
-        else G.Perform(BF, BD);
-      }
-      Props.Add(G);
-#ifdef OCCT_DEBUG
-      if(AffichEps) std::cout<<"\n"<<i<<":\tEpsArea = "<< G.GetEpsilon();
-#endif
+      theError = integrateFace<BRepGProp_Sinert> (theFace, theLoc, theEps, theProps);
     }
+    return Standard_True;
   }
-#ifdef OCCT_DEBUG
-  if(AffichEps) std::cout<<"\n-----------------\n"<<iErrorMax<<":\tMaxError = "<<ErrorMax<<"\n";
-#endif
-  return ErrorMax;
-}
-void  BRepGProp::SurfaceProperties(const TopoDS_Shape& S, GProp_GProps& Props, const Standard_Boolean SkipShared,
-                                   const Standard_Boolean UseTriangulation)
-{
-  // find the origin
-  gp_Pnt P(0,0,0);
-  P.Transform(S.Location());
-  Props = GProp_GProps(P);
-  surfaceProperties(S,Props,1.0, SkipShared, UseTriangulation);
-}
-Standard_Real BRepGProp::SurfaceProperties(const TopoDS_Shape& S, GProp_GProps& Props, const Standard_Real Eps, const Standard_Boolean SkipShared){ 
-  // find the origin
-  gp_Pnt P(0,0,0);  P.Transform(S.Location());
-  Props = GProp_GProps(P);
-  Standard_Real ErrorMax = surfaceProperties(S,Props,Eps,SkipShared, Standard_False);
-  return ErrorMax;
+
+  //! Functor integrating the faces not found in the cache.
+  class BRepGProp_FaceFunctor
+  {
+  public:
+    BRepGProp_FaceFunctor (BRepGProp_VectorOfFaceItem& theFaces,
+                           const BRepGProp_MeshProps::BRepGProp_MeshObjType theType,
+                           const gp_Pnt&          theLoc,
+                           const Standard_Real    theEps,
+                           const Standard_Boolean theUseTriangulation)
+    : myFaces (theFaces),
+      myType  (theType),
+      myLoc   (theLoc),
+      myEps   (theEps),
+      myUseTriangulation (theUseTriangulation)
+    {}
+
+    void operator() (const Standard_Integer theIndex) const
+    {
+      BRepGProp_FaceItem& anItem = myFaces.ChangeValue (theIndex);
+      if (!anItem.IsCached)
+      {
+        anItem.IsDone = faceProperties (anItem.Face, myType, myLoc, myEps, myUseTriangulation,
+                                        anItem.Props, anItem.Error);
+      }
+    }
+
+  private:
+    BRepGProp_FaceFunctor& operator= (const BRepGProp_FaceFunctor&);
+
+  private:
+    BRepGProp_VectorOfFaceItem& myFaces;
+    BRepGProp_MeshProps::BRepGProp_MeshObjType myType;
+    gp_Pnt                      myLoc;
+    Standard_Real               myEps;
+    Standard_Boolean            myUseTriangulation;
+  };
 }
 
 //=======================================================================
-//function : volumeProperties
-//purpose  : 
+//function : facesProperties
+//purpose  : Computes the surface or volume properties of the faces of the shape.
+//           The faces are integrated independently (in parallel, if requested),
+//           then their properties are brought together in the order of exploration
+//           to make the result independent on the number of threads.
 //=======================================================================
-
-static Standard_Real volumeProperties(const TopoDS_Shape& S, GProp_GProps& Props, const Standard_Real Eps, const Standard_Boolean SkipShared,
-                                      const Standard_Boolean UseTriangulation)
+static Standard_Real facesProperties (const TopoDS_Shape& S, GProp_GProps& Props,
+                                      const BRepGProp_MeshProps::BRepGProp_MeshObjType theType,
+                                      const Standard_Real Eps, const Standard_Boolean SkipShared,
+                                      const Standard_Boolean UseTriangulation,
+                                      const Standard_Boolean theIsParallel,
+                                      const Handle(BRepGProp_FacePropsCache)& theCache)
 {
-  Standard_Integer i;
-#ifdef OCCT_DEBUG
-  Standard_Integer iErrorMax = 0;
-#endif
-  Standard_Real ErrorMax = 0.0, Error = 0.0;
-  TopExp_Explorer ex; 
-  gp_Pnt P(roughBaryCenter(S)); 
-  BRepGProp_Vinert G;  G.SetLocation(P);
-  BRepGProp_MeshProps MG(BRepGProp_MeshProps::Vinert);
-  MG.SetLocation(P);
-
-  BRepGProp_Face   BF;
-  BRepGProp_Domain BD;
-  TopTools_MapOfShape aFwdFMap;
-  TopTools_MapOfShape aRvsFMap;
-  TopLoc_Location aLocDummy;
-
-  for (ex.Init(S,TopAbs_FACE), i = 1; ex.More(); ex.Next(), i++) {
-    const TopoDS_Face& F = TopoDS::Face(ex.Current());
-    TopAbs_Orientation anOri = F.Orientation();
-    Standard_Boolean isFwd = anOri == TopAbs_FORWARD;
-    Standard_Boolean isRvs = Standard_False;
-    if(!isFwd)
+  gp_Pnt P;
+  if (theCache.IsNull())
+  {
+    P = roughBaryCenter (S);
+  }
+  else
+  {
+    if (!theCache->HasLocation())
     {
-      isRvs = anOri == TopAbs_REVERSED;
+      theCache->SetLocation (roughBaryCenter (S));
     }
-    if(SkipShared)
+    P = theCache->Location();
+  }
+
+  const Standard_Boolean isVolume = (theType == BRepGProp_MeshProps::Vinert);
+  BRepGProp_VectorOfFaceItem aFaces;
+  TopTools_MapOfShape aFwdFMap;
+  TopTools_MapOfShape aRvsFMap;
+  for (TopExp_Explorer ex (S, TopAbs_FACE); ex.More(); ex.Next())
+  {
+    const TopoDS_Face& F = TopoDS::Face (ex.Current());
+    const TopAbs_Orientation anOri = F.Orientation();
+    if (isVolume)
     {
-      if((isFwd && !aFwdFMap.Add(F)) || (isRvs && !aRvsFMap.Add(F)))
+      // only the faces bounding the volume are taken into account
+      if (anOri != TopAbs_FORWARD && anOri != TopAbs_REVERSED)
       {
         continue;
       }
-    }
-    Standard_Boolean NoSurf = Standard_False, NoTri = Standard_False;
-    {
-      const Handle(Geom_Surface)& aSurf = BRep_Tool::Surface (F, aLocDummy);
-      if (aSurf.IsNull())
-      {
-        NoSurf = Standard_True;
-      }
-      const Handle(Poly_Triangulation)& aTri = BRep_Tool::Triangulation(F, aLocDummy);
-      if (aTri.IsNull() || aTri->NbNodes() == 0 || aTri->NbTriangles() == 0)
-      {
-        NoTri = Standard_True;
-      }
-      if (NoTri && NoSurf)
+      if (SkipShared && !(anOri == TopAbs_FORWARD ? aFwdFMap : aRvsFMap).Add (F))
       {
         continue;
       }
     }
+    else if (SkipShared && !aFwdFMap.Add (F))
+    {
+      continue;
+    }
+
+    BRepGProp_FaceItem anItem;
+    anItem.Face     = F;
+    anItem.Error    = 0.0;
+    anItem.IsCached = !theCache.IsNull()
+                    && theCache->Find (F, theType, Eps, UseTriangulation, anItem.Props, anItem.Error);
+    anItem.IsDone   = anItem.IsCached;
+    aFaces.Append (anItem);
+  }
 
-    if (isFwd || isRvs)
+  OSD_Parallel::For (0, aFaces.Length(),
+                     BRepGProp_FaceFunctor (aFaces, theType, P, Eps, UseTriangulation),
+                     !theIsParallel);
+
+  Standard_Real ErrorMax = 0.0;
+#ifdef OCCT_DEBUG
+  Standard_Integer iErrorMax = 0;
+#endif
+  for (Standard_Integer i = 0; i < aFaces.Length(); ++i)
+  {
+    const BRepGProp_FaceItem& anItem = aFaces.Value (i);
+    if (!anItem.IsDone)
     {
-      if ((UseTriangulation && !NoTri) || (NoSurf && !NoTri))
-      {
-        const Handle(Poly_Triangulation)& aTri = BRep_Tool::Triangulation(F, aLocDummy);
-        MG.Perform(aTri, aLocDummy, anOri);
-        Props.Add(MG);
-      }
-      else
-      {
-        BF.Load(F);
-        Standard_Boolean IsNatRestr = (F.NbChildren () == 0);
-        if (!IsNatRestr) BD.Init(F);
-        if (Eps < 1.0) {
-          G.Perform(BF, BD, Eps);
-          Error = G.GetEpsilon();
-          if (ErrorMax < Error) {
-            ErrorMax = Error;
+      continue;
+    }
+
+    Props.Add (anItem.Props);
+    if (ErrorMax < anItem.Error)
+    {
+      ErrorMax = anItem.Error;
 #ifdef OCCT_DEBUG
-            iErrorMax = i;
+      iErrorMax = i + 1;
 #endif
-          }
-        }
-        else {
-          if (IsNatRestr) G.Perform(BF);
-          else G.Perform(BF, BD);
-        }
-        Props.Add(G);
+    }
 #ifdef OCCT_DEBUG
-        if(AffichEps) std::cout<<"\n"<<i<<":\tEpsVolume = "<< G.GetEpsilon();
+    if (AffichEps) std::cout << "\n" << i + 1 << ":\tEps = " << anItem.Error;
 #endif
-      }
+    if (!theCache.IsNull() && !anItem.IsCached)
+    {
+      theCache->Bind (anItem.Face, theType, Eps, UseTriangulation, anItem.Props, anItem.Error);
     }
   }
 #ifdef OCCT_DEBUG
@@ -306,24 +337,55 @@ static Standard_Real volumeProperties(const TopoDS_Shape& S, GProp_GProps& Props
 #endif
   return ErrorMax;
 }
-void  BRepGProp::VolumeProperties(const TopoDS_Shape& S, GProp_GProps& Props, const Standard_Boolean OnlyClosed, const Standard_Boolean SkipShared,
-                                  const Standard_Boolean UseTriangulation)
+
+//=======================================================================
+//function : SurfaceProperties
+//purpose  : 
+//=======================================================================
+
+void  BRepGProp::SurfaceProperties(const TopoDS_Shape& S, GProp_GProps& Props, const Standard_Boolean SkipShared,
+                                   const Standard_Boolean UseTriangulation)
+{
+  SurfaceProperties (S, Props, 1.0, SkipShared, UseTriangulation, Standard_False);
+}
+
+//=======================================================================
+//function : SurfaceProperties
+//purpose  : 
+//=======================================================================
+
+Standard_Real BRepGProp::SurfaceProperties(const TopoDS_Shape& S, GProp_GProps& Props, const Standard_Real Eps, const Standard_Boolean SkipShared){ 
+  return SurfaceProperties (S, Props, Eps, SkipShared, Standard_False, Standard_False);
+}
+
+//=======================================================================
+//function : SurfaceProperties
+//purpose  : 
+//=======================================================================
+
+Standard_Real BRepGProp::SurfaceProperties (const TopoDS_Shape& S, GProp_GProps& Props,
+                                            const Standard_Real Eps,
+                                            const Standard_Boolean SkipShared,
+                                            const Standard_Boolean UseTriangulation,
+                                            const Standard_Boolean theIsParallel,
+                                            const Handle(BRepGProp_FacePropsCache)& theCache)
 {
   // find the origin
   gp_Pnt P(0,0,0);  P.Transform(S.Location());
   Props = GProp_GProps(P);
-  if(OnlyClosed){
-    TopTools_MapOfShape aShMap;
-    TopExp_Explorer ex(S,TopAbs_SHELL);
-    for (; ex.More(); ex.Next()) {
-      const TopoDS_Shape& Sh = ex.Current();
-      if(SkipShared && !aShMap.Add(Sh))
-      {
-        continue;
-      }
-      if(BRep_Tool::IsClosed(Sh)) volumeProperties(Sh,Props,1.0,SkipShared, UseTriangulation);
-    }
-  } else volumeProperties(S,Props,1.0,SkipShared, UseTriangulation);
+  return facesProperties (S, Props, BRepGProp_MeshProps::Sinert, Eps, SkipShared,
+                          UseTriangulation, theIsParallel, theCache);
+}
+
+//=======================================================================
+//function : VolumeProperties
+//purpose  : 
+//=======================================================================
+
+void  BRepGProp::VolumeProperties(const TopoDS_Shape& S, GProp_GProps& Props, const Standard_Boolean OnlyClosed, const Standard_Boolean SkipShared,
+                                  const Standard_Boolean UseTriangulation)
+{
+  VolumeProperties (S, Props, 1.0, OnlyClosed, SkipShared, UseTriangulation, Standard_False);
 }
 
 //=======================================================================
@@ -334,39 +396,49 @@ void  BRepGProp::VolumeProperties(const TopoDS_Shape& S, GProp_GProps& Props, co
 Standard_Real BRepGProp::VolumeProperties(const TopoDS_Shape& S, GProp_GProps& Props, 
   const Standard_Real Eps, const Standard_Boolean OnlyClosed, const Standard_Boolean SkipShared)
 { 
+  return VolumeProperties (S, Props, Eps, OnlyClosed, SkipShared, Standard_False, Standard_False);
+}
+
+//=======================================================================
+//function : VolumeProperties
+//purpose  : 
+//=======================================================================
+
+Standard_Real BRepGProp::VolumeProperties (const TopoDS_Shape& S, GProp_GProps& Props,
+                                           const Standard_Real Eps,
+                                           const Standard_Boolean OnlyClosed,
+                                           const Standard_Boolean SkipShared,
+                                           const Standard_Boolean UseTriangulation,
+                                           const Standard_Boolean theIsParallel,
+                                           const Handle(BRepGProp_FacePropsCache)& theCache)
+{
   // find the origin
   gp_Pnt P(0,0,0);  P.Transform(S.Location());
   Props = GProp_GProps(P);
-  Standard_Integer i;
-#ifdef OCCT_DEBUG
-  Standard_Integer iErrorMax = 0;
-#endif
-  Standard_Real ErrorMax = 0.0, Error = 0.0;
-  if(OnlyClosed){
-    TopTools_MapOfShape aShMap;
-    TopExp_Explorer ex(S,TopAbs_SHELL);
-    for (i = 1; ex.More(); ex.Next(), i++) {
-      const TopoDS_Shape& Sh = ex.Current();
-      if(SkipShared && !aShMap.Add(Sh))
-      {
-        continue;
-      }
-      if(BRep_Tool::IsClosed(Sh)) {
-        Error = volumeProperties(Sh,Props,Eps,SkipShared, Standard_False);
-        if(ErrorMax < Error) {
-          ErrorMax = Error;
-#ifdef OCCT_DEBUG
-          iErrorMax = i;
-#endif
-        }
-      }
+  if (!OnlyClosed)
+  {
+    return facesProperties (S, Props, BRepGProp_MeshProps::Vinert, Eps, SkipShared,
+                            UseTriangulation, theIsParallel, theCache);
+  }
+
+  Standard_Real ErrorMax = 0.0;
+  TopTools_MapOfShape aShMap;
+  for (TopExp_Explorer ex (S, TopAbs_SHELL); ex.More(); ex.Next())
+  {
+    const TopoDS_Shape& Sh = ex.Current();
+    if (SkipShared && !aShMap.Add (Sh))
+    {
+      continue;
     }
-  } else ErrorMax = volumeProperties(S,Props,Eps,SkipShared, Standard_False);
-#ifdef OCCT_DEBUG
-  if(AffichEps) std::cout<<"\n\n==================="<<iErrorMax<<":\tMaxEpsVolume = "<<ErrorMax<<"\n";
-#endif
+    if (BRep_Tool::IsClosed (Sh))
+    {
+      const Standard_Real Error = facesProperties (Sh, Props, BRepGProp_MeshProps::Vinert, Eps, SkipShared,
+                                                   UseTriangulation, theIsParallel, theCache);
+      ErrorMax = Max (ErrorMax, Error);
+    }
+  }
   return ErrorMax;
-} 
+}
 
 //===========================================================================================//
 // Volume properties by Gauss-Kronrod integration
@@ -23,6 +23,7 @@
 
 #include <Standard_Boolean.hxx>
 #include <TColgp_Array1OfXYZ.hxx>
+#include <BRepGProp_FacePropsCache.hxx>
 
 class TopoDS_Shape;
 class GProp_GProps;
@@ -149,6 +150,24 @@ public:
   //! are taken into calculation only once.
   Standard_EXPORT static Standard_Real SurfaceProperties (const TopoDS_Shape& S, GProp_GProps& SProps,
                         const Standard_Real Eps, const Standard_Boolean SkipShared = Standard_False);
+
+  //! Updates <SProps> with the shape <S> as the methods above do, with the options
+  //! allowing to speed up repeated computations for large or frequently modified shapes.
+  //! Eps has the same meaning as above, value 1.0 means non-adaptive integration.
+  //! UseTriangulation gives a fast approximate mode: the triangulations of
+  //! the faces are used, if they exist, in place of the exact surfaces.
+  //! theIsParallel enables integration of the faces in parallel threads.
+  //! The properties of the faces are brought together in the order of their exploration,
+  //! so the result does not depend on the number of threads.
+  //! theCache, if not null, keeps the properties of the integrated faces, so that
+  //! only the new faces are integrated on the next call for the modified shape.
+  //! Method returns estimation of relative error reached for whole shape.
+  Standard_EXPORT static Standard_Real SurfaceProperties (const TopoDS_Shape& S, GProp_GProps& SProps,
+                                                          const Standard_Real Eps,
+                                                          const Standard_Boolean SkipShared,
+                                                          const Standard_Boolean UseTriangulation,
+                                                          const Standard_Boolean theIsParallel,
+                                                          const Handle(BRepGProp_FacePropsCache)& theCache = Handle(BRepGProp_FacePropsCache)());
   //!
   //! Computes the global volume properties of the solid
   //! S, and brings them together with the global
@@ -213,6 +232,25 @@ public:
   Standard_EXPORT static Standard_Real VolumeProperties (const TopoDS_Shape& S, GProp_GProps& VProps, 
                          const Standard_Real Eps, const Standard_Boolean OnlyClosed = Standard_False, 
                                                  const Standard_Boolean SkipShared = Standard_False);
+
+  //! Updates <VProps> with the shape <S> as the methods above do, with the options
+  //! allowing to speed up repeated computations for large or frequently modified shapes.
+  //! Eps has the same meaning as above, value 1.0 means non-adaptive integration.
+  //! UseTriangulation gives a fast approximate mode: the triangulations of
+  //! the faces are used, if they exist, in place of the exact surfaces.
+  //! theIsParallel enables integration of the faces in parallel threads.
+  //! The properties of the faces are brought together in the order of their exploration,
+  //! so the result does not depend on the number of threads.
+  //! theCache, if not null, keeps the properties of the integrated faces, so that
+  //! only the new faces are integrated on the next call for the modified shape.
+  //! Method returns estimation of relative error reached for whole shape.
+  Standard_EXPORT static Standard_Real VolumeProperties (const TopoDS_Shape& S, GProp_GProps& VProps,
+                                                         const Standard_Real Eps,
+                                                         const Standard_Boolean OnlyClosed,
+                                                         const Standard_Boolean SkipShared,
+                                                         const Standard_Boolean UseTriangulation,
+                                                         const Standard_Boolean theIsParallel,
+                                                         const Handle(BRepGProp_FacePropsCache)& theCache = Handle(BRepGProp_FacePropsCache)());
   
   //! Updates <VProps> with the shape <S>, that contains its principal properties.
   //! The volume properties of all the FORWARD and REVERSED faces in <S> are computed.
@@ -0,0 +1,137 @@
+// Created on: 2026-10-18
+//
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BRepGProp_FacePropsCache.hxx>
+
+#include <NCollection_List.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <TopTools_MapOfOrientedShape.hxx>
+
+IMPLEMENT_STANDARD_RTTIEXT(BRepGProp_FacePropsCache, Standard_Transient)
+
+//=======================================================================
+//function : BRepGProp_FacePropsCache
+//purpose  :
+//=======================================================================
+BRepGProp_FacePropsCache::BRepGProp_FacePropsCache()
+: myHasLocation (Standard_False)
+{
+}
+
+//=======================================================================
+//function : SetLocation
+//purpose  :
+//=======================================================================
+void BRepGProp_FacePropsCache::SetLocation (const gp_Pnt& theLocation)
+{
+  if (myHasLocation && myLocation.IsEqual (theLocation, 0.0))
+  {
+    return;
+  }
+
+  // the properties of the faces are not additive being
+  // computed relatively to different reference points
+  myVolumeProps.Clear();
+  mySurfaceProps.Clear();
+  myLocation    = theLocation;
+  myHasLocation = Standard_True;
+}
+
+//=======================================================================
+//function : Find
+//purpose  :
+//=======================================================================
+Standard_Boolean BRepGProp_FacePropsCache::Find (const TopoDS_Face& theFace,
+                                                 const BRepGProp_MeshProps::BRepGProp_MeshObjType theType,
+                                                 const Standard_Real theEps,
+                                                 const Standard_Boolean theUseTriangulation,
+                                                 GProp_GProps& theProps,
+                                                 Standard_Real& theError) const
+{
+  const DataMapOfFaceProps& aMap = (theType == BRepGProp_MeshProps::Vinert) ? myVolumeProps : mySurfaceProps;
+  const FaceProps* anEntry = aMap.Seek (theFace);
+  if (anEntry == NULL
+   || anEntry->Eps != theEps
+   || anEntry->UseTriangulation != theUseTriangulation)
+  {
+    return Standard_False;
+  }
+
+  theProps = anEntry->Props;
+  theError = anEntry->Error;
+  return Standard_True;
+}
+
+//=======================================================================
+//function : Bind
+//purpose  :
+//=======================================================================
+void BRepGProp_FacePropsCache::Bind (const TopoDS_Face& theFace,
+                                     const BRepGProp_MeshProps::BRepGProp_MeshObjType theType,
+                                     const Standard_Real theEps,
+                                     const Standard_Boolean theUseTriangulation,
+                                     const GProp_GProps& theProps,
+                                     const Standard_Real theError)
+{
+  FaceProps anEntry;
+  anEntry.Props            = theProps;
+  anEntry.Eps              = theEps;
+  anEntry.Error            = theError;
+  anEntry.UseTriangulation = theUseTriangulation;
+
+  changeMap (theType).Bind (theFace, anEntry);
+}
+
+//=======================================================================
+//function : RemoveUnused
+//purpose  :
+//=======================================================================
+void BRepGProp_FacePropsCache::RemoveUnused (const TopoDS_Shape& theShape)
+{
+  TopTools_MapOfOrientedShape aFaces;
+  for (TopExp_Explorer anExp (theShape, TopAbs_FACE); anExp.More(); anExp.Next())
+  {
+    aFaces.Add (anExp.Current());
+  }
+
+  DataMapOfFaceProps* aMaps[2] = { &myVolumeProps, &mySurfaceProps };
+  for (Standard_Integer aMapIt = 0; aMapIt < 2; ++aMapIt)
+  {
+    NCollection_List<TopoDS_Shape> anUnused;
+    for (DataMapOfFaceProps::Iterator anIt (*aMaps[aMapIt]); anIt.More(); anIt.Next())
+    {
+      if (!aFaces.Contains (anIt.Key()))
+      {
+        anUnused.Append (anIt.Key());
+      }
+    }
+    for (NCollection_List<TopoDS_Shape>::Iterator anIt (anUnused); anIt.More(); anIt.Next())
+    {
+      aMaps[aMapIt]->UnBind (anIt.Value());
+    }
+  }
+}
+
+//=======================================================================
+//function : Clear
+//purpose  :
+//=======================================================================
+void BRepGProp_FacePropsCache::Clear()
+{
+  myVolumeProps.Clear();
+  mySurfaceProps.Clear();
+  myHasLocation = Standard_False;
+}
@@ -0,0 +1,117 @@
+// Created on: 2026-10-18
+//
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BRepGProp_FacePropsCache_HeaderFile
+#define _BRepGProp_FacePropsCache_HeaderFile
+
+#include <BRepGProp_MeshProps.hxx>
+#include <NCollection_DataMap.hxx>
+#include <Standard_Transient.hxx>
+#include <TopoDS_Face.hxx>
+#include <TopTools_OrientedShapeMapHasher.hxx>
+
+//! Cache of the global properties of individual faces used by
+//! BRepGProp::SurfaceProperties() and BRepGProp::VolumeProperties().
+//!
+//! Entries are keyed by the face (TShape, location and orientation), by the
+//! kind of properties and by the requested precision, so that on repeated
+//! computations for a locally modified shape only the new faces are integrated.
+//! All properties stored in the cache are computed relatively to the same
+//! reference point, which is defined from the first shape processed with it.
+//!
+//! The cache assumes that the geometry and triangulation of a TShape are not
+//! modified in place; if they are, the cache should be cleared.
+class BRepGProp_FacePropsCache : public Standard_Transient
+{
+public:
+
+  //! Creates an empty cache.
+  Standard_EXPORT BRepGProp_FacePropsCache();
+
+  //! Returns TRUE if the reference point of the cache is defined.
+  Standard_Boolean HasLocation() const { return myHasLocation; }
+
+  //! Returns the reference point of the cached properties.
+  const gp_Pnt& Location() const { return myLocation; }
+
+  //! Sets the reference point of the cached properties.
+  //! The cache is cleared if the point differs from the current one.
+  Standard_EXPORT void SetLocation (const gp_Pnt& theLocation);
+
+  //! Looks for the properties of the face computed with the given parameters.
+  //! @param theFace  [in] the face
+  //! @param theType  [in] kind of properties (volume or surface)
+  //! @param theEps   [in] precision of the integration (1.0 for non-adaptive one)
+  //! @param theUseTriangulation [in] flag of preferable use of the face triangulation
+  //! @param theProps  [out] found properties
+  //! @param theError  [out] error of the integration reached for the face
+  //! @return TRUE if the properties are found
+  Standard_EXPORT Standard_Boolean Find (const TopoDS_Face& theFace,
+                                         const BRepGProp_MeshProps::BRepGProp_MeshObjType theType,
+                                         const Standard_Real theEps,
+                                         const Standard_Boolean theUseTriangulation,
+                                         GProp_GProps& theProps,
+                                         Standard_Real& theError) const;
+
+  //! Stores the properties of the face computed with the given parameters,
+  //! replacing the ones computed for the face with other parameters.
+  Standard_EXPORT void Bind (const TopoDS_Face& theFace,
+                             const BRepGProp_MeshProps::BRepGProp_MeshObjType theType,
+                             const Standard_Real theEps,
+                             const Standard_Boolean theUseTriangulation,
+                             const GProp_GProps& theProps,
+                             const Standard_Real theError);
+
+  //! Removes the entries of the faces not contained in the given shape.
+  Standard_EXPORT void RemoveUnused (const TopoDS_Shape& theShape);
+
+  //! Removes all entries and the reference point.
+  Standard_EXPORT void Clear();
+
+  //! Returns the number of cached entries.
+  Standard_Integer Extent() const { return myVolumeProps.Extent() + mySurfaceProps.Extent(); }
+
+  DEFINE_STANDARD_RTTIEXT(BRepGProp_FacePropsCache, Standard_Transient)
+
+private:
+
+  //! Cached properties of one face.
+  struct FaceProps
+  {
+    GProp_GProps     Props;
+    Standard_Real    Eps;
+    Standard_Real    Error;
+    Standard_Boolean UseTriangulation;
+  };
+
+  typedef NCollection_DataMap<TopoDS_Shape, FaceProps, TopTools_OrientedShapeMapHasher> DataMapOfFaceProps;
+
+  //! Returns the map for the given kind of properties.
+  DataMapOfFaceProps& changeMap (const BRepGProp_MeshProps::BRepGProp_MeshObjType theType)
+  {
+    return theType == BRepGProp_MeshProps::Vinert ? myVolumeProps : mySurfaceProps;
+  }
+
+private:
+
+  DataMapOfFaceProps myVolumeProps;
+  DataMapOfFaceProps mySurfaceProps;
+  gp_Pnt             myLocation;
+  Standard_Boolean   myHasLocation;
+};
+
+DEFINE_STANDARD_HANDLE(BRepGProp_FacePropsCache, Standard_Transient)
+
+#endif // _BRepGProp_FacePropsCache_HeaderFile
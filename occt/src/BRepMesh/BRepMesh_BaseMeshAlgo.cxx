@@ -240,6 +240,17 @@ void BRepMesh_BaseMeshAlgo::commitSurfaceTriangulation()
   }
 
   collectNodes(aTriangulation);
+  if (myParameters.CompactStorage)
+  {
+    aTriangulation->Compact();
+  }
+
+  if (!myParameters.TriangulationSink.IsNull())
+  {
+    // Nodes are already defined in coordinate system of the shape.
+    myParameters.TriangulationSink->Add(myDFace->GetFace(), aTriangulation, TopLoc_Location());
+    return;
+  }
 
   BRepMesh_ShapeTool::AddInFace(myDFace->GetFace(), aTriangulation);
 }
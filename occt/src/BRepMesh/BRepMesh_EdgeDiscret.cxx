@@ -24,6 +24,7 @@
 #include <IMeshData_ParametersListArrayAdaptor.hxx>
 #include <BRepMesh_CurveTessellator.hxx>
 #include <OSD_Parallel.hxx>
+#include <TopoDS.hxx>
 
 IMPLEMENT_STANDARD_RTTIEXT(BRepMesh_EdgeDiscret, IMeshTools_ModelAlgo)
 
@@ -148,10 +149,14 @@ void BRepMesh_EdgeDiscret::process (const Standard_Integer theEdgeIndex) const
       }
       else
       {
-        const IMeshData::IPCurveHandle& aPCurve = aDEdge->GetPCurve(0);
-        const IMeshData::IFaceHandle    aDFace  = aPCurve->GetFace();
-        aEdgeTessellator = BRepMesh_EdgeDiscret::CreateEdgeTessellator(
-          aDEdge, aPCurve->GetOrientation(), aDFace, myParameters);
+        aEdgeTessellator = createAdjacentTessellationExtractor (aDEdge);
+        if (aEdgeTessellator.IsNull())
+        {
+          const IMeshData::IPCurveHandle& aPCurve = aDEdge->GetPCurve(0);
+          const IMeshData::IFaceHandle    aDFace  = aPCurve->GetFace();
+          aEdgeTessellator = BRepMesh_EdgeDiscret::CreateEdgeTessellator(
+            aDEdge, aPCurve->GetOrientation(), aDFace, myParameters);
+        }
       }
     }
     else
@@ -237,6 +242,39 @@ Standard_Real BRepMesh_EdgeDiscret::checkExistingPolygonAndUpdateStatus(
 }
 
 //=======================================================================
+// Function: createAdjacentTessellationExtractor
+// Purpose : 
+Handle(IMeshTools_CurveTessellator) BRepMesh_EdgeDiscret::createAdjacentTessellationExtractor(
+  const IMeshData::IEdgeHandle& theDEdge) const
+{
+  const TopoDS_Shape* aAdjacentFace = myAdjacentFaces.Seek (theDEdge->GetEdge ());
+  if (aAdjacentFace == NULL)
+  {
+    return Handle(IMeshTools_CurveTessellator)();
+  }
+
+  TopLoc_Location aLoc;
+  const Handle (Poly_Triangulation)& aTriangulation =
+    BRep_Tool::Triangulation (TopoDS::Face (*aAdjacentFace), aLoc);
+  if (aTriangulation.IsNull ())
+  {
+    return Handle(IMeshTools_CurveTessellator)();
+  }
+
+  const Handle (Poly_PolygonOnTriangulation)& aPolygon =
+    BRep_Tool::PolygonOnTriangulation (theDEdge->GetEdge (), aTriangulation, aLoc);
+  if (aPolygon.IsNull () || !aPolygon->HasParameters ())
+  {
+    return Handle(IMeshTools_CurveTessellator)();
+  }
+
+  // Polygon of untouched face is kept as is regardless of its deflection
+  // since the face is not going to be remeshed.
+  theDEdge->SetDeflection (Max (aPolygon->Deflection (), Precision::Confusion ()));
+  return new BRepMesh_EdgeTessellationExtractor (
+    theDEdge, theDEdge->GetPCurve (0)->GetFace (), aTriangulation, aPolygon, aLoc);
+}
+
 // Function: Tessellate3d
 // Purpose : 
 //=======================================================================
@@ -19,6 +19,7 @@
 #include <IMeshTools_ModelAlgo.hxx>
 #include <IMeshTools_Parameters.hxx>
 #include <IMeshData_Types.hxx>
+#include <TopTools_DataMapOfShapeShape.hxx>
 
 class IMeshTools_CurveTessellator;
 
@@ -54,6 +55,21 @@ public:
     const IMeshData::IEdgeHandle& theDEdge,
     const IMeshData::IFaceHandle& theDFace);
 
+  //! Sets faces adjacent to the faces of discrete model but not included into it.
+  //! Discretization of an edge bound to such face is extracted from the polygon
+  //! on its triangulation, so the joint mesh stays watertight.
+  //! @param theEdgeFaces map of boundary edges of the model to adjacent faces.
+  void SetAdjacentFaces (const TopTools_DataMapOfShapeShape& theEdgeFaces)
+  {
+    myAdjacentFaces = theEdgeFaces;
+  }
+
+  //! Returns map of boundary edges of the model to adjacent faces.
+  const TopTools_DataMapOfShapeShape& AdjacentFaces () const
+  {
+    return myAdjacentFaces;
+  }
+
   //! Functor API to discretize the given edge.
   void operator() (const Standard_Integer theEdgeIndex) const {
     process (theEdgeIndex);
@@ -92,10 +108,17 @@ private:
     const IMeshData::IEdgeHandle&   theDEdge,
     const IMeshData::IPCurveHandle& thePCurve) const;
 
+  //! Creates extractor of discretization of the edge stored in the polygon
+  //! on triangulation of adjacent face which is not a part of the model.
+  //! @return null handle if there is no adjacent face or suitable polygon.
+  Handle(IMeshTools_CurveTessellator) createAdjacentTessellationExtractor (
+    const IMeshData::IEdgeHandle& theDEdge) const;
+
 private:
 
-  Handle (IMeshData_Model) myModel;
-  IMeshTools_Parameters    myParameters;
+  Handle (IMeshData_Model)     myModel;
+  IMeshTools_Parameters        myParameters;
+  TopTools_DataMapOfShapeShape myAdjacentFaces;
 };
 
 #endif
\ No newline at end of file
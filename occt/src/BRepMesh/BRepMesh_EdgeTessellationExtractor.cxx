@@ -43,6 +43,23 @@ BRepMesh_EdgeTessellationExtractor::BRepMesh_EdgeTessellationExtractor (
   myProvider.Init (theEdge, TopAbs_FORWARD, theFace, aPolygon->Parameters ());
 }
 
+//=======================================================================
+//function : Constructor
+//purpose  : 
+//=======================================================================
+BRepMesh_EdgeTessellationExtractor::BRepMesh_EdgeTessellationExtractor (
+  const IMeshData::IEdgeHandle&               theEdge,
+  const IMeshData::IFaceHandle&               theFace,
+  const Handle(Poly_Triangulation)&           theTriangulation,
+  const Handle(Poly_PolygonOnTriangulation)&  thePolygon,
+  const TopLoc_Location&                      theLocation)
+: myTriangulation (theTriangulation.get()),
+  myIndices       (&thePolygon->Nodes ()),
+  myLoc           (theLocation)
+{
+  myProvider.Init (theEdge, TopAbs_FORWARD, theFace, thePolygon->Parameters ());
+}
+
 //=======================================================================
 //function : Constructor
 //purpose  : 
@@ -21,6 +21,9 @@
 #include <TColStd_Array1OfInteger.hxx>
 #include <TopLoc_Location.hxx>
 
+class Poly_Triangulation;
+class Poly_PolygonOnTriangulation;
+
 //! Auxiliary class implements functionality retrieving tessellated
 //! representation of an edge stored in polygon.
 class BRepMesh_EdgeTessellationExtractor : public IMeshTools_CurveTessellator
@@ -32,6 +35,21 @@ public:
     const IMeshData::IEdgeHandle& theEdge,
     const IMeshData::IFaceHandle& theFace);
 
+  //! Constructor.
+  //! Extracts tessellation from the given polygon on triangulation which may
+  //! belong to a face that is not a part of discrete model.
+  //! @param theEdge edge to be processed.
+  //! @param theFace face of discrete model the parametric values are defined for.
+  //! @param theTriangulation triangulation the polygon refers to.
+  //! @param thePolygon polygon on triangulation with parameters.
+  //! @param theLocation location of the triangulation.
+  Standard_EXPORT BRepMesh_EdgeTessellationExtractor (
+    const IMeshData::IEdgeHandle&               theEdge,
+    const IMeshData::IFaceHandle&               theFace,
+    const Handle(Poly_Triangulation)&           theTriangulation,
+    const Handle(Poly_PolygonOnTriangulation)&  thePolygon,
+    const TopLoc_Location&                      theLocation);
+
   //! Destructor.
   Standard_EXPORT virtual ~BRepMesh_EdgeTessellationExtractor ();
 
@@ -19,6 +19,10 @@
 #include <IMeshData_Edge.hxx>
 #include <IMeshTools_MeshAlgo.hxx>
 #include <OSD_Parallel.hxx>
+#include <Bnd_Box.hxx>
+#include <BRep_Tool.hxx>
+
+#include <algorithm>
 
 IMPLEMENT_STANDARD_RTTIEXT(BRepMesh_FaceDiscret, IMeshTools_ModelAlgo)
 
@@ -40,6 +44,49 @@ BRepMesh_FaceDiscret::~BRepMesh_FaceDiscret()
 {
 }
 
+namespace
+{
+  //! Returns relative complexity of meshing of a surface of the given type.
+  Standard_Real surfaceComplexity (const GeomAbs_SurfaceType theType)
+  {
+    switch (theType)
+    {
+      case GeomAbs_Plane:
+        return 1.;
+      case GeomAbs_Cylinder:
+      case GeomAbs_Cone:
+      case GeomAbs_Sphere:
+      case GeomAbs_Torus:
+        return 2.;
+      case GeomAbs_SurfaceOfRevolution:
+      case GeomAbs_SurfaceOfExtrusion:
+        return 4.;
+      default:
+        // B-spline, Bezier, offset and other free-form surfaces.
+        return 8.;
+    }
+  }
+
+  //! Orders faces by descending cost of meshing.
+  class FaceCostComparator
+  {
+  public:
+    FaceCostComparator (const std::vector<Standard_Real>& theCosts)
+    : myCosts (theCosts)
+    {
+    }
+
+    bool operator() (const Standard_Integer theFace1,
+                     const Standard_Integer theFace2) const
+    {
+      return myCosts[theFace1] > myCosts[theFace2];
+    }
+
+  private:
+    const std::vector<Standard_Real>& myCosts;
+  };
+}
+
 //! Auxiliary functor for parallel processing of Faces.
 class BRepMesh_FaceDiscret::FaceListFunctor
 {
@@ -56,22 +103,93 @@ public:
     }
   }
 
-  void operator() (const Standard_Integer theFaceIndex) const
+  //! Returns order of processing of faces; identity order is used if empty.
+  IMeshData::VectorOfInteger& ChangeOrder()
+  {
+    return myOrder;
+  }
+
+  void operator() (const Standard_Integer theIndex) const
   {
     if (!myScope.More())
     {
       return;
     }
-    Message_ProgressScope aFaceScope(myRanges[theFaceIndex], NULL, 1);
-    myAlgo->process(theFaceIndex, aFaceScope.Next());
+    const Standard_Integer aFaceIndex = myOrder.IsEmpty() ? theIndex : myOrder (theIndex);
+    Message_ProgressScope aFaceScope(myRanges[aFaceIndex], NULL, 1);
+    myAlgo->process(aFaceIndex, aFaceScope.Next());
   }
 
 private:
   mutable BRepMesh_FaceDiscret* myAlgo;
   Message_ProgressScope myScope;
   std::vector<Message_ProgressRange> myRanges;
+  IMeshData::VectorOfInteger myOrder;
 };
 
+//=======================================================================
+// Function: DispatchOrder
+// Purpose : 
+//=======================================================================
+void BRepMesh_FaceDiscret::DispatchOrder (const Handle(IMeshData_Model)& theModel,
+                                          IMeshData::VectorOfInteger&    theOrder)
+{
+  std::vector<Standard_Real>    aCosts (theModel->FacesNb());
+  std::vector<Standard_Integer> aOrder (theModel->FacesNb());
+  for (Standard_Integer aFaceIt = 0; aFaceIt < theModel->FacesNb(); ++aFaceIt)
+  {
+    aCosts[aFaceIt] = EstimateCost(theModel->GetFace(aFaceIt));
+    aOrder[aFaceIt] = aFaceIt;
+  }
+  std::stable_sort(aOrder.begin(), aOrder.end(), FaceCostComparator(aCosts));
+
+  theOrder.Clear();
+  for (std::vector<Standard_Integer>::const_iterator aFaceIt = aOrder.begin(); aFaceIt != aOrder.end(); ++aFaceIt)
+  {
+    theOrder.Append(*aFaceIt);
+  }
+}
+
+// Function: EstimateCost
+// Purpose : 
+Standard_Real BRepMesh_FaceDiscret::EstimateCost (const IMeshData::IFaceHandle& theDFace)
+{
+  if (theDFace->IsSet(IMeshData_Failure) ||
+      theDFace->IsSet(IMeshData_Reused))
+  {
+    return 0.;
+  }
+
+  // Boundary nodes are already known from edges discretization.
+  Bnd_Box aBox;
+  Standard_Real aNbNodes = 0.;
+  for (Standard_Integer aWireIt = 0; aWireIt < theDFace->WiresNb(); ++aWireIt)
+  {
+    const IMeshData::IWireHandle& aDWire = theDFace->GetWire(aWireIt);
+    for (Standard_Integer aEdgeIt = 0; aEdgeIt < aDWire->EdgesNb(); ++aEdgeIt)
+    {
+      const IMeshData::ICurveHandle& aCurve = aDWire->GetEdge(aEdgeIt)->GetCurve();
+      for (Standard_Integer aPointIt = 0; aPointIt < aCurve->ParametersNb(); ++aPointIt)
+      {
+        aBox.Add(aCurve->GetPoint(aPointIt));
+      }
+      aNbNodes += aCurve->ParametersNb();
+    }
+  }
+
+  const GeomAbs_SurfaceType aType = theDFace->GetSurface()->GetType();
+  if (aType != GeomAbs_Plane && !aBox.IsVoid())
+  {
+    // Number of interior nodes required to fit the deflection assuming
+    // curvature radius of the surface is comparable with the size of the face.
+    const Standard_Real aSize = Sqrt(aBox.SquareExtent());
+    aNbNodes += aSize / (8. * Max(theDFace->GetDeflection(), Precision::Confusion()));
+  }
+
+  // Delaunay insertion is of N*log(N) complexity.
+  return surfaceComplexity(aType) * aNbNodes * Log(aNbNodes + 2.);
+}
+
 //=======================================================================
 // Function: Perform
 // Purpose : 
@@ -89,7 +207,15 @@ Standard_Boolean BRepMesh_FaceDiscret::performInternal(
   }
 
   FaceListFunctor aFunctor(this, theRange);
-  OSD_Parallel::For(0, myModel->FacesNb(), aFunctor, !(myParameters.InParallel && myModel->FacesNb() > 1));
+  const Standard_Boolean isOneThread = !(myParameters.InParallel && myModel->FacesNb() > 1);
+  if (!isOneThread)
+  {
+    // OSD_Parallel::For() starts items in index order, so putting the most expensive
+    // faces first keeps a single heavy face from being left alone at the end
+    // (checked by test bugs/mesh/parallel_face_order).
+    DispatchOrder(myModel, aFunctor.ChangeOrder());
+  }
+  OSD_Parallel::For(0, myModel->FacesNb(), aFunctor, isOneThread);
   if (!theRange.More())
   {
     return Standard_False;
@@ -107,12 +233,24 @@ void BRepMesh_FaceDiscret::process(const Standard_Integer theFaceIndex,
                                    const Message_ProgressRange& theRange) const
 {
   const IMeshData::IFaceHandle& aDFace = myModel->GetFace(theFaceIndex);
-  if (aDFace->IsSet(IMeshData_Failure) ||
-      aDFace->IsSet(IMeshData_Reused))
+  if (aDFace->IsSet(IMeshData_Failure))
   {
     return;
   }
 
+  if (aDFace->IsSet(IMeshData_Reused))
+  {
+    if (!myParameters.TriangulationSink.IsNull())
+    {
+      // Pass existing triangulation as is.
+      TopLoc_Location aLoc;
+      const Handle(Poly_Triangulation)& aTriangulation =
+        BRep_Tool::Triangulation(aDFace->GetFace(), aLoc);
+      myParameters.TriangulationSink->Add(aDFace->GetFace(), aTriangulation, aLoc);
+    }
+    return;
+  }
+
   try
   {
     OCC_CATCH_SIGNALS
@@ -35,6 +35,18 @@ public:
   //! Destructor.
   Standard_EXPORT virtual ~BRepMesh_FaceDiscret();
 
+  //! Estimates relative computational cost of meshing of the given face
+  //! using its surface type, size, deflection and number of boundary nodes
+  //! produced by edges discretization.
+  //! Used to schedule the most expensive faces first in parallel mode.
+  Standard_EXPORT static Standard_Real EstimateCost (const IMeshData::IFaceHandle& theDFace);
+
+  //! Fills the indices of the faces of the model in order of decreasing estimated cost
+  //! (faces of equal cost keep their order in the model).
+  //! The faces are dispatched to the threads in this order in parallel mode.
+  Standard_EXPORT static void DispatchOrder (const Handle(IMeshData_Model)& theModel,
+                                             IMeshData::VectorOfInteger&    theOrder);
+
   DEFINE_STANDARD_RTTIEXT(BRepMesh_FaceDiscret, IMeshTools_ModelAlgo)
 
 protected:
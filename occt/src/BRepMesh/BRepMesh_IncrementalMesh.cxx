@@ -16,10 +16,22 @@
 
 #include <BRepMesh_IncrementalMesh.hxx>
 #include <BRepMesh_Context.hxx>
+#include <BRepMesh_EdgeDiscret.hxx>
 #include <BRepMesh_PluginMacro.hxx>
+#include <BRepMesh_ShapeTool.hxx>
+#include <BRep_Builder.hxx>
+#include <BRep_Tool.hxx>
 #include <IMeshData_Face.hxx>
 #include <IMeshData_Wire.hxx>
 #include <IMeshTools_MeshBuilder.hxx>
+#include <TopExp.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Compound.hxx>
+#include <TopTools_DataMapOfShapeShape.hxx>
+#include <TopTools_IndexedDataMapOfShapeListOfShape.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+#include <TopTools_MapOfShape.hxx>
 
 IMPLEMENT_STANDARD_RTTIEXT(BRepMesh_IncrementalMesh, BRepMesh_DiscretRoot)
 
@@ -101,7 +113,7 @@ void BRepMesh_IncrementalMesh::Perform(const Handle(IMeshTools_Context)& theCont
 {
   initParameters();
 
-  theContext->SetShape(Shape());
+  theContext->SetShape(prepareModifiedFaces(theContext));
   theContext->ChangeParameters()            = myParameters;
   theContext->ChangeParameters().CleanModel = Standard_False;
 
@@ -133,6 +145,94 @@ void BRepMesh_IncrementalMesh::Perform(const Handle(IMeshTools_Context)& theCont
   setDone();
 }
 
+//=======================================================================
+//function : prepareModifiedFaces
+//purpose  : 
+//=======================================================================
+TopoDS_Shape BRepMesh_IncrementalMesh::prepareModifiedFaces(
+  const Handle(IMeshTools_Context)& theContext)
+{
+  TopTools_DataMapOfShapeShape aAdjacentFaces;
+  Handle(BRepMesh_EdgeDiscret) aEdgeDiscret =
+    Handle(BRepMesh_EdgeDiscret)::DownCast(theContext->GetEdgeDiscret());
+  if (myModifiedFaces.IsEmpty() || Shape().IsNull())
+  {
+    if (!aEdgeDiscret.IsNull())
+    {
+      aEdgeDiscret->SetAdjacentFaces(aAdjacentFaces);
+    }
+    return Shape();
+  }
+
+  TopTools_IndexedDataMapOfShapeListOfShape aEdgeFaceMap;
+  TopExp::MapShapesAndUniqueAncestors(Shape(), TopAbs_EDGE, TopAbs_FACE, aEdgeFaceMap);
+
+  TopTools_IndexedMapOfShape aShapeFaces;
+  TopExp::MapShapes(Shape(), TopAbs_FACE, aShapeFaces);
+
+  // Collect modified faces belonging to the shape and drop their outdated mesh.
+  BRep_Builder     aBuilder;
+  TopoDS_Compound  aCompound;
+  aBuilder.MakeCompound(aCompound);
+
+  TopTools_MapOfShape aFaces;
+  for (TopTools_ListOfShape::Iterator aFaceIt(myModifiedFaces); aFaceIt.More(); aFaceIt.Next())
+  {
+    const TopoDS_Shape& aFace = aFaceIt.Value();
+    if (aFace.IsNull() || aFace.ShapeType() != TopAbs_FACE ||
+       !aShapeFaces.Contains(aFace) || !aFaces.Add(aFace))
+    {
+      continue;
+    }
+
+    aBuilder.Add(aCompound, aFace);
+
+    TopLoc_Location aLoc;
+    const Handle(Poly_Triangulation) aTriangulation =
+      BRep_Tool::Triangulation(TopoDS::Face(aFace), aLoc);
+    if (!aTriangulation.IsNull())
+    {
+      for (TopExp_Explorer aEdgeIt(aFace, TopAbs_EDGE); aEdgeIt.More(); aEdgeIt.Next())
+      {
+        BRepMesh_ShapeTool::NullifyEdge(TopoDS::Edge(aEdgeIt.Current()), aTriangulation, aLoc);
+      }
+      BRepMesh_ShapeTool::NullifyFace(TopoDS::Face(aFace));
+    }
+  }
+
+  // Bind boundary edges of modified region to untouched meshed neighbors.
+  for (TopTools_MapOfShape::Iterator aFaceIt(aFaces); aFaceIt.More(); aFaceIt.Next())
+  {
+    for (TopExp_Explorer aEdgeIt(aFaceIt.Value(), TopAbs_EDGE); aEdgeIt.More(); aEdgeIt.Next())
+    {
+      const TopoDS_Shape& aEdge = aEdgeIt.Current();
+      const TopTools_ListOfShape* aEdgeFaces = aEdgeFaceMap.Seek(aEdge);
+      if (aEdgeFaces == NULL || aAdjacentFaces.IsBound(aEdge))
+      {
+        continue;
+      }
+
+      for (TopTools_ListOfShape::Iterator aAdjIt(*aEdgeFaces); aAdjIt.More(); aAdjIt.Next())
+      {
+        const TopoDS_Face& aAdjFace = TopoDS::Face(aAdjIt.Value());
+        TopLoc_Location aLoc;
+        if (!aFaces.Contains(aAdjFace) &&
+            !BRep_Tool::Triangulation(aAdjFace, aLoc).IsNull())
+        {
+          aAdjacentFaces.Bind(aEdge, aAdjFace);
+          break;
+        }
+      }
+    }
+  }
+
+  if (!aEdgeDiscret.IsNull())
+  {
+    aEdgeDiscret->SetAdjacentFaces(aAdjacentFaces);
+  }
+  return aCompound;
+}
+
 //=======================================================================
 //function : Discret
 //purpose  :
@@ -17,6 +17,7 @@
 #include <BRepMesh_DiscretRoot.hxx>
 #include <IMeshTools_Context.hxx>
 #include <Standard_NumericError.hxx>
+#include <TopTools_ListOfShape.hxx>
 
 //! Builds the mesh of a shape with respect of their 
 //! correctly triangulated parts 
@@ -59,6 +60,27 @@ public: //! @name mesher API
   //! Performs meshing using custom context;
   Standard_EXPORT void Perform(const Handle(IMeshTools_Context)& theContext,
                                const Message_ProgressRange& theRange = Message_ProgressRange());
+
+public: //! @name incremental re-meshing of modified faces.
+
+  //! Sets faces of the shape modified since its previous meshing.
+  //! When the list is not empty, Perform() builds discrete model only for these
+  //! faces and their boundary edges instead of the whole shape. Triangulations of
+  //! the given faces are dropped and recomputed, while the remaining faces are kept
+  //! untouched: discretization of an edge shared with such a face is taken from its
+  //! Poly_PolygonOnTriangulation, so the seams of the joint mesh stay watertight.
+  //! Note that in relative mode deflection is evaluated against the size of
+  //! the modified region rather than the whole shape.
+  void SetModifiedFaces (const TopTools_ListOfShape& theFaces)
+  {
+    myModifiedFaces = theFaces;
+  }
+
+  //! Returns faces to be re-meshed in incremental mode.
+  const TopTools_ListOfShape& ModifiedFaces() const
+  {
+    return myModifiedFaces;
+  }
   
 public: //! @name accessing to parameters.
 
@@ -118,6 +140,13 @@ private:
     }
   }
 
+  //! Prepares the context for incremental re-meshing of modified faces.
+  //! Drops outdated triangulations of modified faces and passes their untouched
+  //! neighbors to edge discretization algorithm.
+  //! @return compound of modified faces to be meshed or the whole shape
+  //! if incremental mode is not requested.
+  TopoDS_Shape prepareModifiedFaces (const Handle(IMeshTools_Context)& theContext);
+
 public: //! @name plugin API
 
   //! Plugin interface for the Mesh Factories.
@@ -144,6 +173,7 @@ public: //! @name plugin API
 protected:
 
   IMeshTools_Parameters myParameters;
+  TopTools_ListOfShape  myModifiedFaces;
   Standard_Boolean      myModified;
   Standard_Integer      myStatus;
 };
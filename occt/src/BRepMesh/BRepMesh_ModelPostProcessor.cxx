@@ -235,6 +235,12 @@ Standard_Boolean BRepMesh_ModelPostProcessor::performInternal(
     return Standard_False;
   }
 
+  if (!theParameters.TriangulationSink.IsNull())
+  {
+    // Triangulations have been passed to the sink, nothing to commit.
+    return Standard_True;
+  }
+
   // TODO: Force single threaded solution due to data races on edges sharing the same TShape
   OSD_Parallel::For (0, theModel->EdgesNb(), PolygonCommitter (theModel), Standard_True/*!theParameters.InParallel*/);
 
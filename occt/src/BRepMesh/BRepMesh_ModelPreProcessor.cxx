@@ -36,9 +36,11 @@ namespace
   public:
     //! Constructor
     TriangulationConsistency(const Handle(IMeshData_Model)& theModel,
-                             const Standard_Boolean theAllowQualityDecrease)
+                             const Standard_Boolean theAllowQualityDecrease,
+                             const Standard_Boolean theCompactStorage)
       : myModel (theModel)
       , myAllowQualityDecrease (theAllowQualityDecrease)
+      , myCompactStorage (theCompactStorage)
     {
     }
 
@@ -70,6 +72,21 @@ namespace
                                              aDFace->GetDeflection(),
                                              myAllowQualityDecrease);
 
+        // compact visualization mesh is not reused when full precision mesh is requested,
+        // other single precision triangulations are kept as before;
+        // only compact mesh is reused when compact storage is requested
+        if (isTriangulationConsistent && !myCompactStorage)
+        {
+          isTriangulationConsistent = !aTriangulation->IsQuantizedUVNodes()
+                                   && !aTriangulation->IsOctEncodedNormals();
+        }
+        else if (isTriangulationConsistent)
+        {
+          isTriangulationConsistent = !aTriangulation->IsDoublePrecision()
+                                   &&  aTriangulation->IsOctEncodedNormals()
+                                   && (aTriangulation->IsQuantizedUVNodes() || !aTriangulation->HasUVNodes());
+        }
+
         if (isTriangulationConsistent)
         {
           // #25080: check that indices of links forming triangles are in range.
@@ -102,6 +119,7 @@ namespace
 
     Handle(IMeshData_Model) myModel;
     Standard_Boolean myAllowQualityDecrease; //!< Flag used for consistency check
+    Standard_Boolean myCompactStorage;       //!< Flag requiring compact triangulation
   };
 
   //! Adds additional points to seam edges on specific surfaces.
@@ -311,7 +329,13 @@ Standard_Boolean BRepMesh_ModelPreProcessor::performInternal(
   const Standard_Integer aFacesNb    = theModel->FacesNb();
   const Standard_Boolean isOneThread = !theParameters.InParallel;
   OSD_Parallel::For(0, aFacesNb, SeamEdgeAmplifier        (theModel, theParameters),                      isOneThread);
-  OSD_Parallel::For(0, aFacesNb, TriangulationConsistency (theModel, theParameters.AllowQualityDecrease), isOneThread);
+  OSD_Parallel::For(0, aFacesNb, TriangulationConsistency (theModel, theParameters.AllowQualityDecrease, theParameters.CompactStorage), isOneThread);
+
+  if (!theParameters.TriangulationSink.IsNull())
+  {
+    // Results are not going to be stored in the shape, keep it untouched.
+    return Standard_True;
+  }
 
   // Clean edges and faces from outdated polygons.
   Handle(NCollection_IncAllocator) aTmpAlloc(new NCollection_IncAllocator(IMeshData::MEMORY_BLOCK_SIZE_HUGE));
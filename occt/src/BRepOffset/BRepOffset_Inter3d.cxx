@@ -45,6 +45,9 @@
 #include <BOPTools_BoxTree.hxx>
 //
 #include <BOPTools_AlgoTools.hxx>
+#include <NCollection_Vector.hxx>
+#include <OSD_Parallel.hxx>
+#include <Standard_ErrorHandler.hxx>
 
 //=======================================================================
 //function : BRepOffset_Inter3d
@@ -55,7 +58,8 @@ BRepOffset_Inter3d::BRepOffset_Inter3d(const Handle(BRepAlgo_AsDes)& AsDes,
                                        const Standard_Real           Tol)
 :myAsDes(AsDes),
 mySide(Side),
-myTol(Tol)
+myTol(Tol),
+myIsParallel(Standard_False)
 {
 }
 
@@ -400,6 +404,146 @@ void BRepOffset_Inter3d::ConnexIntByArc(const TopTools_ListOfShape& /*SetOfFaces
 }
 
 
+namespace
+{
+  //! Pair of the extended offset faces to be intersected in ConnexIntByInt().
+  struct BRepOffset_FacesToIntersect
+  {
+    TopoDS_Shape         Shape;      //!< edge or vertex connecting the initial faces
+    TopoDS_Edge          Edge;       //!< connecting edge (null for the vertex)
+    TopoDS_Face          F1, F2;     //!< initial faces
+    TopoDS_Face          NF1, NF2;   //!< extended offset faces
+    TopAbs_State         Side;       //!< side of the intersection
+    Standard_Boolean     IsComputed; //!< flag of the intersection computed in advance
+    TopTools_ListOfShape LInt1, LInt2;
+  };
+
+  //! Functor intersecting the pairs of unbounded planar faces in parallel threads.
+  class BRepOffset_PlanesInterFunctor
+  {
+  public:
+
+    BRepOffset_PlanesInterFunctor (NCollection_Vector<BRepOffset_FacesToIntersect>& thePairs,
+                                   const NCollection_Vector<Standard_Integer>& theIndices)
+    : myPairs (thePairs),
+      myIndices (theIndices)
+    {}
+
+    void operator() (const Standard_Integer theIndex) const
+    {
+      BRepOffset_FacesToIntersect& aPair = myPairs.ChangeValue (myIndices.Value (theIndex));
+      try
+      {
+        OCC_CATCH_SIGNALS
+        BRepOffset_Tool::Inter3D (aPair.NF1, aPair.NF2, aPair.LInt1, aPair.LInt2,
+                                  aPair.Side, aPair.Edge, aPair.F1, aPair.F2);
+        aPair.IsComputed = Standard_True;
+      }
+      catch (Standard_Failure const&)
+      {
+        // the pair will be intersected again in the main thread
+        aPair.LInt1.Clear();
+        aPair.LInt2.Clear();
+      }
+    }
+
+  private:
+    BRepOffset_PlanesInterFunctor& operator= (const BRepOffset_PlanesInterFunctor&);
+
+  private:
+    NCollection_Vector<BRepOffset_FacesToIntersect>& myPairs;
+    const NCollection_Vector<Standard_Integer>&      myIndices;
+  };
+}
+
+//=======================================================================
+//function : AddPair
+//purpose  : Registers the pair of faces, returns FALSE if it is already registered
+//=======================================================================
+static Standard_Boolean AddPair (TopTools_DataMapOfShapeListOfShape& theMPairs,
+                                 const TopoDS_Shape& theF1,
+                                 const TopoDS_Shape& theF2)
+{
+  TopTools_ListOfShape* pLF = theMPairs.ChangeSeek (theF1);
+  if (pLF) {
+    for (TopTools_ListIteratorOfListOfShape it (*pLF); it.More(); it.Next()) {
+      if (it.Value().IsSame (theF2)) {
+        return Standard_False;
+      }
+    }
+  }
+  else {
+    pLF = theMPairs.Bound (theF1, TopTools_ListOfShape());
+  }
+  pLF->Append (theF2);
+  //
+  TopTools_ListOfShape* pLF2 = theMPairs.ChangeSeek (theF2);
+  if (!pLF2) {
+    pLF2 = theMPairs.Bound (theF2, TopTools_ListOfShape());
+  }
+  pLF2->Append (theF1);
+  return Standard_True;
+}
+
+//=======================================================================
+//function : IsUnboundedPlane
+//purpose  : Checks the face using the map of already checked faces
+//=======================================================================
+static Standard_Boolean IsUnboundedPlane (NCollection_DataMap<TopoDS_Shape, Standard_Boolean, TopTools_ShapeMapHasher>& theMFPlanes,
+                                          const TopoDS_Face& theF)
+{
+  const Standard_Boolean* pIsPlane = theMFPlanes.Seek (theF);
+  if (!pIsPlane) {
+    pIsPlane = theMFPlanes.Bound (theF, BRepOffset_Tool::IsUnboundedPlane (theF));
+  }
+  return *pIsPlane;
+}
+
+//=======================================================================
+//function : IntersectPlanesInParallel
+//purpose  : Intersects in parallel threads the pairs of unbounded planar
+//           faces which are intersected for the first time. The faces
+//           involved into other intersections (modifying the faces) are
+//           left for the serial treatment.
+//=======================================================================
+static void IntersectPlanesInParallel (const BRepOffset_Inter3d& theInter,
+                                       NCollection_Vector<BRepOffset_FacesToIntersect>& thePairs)
+{
+  TopTools_DataMapOfShapeListOfShape aMPairs;
+  NCollection_DataMap<TopoDS_Shape, Standard_Boolean, TopTools_ShapeMapHasher> aMFPlanes;
+  TopTools_MapOfShape aMFOther;
+  NCollection_Vector<Standard_Integer> aLPlanes;
+  for (Standard_Integer i = 0; i < thePairs.Length(); ++i) {
+    const BRepOffset_FacesToIntersect& aPair = thePairs.Value (i);
+    if (theInter.IsDone (aPair.NF1, aPair.NF2) ||
+        !AddPair (aMPairs, aPair.NF1, aPair.NF2)) {
+      continue;
+    }
+    //
+    if (IsUnboundedPlane (aMFPlanes, aPair.NF1) &&
+        IsUnboundedPlane (aMFPlanes, aPair.NF2)) {
+      aLPlanes.Append (i);
+    }
+    else {
+      aMFOther.Add (aPair.NF1);
+      aMFOther.Add (aPair.NF2);
+    }
+  }
+  //
+  NCollection_Vector<Standard_Integer> anIndices;
+  for (NCollection_Vector<Standard_Integer>::Iterator it (aLPlanes); it.More(); it.Next()) {
+    const BRepOffset_FacesToIntersect& aPair = thePairs.Value (it.Value());
+    if (!aMFOther.Contains (aPair.NF1) && !aMFOther.Contains (aPair.NF2)) {
+      anIndices.Append (it.Value());
+    }
+  }
+  //
+  if (anIndices.Length() > 1) {
+    BRepOffset_PlanesInterFunctor aFunctor (thePairs, anIndices);
+    OSD_Parallel::For (0, anIndices.Length(), aFunctor);
+  }
+}
+
 //=======================================================================
 //function : ConnexIntByInt
 //purpose  : 
@@ -575,13 +719,10 @@ void BRepOffset_Inter3d::ConnexIntByInt
     }
   }
   //
+  // Collect the pairs of the extended offset faces to intersect
+  NCollection_Vector<BRepOffset_FacesToIntersect> aPairs;
   aNb = VEmap.Extent();
-  Message_ProgressScope aPSInter(aPSOuter.Next(8), "Intersecting offset faces", aNb);
-  for (i = 1; i <= aNb; ++i, aPSInter.Next()) {
-    if (!aPSInter.More())
-    {
-      return;
-    }
+  for (i = 1; i <= aNb; ++i) {
     const TopoDS_Shape& aS = VEmap(i);
     //
     TopoDS_Edge E;
@@ -659,82 +800,116 @@ void BRepOffset_Inter3d::ConnexIntByInt
         NF2 = TopoDS::Face(MES(OF2));
       }
       //
-      if (!IsDone(NF1,NF2)) {
-        TopTools_ListOfShape LInt1,LInt2;
-        BRepOffset_Tool::Inter3D (NF1,NF2,LInt1,LInt2,CurSide,E,F1,F2);
-        SetDone(NF1,NF2);
-        if (!LInt1.IsEmpty()) {
-          Store (NF1,NF2,LInt1,LInt2);
-          //
-          TopoDS_Compound C;
-          B.MakeCompound(C);
-          //
-          if (Build.IsBound(aS)) {
-            const TopoDS_Shape& aSE = Build(aS);
-            TopExp_Explorer aExp(aSE, TopAbs_EDGE);
-            for (; aExp.More(); aExp.Next()) {
-              const TopoDS_Shape& aNE = aExp.Current();
-              B.Add(C, aNE);
-            }
-          }
-          //
-          it.Initialize(LInt1);
-          for (; it.More(); it.Next()) {
-            const TopoDS_Shape& aNE = it.Value();
+      BRepOffset_FacesToIntersect& aPair = aPairs.Appended();
+      aPair.Shape = aS;
+      aPair.Edge  = E;
+      aPair.F1    = F1;
+      aPair.F2    = F2;
+      aPair.NF1   = NF1;
+      aPair.NF2   = NF2;
+      aPair.Side  = CurSide;
+      aPair.IsComputed = Standard_False;
+    }
+  }
+  //
+  if (myIsParallel) {
+    IntersectPlanesInParallel (*this, aPairs);
+  }
+  //
+  Message_ProgressScope aPSInter(aPSOuter.Next(8), "Intersecting offset faces", aPairs.Length());
+  for (NCollection_Vector<BRepOffset_FacesToIntersect>::Iterator aItP (aPairs); aItP.More(); aItP.Next(), aPSInter.Next()) {
+    if (!aPSInter.More())
+    {
+      return;
+    }
+    const BRepOffset_FacesToIntersect& aPair = aItP.Value();
+    const TopoDS_Shape& aS = aPair.Shape;
+    F1  = aPair.F1;
+    F2  = aPair.F2;
+    NF1 = aPair.NF1;
+    NF2 = aPair.NF2;
+    //
+    if (!IsDone(NF1,NF2)) {
+      TopTools_ListOfShape LInt1,LInt2;
+      if (aPair.IsComputed) {
+        LInt1 = aPair.LInt1;
+        LInt2 = aPair.LInt2;
+      }
+      else {
+        BRepOffset_Tool::Inter3D (NF1,NF2,LInt1,LInt2,aPair.Side,aPair.Edge,F1,F2);
+      }
+      SetDone(NF1,NF2);
+      if (!LInt1.IsEmpty()) {
+        Store (NF1,NF2,LInt1,LInt2);
+        //
+        TopoDS_Compound C;
+        B.MakeCompound(C);
+        //
+        if (Build.IsBound(aS)) {
+          const TopoDS_Shape& aSE = Build(aS);
+          TopExp_Explorer aExp(aSE, TopAbs_EDGE);
+          for (; aExp.More(); aExp.Next()) {
+            const TopoDS_Shape& aNE = aExp.Current();
             B.Add(C, aNE);
-            //
-            // keep connection from new edge to shape from which it was created
-            TopTools_ListOfShape *pLS = &aDMIntE(aDMIntE.Add(aNE, TopTools_ListOfShape()));
-            pLS->Append(aS);
-            // keep connection to faces created the edge as well
-            TopTools_ListOfShape* pLFF = aDMIntFF.Bound(aNE, TopTools_ListOfShape());
-            pLFF->Append(F1);
-            pLFF->Append(F2);
           }
-          //
-          Build.Bind(aS,C);
-        }
-        else {
-          Failed.Append(aS);
         }
-      } else { // IsDone(NF1,NF2)
-        //  Modified by skv - Fri Dec 26 12:20:13 2003 OCC4455 Begin
-        const TopTools_ListOfShape &aLInt1 = myAsDes->Descendant(NF1);
-        const TopTools_ListOfShape &aLInt2 = myAsDes->Descendant(NF2);
-        
-        if (!aLInt1.IsEmpty()) {
-          TopoDS_Compound C;
-          B.MakeCompound(C);
+        //
+        it.Initialize(LInt1);
+        for (; it.More(); it.Next()) {
+          const TopoDS_Shape& aNE = it.Value();
+          B.Add(C, aNE);
           //
-          if (Build.IsBound(aS)) {
-            const TopoDS_Shape& aSE = Build(aS);
-            TopExp_Explorer aExp(aSE, TopAbs_EDGE);
-            for (; aExp.More(); aExp.Next()) {
-              const TopoDS_Shape& aNE = aExp.Current();
-              B.Add(C, aNE);
-            }
+          // keep connection from new edge to shape from which it was created
+          TopTools_ListOfShape *pLS = &aDMIntE(aDMIntE.Add(aNE, TopTools_ListOfShape()));
+          pLS->Append(aS);
+          // keep connection to faces created the edge as well
+          TopTools_ListOfShape* pLFF = aDMIntFF.Bound(aNE, TopTools_ListOfShape());
+          pLFF->Append(F1);
+          pLFF->Append(F2);
+        }
+        //
+        Build.Bind(aS,C);
+      }
+      else {
+        Failed.Append(aS);
+      }
+    } else { // IsDone(NF1,NF2)
+      //  Modified by skv - Fri Dec 26 12:20:13 2003 OCC4455 Begin
+      const TopTools_ListOfShape &aLInt1 = myAsDes->Descendant(NF1);
+      const TopTools_ListOfShape &aLInt2 = myAsDes->Descendant(NF2);
+      
+      if (!aLInt1.IsEmpty()) {
+        TopoDS_Compound C;
+        B.MakeCompound(C);
+        //
+        if (Build.IsBound(aS)) {
+          const TopoDS_Shape& aSE = Build(aS);
+          TopExp_Explorer aExp(aSE, TopAbs_EDGE);
+          for (; aExp.More(); aExp.Next()) {
+            const TopoDS_Shape& aNE = aExp.Current();
+            B.Add(C, aNE);
           }
+        }
+        //
+        for (it.Initialize(aLInt1) ; it.More(); it.Next()) {
+          const TopoDS_Shape &anE1 = it.Value();
           //
-          for (it.Initialize(aLInt1) ; it.More(); it.Next()) {
-            const TopoDS_Shape &anE1 = it.Value();
-            //
-            for (it1.Initialize(aLInt2) ; it1.More(); it1.Next()) {
-              const TopoDS_Shape &anE2 = it1.Value();
-              if (anE1.IsSame(anE2)) {
-                B.Add(C, anE1);
-                //
-                TopTools_ListOfShape *pLS = aDMIntE.ChangeSeek(anE1);
-                if (pLS) {
-                  pLS->Append(aS);
-                }
+          for (it1.Initialize(aLInt2) ; it1.More(); it1.Next()) {
+            const TopoDS_Shape &anE2 = it1.Value();
+            if (anE1.IsSame(anE2)) {
+              B.Add(C, anE1);
+              //
+              TopTools_ListOfShape *pLS = aDMIntE.ChangeSeek(anE1);
+              if (pLS) {
+                pLS->Append(aS);
               }
             }
           }
-          Build.Bind(aS,C);
-        }
-        else {
-          Failed.Append(aS);
         }
+        Build.Bind(aS,C);
+      }
+      else {
+        Failed.Append(aS);
       }
     }
     //  Modified by skv - Fri Dec 26 12:20:14 2003 OCC4455 End
@@ -114,6 +114,15 @@ public:
   //! Returns new edges
   TopTools_IndexedMapOfShape& NewEdges() { return myNewEdges; }
 
+  //! Sets the flag of parallel intersection of the pairs of faces in ConnexIntByInt().
+  //! Only the pairs of unbounded planar faces not involved in other intersections
+  //! are processed in parallel threads; the results are stored in AsDes tool in the
+  //! same order as in the serial mode.
+  void SetRunParallel (const Standard_Boolean theIsParallel) { myIsParallel = theIsParallel; }
+
+  //! Returns the flag of parallel intersection of the pairs of faces.
+  Standard_Boolean RunParallel() const { return myIsParallel; }
+
 private:
 
   //! Stores the intersection results into AsDes
@@ -129,5 +138,6 @@ private:
   TopTools_IndexedMapOfShape myNewEdges;
   TopAbs_State mySide;
   Standard_Real myTol;
+  Standard_Boolean myIsParallel;
 };
 #endif // _BRepOffset_Inter3d_HeaderFile
@@ -98,6 +98,9 @@
 //
 #include <BOPAlgo_MakerVolume.hxx>
 #include <BOPTools_AlgoTools.hxx>
+#include <NCollection_Array1.hxx>
+#include <OSD_Parallel.hxx>
+#include <Standard_ErrorHandler.hxx>
 
 #include <stdio.h>
 // POP for NT
@@ -591,6 +594,7 @@ static void FillContours(const TopoDS_Shape& aShape,
 //=======================================================================
 
 BRepOffset_MakeOffset::BRepOffset_MakeOffset()
+: myIsParallel (Standard_False)
 {
   myAsDes = new BRepAlgo_AsDes();
 }
@@ -622,7 +626,8 @@ mySelfInter  (SelfInter),
 myJoin       (Join),
 myThickening    (Thickening),
 myRemoveIntEdges(RemoveIntEdges),
-myDone     (Standard_False)
+myDone     (Standard_False),
+myIsParallel (Standard_False)
 {
   myAsDes = new BRepAlgo_AsDes();
   myIsLinearizationAllowed = Standard_True;
@@ -1195,6 +1200,63 @@ const TopoDS_Shape&  BRepOffset_MakeOffset::Shape() const
   return myOffsetShape;
 }
 
+namespace
+{
+  //! Functor building the offset faces in parallel threads.
+  //! The faces are built without the images of the tangential edges,
+  //! thus only the faces having no such edges should be processed.
+  class BRepOffset_OffsetFaceFunctor
+  {
+  public:
+
+    BRepOffset_OffsetFaceFunctor (const NCollection_Array1<TopoDS_Face>& theFaces,
+                                  const NCollection_Array1<Standard_Real>& theOffsets,
+                                  const Standard_Boolean theOffsetOutside,
+                                  const GeomAbs_JoinType theJoin,
+                                  NCollection_Array1<BRepOffset_Offset>& theOffsetFaces,
+                                  NCollection_Array1<Standard_Boolean>& theIsBuilt)
+    : myFaces (theFaces),
+      myOffsets (theOffsets),
+      myOffsetOutside (theOffsetOutside),
+      myJoin (theJoin),
+      myOffsetFaces (theOffsetFaces),
+      myIsBuilt (theIsBuilt)
+    {}
+
+    void operator() (const Standard_Integer theIndex) const
+    {
+      if (!myIsBuilt (theIndex))
+      {
+        return;
+      }
+
+      try
+      {
+        OCC_CATCH_SIGNALS
+        const TopTools_DataMapOfShapeShape anEmptyMap;
+        myOffsetFaces.ChangeValue (theIndex).Init (myFaces (theIndex), myOffsets (theIndex),
+                                                   anEmptyMap, myOffsetOutside, myJoin);
+      }
+      catch (Standard_Failure const&)
+      {
+        // the face will be built again in the main thread
+        myIsBuilt.ChangeValue (theIndex) = Standard_False;
+      }
+    }
+
+  private:
+    BRepOffset_OffsetFaceFunctor& operator= (const BRepOffset_OffsetFaceFunctor&);
+
+  private:
+    const NCollection_Array1<TopoDS_Face>&   myFaces;
+    const NCollection_Array1<Standard_Real>& myOffsets;
+    const Standard_Boolean                   myOffsetOutside;
+    const GeomAbs_JoinType                   myJoin;
+    NCollection_Array1<BRepOffset_Offset>&   myOffsetFaces;
+    NCollection_Array1<Standard_Boolean>&    myIsBuilt;
+  };
+}
+
 //=======================================================================
 //function : MakeOffsetFaces
 //purpose  : 
@@ -1210,9 +1272,34 @@ void BRepOffset_MakeOffset::MakeOffsetFaces(BRepOffset_DataMapOfShapeOffset& the
   //
   BRepLib::SortFaces(myFaceComp, aLF);
   //
+  // The faces without tangential edges do not use the offset edges
+  // created for the other faces, thus they can be built in parallel.
+  NCollection_Array1<BRepOffset_Offset> anOffsetFaces;
+  NCollection_Array1<Standard_Boolean> anIsBuilt;
+  if (myIsParallel && aLF.Extent() > 1)
+  {
+    const Standard_Integer aNbF = aLF.Extent();
+    NCollection_Array1<TopoDS_Face> aFaces (1, aNbF);
+    NCollection_Array1<Standard_Real> anOffsets (1, aNbF);
+    anOffsetFaces.Resize (1, aNbF, Standard_False);
+    anIsBuilt.Resize (1, aNbF, Standard_False);
+    Standard_Integer anIndex = 1;
+    for (aItLF.Initialize(aLF); aItLF.More(); aItLF.Next(), ++anIndex)
+    {
+      const TopoDS_Face& aF = TopoDS::Face(aItLF.Value());
+      TopTools_ListOfShape Let;
+      myAnalyse.Edges(aF,ChFiDS_Tangential,Let);
+      aFaces (anIndex) = aF;
+      anOffsets (anIndex) = myFaceOffset.IsBound(aF) ? myFaceOffset(aF) : myOffset;
+      anIsBuilt (anIndex) = Let.IsEmpty();
+    }
+    BRepOffset_OffsetFaceFunctor aFunctor (aFaces, anOffsets, OffsetOutside, myJoin, anOffsetFaces, anIsBuilt);
+    OSD_Parallel::For (1, aNbF + 1, aFunctor);
+  }
+  //
   Message_ProgressScope aPS(theRange, "Making offset faces", aLF.Size());
   aItLF.Initialize(aLF);
-  for (; aItLF.More(); aItLF.Next(), aPS.Next()) {
+  for (Standard_Integer anIndex = 1; aItLF.More(); aItLF.Next(), aPS.Next(), ++anIndex) {
     if (!aPS.More())
     {
       myError = BRepOffset_UserBreak;
@@ -1220,7 +1307,11 @@ void BRepOffset_MakeOffset::MakeOffsetFaces(BRepOffset_DataMapOfShapeOffset& the
     }
     const TopoDS_Face& aF = TopoDS::Face(aItLF.Value());
     aCurOffset = myFaceOffset.IsBound(aF) ? myFaceOffset(aF) : myOffset;
-    BRepOffset_Offset OF(aF, aCurOffset, ShapeTgt, OffsetOutside, myJoin);
+    BRepOffset_Offset OF;
+    if (!anIsBuilt.IsEmpty() && anIsBuilt (anIndex))
+      OF = anOffsetFaces (anIndex);
+    else
+      OF.Init(aF, aCurOffset, ShapeTgt, OffsetOutside, myJoin);
     TopTools_ListOfShape Let;
     myAnalyse.Edges(aF,ChFiDS_Tangential,Let);
     TopTools_ListIteratorOfListOfShape itl(Let);    
@@ -1344,6 +1435,7 @@ void BRepOffset_MakeOffset::BuildOffsetByInter(const Message_ProgressRange& theR
   if (myOffset > 0) ExtentContext = 1;
 
   BRepOffset_Inter3d Inter3 (AsDes,Side,myTol);
+  Inter3.SetRunParallel (myIsParallel);
   // Intersection between parallel faces
   Inter3.ConnexIntByInt(myFaceComp, MapSF, myAnalyse, MES, Build, Failed,
                         aPSOuter.Next(aSteps(BuildOffsetByInter_ConnexIntByInt)), myIsPlanar);
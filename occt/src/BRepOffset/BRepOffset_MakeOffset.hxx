@@ -74,6 +74,16 @@ public:
   
   //! Changes the flag allowing the linearization
   Standard_EXPORT void AllowLinearization (const Standard_Boolean theIsAllowed);
+
+  //! Sets the flag of parallel processing. In parallel mode the offset faces
+  //! not connected to other faces by tangential edges are built in parallel
+  //! threads, as well as the intersections of the extended planar offset faces
+  //! in the mode with intersection join type. The result does not depend on
+  //! the mode. The flag is not reset by Initialize().
+  void SetRunParallel (const Standard_Boolean theIsParallel) { myIsParallel = theIsParallel; }
+
+  //! Returns the flag of parallel processing.
+  Standard_Boolean RunParallel() const { return myIsParallel; }
   
   //! Add Closing Faces,  <F>  has to be  in  the initial
   //! shape S.
@@ -264,6 +274,7 @@ private:
   BRepOffset_MakeLoops myMakeLoops;
   Standard_Boolean myIsPerformSewing; // Handle bad walls in thicksolid mode.
   Standard_Boolean myIsPlanar;
+  Standard_Boolean myIsParallel;
   TopoDS_Shape myBadShape;
   TopTools_DataMapOfShapeShape myFacePlanfaceMap;
   TopTools_ListOfShape myGenerated;
@@ -1402,18 +1402,10 @@ void BRepOffset_Tool::Inter3D(const TopoDS_Face& F1,
 
   // Check if the faces are planar and not trimmed - in this case
   // the IntTools_FaceFace intersection algorithm will be used directly.
-  BRepAdaptor_Surface aBAS1(F1, Standard_False), aBAS2(F2, Standard_False);
-  if (aBAS1.GetType() == GeomAbs_Plane &&
-      aBAS2.GetType() == GeomAbs_Plane) {
-    aBAS1.Initialize(F1, Standard_True);
-    if (IsInf(aBAS1.LastUParameter()) && IsInf(aBAS1.LastVParameter())) {
-      aBAS2.Initialize(F2, Standard_True);
-      if (IsInf(aBAS2.LastUParameter()) && IsInf(aBAS2.LastVParameter())) {
-        // Intersect the planes without pave filler
-        PerformPlanes(F1, F2, Side, L1, L2);
-        return;
-      }
-    }
+  if (IsUnboundedPlane(F1) && IsUnboundedPlane(F2)) {
+    // Intersect the planes without pave filler
+    PerformPlanes(F1, F2, Side, L1, L2);
+    return;
   }
   
   // create 3D curves on faces
@@ -4036,6 +4028,20 @@ void BRepOffset_Tool::CorrectOrientation(const TopoDS_Shape&        SI,
 
 }
 
+//=======================================================================
+//function : IsUnboundedPlane
+//purpose  : 
+//=======================================================================
+Standard_Boolean BRepOffset_Tool::IsUnboundedPlane(const TopoDS_Face& theFace)
+{
+  BRepAdaptor_Surface aBAS(theFace, Standard_False);
+  if (aBAS.GetType() != GeomAbs_Plane) {
+    return Standard_False;
+  }
+  aBAS.Initialize(theFace, Standard_True);
+  return IsInf(aBAS.LastUParameter()) && IsInf(aBAS.LastVParameter());
+}
+
 //=======================================================================
 //function : CheckNormals
 //purpose  : 
@@ -202,6 +202,12 @@ public:
                                                              const TopoDS_Face& theFace2,
                                                              const Standard_Real theTolAng = 1.e-8);
 
+  //! Returns TRUE if the face is planar and is not bounded by its edges
+  //! (e.g. the face enlarged by EnLargeFace()). The intersection of two
+  //! such faces is computed by Inter3D() without modification of the faces
+  //! and their sub-shapes, thus it can be performed concurrently.
+  Standard_EXPORT static Standard_Boolean IsUnboundedPlane (const TopoDS_Face& theFace);
+
 protected:
 
 private:
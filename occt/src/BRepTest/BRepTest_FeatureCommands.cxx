@@ -1118,12 +1118,13 @@ static Standard_Real         TheTolerance = Precision::Confusion();
 static Standard_Boolean      TheInter = Standard_False;
 static GeomAbs_JoinType      TheJoin = GeomAbs_Arc;
 static Standard_Boolean      RemoveIntEdges = Standard_False;
+static Standard_Boolean      TheRunParallel = Standard_False;
 
 Standard_Integer offsetparameter(Draw_Interpretor& di,
   Standard_Integer n, const char** a)
 {
   if (n == 1) {
-    di << " offsetparameter Tol Inter(c/p) JoinType(a/i/t) [RemoveInternalEdges(r/k)]\n";
+    di << " offsetparameter Tol Inter(c/p) JoinType(a/i/t) [RemoveInternalEdges(r/k)] [-parallel]\n";
     di << " Current Values\n";
     di << "   --> Tolerance : " << TheTolerance << "\n";
     di << "   --> TheInter  : ";
@@ -1149,11 +1150,14 @@ Standard_Integer offsetparameter(Draw_Interpretor& di,
     else {
       di << "Keep";
     }
+    di << "\n   --> Parallel : " << (TheRunParallel ? "Yes" : "No");
     di << "\n";
     //
     return 0;
   }
 
+  TheRunParallel = !strcmp(a[n - 1], "-parallel");
+  if (TheRunParallel) --n;
   if (n < 4) return 1;
   //
   TheTolerance = Draw::Atof(a[1]);
@@ -1186,6 +1190,7 @@ Standard_Integer offsetload(Draw_Interpretor&,
 
   TheOffset.Initialize(S, Of, TheTolerance, BRepOffset_Skin, TheInter, 0, TheJoin,
     Standard_False, RemoveIntEdges);
+  TheOffset.SetRunParallel(TheRunParallel);
   //------------------------------------------
   // recuperation et chargement des bouchons.
   //----------------------------------------
@@ -2564,7 +2569,8 @@ void BRepTest::FeatureCommands(Draw_Interpretor& theCommands)
     __FILE__, offsetshape, g);
 
   theCommands.Add("offsetparameter",
-    "offsetparameter Tol Inter(c/p) JoinType(a/i/t) [RemoveInternalEdges(r/k)]",
+    "offsetparameter Tol Inter(c/p) JoinType(a/i/t) [RemoveInternalEdges(r/k)] [-parallel]\n"
+    "\t\t-parallel : build the offset faces and intersect them in parallel threads",
     __FILE__, offsetparameter, g);
 
   theCommands.Add("offsetload",
@@ -44,6 +44,7 @@
 #include <DrawTrSurf.hxx>
 #include <Message.hxx>
 #include <Draw_ProgressIndicator.hxx>
+#include <NCollection_Array1.hxx>
 
 #include <stdio.h>
 
@@ -135,10 +136,24 @@ static Standard_Integer tolblend(Draw_Interpretor& di, Standard_Integer narg, co
   }
   return 1;
 }
-static Standard_Integer BLEND(Draw_Interpretor& di, Standard_Integer narg, const char** a)
+static Standard_Integer BLEND(Draw_Interpretor& di, Standard_Integer theNArg, const char** theArgs)
 {
   if(Rakk != 0) {delete Rakk; Rakk = 0;}
   printtolblend(di);
+
+  // the option of parallel processing may be given at any place
+  Standard_Boolean isParallel = Standard_False;
+  NCollection_Array1<const char*> anArgs (0, Max (theNArg - 1, 0));
+  Standard_Integer narg = 0;
+  for (Standard_Integer anArgIter = 0; anArgIter < theNArg; ++anArgIter)
+  {
+    if (!strcasecmp (theArgs[anArgIter], "-parallel"))
+      isParallel = Standard_True;
+    else
+      anArgs (narg++) = theArgs[anArgIter];
+  }
+  const char** a = &anArgs (0);
+
   if (narg<5) return 1;
   TopoDS_Shape V = DBRep::Get(a[2]);
   if(V.IsNull()) return 1;
@@ -154,6 +169,7 @@ static Standard_Integer BLEND(Draw_Interpretor& di, Standard_Integer narg, const
   Rakk = new BRepFilletAPI_MakeFillet(V,FSh);
   Rakk->SetParams(ta,t3d,t2d,t3d,t2d,fl);
   Rakk->SetContinuity(blend_cont, tapp_angle);
+  Rakk->SetRunParallel(isParallel);
   Standard_Real Rad;
   TopoDS_Edge E;
   Standard_Integer nbedge = 0;
@@ -714,7 +730,7 @@ void  BRepTest::FilletCommands(Draw_Interpretor& theCommands)
 		  tolblend,g);
 
   theCommands.Add("blend",
-		  "blend result object rad1 ed1 rad2 ed2 ... [R/Q/P]",__FILE__,
+		  "blend result object rad1 ed1 rad2 ed2 ... [R/Q/P] [-parallel]",__FILE__,
 		  BLEND,g);
 
   theCommands.Add("checkhist",
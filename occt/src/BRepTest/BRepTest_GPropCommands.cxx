@@ -26,10 +26,17 @@
 
 #include <Precision.hxx>
 
+//! Returns the cache of face properties shared by the props commands called with -cache key.
+static const Handle(BRepGProp_FacePropsCache)& propsCache()
+{
+  static const Handle(BRepGProp_FacePropsCache) THE_PROPS_CACHE = new BRepGProp_FacePropsCache();
+  return THE_PROPS_CACHE;
+}
+
 Standard_Integer props(Draw_Interpretor& di, Standard_Integer n, const char** a)
 {
   if (n < 2) {
-    di << "Use: " << a[0] << " shape [epsilon] [c[losed]] [x y z] [-skip] [-full] [-tri]\n";
+    di << "Use: " << a[0] << " shape [epsilon] [c[losed]] [x y z] [-skip] [-full] [-tri] [-parallel] [-cache]\n";
     di << "Compute properties of the shape, exact geometry (curves, surfaces) or\n";
     di << "some discrete data (polygons, triangulations) can be used for calculations\n";
     di << "The epsilon, if given, defines relative precision of computation\n";
@@ -38,10 +45,25 @@ Standard_Integer props(Draw_Interpretor& di, Standard_Integer n, const char** a)
     di << "Shared entities will be take in account only one time in the skip mode\n";
     di << "All values are outputted with the full precision in the full mode.\n";
     di << "Preferable source of geometry data are triangulations in case if it exists, if the -tri key is used.\n";
-    di << "If epsilon is given, exact geometry (curves, surfaces) are used for calculations independently of using key -tri\n\n";
+    di << "If epsilon is given, exact geometry (curves, surfaces) are used for calculations independently of using key -tri\n";
+    di << "Faces are integrated in parallel threads if the -parallel key is used.\n";
+    di << "Properties of the faces are reused from the previous calls if the -cache key is used (see propscache).\n\n";
     return 1;
   }
 
+  Standard_Boolean isUseCache = Standard_False;
+  if (n >= 2 && strcmp(a[n - 1], "-cache") == 0)
+  {
+    isUseCache = Standard_True;
+    --n;
+  }
+  Standard_Boolean isParallel = Standard_False;
+  if (n >= 2 && strcmp(a[n - 1], "-parallel") == 0)
+  {
+    isParallel = Standard_True;
+    --n;
+  }
+
   Standard_Boolean UseTriangulation = Standard_False;
   if (n >= 2 && strcmp(a[n - 1], "-tri") == 0)
   {
@@ -72,22 +94,23 @@ Standard_Integer props(Draw_Interpretor& di, Standard_Integer n, const char** a)
   if((n > 2 && *a[2]=='c') || (n > 3 && *a[3]=='c')) onlyClosed = Standard_True;
   if(n > 2 && *a[2]!='c' && n != 5) {eps = Draw::Atof (a[2]); witheps = Standard_True;}
 
+  Handle(BRepGProp_FacePropsCache) aCache = isUseCache ? propsCache() : Handle(BRepGProp_FacePropsCache)();
   if (witheps){
     if (Abs(eps) < Precision::Angular()) return 2;
     if (*a[0] == 'l')
       BRepGProp::LinearProperties(S,G,SkipShared);
     else if (*a[0] == 's')
-      eps = BRepGProp::SurfaceProperties(S,G,eps,SkipShared);
+      eps = BRepGProp::SurfaceProperties(S,G,eps,SkipShared,Standard_False,isParallel,aCache);
     else 
-      eps = BRepGProp::VolumeProperties(S,G,eps,onlyClosed,SkipShared);
+      eps = BRepGProp::VolumeProperties(S,G,eps,onlyClosed,SkipShared,Standard_False,isParallel,aCache);
   }
   else {
     if (*a[0] == 'l')
       BRepGProp::LinearProperties(S, G, SkipShared, UseTriangulation);
     else if (*a[0] == 's')
-      BRepGProp::SurfaceProperties(S, G, SkipShared, UseTriangulation);
+      BRepGProp::SurfaceProperties(S, G, 1.0, SkipShared, UseTriangulation, isParallel, aCache);
     else 
-      BRepGProp::VolumeProperties(S,G,onlyClosed,SkipShared, UseTriangulation);
+      BRepGProp::VolumeProperties(S, G, 1.0, onlyClosed, SkipShared, UseTriangulation, isParallel, aCache);
   }
   
   gp_Pnt P = G.CentreOfMass();
@@ -175,6 +198,26 @@ Standard_Integer props(Draw_Interpretor& di, Standard_Integer n, const char** a)
 }
 
 
+//=======================================================================
+//function : propscache
+//purpose  : 
+//=======================================================================
+static Standard_Integer propscache(Draw_Interpretor& di, Standard_Integer n, const char** a)
+{
+  if (n > 2 || (n == 2 && strcmp(a[1], "-clear") != 0))
+  {
+    di << "Use: " << a[0] << " [-clear]\n";
+    return 1;
+  }
+
+  di << "Cached faces: " << propsCache()->Extent() << "\n";
+  if (n == 2)
+  {
+    propsCache()->Clear();
+  }
+  return 0;
+}
+
 Standard_Integer vpropsgk(Draw_Interpretor& di, Standard_Integer n, const char** a)
 {
   if (n < 2) {
@@ -328,10 +371,12 @@ void  BRepTest::GPropCommands(Draw_Interpretor& theCommands)
   theCommands.Add("lprops",
     "lprops name [x y z] [-skip] [-full] [-tri]: compute linear properties",
     __FILE__, props, g);
-  theCommands.Add("sprops", "sprops name [epsilon] [x y z] [-skip] [-full] [-tri]:\n"
+  theCommands.Add("sprops", "sprops name [epsilon] [x y z] [-skip] [-full] [-tri] [-parallel] [-cache]:\n"
 "  compute surfacic properties", __FILE__, props, g);
-  theCommands.Add("vprops", "vprops name [epsilon] [c[losed]] [x y z] [-skip] [-full] [-tri]:\n"
+  theCommands.Add("vprops", "vprops name [epsilon] [c[losed]] [x y z] [-skip] [-full] [-tri] [-parallel] [-cache]:\n"
 "  compute volumic properties", __FILE__, props, g);
+  theCommands.Add("propscache", "propscache [-clear]: print the number of faces in the cache"
+"  of sprops/vprops -cache and clear it if -clear is given", __FILE__, propscache, g);
 
   theCommands.Add("vpropsgk",
 		  "vpropsgk name epsilon closed span mode [x y z] [-skip] : compute volumic properties",
@@ -54,6 +54,10 @@
 #include <BRepIntCurveSurface_Inter.hxx>
 #include <BRepOffset_MakeOffset.hxx>
 #include <BRepClass3d_SolidClassifier.hxx>
+#include <BRepClass3d_BatchClassifier.hxx>
+#include <BRepBndLib.hxx>
+#include <Bnd_Box.hxx>
+#include <TColgp_Array1OfPnt.hxx>
 #include <GeomAdaptor_Curve.hxx>
 #include <Message.hxx>
 
@@ -75,6 +79,7 @@ static Standard_Integer MakeBoss  (Draw_Interpretor&, Standard_Integer, const ch
 static Standard_Integer MakeShell (Draw_Interpretor&, Standard_Integer, const char** );
 static Standard_Integer xbounds   (Draw_Interpretor&, Standard_Integer, const char** );
 static Standard_Integer xclassify (Draw_Interpretor&, Standard_Integer, const char** );
+static Standard_Integer batchclassify (Draw_Interpretor&, Standard_Integer, const char** );
 
 //=======================================================================
 //function : OtherCommands
@@ -103,6 +108,13 @@ void  BRepTest::OtherCommands(Draw_Interpretor& theCommands)
   theCommands.Add("mksh", "create a shell on Shape", __FILE__, MakeShell, g);
   theCommands.Add("xbounds",  "xbounds face", __FILE__, xbounds, g);
   theCommands.Add("xclassify",  "use xclassify Solid [Tolerance=1.e-7]", __FILE__, xclassify, g);
+  theCommands.Add("batchclassify",
+                  "batchclassify solid nbx nby nbz [-tol value=1.e-7] [-serial] [-compare]"
+                  "\n\t\t: Classifies the points of the regular grid in the bounding box of the solid"
+                  "\n\t\t: by BRepClass3d_BatchClassifier and prints the numbers of points in each state."
+                  "\n\t\t: -serial  classifies the points in one thread"
+                  "\n\t\t: -compare compares the states with the ones of BRepClass3d_SolidClassifier",
+                  __FILE__, batchclassify, g);
   
 
 }
@@ -481,6 +493,116 @@ Standard_Integer xclassify (Draw_Interpretor& aDI, Standard_Integer n, const cha
   //
   return 0;
 }
+//=======================================================================
+//function : batchclassify
+//purpose  : 
+//=======================================================================
+Standard_Integer batchclassify (Draw_Interpretor& theDI, Standard_Integer theNArg, const char** theArgVec)
+{
+  if (theNArg < 5)
+  {
+    theDI.PrintHelp (theArgVec[0]);
+    return 1;
+  }
+
+  TopoDS_Shape aShape = DBRep::Get (theArgVec[1]);
+  if (aShape.IsNull())
+  {
+    theDI << "Error: " << theArgVec[1] << " is not a shape\n";
+    return 1;
+  }
+
+  const Standard_Integer aNbSteps[3] = { Draw::Atoi (theArgVec[2]),
+                                         Draw::Atoi (theArgVec[3]),
+                                         Draw::Atoi (theArgVec[4]) };
+  if (aNbSteps[0] < 1 || aNbSteps[1] < 1 || aNbSteps[2] < 1)
+  {
+    theDI << "Error: wrong number of points\n";
+    return 1;
+  }
+
+  Standard_Real aTol = 1.e-7;
+  Standard_Boolean isParallel = Standard_True, isToCompare = Standard_False;
+  for (Standard_Integer anArgIter = 5; anArgIter < theNArg; ++anArgIter)
+  {
+    TCollection_AsciiString anArg (theArgVec[anArgIter]);
+    anArg.LowerCase();
+    if (anArg == "-tol" && anArgIter + 1 < theNArg)
+    {
+      aTol = Draw::Atof (theArgVec[++anArgIter]);
+    }
+    else if (anArg == "-serial")
+    {
+      isParallel = Standard_False;
+    }
+    else if (anArg == "-compare")
+    {
+      isToCompare = Standard_True;
+    }
+    else
+    {
+      theDI << "Syntax error at '" << theArgVec[anArgIter] << "'\n";
+      return 1;
+    }
+  }
+
+  Bnd_Box aBox;
+  BRepBndLib::Add (aShape, aBox);
+  aBox.Enlarge (0.1 * Sqrt (aBox.SquareExtent()));
+  Standard_Real aXMin, aYMin, aZMin, aXMax, aYMax, aZMax;
+  aBox.Get (aXMin, aYMin, aZMin, aXMax, aYMax, aZMax);
+
+  TColgp_Array1OfPnt aPoints (1, aNbSteps[0] * aNbSteps[1] * aNbSteps[2]);
+  Standard_Integer anIndex = 1;
+  for (Standard_Integer i = 0; i < aNbSteps[0]; ++i)
+  {
+    const Standard_Real aX = aXMin + (aXMax - aXMin) * (i + 0.5) / aNbSteps[0];
+    for (Standard_Integer j = 0; j < aNbSteps[1]; ++j)
+    {
+      const Standard_Real aY = aYMin + (aYMax - aYMin) * (j + 0.5) / aNbSteps[1];
+      for (Standard_Integer k = 0; k < aNbSteps[2]; ++k)
+      {
+        const Standard_Real aZ = aZMin + (aZMax - aZMin) * (k + 0.5) / aNbSteps[2];
+        aPoints.SetValue (anIndex++, gp_Pnt (aX, aY, aZ));
+      }
+    }
+  }
+
+  BRepClass3d_BatchClassifier aClassifier (aShape, aTol);
+  aClassifier.Perform (aPoints, isParallel);
+
+  Standard_Integer aNbStates[4] = { 0, 0, 0, 0 };
+  Standard_Integer aNbMismatches = 0;
+  BRepClass3d_SolidClassifier anExactClassifier;
+  if (isToCompare)
+  {
+    anExactClassifier.Load (aShape);
+  }
+  for (Standard_Integer aPntIter = aPoints.Lower(); aPntIter <= aPoints.Upper(); ++aPntIter)
+  {
+    const TopAbs_State aState = aClassifier.State (aPntIter);
+    ++aNbStates[aState];
+    if (isToCompare)
+    {
+      anExactClassifier.Perform (aPoints (aPntIter), aTol);
+      if (anExactClassifier.State() != aState)
+      {
+        ++aNbMismatches;
+      }
+    }
+  }
+
+  theDI << "IN: " << aNbStates[TopAbs_IN] << " OUT: " << aNbStates[TopAbs_OUT]
+        << " ON: " << aNbStates[TopAbs_ON] << " UNKNOWN: " << aNbStates[TopAbs_UNKNOWN] << "\n";
+  theDI << "Mesh used: " << (aClassifier.IsMeshUsed() ? "yes" : "no")
+        << " exactly classified points: " << aClassifier.NbExactPoints() << "\n";
+  if (isToCompare)
+  {
+    theDI << "Mismatches: " << aNbMismatches << "\n";
+  }
+  return 0;
+}
+
 //=======================================================================
 //function : PrintState
 //purpose  : 
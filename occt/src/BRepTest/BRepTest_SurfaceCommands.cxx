@@ -327,6 +327,7 @@ static Standard_Integer sewing (Draw_Interpretor& theDi,
   Standard_Boolean aSameParameterMode = Standard_True;
   Standard_Boolean aFloatingEdgesMode = Standard_False;
   Standard_Boolean aFaceMode = Standard_True;
+  Standard_Boolean aRunParallel = Standard_False;
   Standard_Boolean aSetMinTol = Standard_False;
   Standard_Real aMinTol = 0.;
   Standard_Real aMaxTol = Precision::Infinite();
@@ -372,6 +373,7 @@ static Standard_Integer sewing (Draw_Interpretor& theDi,
       case 'p': aSameParameterMode = aVal; break;
       case 'e': aFloatingEdgesMode = aVal; break;
       case 'f': aFaceMode = aVal; break;
+      case 't': aRunParallel = aVal; break;
       }
     }
     else
@@ -408,6 +410,7 @@ static Standard_Integer sewing (Draw_Interpretor& theDi,
     theDi << "  p - mode for same parameter processing for edges\n";
     theDi << "  e - mode for sewing floating edges\n";
     theDi << "  f - mode for sewing faces\n";
+    theDi << "  t - mode for multi-threaded processing\n";
     return (1);
   }
     
@@ -432,6 +435,7 @@ static Standard_Integer sewing (Draw_Interpretor& theDi,
   aSewing.SetSameParameterMode (aSameParameterMode);
   aSewing.SetFloatingEdgesMode (aFloatingEdgesMode);
   aSewing.SetFaceMode (aFaceMode);
+  aSewing.SetRunParallel (aRunParallel);
   aSewing.SetMinTolerance (aMinTol);
   aSewing.SetMaxTolerance (aMaxTol);
 
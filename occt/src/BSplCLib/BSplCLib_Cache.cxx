@@ -20,6 +20,7 @@
 #include <TColgp_HArray1OfPnt2d.hxx>
 #include <TColStd_HArray2OfReal.hxx>
 
+#include <algorithm>
 
 IMPLEMENT_STANDARD_RTTIEXT(BSplCLib_Cache,Standard_Transient)
 
@@ -270,3 +271,53 @@ void BSplCLib_Cache::D3(const Standard_Real& theParameter,
   theTorsion.SetCoord(aPntDeriv[aShift], aPntDeriv[aShift + 1], aPntDeriv[aShift + 2]);
 }
 
+void BSplCLib_Cache::EvaluatePoints (const TColStd_Array1OfReal& theParameters,
+                                     const TColStd_Array1OfReal& theFlatKnots,
+                                     const TColgp_Array1OfPnt&   thePoles,
+                                     const TColStd_Array1OfReal* theWeights,
+                                     TColgp_Array1OfPnt&         thePoints,
+                                     TColgp_Array1OfVec*         theTangents)
+{
+  const Standard_Integer aNb = theParameters.Length();
+  if (aNb == 0)
+  {
+    return;
+  }
+
+  // Sort the parameters by the spans
+  NCollection_Array1<Standard_Integer> aSpans (0, aNb - 1), anOrder (0, aNb - 1);
+  for (Standard_Integer i = 0; i < aNb; ++i)
+  {
+    Standard_Real aNewParam = myParams.PeriodicNormalization (theParameters (theParameters.Lower() + i));
+    Standard_Integer aSpanIndex = 0;
+    BSplCLib::LocateParameter (myParams.Degree, theFlatKnots, BSplCLib::NoMults(),
+                               aNewParam, myParams.IsPeriodic, aSpanIndex, aNewParam);
+    aSpans (i) = aSpanIndex;
+    anOrder (i) = i;
+  }
+  std::sort (&anOrder (0), &anOrder (0) + aNb,
+             [&aSpans] (const Standard_Integer theI1, const Standard_Integer theI2)
+             {
+               return aSpans (theI1) < aSpans (theI2);
+             });
+
+  for (Standard_Integer k = 0; k < aNb; ++k)
+  {
+    const Standard_Integer i = anOrder (k);
+    const Standard_Real aParam = theParameters (theParameters.Lower() + i);
+    if (k == 0 || aSpans (i) != aSpans (anOrder (k - 1)))
+    {
+      BuildCache (aParam, theFlatKnots, thePoles, theWeights);
+    }
+
+    gp_Pnt& aPnt = thePoints (thePoints.Lower() + i);
+    if (theTangents != NULL)
+    {
+      D1 (aParam, aPnt, theTangents->ChangeValue (theTangents->Lower() + i));
+    }
+    else
+    {
+      D0 (aParam, aPnt);
+    }
+  }
+}
@@ -15,6 +15,8 @@
 #define _BSplCLib_Cache_Headerfile
 
 #include <BSplCLib_CacheParams.hxx>
+#include <TColgp_Array1OfPnt.hxx>
+#include <TColgp_Array1OfVec.hxx>
 #include <TColStd_HArray2OfReal.hxx>
 
 //! \brief A cache class for Bezier and B-spline curves.
@@ -117,6 +119,22 @@ public:
                                 gp_Vec&        theCurvature,
                                 gp_Vec&        theTorsion) const;
 
+  //! Calculates the points of the 3D curve (and the first derivatives, if the array for them is given)
+  //! for the set of parameters. The parameters are processed grouped by the spans of the curve,
+  //! so that the cache is rebuilt only once for each span containing the parameters.
+  //! After the call the cache corresponds to the span of the last processed group of parameters.
+  //! \param[in]  theParameters parameters of the points
+  //! \param[in]  theFlatKnots  knots of Bezier/B-spline curve (with repetitions)
+  //! \param[in]  thePoles      array of poles of 3D curve
+  //! \param[in]  theWeights    array of weights of corresponding poles
+  //! \param[out] thePoints     calculated points, indexed as the parameters
+  //! \param[out] theTangents   calculated first derivatives (optional), indexed as the parameters
+  Standard_EXPORT void EvaluatePoints (const TColStd_Array1OfReal& theParameters,
+                                       const TColStd_Array1OfReal& theFlatKnots,
+                                       const TColgp_Array1OfPnt&   thePoles,
+                                       const TColStd_Array1OfReal* theWeights,
+                                       TColgp_Array1OfPnt&         thePoints,
+                                       TColgp_Array1OfVec*         theTangents = NULL);
 
   DEFINE_STANDARD_RTTIEXT(BSplCLib_Cache,Standard_Transient)
 
@@ -19,9 +19,46 @@
 #include <TColgp_HArray2OfPnt.hxx>
 #include <TColStd_HArray2OfReal.hxx>
 
+#include <algorithm>
+
 
 IMPLEMENT_STANDARD_RTTIEXT(BSplSLib_Cache,Standard_Transient)
 
+namespace
+{
+  //! Returns the index of the span containing the parameter (as computed by BuildCache())
+  static Standard_Integer locateSpan (const BSplCLib_CacheParams& theParams,
+                                      const Standard_Real         theParameter,
+                                      const TColStd_Array1OfReal& theFlatKnots)
+  {
+    Standard_Real aNewParam = theParams.PeriodicNormalization (theParameter);
+    Standard_Integer aSpanIndex = 0;
+    BSplCLib::LocateParameter (theParams.Degree, theFlatKnots, BSplCLib::NoMults(),
+                               aNewParam, theParams.IsPeriodic, aSpanIndex, aNewParam);
+    return aSpanIndex;
+  }
+
+  //! Computes the spans of the parameters and the order of the parameters sorted by the spans
+  static void sortBySpans (const BSplCLib_CacheParams&           theParams,
+                           const TColStd_Array1OfReal&           theParameters,
+                           const TColStd_Array1OfReal&           theFlatKnots,
+                           NCollection_Array1<Standard_Integer>& theSpans,
+                           NCollection_Array1<Standard_Integer>& theOrder)
+  {
+    const Standard_Integer aNb = theParameters.Length();
+    for (Standard_Integer i = 0; i < aNb; ++i)
+    {
+      theSpans (i) = locateSpan (theParams, theParameters (theParameters.Lower() + i), theFlatKnots);
+      theOrder (i) = i;
+    }
+    std::sort (&theOrder (0), &theOrder (0) + aNb,
+               [&theSpans] (const Standard_Integer theI1, const Standard_Integer theI2)
+               {
+                 return theSpans (theI1) < theSpans (theI2);
+               });
+  }
+}
+
 //! Converts handle of array of Standard_Real into the pointer to Standard_Real
 static Standard_Real* ConvertArray(const Handle(TColStd_HArray2OfReal)& theHArray)
 {
@@ -340,3 +377,130 @@ void BSplSLib_Cache::D2(const Standard_Real& theU,
   theCurvatureUV.Multiply(anInvU * anInvV);
 }
 
+
+void BSplSLib_Cache::EvaluatePoints (const TColgp_Array1OfPnt2d& theUVs,
+                                     const TColStd_Array1OfReal& theFlatKnotsU,
+                                     const TColStd_Array1OfReal& theFlatKnotsV,
+                                     const TColgp_Array2OfPnt&   thePoles,
+                                     const TColStd_Array2OfReal* theWeights,
+                                     TColgp_Array1OfPnt&         thePoints,
+                                     TColgp_Array1OfVec*         theD1U,
+                                     TColgp_Array1OfVec*         theD1V)
+{
+  const Standard_Integer aNb = theUVs.Length();
+  if (aNb == 0)
+  {
+    return;
+  }
+
+  // Sort the parameters by the pairs of spans
+  NCollection_Array1<Standard_Integer> aSpansU (0, aNb - 1), aSpansV (0, aNb - 1), anOrder (0, aNb - 1);
+  for (Standard_Integer i = 0; i < aNb; ++i)
+  {
+    const gp_Pnt2d& aUV = theUVs (theUVs.Lower() + i);
+    aSpansU (i) = locateSpan (myParamsU, aUV.X(), theFlatKnotsU);
+    aSpansV (i) = locateSpan (myParamsV, aUV.Y(), theFlatKnotsV);
+    anOrder (i) = i;
+  }
+  std::sort (&anOrder (0), &anOrder (0) + aNb,
+             [&aSpansU, &aSpansV] (const Standard_Integer theI1, const Standard_Integer theI2)
+             {
+               return aSpansU (theI1) < aSpansU (theI2)
+                   || (aSpansU (theI1) == aSpansU (theI2) && aSpansV (theI1) < aSpansV (theI2));
+             });
+
+  const Standard_Boolean isD1 = theD1U != NULL || theD1V != NULL;
+  gp_Vec aD1U, aD1V;
+  for (Standard_Integer k = 0; k < aNb; ++k)
+  {
+    const Standard_Integer i = anOrder (k);
+    const gp_Pnt2d& aUV = theUVs (theUVs.Lower() + i);
+    if (k == 0 || aSpansU (i) != aSpansU (anOrder (k - 1)) || aSpansV (i) != aSpansV (anOrder (k - 1)))
+    {
+      BuildCache (aUV.X(), aUV.Y(), theFlatKnotsU, theFlatKnotsV, thePoles, theWeights);
+    }
+
+    gp_Pnt& aPnt = thePoints (thePoints.Lower() + i);
+    if (!isD1)
+    {
+      D0 (aUV.X(), aUV.Y(), aPnt);
+      continue;
+    }
+    D1 (aUV.X(), aUV.Y(), aPnt, aD1U, aD1V);
+    if (theD1U != NULL)
+    {
+      theD1U->ChangeValue (theD1U->Lower() + i) = aD1U;
+    }
+    if (theD1V != NULL)
+    {
+      theD1V->ChangeValue (theD1V->Lower() + i) = aD1V;
+    }
+  }
+}
+
+void BSplSLib_Cache::EvaluateGrid (const TColStd_Array1OfReal& theUs,
+                                   const TColStd_Array1OfReal& theVs,
+                                   const TColStd_Array1OfReal& theFlatKnotsU,
+                                   const TColStd_Array1OfReal& theFlatKnotsV,
+                                   const TColgp_Array2OfPnt&   thePoles,
+                                   const TColStd_Array2OfReal* theWeights,
+                                   TColgp_Array2OfPnt&         thePoints,
+                                   TColgp_Array2OfVec*         theD1U,
+                                   TColgp_Array2OfVec*         theD1V)
+{
+  const Standard_Integer aNbU = theUs.Length();
+  const Standard_Integer aNbV = theVs.Length();
+  if (aNbU == 0 || aNbV == 0)
+  {
+    return;
+  }
+
+  // Sort the parameters of each direction by the spans
+  NCollection_Array1<Standard_Integer> aSpansU (0, aNbU - 1), anOrderU (0, aNbU - 1);
+  NCollection_Array1<Standard_Integer> aSpansV (0, aNbV - 1), anOrderV (0, aNbV - 1);
+  sortBySpans (myParamsU, theUs, theFlatKnotsU, aSpansU, anOrderU);
+  sortBySpans (myParamsV, theVs, theFlatKnotsV, aSpansV, anOrderV);
+
+  const Standard_Boolean isD1 = theD1U != NULL || theD1V != NULL;
+  gp_Vec aD1U, aD1V;
+  for (Standard_Integer aFirstU = 0, aLastU = 0; aFirstU < aNbU; aFirstU = aLastU)
+  {
+    // Group of U parameters of the same span
+    for (aLastU = aFirstU + 1; aLastU < aNbU && aSpansU (anOrderU (aLastU)) == aSpansU (anOrderU (aFirstU)); ++aLastU) {}
+
+    for (Standard_Integer aFirstV = 0, aLastV = 0; aFirstV < aNbV; aFirstV = aLastV)
+    {
+      // Group of V parameters of the same span
+      for (aLastV = aFirstV + 1; aLastV < aNbV && aSpansV (anOrderV (aLastV)) == aSpansV (anOrderV (aFirstV)); ++aLastV) {}
+
+      BuildCache (theUs (theUs.Lower() + anOrderU (aFirstU)), theVs (theVs.Lower() + anOrderV (aFirstV)),
+                  theFlatKnotsU, theFlatKnotsV, thePoles, theWeights);
+
+      for (Standard_Integer ku = aFirstU; ku < aLastU; ++ku)
+      {
+        const Standard_Integer iu = anOrderU (ku);
+        const Standard_Real aU = theUs (theUs.Lower() + iu);
+        for (Standard_Integer kv = aFirstV; kv < aLastV; ++kv)
+        {
+          const Standard_Integer iv = anOrderV (kv);
+          const Standard_Real aV = theVs (theVs.Lower() + iv);
+          gp_Pnt& aPnt = thePoints (thePoints.LowerRow() + iu, thePoints.LowerCol() + iv);
+          if (!isD1)
+          {
+            D0 (aU, aV, aPnt);
+            continue;
+          }
+          D1 (aU, aV, aPnt, aD1U, aD1V);
+          if (theD1U != NULL)
+          {
+            theD1U->ChangeValue (theD1U->LowerRow() + iu, theD1U->LowerCol() + iv) = aD1U;
+          }
+          if (theD1V != NULL)
+          {
+            theD1V->ChangeValue (theD1V->LowerRow() + iu, theD1V->LowerCol() + iv) = aD1V;
+          }
+        }
+      }
+    }
+  }
+}
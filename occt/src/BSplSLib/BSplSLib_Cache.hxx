@@ -18,6 +18,11 @@
 #include <TColStd_Array2OfReal.hxx>
 
 #include <BSplCLib_CacheParams.hxx>
+#include <TColgp_Array1OfPnt.hxx>
+#include <TColgp_Array1OfPnt2d.hxx>
+#include <TColgp_Array1OfVec.hxx>
+#include <TColgp_Array2OfPnt.hxx>
+#include <TColgp_Array2OfVec.hxx>
 
 //! \brief A cache class for Bezier and B-spline surfaces.
 //!
@@ -103,6 +108,48 @@ public:
                                 gp_Vec&        theCurvatureV, 
                                 gp_Vec&        theCurvatureUV) const;
 
+  //! Calculates the points of the surface (and the first derivatives, if the arrays for them are given)
+  //! for the set of parameters. The parameters are processed grouped by the spans of the surface,
+  //! so that the cache is rebuilt only once for each span containing the parameters.
+  //! After the call the cache corresponds to the span of the last processed group of parameters.
+  //! \param[in]  theUVs        parameters of the points
+  //! \param[in]  theFlatKnotsU flat knots of the surface along U axis
+  //! \param[in]  theFlatKnotsV flat knots of the surface along V axis
+  //! \param[in]  thePoles      array of poles of the surface
+  //! \param[in]  theWeights    array of weights of corresponding poles
+  //! \param[out] thePoints     calculated points, indexed as the parameters
+  //! \param[out] theD1U        tangent vectors along U axis (optional), indexed as the parameters
+  //! \param[out] theD1V        tangent vectors along V axis (optional), indexed as the parameters
+  Standard_EXPORT void EvaluatePoints (const TColgp_Array1OfPnt2d& theUVs,
+                                       const TColStd_Array1OfReal& theFlatKnotsU,
+                                       const TColStd_Array1OfReal& theFlatKnotsV,
+                                       const TColgp_Array2OfPnt&   thePoles,
+                                       const TColStd_Array2OfReal* theWeights,
+                                       TColgp_Array1OfPnt&         thePoints,
+                                       TColgp_Array1OfVec*         theD1U = NULL,
+                                       TColgp_Array1OfVec*         theD1V = NULL);
+
+  //! Calculates the points of the surface (and the first derivatives, if the arrays for them are given)
+  //! in the nodes of the grid of parameters. The cache is rebuilt only once for each pair of spans
+  //! containing the nodes.
+  //! \param[in]  theUs         U parameters of the grid
+  //! \param[in]  theVs         V parameters of the grid
+  //! \param[in]  theFlatKnotsU flat knots of the surface along U axis
+  //! \param[in]  theFlatKnotsV flat knots of the surface along V axis
+  //! \param[in]  thePoles      array of poles of the surface
+  //! \param[in]  theWeights    array of weights of corresponding poles
+  //! \param[out] thePoints     calculated points, rows and columns are indexed as U and V parameters
+  //! \param[out] theD1U        tangent vectors along U axis (optional), indexed as the points
+  //! \param[out] theD1V        tangent vectors along V axis (optional), indexed as the points
+  Standard_EXPORT void EvaluateGrid (const TColStd_Array1OfReal& theUs,
+                                     const TColStd_Array1OfReal& theVs,
+                                     const TColStd_Array1OfReal& theFlatKnotsU,
+                                     const TColStd_Array1OfReal& theFlatKnotsV,
+                                     const TColgp_Array2OfPnt&   thePoles,
+                                     const TColStd_Array2OfReal* theWeights,
+                                     TColgp_Array2OfPnt&         thePoints,
+                                     TColgp_Array2OfVec*         theD1U = NULL,
+                                     TColgp_Array2OfVec*         theD1V = NULL);
 
   DEFINE_STANDARD_RTTIEXT(BSplSLib_Cache,Standard_Transient)
 
@@ -17,6 +17,8 @@
 #define BVH_BinnedBuilder_HeaderFile
 
 #include <BVH_QueueBuilder.hxx>
+#include <NCollection_Array1.hxx>
+#include <OSD_Parallel.hxx>
 
 #include <algorithm>
 
@@ -97,6 +99,81 @@ private:
 
 };
 
+namespace BVH
+{
+  //! Minimal number of primitives of the node whose primitives are arranged into bins in parallel.
+  static const Standard_Integer THE_PARALLEL_BINNING_MIN_SIZE = 1 << 14;
+
+  //! Arranges the given range of primitives into bins.
+  template<class T, int N>
+  void BinPrimitives (BVH_Set<T, N>*         theSet,
+                      const Standard_Integer theBeg,
+                      const Standard_Integer theEnd,
+                      const Standard_Integer theAxis,
+                      const T                theMin,
+                      const T                theInverseStep,
+                      BVH_Bin<T, N>*         theBins,
+                      const Standard_Integer theNbBins)
+  {
+    for (Standard_Integer anIdx = theBeg; anIdx <= theEnd; ++anIdx)
+    {
+      typename BVH_Set<T, N>::BVH_BoxNt aBox = theSet->Box (anIdx);
+      Standard_Integer aBinIndex = BVH::IntFloor<T> ((theSet->Center (anIdx, theAxis) - theMin) * theInverseStep);
+      if (aBinIndex < 0)
+      {
+        aBinIndex = 0;
+      }
+      else if (aBinIndex >= theNbBins)
+      {
+        aBinIndex = theNbBins - 1;
+      }
+
+      theBins[aBinIndex].Count++;
+      theBins[aBinIndex].Box.Combine (aBox);
+    }
+  }
+
+  //! Functor arranging the blocks of primitives of the node into separate arrays of bins in parallel.
+  template<class T, int N>
+  class BinPrimitivesFunctor
+  {
+  public:
+
+    //! Creates new functor for the given range of primitives.
+    BinPrimitivesFunctor (BVH_Set<T, N>*         theSet,
+                          const Standard_Integer theBeg,
+                          const Standard_Integer theEnd,
+                          const Standard_Integer theNbBlocks,
+                          const Standard_Integer theAxis,
+                          const T                theMin,
+                          const T                theInverseStep,
+                          BVH_Bin<T, N>*         theBins,
+                          const Standard_Integer theNbBins)
+    : mySet (theSet), myBeg (theBeg), myEnd (theEnd), myNbBlocks (theNbBlocks), myAxis (theAxis),
+      myMin (theMin), myInverseStep (theInverseStep), myBins (theBins), myNbBins (theNbBins) {}
+
+    //! Arranges primitives of the block into its bins.
+    void operator() (const Standard_Integer theBlock) const
+    {
+      const Standard_Size aNbPrims = static_cast<Standard_Size> (myEnd - myBeg + 1);
+      const Standard_Integer aBeg = myBeg + static_cast<Standard_Integer> (aNbPrims * theBlock / myNbBlocks);
+      const Standard_Integer anEnd = myBeg + static_cast<Standard_Integer> (aNbPrims * (theBlock + 1) / myNbBlocks) - 1;
+      BinPrimitives<T, N> (mySet, aBeg, anEnd, myAxis, myMin, myInverseStep, myBins + theBlock * myNbBins, myNbBins);
+    }
+
+  private:
+    BVH_Set<T, N>*   mySet;
+    Standard_Integer myBeg;
+    Standard_Integer myEnd;
+    Standard_Integer myNbBlocks;
+    Standard_Integer myAxis;
+    T                myMin;
+    T                myInverseStep;
+    BVH_Bin<T, N>*   myBins;
+    Standard_Integer myNbBins;
+  };
+}
+
 // =======================================================================
 // function : getSubVolumes
 // purpose  :
@@ -111,21 +188,29 @@ void BVH_BinnedBuilder<T, N, Bins>::getSubVolumes (BVH_Set<T, N>*         theSet
   const T aMin = BVH::VecComp<T, N>::Get (theBVH->MinPoint (theNode), theAxis);
   const T aMax = BVH::VecComp<T, N>::Get (theBVH->MaxPoint (theNode), theAxis);
   const T anInverseStep = static_cast<T> (Bins) / (aMax - aMin);
-  for (Standard_Integer anIdx = theBVH->BegPrimitive (theNode); anIdx <= theBVH->EndPrimitive (theNode); ++anIdx)
+  const Standard_Integer aBegPrimitive = theBVH->BegPrimitive (theNode);
+  const Standard_Integer anEndPrimitive = theBVH->EndPrimitive (theNode);
+  if (!this->IsParallel()
+   || anEndPrimitive - aBegPrimitive + 1 < BVH::THE_PARALLEL_BINNING_MIN_SIZE)
   {
-    typename BVH_Set<T, N>::BVH_BoxNt aBox = theSet->Box (anIdx);
-    Standard_Integer aBinIndex = BVH::IntFloor<T> ((theSet->Center (anIdx, theAxis) - aMin) * anInverseStep);
-    if (aBinIndex < 0)
-    {
-      aBinIndex = 0;
-    }
-    else if (aBinIndex >= Bins)
+    BVH::BinPrimitives<T, N> (theSet, aBegPrimitive, anEndPrimitive, theAxis, aMin, anInverseStep, theBins, Bins);
+    return;
+  }
+
+  // the top-level nodes are binned by blocks of primitives in parallel
+  const Standard_Integer aNbBlocks = Min (OSD_Parallel::NbLogicalProcessors(),
+                                          (anEndPrimitive - aBegPrimitive + 1) / (BVH::THE_PARALLEL_BINNING_MIN_SIZE / 4));
+  NCollection_Array1<BVH_Bin<T, N> > aBlockBins (0, aNbBlocks * Bins - 1);
+  OSD_Parallel::For (0, aNbBlocks, BVH::BinPrimitivesFunctor<T, N> (theSet, aBegPrimitive, anEndPrimitive, aNbBlocks,
+                                                                    theAxis, aMin, anInverseStep, &aBlockBins.ChangeFirst(), Bins));
+  for (Standard_Integer aBlock = 0; aBlock < aNbBlocks; ++aBlock)
+  {
+    for (Standard_Integer aBinIndex = 0; aBinIndex < Bins; ++aBinIndex)
     {
-      aBinIndex = Bins - 1;
+      const BVH_Bin<T, N>& aBin = aBlockBins.Value (aBlock * Bins + aBinIndex);
+      theBins[aBinIndex].Count += aBin.Count;
+      theBins[aBinIndex].Box.Combine (aBin.Box);
     }
-
-    theBins[aBinIndex].Count++;
-    theBins[aBinIndex].Box.Combine (aBox);
   }
 }
 
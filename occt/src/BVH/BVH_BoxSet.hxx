@@ -66,6 +66,15 @@ public: //! @name Adding elements in BVH
     BVH_Object<NumType, Dimension>::myIsDirty = Standard_True;
   }
 
+  //! Replaces the box of the element with the given index.
+  //! Note that the elements are reordered by the construction of BVH,
+  //! the new boxes of the moved elements can be applied by Refit().
+  virtual void SetBox (const Standard_Integer theIndex, const BVH_Box<NumType, Dimension>& theBox)
+  {
+    myBoxes[theIndex] = theBox;
+    BVH_Object<NumType, Dimension>::myIsDirty = Standard_True;
+  }
+
 public: //! @name BVH construction
 
   //! BVH construction
@@ -92,6 +92,24 @@ public:
   //! Sets the method (builder) used to construct BVH.
   virtual void SetBuilder (const opencascade::handle<BVH_Builder<T, N> >& theBuilder) { myBuilder = theBuilder; }
 
+  //! Updates bounding boxes of the existing BVH after the objects have been moved
+  //! (e.g. the instances have got new transformations), keeping the tree topology
+  //! (see BVH_Builder::Refit()). The number and the order of the objects should not
+  //! be changed since the tree was built. The tree is built if it does not exist yet.
+  virtual void Refit()
+  {
+    if (myBVH->Length() == 0)
+    {
+      myIsDirty = Standard_True;
+      Update();
+      return;
+    }
+
+    myBuilder->Refit (this, myBVH.operator->());
+    myBox = BVH_Box<T, N> (myBVH->MinPoint (0), myBVH->MaxPoint (0));
+    myIsDirty = Standard_False;
+  }
+
 protected:
 
   //! Updates internal geometry state.
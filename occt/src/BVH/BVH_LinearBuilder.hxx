@@ -163,139 +163,6 @@ Standard_Integer BVH_LinearBuilder<T, N>::emitHierachy (BVH_Tree<T, N>*        t
   }
 }
 
-namespace BVH
-{
-  //! Calculates bounding boxes (AABBs) for the given BVH tree.
-  template<class T, int N>
-  Standard_Integer UpdateBounds (BVH_Set<T, N>* theSet, BVH_Tree<T, N>* theTree, const Standard_Integer theNode = 0)
-  {
-    const BVH_Vec4i aData = theTree->NodeInfoBuffer()[theNode];
-    if (aData.x() == 0)
-    {
-      const Standard_Integer aLftChild = theTree->NodeInfoBuffer()[theNode].y();
-      const Standard_Integer aRghChild = theTree->NodeInfoBuffer()[theNode].z();
-
-      const Standard_Integer aLftDepth = UpdateBounds (theSet, theTree, aLftChild);
-      const Standard_Integer aRghDepth = UpdateBounds (theSet, theTree, aRghChild);
-
-      typename BVH_Box<T, N>::BVH_VecNt aLftMinPoint = theTree->MinPointBuffer()[aLftChild];
-      typename BVH_Box<T, N>::BVH_VecNt aLftMaxPoint = theTree->MaxPointBuffer()[aLftChild];
-      typename BVH_Box<T, N>::BVH_VecNt aRghMinPoint = theTree->MinPointBuffer()[aRghChild];
-      typename BVH_Box<T, N>::BVH_VecNt aRghMaxPoint = theTree->MaxPointBuffer()[aRghChild];
-
-      BVH::BoxMinMax<T, N>::CwiseMin (aLftMinPoint, aRghMinPoint);
-      BVH::BoxMinMax<T, N>::CwiseMax (aLftMaxPoint, aRghMaxPoint);
-
-      theTree->MinPointBuffer()[theNode] = aLftMinPoint;
-      theTree->MaxPointBuffer()[theNode] = aLftMaxPoint;
-      return Max (aLftDepth, aRghDepth) + 1;
-    }
-    else
-    {
-      typename BVH_Box<T, N>::BVH_VecNt& aMinPoint = theTree->MinPointBuffer()[theNode];
-      typename BVH_Box<T, N>::BVH_VecNt& aMaxPoint = theTree->MaxPointBuffer()[theNode];
-      for (Standard_Integer aPrimIdx = aData.y(); aPrimIdx <= aData.z(); ++aPrimIdx)
-      {
-        const BVH_Box<T, N> aBox = theSet->Box (aPrimIdx);
-        if (aPrimIdx == aData.y())
-        {
-          aMinPoint = aBox.CornerMin();
-          aMaxPoint = aBox.CornerMax();
-        }
-        else
-        {
-          BVH::BoxMinMax<T, N>::CwiseMin (aMinPoint, aBox.CornerMin());
-          BVH::BoxMinMax<T, N>::CwiseMax (aMaxPoint, aBox.CornerMax());
-        }
-      }
-    }
-    return 0;
-  }
-
-  template<class T, int N>
-  struct BoundData
-  {
-    BVH_Set <T, N>*   mySet;    //!< Set of geometric objects
-    BVH_Tree<T, N>*   myBVH;    //!< BVH tree built over the set
-    Standard_Integer  myNode;   //!< BVH node to update bounding box
-    Standard_Integer  myLevel;  //!< Level of the processed BVH node
-    Standard_Integer* myHeight; //!< Height of the processed BVH node
-  };
-
-  //! Task for parallel bounds updating.
-  template<class T, int N>
-  class UpdateBoundTask
-  {
-  public:
-
-    UpdateBoundTask (const Standard_Boolean isParallel)
-    : myIsParallel (isParallel)
-    {
-    }
-    
-    //! Executes the task.
-    void operator()(const BoundData<T, N>& theData) const
-    {
-      if (theData.myBVH->IsOuter (theData.myNode) || theData.myLevel > 2)
-      {
-        *theData.myHeight = BVH::UpdateBounds (theData.mySet, theData.myBVH, theData.myNode);
-      }
-      else
-      {
-        Standard_Integer aLftHeight = 0;
-        Standard_Integer aRghHeight = 0;
-
-        const Standard_Integer aLftChild = theData.myBVH->NodeInfoBuffer()[theData.myNode].y();
-        const Standard_Integer aRghChild = theData.myBVH->NodeInfoBuffer()[theData.myNode].z();
-
-        std::vector<BoundData<T, N> > aList;
-        aList.reserve (2);
-        if (!theData.myBVH->IsOuter (aLftChild))
-        {
-          BoundData<T, N> aBoundData = {theData.mySet, theData.myBVH, aLftChild, theData.myLevel + 1, &aLftHeight};
-          aList.push_back (aBoundData);
-        }
-        else
-        {
-          aLftHeight = BVH::UpdateBounds (theData.mySet, theData.myBVH, aLftChild);
-        }
-
-        if (!theData.myBVH->IsOuter (aRghChild))
-        {
-          BoundData<T, N> aBoundData = {theData.mySet, theData.myBVH, aRghChild, theData.myLevel + 1, &aRghHeight};
-          aList.push_back (aBoundData);
-        }
-        else
-        {
-          aRghHeight = BVH::UpdateBounds (theData.mySet, theData.myBVH, aRghChild);
-        }
-
-        if (!aList.empty())
-        {
-          OSD_Parallel::ForEach (aList.begin (), aList.end (), UpdateBoundTask<T, N> (myIsParallel), !myIsParallel);
-        }
-
-        typename BVH_Box<T, N>::BVH_VecNt aLftMinPoint = theData.myBVH->MinPointBuffer()[aLftChild];
-        typename BVH_Box<T, N>::BVH_VecNt aLftMaxPoint = theData.myBVH->MaxPointBuffer()[aLftChild];
-        typename BVH_Box<T, N>::BVH_VecNt aRghMinPoint = theData.myBVH->MinPointBuffer()[aRghChild];
-        typename BVH_Box<T, N>::BVH_VecNt aRghMaxPoint = theData.myBVH->MaxPointBuffer()[aRghChild];
-
-        BVH::BoxMinMax<T, N>::CwiseMin (aLftMinPoint, aRghMinPoint);
-        BVH::BoxMinMax<T, N>::CwiseMax (aLftMaxPoint, aRghMaxPoint);
-
-        theData.myBVH->MinPointBuffer()[theData.myNode] = aLftMinPoint;
-        theData.myBVH->MaxPointBuffer()[theData.myNode] = aLftMaxPoint;
-
-        *theData.myHeight = Max (aLftHeight, aRghHeight) + 1;
-      }
-    }
-    
-  private:
-    
-    Standard_Boolean myIsParallel;
-  };
-}
-
 // =======================================================================
 // function : Build
 // purpose  :
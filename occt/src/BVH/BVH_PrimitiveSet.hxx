@@ -90,6 +90,24 @@ public:
   //! Sets the method (builder) used to construct BVH.
   virtual void SetBuilder (const opencascade::handle<BVH_Builder<T, N> >& theBuilder) { myBuilder = theBuilder; }
 
+  //! Updates bounding boxes of the existing BVH after the primitives have been moved,
+  //! keeping the tree topology (see BVH_Builder::Refit()). The number and the order
+  //! of the primitives should not be changed since the tree was built.
+  //! The tree is built if it does not exist yet.
+  virtual void Refit()
+  {
+    if (myBVH->Length() == 0)
+    {
+      BVH_Object<T, N>::myIsDirty = Standard_True;
+      Update();
+      return;
+    }
+
+    myBuilder->Refit (this, myBVH.operator->());
+    myBox = BVH_Box<T, N> (myBVH->MinPoint (0), myBVH->MaxPoint (0));
+    BVH_Object<T, N>::myIsDirty = Standard_False;
+  }
+
 protected:
 
   //! Updates BVH of primitive set.
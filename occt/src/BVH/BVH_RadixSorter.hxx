@@ -92,6 +92,69 @@ namespace BVH
     }
   };
 
+  //! Minimal number of links sorted by the parallel LSD radix sort.
+  //! Smaller arrays are sorted by the MSD radix sort which is faster in one thread.
+  static const Standard_Integer THE_PARALLEL_SORT_MIN_SIZE = 1 << 16;
+
+  //! Functor class computing Morton codes of the primitives in parallel.
+  template<class T, int N>
+  class EncodeLinksFunctor
+  {
+  public:
+
+    typedef typename BVH::VectorType<T, N>::Type BVH_VecNt;
+
+    //! Creates new functor for the given parameters of the virtual grid.
+    EncodeLinksFunctor (BVH_Set<T, N>*                       theSet,
+                        NCollection_Array1<BVH_EncodedLink>& theLinks,
+                        const BVH_VecNt&                     theSceneMin,
+                        const BVH_VecNt&                     theReverseSize,
+                        const Standard_Integer               theDimension)
+    : mySet (theSet),
+      myLinks (theLinks),
+      mySceneMin (theSceneMin),
+      myReverseSize (theReverseSize),
+      myDimension (theDimension)
+    {
+    }
+
+    //! Assigns Morton code to the primitive.
+    void operator() (const Standard_Integer thePrimIdx) const
+    {
+      const Standard_Integer aNbEffComp = N == 2 ? 2 : 3; // 4th component is ignored
+
+      const BVH_VecNt aCenter = mySet->Box (thePrimIdx).Center();
+      const BVH_VecNt aVoxelF = (aCenter - mySceneMin) * myReverseSize;
+
+      unsigned int aMortonCode = 0;
+      for (Standard_Integer aCompIter = 0; aCompIter < aNbEffComp; ++aCompIter)
+      {
+        const Standard_Integer aVoxelI = BVH::IntFloor (BVH::VecComp<T, N>::Get (aVoxelF, aCompIter));
+
+        unsigned int aVoxel = static_cast<unsigned int>(Max (0, Min (aVoxelI, myDimension - 1)));
+
+        aVoxel = (aVoxel | (aVoxel << 16)) & 0x030000FF;
+        aVoxel = (aVoxel | (aVoxel <<  8)) & 0x0300F00F;
+        aVoxel = (aVoxel | (aVoxel <<  4)) & 0x030C30C3;
+        aVoxel = (aVoxel | (aVoxel <<  2)) & 0x09249249;
+
+        aMortonCode |= (aVoxel << aCompIter);
+      }
+
+      myLinks.ChangeValue (thePrimIdx) = BVH_EncodedLink (aMortonCode, thePrimIdx);
+    }
+
+  private:
+    void operator=(const EncodeLinksFunctor&);
+
+  private:
+    BVH_Set<T, N>*                       mySet;
+    NCollection_Array1<BVH_EncodedLink>& myLinks;
+    BVH_VecNt                            mySceneMin;
+    BVH_VecNt                            myReverseSize;
+    Standard_Integer                     myDimension;
+  };
+
   //! Tool object for sorting link array using radix sort algorithm.
   class RadixSorter
   {
@@ -136,6 +199,53 @@ namespace BVH
 
   public:
 
+    //! Sorts the links by the LSD (least significant digit) radix sort
+    //! with the passes over 10-bit digits (the codes should not exceed 30 bits).
+    //! Each pass counts the digits and scatters the links by the blocks
+    //! of the array processed in parallel; the sort is stable.
+    static void SortParallel (NCollection_Array1<BVH_EncodedLink>& theLinks)
+    {
+      const Standard_Integer aNbLinks = theLinks.Size();
+      if (aNbLinks < 2)
+      {
+        return;
+      }
+
+      const Standard_Integer aNbBlocks = Min (4 * OSD_Parallel::NbLogicalProcessors(), (aNbLinks + 1023) / 1024);
+      NCollection_Array1<BVH_EncodedLink> aBuffer (0, aNbLinks - 1);
+      NCollection_Array1<Standard_Integer> anOffsets (0, aNbBlocks * THE_NB_BUCKETS - 1);
+
+      BVH_EncodedLink* aSource = &theLinks.ChangeFirst();
+      BVH_EncodedLink* aTarget = &aBuffer.ChangeFirst();
+      for (Standard_Integer aShift = 0; aShift < 30; aShift += THE_DIGIT_BITS)
+      {
+        anOffsets.Init (0);
+        SortPass aPass (aSource, aTarget, aNbLinks, aNbBlocks, aShift, &anOffsets.ChangeFirst());
+        OSD_Parallel::For (0, aNbBlocks, CountFunctor (aPass));
+
+        // turn the counters into the positions of the buckets of each block
+        Standard_Integer aPosition = 0;
+        for (Standard_Integer aBucket = 0; aBucket < THE_NB_BUCKETS; ++aBucket)
+        {
+          for (Standard_Integer aBlock = 0; aBlock < aNbBlocks; ++aBlock)
+          {
+            Standard_Integer& anOffset = anOffsets.ChangeValue (aBlock * THE_NB_BUCKETS + aBucket);
+            const Standard_Integer aCount = anOffset;
+            anOffset = aPosition;
+            aPosition += aCount;
+          }
+        }
+
+        OSD_Parallel::For (0, aNbBlocks, ScatterFunctor (aPass));
+        std::swap (aSource, aTarget);
+      }
+
+      if (aSource != &theLinks.ChangeFirst())
+      {
+        std::copy (aSource, aSource + aNbLinks, &theLinks.ChangeFirst());
+      }
+    }
+
     static void Sort (LinkIterator theStart, LinkIterator theFinal, Standard_Integer theDigit, const Standard_Boolean isParallel)
     {
       if (theDigit < 24)
@@ -154,6 +264,76 @@ namespace BVH
       }
     }
 
+  private:
+
+    //! Number of bits of the digit of the LSD radix sort.
+    static const Standard_Integer THE_DIGIT_BITS = 10;
+
+    //! Number of buckets of the digit of the LSD radix sort.
+    static const Standard_Integer THE_NB_BUCKETS = 1 << THE_DIGIT_BITS;
+
+    //! Parameters of the pass of the LSD radix sort over the blocks of the array.
+    struct SortPass
+    {
+      BVH_EncodedLink*  mySource;   //!< Links to be sorted by the digit
+      BVH_EncodedLink*  myTarget;   //!< Links sorted by the digit
+      Standard_Integer  myNbLinks;  //!< Number of links
+      Standard_Integer  myNbBlocks; //!< Number of blocks
+      Standard_Integer  myShift;    //!< Position of the digit in the code
+      Standard_Integer* myOffsets;  //!< Counters (positions) of the buckets of each block
+
+      SortPass (BVH_EncodedLink* theSource, BVH_EncodedLink* theTarget,
+                    const Standard_Integer theNbLinks, const Standard_Integer theNbBlocks,
+                    const Standard_Integer theShift, Standard_Integer* theOffsets)
+      : mySource (theSource), myTarget (theTarget), myNbLinks (theNbLinks),
+        myNbBlocks (theNbBlocks), myShift (theShift), myOffsets (theOffsets) {}
+
+      //! Returns the first link of the block.
+      Standard_Integer Lower (const Standard_Integer theBlock) const
+      {
+        return static_cast<Standard_Integer> ((static_cast<Standard_Size> (myNbLinks) * theBlock) / myNbBlocks);
+      }
+
+      //! Returns the digit of the link.
+      Standard_Integer Digit (const BVH_EncodedLink& theLink) const
+      {
+        return static_cast<Standard_Integer> ((theLink.first >> myShift) & (THE_NB_BUCKETS - 1));
+      }
+    };
+
+    //! Functor counting the digits of the links of the block.
+    struct CountFunctor
+    {
+      const SortPass& myPass;
+      CountFunctor (const SortPass& thePass) : myPass (thePass) {}
+
+      void operator() (const Standard_Integer theBlock) const
+      {
+        Standard_Integer* aCounters = myPass.myOffsets + theBlock * THE_NB_BUCKETS;
+        for (Standard_Integer anIdx = myPass.Lower (theBlock); anIdx < myPass.Lower (theBlock + 1); ++anIdx)
+        {
+          ++aCounters[myPass.Digit (myPass.mySource[anIdx])];
+        }
+      }
+    };
+
+    //! Functor moving the links of the block to the positions of their buckets.
+    struct ScatterFunctor
+    {
+      const SortPass& myPass;
+      ScatterFunctor (const SortPass& thePass) : myPass (thePass) {}
+
+      void operator() (const Standard_Integer theBlock) const
+      {
+        Standard_Integer* aPositions = myPass.myOffsets + theBlock * THE_NB_BUCKETS;
+        for (Standard_Integer anIdx = myPass.Lower (theBlock); anIdx < myPass.Lower (theBlock + 1); ++anIdx)
+        {
+          const BVH_EncodedLink& aLink = myPass.mySource[anIdx];
+          myPass.myTarget[aPositions[myPass.Digit (aLink)]++] = aLink;
+        }
+      }
+    };
+
   protected:
 
     // Performs MSD (most significant digit) radix sort.
@@ -179,7 +359,6 @@ void BVH_RadixSorter<T, N>::Perform (BVH_Set<T, N>* theSet, const Standard_Integ
   Standard_STATIC_ASSERT (N == 2 || N == 3 || N == 4);
 
   const Standard_Integer aDimension = 1024;
-  const Standard_Integer aNbEffComp = N == 2 ? 2 : 3; // 4th component is ignored
 
   const BVH_VecNt aSceneMin = myBox.CornerMin();
   const BVH_VecNt aSceneMax = myBox.CornerMax();
@@ -192,31 +371,20 @@ void BVH_RadixSorter<T, N>::Perform (BVH_Set<T, N>* theSet, const Standard_Integ
   myEncodedLinks = new NCollection_Shared<NCollection_Array1<BVH_EncodedLink> >(theStart, theFinal);
 
   // Step 1 -- Assign Morton code to each primitive
-  for (Standard_Integer aPrimIdx = theStart; aPrimIdx <= theFinal; ++aPrimIdx)
-  {
-    const BVH_VecNt aCenter = theSet->Box (aPrimIdx).Center();
-    const BVH_VecNt aVoxelF = (aCenter - aSceneMin) * aReverseSize;
-
-    unsigned int aMortonCode = 0;
-    for (Standard_Integer aCompIter = 0; aCompIter < aNbEffComp; ++aCompIter)
-    {
-      const Standard_Integer aVoxelI = BVH::IntFloor (BVH::VecComp<T, N>::Get (aVoxelF, aCompIter));
-
-      unsigned int aVoxel = static_cast<unsigned int>(Max (0, Min (aVoxelI, aDimension - 1)));
-
-      aVoxel = (aVoxel | (aVoxel << 16)) & 0x030000FF;
-      aVoxel = (aVoxel | (aVoxel <<  8)) & 0x0300F00F;
-      aVoxel = (aVoxel | (aVoxel <<  4)) & 0x030C30C3;
-      aVoxel = (aVoxel | (aVoxel <<  2)) & 0x09249249;
-
-      aMortonCode |= (aVoxel << aCompIter);
-    }
-
-    myEncodedLinks->ChangeValue (aPrimIdx) = BVH_EncodedLink (aMortonCode, aPrimIdx);
-  }
+  OSD_Parallel::For (theStart, theFinal + 1,
+                     BVH::EncodeLinksFunctor<T, N> (theSet, *myEncodedLinks, aSceneMin, aReverseSize, aDimension),
+                     !this->IsParallel());
 
   // Step 2 -- Sort primitives by their Morton codes using radix sort
-  BVH::RadixSorter::Sort (myEncodedLinks->begin(), myEncodedLinks->end(), 29, this->IsParallel());
+  if (this->IsParallel()
+   && myEncodedLinks->Size() >= BVH::THE_PARALLEL_SORT_MIN_SIZE)
+  {
+    BVH::RadixSorter::SortParallel (*myEncodedLinks);
+  }
+  else
+  {
+    BVH::RadixSorter::Sort (myEncodedLinks->begin(), myEncodedLinks->end(), 29, this->IsParallel());
+  }
 
   NCollection_Array1<Standard_Integer> aLinkMap (theStart, theFinal);
   for (Standard_Integer aLinkIdx = theStart; aLinkIdx <= theFinal; ++aLinkIdx)
@@ -30,12 +30,17 @@
 #include <ChFiDS_SurfData.hxx>
 #include <Geom2d_Curve.hxx>
 #include <gp_Pnt2d.hxx>
+#include <NCollection_Array1.hxx>
+#include <OSD_Parallel.hxx>
 #include <Precision.hxx>
 #include <ShapeFix.hxx>
 #include <Standard_ErrorHandler.hxx>
 #include <Standard_Failure.hxx>
 #include <Standard_NotImplemented.hxx>
+#include <TCollection_AsciiString.hxx>
+#include <TColStd_DataMapOfIntegerListOfInteger.hxx>
 #include <TColStd_ListIteratorOfListOfInteger.hxx>
+#include <TColStd_MapIteratorOfMapOfInteger.hxx>
 #include <TColStd_MapOfInteger.hxx>
 #include <TopAbs_ShapeEnum.hxx>
 #include <TopExp_Explorer.hxx>
@@ -176,6 +181,110 @@ void ChFi3d_Builder::ExtentAnalyse ()
   }
 }
 
+//=======================================================================
+//function : ChFi3d_StripeNeighbours
+//purpose  : Finds for each stripe the next stripes having surface data
+//           on the same faces, only they are checked for intersections
+//           by ChFi3d_StripeEdgeInter(). The stripes without surface data
+//           cannot be checked and are reported as failed.
+//=======================================================================
+
+static void ChFi3d_StripeNeighbours (const NCollection_Array1<Handle(ChFiDS_Stripe)>& theStripes,
+                                     NCollection_Array1<TColStd_ListOfInteger>& theNeighbours,
+                                     NCollection_Array1<TCollection_AsciiString>& theErrors)
+{
+  // stripes by indices of faces
+  TColStd_DataMapOfIntegerListOfInteger aFaceStripes;
+  NCollection_Array1<TColStd_MapOfInteger> aStripeFaces (theStripes.Lower(), theStripes.Upper());
+  for (Standard_Integer i = theStripes.Lower(); i <= theStripes.Upper(); i++)
+  {
+    Handle(ChFiDS_HData) aSurfData = theStripes (i)->SetOfSurfData();
+    if (aSurfData.IsNull())
+    {
+      theErrors (i) = "ChFi3d_Builder: the stripe has no surface data";
+      continue;
+    }
+    for (Standard_Integer j = 1; j <= aSurfData->Length(); j++)
+    {
+      const Handle(ChFiDS_SurfData)& aData = aSurfData->Value (j);
+      const Standard_Integer aFaces[2] = { aData->IndexOfS1(), aData->IndexOfS2() };
+      for (Standard_Integer k = 0; k < 2; k++)
+      {
+        if (!aStripeFaces (i).Add (aFaces[k]))
+          continue;
+        TColStd_ListOfInteger* aList = aFaceStripes.ChangeSeek (aFaces[k]);
+        if (aList == NULL)
+          aList = aFaceStripes.Bound (aFaces[k], TColStd_ListOfInteger());
+        aList->Append (i);
+      }
+    }
+  }
+
+  for (Standard_Integer i = theStripes.Lower(); i <= theStripes.Upper(); i++)
+  {
+    TColStd_MapOfInteger aNeighbours;
+    for (TColStd_MapIteratorOfMapOfInteger aFaceIt (aStripeFaces (i)); aFaceIt.More(); aFaceIt.Next())
+    {
+      for (TColStd_ListIteratorOfListOfInteger anIt (aFaceStripes.Find (aFaceIt.Key())); anIt.More(); anIt.Next())
+      {
+        if (anIt.Value() > i && aNeighbours.Add (anIt.Value()))
+          theNeighbours (i).Append (anIt.Value());
+      }
+    }
+  }
+}
+
+namespace
+{
+  //! Functor checking the intersections between the fillets of
+  //! a stripe and the ones of its neighbours.
+  //! The message of the exception is kept for each failed stripe.
+  class ChFi3d_StripeInterFunctor
+  {
+  public:
+
+    ChFi3d_StripeInterFunctor (const NCollection_Array1<Handle(ChFiDS_Stripe)>& theStripes,
+                               const NCollection_Array1<TColStd_ListOfInteger>& theNeighbours,
+                               TopOpeBRepDS_DataStructure& theDS,
+                               const Standard_Real theTol2d,
+                               NCollection_Array1<TCollection_AsciiString>& theErrors)
+    : myStripes (theStripes),
+      myNeighbours (theNeighbours),
+      myDS (theDS),
+      myTol2d (theTol2d),
+      myErrors (theErrors)
+    {}
+
+    void operator() (const Standard_Integer theIndex) const
+    {
+      for (TColStd_ListIteratorOfListOfInteger anIt (myNeighbours (theIndex)); anIt.More(); anIt.Next())
+      {
+        try
+        {
+          OCC_CATCH_SIGNALS
+          ChFi3d_StripeEdgeInter (myStripes (theIndex), myStripes (anIt.Value()), myDS, myTol2d);
+        }
+        catch (Standard_Failure const& anException)
+        {
+          myErrors (theIndex) = TCollection_AsciiString (anException.DynamicType()->Name())
+                              + ": " + anException.GetMessageString();
+          break;
+        }
+      }
+    }
+
+  private:
+    ChFi3d_StripeInterFunctor& operator= (const ChFi3d_StripeInterFunctor&);
+
+  private:
+    const NCollection_Array1<Handle(ChFiDS_Stripe)>& myStripes;
+    const NCollection_Array1<TColStd_ListOfInteger>& myNeighbours;
+    TopOpeBRepDS_DataStructure&                      myDS;
+    const Standard_Real                              myTol2d;
+    NCollection_Array1<TCollection_AsciiString>&     myErrors;
+  };
+}
+
 //=======================================================================
 //function : Compute
 //purpose  : 
@@ -302,38 +411,31 @@ void  ChFi3d_Builder::Compute()
     MapIndSo.Add(indcursh);
   }
   if (done) {
-    Standard_Integer i1;
-    for (itel.Initialize(myListStripe), i1=0;
-	 itel.More(); 
-	 itel.Next(), i1++) {
-      const Handle(ChFiDS_Stripe)& st = itel.Value();
-      // 05/02/02 akm vvv : (OCC119) First we'll check ain't there 
-      //                    intersections between fillets
-      ChFiDS_ListIteratorOfListOfStripe itel1;
-      Standard_Integer i2;
-      for (itel1.Initialize(myListStripe), i2=0;
-	   itel1.More(); 
-	   itel1.Next(), i2++) {
-	if (i2 <= i1)
-	  // Do not twice intersect the stripes
-	  continue;
-	Handle(ChFiDS_Stripe) aCheckStripe = itel1.Value();
-	try {
-	  OCC_CATCH_SIGNALS
-	  ChFi3d_StripeEdgeInter (st, aCheckStripe, DStr, tol2d);
-	}
-	catch(Standard_Failure const& anException) {
+    // 05/02/02 akm (OCC119) : first check that there are no intersections
+    // between fillets. The check only reads the stripes, so it is done for
+    // all pairs of stripes sharing faces before the DS is filled.
+    const Standard_Integer aNbStripes = myListStripe.Extent();
+    NCollection_Array1<Handle(ChFiDS_Stripe)> aStripes (1, aNbStripes);
+    NCollection_Array1<TColStd_ListOfInteger> aNeighbours (1, aNbStripes);
+    NCollection_Array1<TCollection_AsciiString> anErrors (1, aNbStripes);
+    Standard_Integer i1 = 1;
+    for (itel.Initialize(myListStripe); itel.More(); itel.Next(), i1++)
+      aStripes (i1) = itel.Value();
+    ChFi3d_StripeNeighbours (aStripes, aNeighbours, anErrors);
+
+    ChFi3d_StripeInterFunctor aFunctor (aStripes, aNeighbours, DStr, tol2d, anErrors);
+    OSD_Parallel::For (1, aNbStripes + 1, aFunctor, !myRunParallel);
+
+    for (i1 = 1; i1 <= aNbStripes; i1++) {
+      const Handle(ChFiDS_Stripe)& st = aStripes (i1);
+      if (!anErrors (i1).IsEmpty()) {
 #ifdef OCCT_DEBUG
-	  std::cout <<"EXCEPTION Fillets compute " << anException << std::endl;
+	std::cout <<"EXCEPTION Fillets compute " << anErrors (i1) << std::endl;
 #endif
-	  (void)anException;
-	  badstripes.Append(itel.Value());
-	  hasresult=Standard_False;
-	  done = Standard_False;
-	  break;
-	}
+	badstripes.Append(st);
+	hasresult=Standard_False;
+	done = Standard_False;
       }
-      // 05/02/02 akm ^^^
       Standard_Integer solidindex = st->SolidIndex();
       ChFi3d_FilDS(solidindex,st,DStr,myRegul,tolesp,tol2d);
       if (!done) break;
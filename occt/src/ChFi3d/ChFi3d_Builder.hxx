@@ -80,6 +80,14 @@ public:
   Standard_EXPORT void SetContinuity (const GeomAbs_Shape InternalContinuity,
                                       const Standard_Real AngularTolerance);
   
+  //! Sets the flag of parallel processing. If it is True, the
+  //! check of intersections between the computed fillets is
+  //! performed in parallel threads.
+  void SetRunParallel (const Standard_Boolean theIsParallel) { myRunParallel = theIsParallel; }
+  
+  //! Returns the flag of parallel processing.
+  Standard_Boolean RunParallel() const { return myRunParallel; }
+  
   //! extracts from  the list the contour containing edge E.
   Standard_EXPORT void Remove (const TopoDS_Edge& E);
   
@@ -772,6 +780,7 @@ protected:
   TopTools_DataMapOfShapeShape myEdgeFirstFace;
   Standard_Boolean done;
   Standard_Boolean hasresult;
+  Standard_Boolean myRunParallel;
 
 
 private:
@@ -36,12 +36,14 @@
 #include <TopAbs.hxx>
 #include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
+#include <TopExp_ShapeIndex.hxx>
 #include <TopoDS.hxx>
 #include <TopoDS_Compound.hxx>
 #include <TopoDS_Iterator.hxx>
 #include <TopTools_Array1OfShape.hxx>
 #include <TopTools_MapOfShape.hxx>
 
+#include <algorithm>
 #include <stdio.h>
 // memory management
 #ifdef _WIN32
@@ -609,18 +611,19 @@ static Standard_Integer explode(Draw_Interpretor& di,
 	return 1;
     }
     
-    TopTools_MapOfShape M;
-    M.Add(S);
-    TopExp_Explorer ex(S,typ);
-    for (; ex.More(); ex.Next()) {
-      const TopoDS_Shape& Sx = ex.Current();
-      Standard_Boolean added = M.Add(Sx);
-      if (added) {
-	i++;
-	Sprintf(p,"%d",i);
-	DBRep::Set(newname,Sx);
-	di.AppendElement(newname);
+    // the index of sub-shapes is shared by the repeated explorations of the shape
+    Handle(TopExp_ShapeIndex) anIndex = TopExp_ShapeIndex::Get(S);
+    const Standard_Integer aNbShapes = anIndex->NbShapes(typ);
+    for (Standard_Integer k = 1; k <= aNbShapes; k++) {
+      const Standard_Integer aSubIndex = anIndex->Index(typ, k);
+      if (aSubIndex == 1) {
+        // the shape itself is not exploded
+        continue;
       }
+      i++;
+      Sprintf(p,"%d",i);
+      DBRep::Set(newname,anIndex->Shape(S, aSubIndex));
+      di.AppendElement(newname);
     }
   }
   return 0;
@@ -663,30 +666,25 @@ static Standard_Integer nexplode(Draw_Interpretor& di,
     default :
       return 1;
   }
-  TopTools_IndexedMapOfShape IMOStmp;
-  TopTools_MapOfShape MShape;
-  IMOStmp.Add(S);
-  TopExp::MapShapes(S,typ,IMOStmp);
-  TopExp_Explorer Exp(S,typ);
-  Standard_Integer MaxShapes, Index = 0;
-  MaxShapes = IMOStmp.Extent()-1;
-  TopTools_Array1OfShape aShapes(1,MaxShapes);
+  // the index of sub-shapes is shared by the repeated explorations of the shape
+  Handle(TopExp_ShapeIndex) anIndex = TopExp_ShapeIndex::Get(S);
+  Standard_Integer MaxShapes = 0, Index;
+  TopTools_Array1OfShape aShapes(1, Max(anIndex->NbShapes(typ), 1));
   
   // explode 
-  while (Exp.More()) {
-    if (MShape.Add(Exp.Current())) {
-      Index++;
-      aShapes.SetValue(Index,Exp.Current());
+  for (Index = 1; Index <= anIndex->NbShapes(typ); Index++) {
+    const Standard_Integer aSubIndex = anIndex->Index(typ, Index);
+    if (aSubIndex != 1) {
+      MaxShapes++;
+      aShapes.SetValue(MaxShapes, anIndex->Shape(S, aSubIndex));
     }
-    Exp.Next();
   }
+  if (MaxShapes == 0) return 0;
   //
   TColStd_Array1OfInteger OrderInd(1,MaxShapes);
   gp_Pnt GPoint;
   GProp_GProps GPr;
-  Standard_Integer aTemp;
   TColStd_Array1OfReal MidXYZ(1,MaxShapes); //X,Y,Z;
-  Standard_Boolean NoSort = Standard_True;
   //
   // Computing of CentreOfMass for edge and face
   // and for vertex use its point
@@ -703,18 +701,12 @@ static Standard_Integer nexplode(Draw_Interpretor& di,
     MidXYZ.SetValue(Index, GPoint.X()*999 + GPoint.Y()*99 +
 		    GPoint.Z()*0.9);
   }   
-  // Sorting
-  while(NoSort) {
-    NoSort = Standard_False;
-    for (Index=1; Index < MaxShapes; Index++) {
-      if (MidXYZ(OrderInd(Index)) > MidXYZ(OrderInd(Index+1))) {
-        aTemp = OrderInd(Index);
-        OrderInd(Index) = OrderInd(Index+1);
-        OrderInd(Index+1) = aTemp;
-        NoSort = Standard_True;
-      }
-    }
-  }
+  // Sorting (stable, the shapes with equal keys keep the order of exploration)
+  std::stable_sort (&OrderInd.ChangeFirst(), &OrderInd.ChangeLast() + 1,
+                    [&MidXYZ] (const Standard_Integer theI1, const Standard_Integer theI2)
+                    {
+                      return MidXYZ(theI1) < MidXYZ(theI2);
+                    });
   // Check of equality of MidXYZ
   for (Index=1; Index < MaxShapes; Index++) {
     if (MidXYZ(OrderInd(Index+1)) == MidXYZ(OrderInd(Index)))
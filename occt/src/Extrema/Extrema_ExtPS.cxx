@@ -365,6 +365,48 @@ void Extrema_ExtPS::Perform(const gp_Pnt& thePoint)
 }
 
 
+//=======================================================================
+//function : Perform
+//purpose  : 
+//=======================================================================
+
+void Extrema_ExtPS::Perform (const gp_Pnt&       thePoint,
+                             const Standard_Real theU0,
+                             const Standard_Real theV0)
+{
+  switch (mytype)
+  {
+    case GeomAbs_Cylinder:
+    case GeomAbs_Plane:
+    case GeomAbs_Cone:
+    case GeomAbs_Sphere:
+    case GeomAbs_Torus:
+    case GeomAbs_SurfaceOfExtrusion:
+    case GeomAbs_SurfaceOfRevolution:
+    {
+      // the solutions are computed analytically or by specific algorithms, the seed is not used
+      Perform (thePoint);
+      return;
+    }
+    default:
+      break;
+  }
+
+  myPoints.Clear();
+  mySqDist.Clear();
+
+  myExtPS.Perform (thePoint, theU0, theV0);
+  myDone = myExtPS.IsDone();
+  if (myDone)
+  {
+    for (Standard_Integer anIdx = 1; anIdx <= myExtPS.NbExt(); ++anIdx)
+    {
+      TreatSolution (myExtPS.Point (anIdx), myExtPS.SquareDistance (anIdx));
+    }
+  }
+}
+
+
 Standard_Boolean Extrema_ExtPS::IsDone() const
 {
   return myDone;
@@ -75,6 +75,15 @@ public:
   //! An exception is raised if the fieds have not been
   //! initialized.
   Standard_EXPORT void Perform (const gp_Pnt& P);
+
+  //! Computes the distances starting the search from the parameters (theU0, theV0),
+  //! e.g. the solution for the previous point of the sequence of close points.
+  //! The seed is used by the general algorithm (Extrema_GenExtPS) only,
+  //! for the analytical surfaces and the surfaces of extrusion and revolution
+  //! the method is equivalent to Perform (P).
+  Standard_EXPORT void Perform (const gp_Pnt&       P,
+                                const Standard_Real theU0,
+                                const Standard_Real theV0);
   
   //! Returns True if the distances are found.
   Standard_EXPORT Standard_Boolean IsDone() const;
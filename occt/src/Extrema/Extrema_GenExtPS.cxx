@@ -18,10 +18,10 @@
 
 #include <Extrema_GenExtPS.hxx>
 
-#include <Bnd_HArray1OfSphere.hxx>
-#include <Bnd_Sphere.hxx>
+#include <BVH_Distance.hxx>
+#include <BVH_LinearBuilder.hxx>
+#include <BVH_Tools.hxx>
 #include <Extrema_ExtFlag.hxx>
-#include <Extrema_HUBTreeOfSphere.hxx>
 #include <Extrema_POnSurf.hxx>
 #include <Extrema_POnSurfParams.hxx>
 #include <Geom_BezierCurve.hxx>
@@ -37,129 +37,195 @@
 #include <StdFail_NotDone.hxx>
 #include <TColStd_Array2OfInteger.hxx>
 
-//IMPLEMENT_HARRAY1(Extrema_HArray1OfSphere)
-class Bnd_SphereUBTreeSelector : public Extrema_UBTreeOfSphere::Selector
-{
- public:
-
-  Bnd_SphereUBTreeSelector (const Handle(Bnd_HArray1OfSphere)& theSphereArray,
-Bnd_Sphere& theSol)
-    : myXYZ(0,0,0),
-      mySphereArray(theSphereArray),
-      mySol(theSol)
-  {
-  }
-
-  void DefineCheckPoint( const gp_Pnt& theXYZ )
-  { myXYZ = theXYZ; }
-
-  Bnd_Sphere& Sphere() const
-  { return mySol; }
+typedef BVH_BoxSet<Standard_Real, 3, Standard_Integer> Extrema_GenExtPS_CellSet;
+typedef BVH_Box<Standard_Real, 3>::BVH_VecNt BVH_Vec3d;
 
-  virtual Standard_Boolean Reject( const Bnd_Sphere &theBnd ) const = 0;
-  
-  virtual Standard_Boolean Accept(const Standard_Integer& theObj) = 0;
- protected:
-  gp_Pnt                              myXYZ;
-  const Handle(Bnd_HArray1OfSphere)&  mySphereArray;
-  Bnd_Sphere&                         mySol;
- private:
-  void operator= (const Bnd_SphereUBTreeSelector&);
-
-};
-
-class Bnd_SphereUBTreeSelectorMin : public Bnd_SphereUBTreeSelector
+namespace
 {
-public:
-  Bnd_SphereUBTreeSelectorMin (const Handle(Bnd_HArray1OfSphere)& theSphereArray,
-		Bnd_Sphere& theSol)
-		: Bnd_SphereUBTreeSelector(theSphereArray, theSol),
-		  myMinDist(RealLast())
-  {}
-  
-  void SetMinDist( const Standard_Real theMinDist )
-  { myMinDist = theMinDist; }
-
-  Standard_Real MinDist() const
-  { return myMinDist; }
-
-  Standard_Boolean Reject( const Bnd_Sphere &theBnd ) const
-  { 
-    Bnd_SphereUBTreeSelectorMin* me =
-      const_cast<Bnd_SphereUBTreeSelectorMin*>(this);
-    // myMinDist is decreased each time a nearer object is found
-    return theBnd.IsOut( myXYZ.XYZ(), me->myMinDist );
+  //! Computes the square distances from the point to the four corners of the cell
+  //! of the sample grid with the given index of the lower-left corner.
+  //! The distances are computed at once on the packed coordinates of the corners.
+  static inline void cornerSquareDistances (const NCollection_Array2<gp_XYZ>& thePoints,
+                                            const Standard_Integer            theU,
+                                            const Standard_Integer            theV,
+                                            const gp_XYZ&                     thePoint,
+                                            Standard_Real                     theSqDists[4])
+  {
+    const gp_XYZ* aCorners[4] =
+    {
+      &thePoints.Value (theU,     theV),
+      &thePoints.Value (theU + 1, theV),
+      &thePoints.Value (theU,     theV + 1),
+      &thePoints.Value (theU + 1, theV + 1)
+    };
+    Standard_Real aX[4], aY[4], aZ[4];
+    for (Standard_Integer i = 0; i < 4; ++i)
+    {
+      aX[i] = aCorners[i]->X();
+      aY[i] = aCorners[i]->Y();
+      aZ[i] = aCorners[i]->Z();
+    }
+    for (Standard_Integer i = 0; i < 4; ++i)
+    {
+      const Standard_Real aDX = aX[i] - thePoint.X();
+      const Standard_Real aDY = aY[i] - thePoint.Y();
+      const Standard_Real aDZ = aZ[i] - thePoint.Z();
+      theSqDists[i] = aDX * aDX + aDY * aDY + aDZ * aDZ;
+    }
   }
 
-  Standard_Boolean Accept(const Standard_Integer&);
-
-private:
-	Standard_Real	myMinDist;
-};
+  //=======================================================================
+  //class : Extrema_GenExtPS_NearestSample
+  //purpose  : Search of the nearest sample in the BVH tree of the cells
+  //=======================================================================
+  class Extrema_GenExtPS_NearestSample :
+    public BVH_Distance<Standard_Real, 3, BVH_Vec3d, Extrema_GenExtPS_CellSet>
+  {
+  public:
+
+    //! Constructor
+    Extrema_GenExtPS_NearestSample (const NCollection_Array2<gp_XYZ>& thePoints,
+                                    const Standard_Real               theMaxSqDist)
+    : myPoints (thePoints),
+      myU (0),
+      myV (0)
+    {
+      myDistance = theMaxSqDist;
+    }
 
-Standard_Boolean Bnd_SphereUBTreeSelectorMin::Accept(const Standard_Integer& theInd)
-{
-  const Bnd_Sphere& aSph = mySphereArray->Value(theInd);
-  Standard_Real aCurDist;
+    //! Returns indices of the nearest sample, zeros if it is not found
+    void Indices (Standard_Integer& theU, Standard_Integer& theV) const
+    {
+      theU = myU;
+      theV = myV;
+    }
 
-//    if ( (aCurDist = aSph.SquareDistance(myXYZ.XYZ())) < mySol.SquareDistance(myXYZ.XYZ()) )
-    if ( (aCurDist = aSph.Distance(myXYZ.XYZ())) < mySol.Distance(myXYZ.XYZ()) )
+    //! Rejects the node by the square distance to its box
+    virtual Standard_Boolean RejectNode (const BVH_Vec3d& theCMin,
+                                         const BVH_Vec3d& theCMax,
+                                         Standard_Real& theMetric) const Standard_OVERRIDE
     {
-      mySol = aSph;
-      if ( aCurDist < myMinDist ) 
-        myMinDist = aCurDist;
+      theMetric = BVH_Tools<Standard_Real, 3>::PointBoxSquareDistance (myObject, theCMin, theCMax);
+      return RejectMetric (theMetric);
+    }
 
-      return Standard_True;
+    //! Checks the corners of the cell
+    virtual Standard_Boolean Accept (const Standard_Integer theIndex,
+                                     const Standard_Real&) Standard_OVERRIDE
+    {
+      const Standard_Integer aCell = myBVHSet->Element (theIndex);
+      const Standard_Integer aU = aCell / (myPoints.UpperCol() - 1) + 1;
+      const Standard_Integer aV = aCell % (myPoints.UpperCol() - 1) + 1;
+      Standard_Real aSqDists[4];
+      cornerSquareDistances (myPoints, aU, aV, gp_XYZ (myObject.x(), myObject.y(), myObject.z()), aSqDists);
+
+      Standard_Boolean isAccepted = Standard_False;
+      for (Standard_Integer i = 0; i < 4; ++i)
+      {
+        if (aSqDists[i] < myDistance)
+        {
+          myDistance = aSqDists[i];
+          myU = aU + (i & 1);
+          myV = aV + (i >> 1);
+          isAccepted = Standard_True;
+        }
+      }
+      return isAccepted;
     }
 
-  return Standard_False;
-}
+  private:
 
-class Bnd_SphereUBTreeSelectorMax : public Bnd_SphereUBTreeSelector
-{
-public:
-  Bnd_SphereUBTreeSelectorMax (const Handle(Bnd_HArray1OfSphere)& theSphereArray,
-		Bnd_Sphere& theSol)
-		: Bnd_SphereUBTreeSelector(theSphereArray, theSol),
-		  myMaxDist(0)
-  {}
-
-  void SetMaxDist( const Standard_Real theMaxDist )
-  { myMaxDist = theMaxDist; }
-
-  Standard_Real MaxDist() const
-  { return myMaxDist; }
-
-  Standard_Boolean Reject( const Bnd_Sphere &theBnd ) const
-  { 
-    Bnd_SphereUBTreeSelectorMax* me =
-      const_cast<Bnd_SphereUBTreeSelectorMax*>(this);
-    // myMaxDist is decreased each time a nearer object is found
-    return theBnd.IsOut( myXYZ.XYZ(), me->myMaxDist );
-  }
+    const NCollection_Array2<gp_XYZ>& myPoints;
+    Standard_Integer myU;
+    Standard_Integer myV;
+  };
 
-  Standard_Boolean Accept(const Standard_Integer&);
+  //=======================================================================
+  //class : Extrema_GenExtPS_FarthestSample
+  //purpose  : Search of the farthest sample in the BVH tree of the cells
+  //=======================================================================
+  class Extrema_GenExtPS_FarthestSample :
+    public BVH_Traverse<Standard_Real, 3, Extrema_GenExtPS_CellSet, Standard_Real>
+  {
+  public:
+
+    //! Constructor
+    Extrema_GenExtPS_FarthestSample (const NCollection_Array2<gp_XYZ>& thePoints,
+                                     const gp_XYZ&                     thePoint)
+    : myPoints (thePoints),
+      myPoint (thePoint),
+      mySqDist (-1.0),
+      myU (0),
+      myV (0)
+    {}
+
+    //! Returns indices of the farthest sample
+    void Indices (Standard_Integer& theU, Standard_Integer& theV) const
+    {
+      theU = myU;
+      theV = myV;
+    }
 
-private:
-	Standard_Real	myMaxDist;
-};
+    //! Prefers the nodes with the greater upper bound of the distance
+    virtual Standard_Boolean IsMetricBetter (const Standard_Real& theLeft,
+                                             const Standard_Real& theRight) const Standard_OVERRIDE
+    {
+      return theLeft > theRight;
+    }
 
-Standard_Boolean Bnd_SphereUBTreeSelectorMax::Accept(const Standard_Integer& theInd)
-{
-  const Bnd_Sphere& aSph = mySphereArray->Value(theInd);
-  Standard_Real aCurDist;
+    //! Rejects the nodes which can not contain the farther sample
+    virtual Standard_Boolean RejectMetric (const Standard_Real& theMetric) const Standard_OVERRIDE
+    {
+      return theMetric <= mySqDist;
+    }
 
-//    if ( (aCurDist = aSph.SquareDistance(myXYZ.XYZ())) > mySol.SquareDistance(myXYZ.XYZ()) )
-    if ( (aCurDist = aSph.Distance(myXYZ.XYZ())) > mySol.Distance(myXYZ.XYZ()) )
+    //! Rejects the node by the square distance to the farthest corner of its box
+    virtual Standard_Boolean RejectNode (const BVH_Vec3d& theCMin,
+                                         const BVH_Vec3d& theCMax,
+                                         Standard_Real& theMetric) const Standard_OVERRIDE
     {
-      mySol = aSph;
-      if ( aCurDist > myMaxDist ) 
-        myMaxDist = aCurDist;
+      theMetric = 0.0;
+      for (Standard_Integer i = 0; i < 3; ++i)
+      {
+        const Standard_Real aD = Max (Abs (myPoint.Coord (i + 1) - theCMin[i]),
+                                      Abs (myPoint.Coord (i + 1) - theCMax[i]));
+        theMetric += aD * aD;
+      }
+      return RejectMetric (theMetric);
+    }
 
-      return Standard_True;
+    //! Checks the corners of the cell
+    virtual Standard_Boolean Accept (const Standard_Integer theIndex,
+                                     const Standard_Real&) Standard_OVERRIDE
+    {
+      const Standard_Integer aCell = myBVHSet->Element (theIndex);
+      const Standard_Integer aU = aCell / (myPoints.UpperCol() - 1) + 1;
+      const Standard_Integer aV = aCell % (myPoints.UpperCol() - 1) + 1;
+      Standard_Real aSqDists[4];
+      cornerSquareDistances (myPoints, aU, aV, myPoint, aSqDists);
+
+      Standard_Boolean isAccepted = Standard_False;
+      for (Standard_Integer i = 0; i < 4; ++i)
+      {
+        if (aSqDists[i] > mySqDist)
+        {
+          mySqDist = aSqDists[i];
+          myU = aU + (i & 1);
+          myV = aV + (i >> 1);
+          isAccepted = Standard_True;
+        }
+      }
+      return isAccepted;
     }
 
-  return Standard_False;
+  private:
+
+    const NCollection_Array2<gp_XYZ>& myPoints;
+    gp_XYZ           myPoint;
+    Standard_Real    mySqDist;
+    Standard_Integer myU;
+    Standard_Integer myV;
+  };
 }
 
 //=============================================================================
@@ -313,7 +379,7 @@ void Extrema_GenExtPS::Initialize(const Adaptor3d_Surface& S,
 
   myF.Initialize(S);
 
-  mySphereUBTree.Nullify();
+  myCellTree.Nullify();
   myUParams.Nullify();
   myVParams.Nullify();
   myInit = Standard_False;
@@ -807,59 +873,107 @@ static void CorrectNbSamples(const Adaptor3d_Surface& theS,
 void Extrema_GenExtPS::BuildTree()
 {
   // if tree already exists, assume it is already correctly filled
-  if (!mySphereUBTree.IsNull())
+  if (!myCellTree.IsNull())
     return;
 
+  // the numbers of samples of the tree are kept apart from the ones of the grid,
+  // so that both algorithms could be used with the same initialization
+  Standard_Integer aNbU = myusample, aNbV = myvsample;
   if (myS->GetType() == GeomAbs_BSplineSurface) {
     Handle(Geom_BSplineSurface) aBspl = myS->BSpline();
     Standard_Integer aUValue = aBspl->UDegree() * aBspl->NbUKnots();
     Standard_Integer aVValue = aBspl->VDegree() * aBspl->NbVKnots();
     // 300 is value, which is used for singular points (see Extrema_ExtPS.cxx::Initialize(...))
-    if (aUValue > myusample)
-      myusample = Min(aUValue, 300);
-    if (aVValue > myvsample)
-      myvsample = Min(aVValue, 300);
+    if (aUValue > aNbU)
+      aNbU = Min(aUValue, 300);
+    if (aVValue > aNbV)
+      aNbV = Min(aVValue, 300);
   }
   //
-  CorrectNbSamples(*myS, myumin, myusup, myusample, myvmin, myvsup, myvsample);
+  CorrectNbSamples(*myS, myumin, myusup, aNbU, myvmin, myvsup, aNbV);
   //
   Standard_Real PasU = myusup - myumin;
   Standard_Real PasV = myvsup - myvmin;
-  Standard_Real U0 = PasU / myusample / 100.;
-  Standard_Real V0 = PasV / myvsample / 100.;
-  gp_Pnt P1;
-  PasU = (PasU - U0) / (myusample - 1);
-  PasV = (PasV - V0) / (myvsample - 1);
+  Standard_Real U0 = PasU / aNbU / 100.;
+  Standard_Real V0 = PasV / aNbV / 100.;
+  PasU = (PasU - U0) / (aNbU - 1);
+  PasV = (PasV - V0) / (aNbV - 1);
   U0 = U0/2. + myumin;
   V0 = V0/2. + myvmin;
 
   //build grid of parametric points 
-  myUParams = new TColStd_HArray1OfReal(1,myusample );
-  myVParams = new TColStd_HArray1OfReal(1,myvsample );
+  myTreeUParams.Resize (1, aNbU, Standard_False);
+  myTreeVParams.Resize (1, aNbV, Standard_False);
   Standard_Integer NoU, NoV;
   Standard_Real U = U0, V = V0;
-  for ( NoU = 1 ; NoU <= myusample; NoU++, U += PasU) 
-    myUParams->SetValue(NoU, U);
-  for ( NoV = 1, V = V0; NoV <= myvsample; NoV++, V += PasV)
-    myVParams->SetValue(NoV, V);
-
-  // Calculation of distances
-  mySphereUBTree = new Extrema_UBTreeOfSphere;
-  Extrema_UBTreeFillerOfSphere aFiller(*mySphereUBTree);
-  Standard_Integer i = 0;
-  
-  mySphereArray = new Bnd_HArray1OfSphere(0, myusample * myvsample);
- 
-  for ( NoU = 1; NoU <= myusample; NoU++ ) {
-    for ( NoV = 1; NoV <= myvsample; NoV++) {
-      P1 = myS->Value(myUParams->Value(NoU), myVParams->Value(NoV));
-      Bnd_Sphere aSph(P1.XYZ(), 0/*mytolu < mytolv ? mytolu : mytolv*/, NoU, NoV);
-      aFiller.Add(i, aSph);
-      mySphereArray->SetValue( i, aSph );
-      i++;
+  for ( NoU = 1 ; NoU <= aNbU; NoU++, U += PasU) 
+    myTreeUParams.SetValue(NoU, U);
+  for ( NoV = 1, V = V0; NoV <= aNbV; NoV++, V += PasV)
+    myTreeVParams.SetValue(NoV, V);
+
+  myTreePoints.Resize (1, aNbU, 1, aNbV, Standard_False);
+  for ( NoU = 1; NoU <= aNbU; NoU++ ) {
+    for ( NoV = 1; NoV <= aNbV; NoV++) {
+      myTreePoints.SetValue (NoU, NoV, myS->Value(myTreeUParams(NoU), myTreeVParams(NoV)).XYZ());
+    }
+  }
+
+  // the tree is built on the cells of the grid, the box of the cell
+  // contains its four corners
+  opencascade::handle<BVH_LinearBuilder<Standard_Real, 3> > aBuilder =
+    new BVH_LinearBuilder<Standard_Real, 3> (BVH_Constants_LeafNodeSizeSmall);
+  myCellTree = new Extrema_GenExtPS_CellSet (aBuilder);
+  myCellTree->SetSize ((aNbU - 1) * (aNbV - 1));
+  for ( NoU = 1; NoU < aNbU; NoU++ ) {
+    for ( NoV = 1; NoV < aNbV; NoV++) {
+      BVH_Box<Standard_Real, 3> aBox;
+      for (Standard_Integer i = 0; i < 4; ++i)
+      {
+        const gp_XYZ& aP = myTreePoints (NoU + (i & 1), NoV + (i >> 1));
+        aBox.Add (BVH_Vec3d (aP.X(), aP.Y(), aP.Z()));
+      }
+      myCellTree->Add ((NoU - 1) * (aNbV - 1) + NoV - 1, aBox);
+    }
+  }
+  myCellTree->Build();
+}
+
+//=======================================================================
+//function : FindTreeSolutions
+//purpose  : 
+//=======================================================================
+void Extrema_GenExtPS::FindTreeSolutions (const gp_Pnt& P, const Standard_Real theMinSqDist)
+{
+  Standard_Integer aU = 0, aV = 0;
+  if(myFlag == Extrema_ExtFlag_MIN || myFlag == Extrema_ExtFlag_MINMAX)
+  {
+    Extrema_GenExtPS_NearestSample aSelector (myTreePoints, theMinSqDist);
+    aSelector.SetObject (BVH_Vec3d (P.X(), P.Y(), P.Z()));
+    aSelector.SetBVHSet (myCellTree.get());
+    aSelector.ComputeDistance();
+    aSelector.Indices (aU, aV);
+    if (aU > 0)
+    {
+      Extrema_POnSurfParams aParams (myTreeUParams (aU), myTreeVParams (aV), myTreePoints (aU, aV));
+      aParams.SetSqrDistance (aSelector.Distance());
+      aParams.SetIndices (aU, aV);
+      FindSolution (P, aParams);
+    }
+  }
+  if(myFlag == Extrema_ExtFlag_MAX || myFlag == Extrema_ExtFlag_MINMAX)
+  {
+    Extrema_GenExtPS_FarthestSample aSelector (myTreePoints, P.XYZ());
+    aSelector.SetBVHSet (myCellTree.get());
+    aSelector.Select();
+    aSelector.Indices (aU, aV);
+    if (aU > 0)
+    {
+      Extrema_POnSurfParams aParams (myTreeUParams (aU), myTreeVParams (aV), myTreePoints (aU, aV));
+      aParams.SetSqrDistance (P.SquareDistance (aParams.Value()));
+      aParams.SetIndices (aU, aV);
+      FindSolution (P, aParams);
     }
   }
-  aFiller.Fill();
 }
 
 void Extrema_GenExtPS::FindSolution(const gp_Pnt& /*P*/, 
@@ -1030,42 +1144,47 @@ void Extrema_GenExtPS::Perform(const gp_Pnt& P)
   else
   {
     BuildTree();
-    if(myFlag == Extrema_ExtFlag_MIN || myFlag == Extrema_ExtFlag_MINMAX)
-    {
-      Bnd_Sphere aSol = mySphereArray->Value(0);
-      Bnd_SphereUBTreeSelectorMin aSelector(mySphereArray, aSol);
-      //aSelector.SetMaxDist( RealLast() );
-      aSelector.DefineCheckPoint( P );
-      mySphereUBTree->Select( aSelector );
-      //TODO: check if no solution in binary tree
-      Bnd_Sphere& aSph = aSelector.Sphere();
-      Standard_Real aU = myUParams->Value(aSph.U());
-      Standard_Real aV = myVParams->Value(aSph.V());
-      Extrema_POnSurfParams aParams(aU, aV, myS->Value(aU, aV));
-
-      aParams.SetSqrDistance(P.SquareDistance(aParams.Value()));
-      aParams.SetIndices(aSph.U(), aSph.V());
-      FindSolution(P, aParams);
-    }
-    if(myFlag == Extrema_ExtFlag_MAX || myFlag == Extrema_ExtFlag_MINMAX)
+    FindTreeSolutions (P, RealLast());
+  }
+}
+
+//=======================================================================
+//function : Perform
+//purpose  : 
+//=======================================================================
+void Extrema_GenExtPS::Perform (const gp_Pnt&       P,
+                                const Standard_Real theU0,
+                                const Standard_Real theV0)
+{
+  if (myAlgo == Extrema_ExtAlgo_Grad)
+  {
+    // all local extrema are searched over the whole grid, the seed is not needed
+    Perform (P);
+    return;
+  }
+
+  myDone = Standard_False;
+  myF.SetPoint(P);
+  BuildTree();
+
+  Standard_Real aMinSqDist = RealLast();
+  if(myFlag == Extrema_ExtFlag_MIN || myFlag == Extrema_ExtFlag_MINMAX)
+  {
+    // iterate from the given parameters
+    Extrema_POnSurfParams aParams (Max (myumin, Min (myusup, theU0)),
+                                   Max (myvmin, Min (myvsup, theV0)), gp_Pnt());
+    FindSolution (P, aParams);
+    for (Standard_Integer i = 1; i <= myF.NbExt(); ++i)
     {
-      Bnd_Sphere aSol = mySphereArray->Value(0);
-      Bnd_SphereUBTreeSelectorMax aSelector(mySphereArray, aSol);
-      //aSelector.SetMaxDist( RealLast() );
-      aSelector.DefineCheckPoint( P );
-      mySphereUBTree->Select( aSelector );
-      //TODO: check if no solution in binary tree
-      Bnd_Sphere& aSph = aSelector.Sphere();
-      Standard_Real aU = myUParams->Value(aSph.U());
-      Standard_Real aV = myVParams->Value(aSph.V());
-      Extrema_POnSurfParams aParams(aU, aV, myS->Value(aU, aV));
-      aParams.SetSqrDistance(P.SquareDistance(aParams.Value()));
-      aParams.SetIndices(aSph.U(), aSph.V());
-
-      FindSolution(P, aParams);
+      aMinSqDist = Min (aMinSqDist, myF.SquareDistance (i));
     }
   }
+
+  // the samples farther than the solution are not visited
+  FindTreeSolutions (P, aMinSqDist);
+  myDone = Standard_True;
 }
+
 //=============================================================================
 
 Standard_Boolean Extrema_GenExtPS::IsDone () const { return myDone; }
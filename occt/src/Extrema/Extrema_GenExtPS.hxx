@@ -17,13 +17,15 @@
 #ifndef _Extrema_GenExtPS_HeaderFile
 #define _Extrema_GenExtPS_HeaderFile
 
-#include <Bnd_HArray1OfSphere.hxx>
+#include <BVH_BoxSet.hxx>
 #include <Extrema_Array2OfPOnSurfParams.hxx>
 #include <Extrema_POnSurfParams.hxx>
-#include <Extrema_HUBTreeOfSphere.hxx>
 #include <Extrema_FuncPSNorm.hxx>
 #include <Extrema_ExtFlag.hxx>
 #include <Extrema_ExtAlgo.hxx>
+#include <gp_XYZ.hxx>
+#include <NCollection_Array2.hxx>
+#include <TColStd_Array1OfReal.hxx>
 #include <TColStd_HArray1OfReal.hxx>
 
 class Adaptor3d_Surface;
@@ -79,6 +81,20 @@ public:
   //! An exception is raised if the fields have not
   //! been initialized.
   Standard_EXPORT void Perform (const gp_Pnt& P);
+
+  //! Searches the minimum distance from the point P starting the iterations
+  //! from the parameters (theU0, theV0), e.g. the solution for the previous point
+  //! of the spatially coherent sequence of points (along a curve or across a grid).
+  //! The solution of the iterations is checked by the search of the nearest sample
+  //! of the surface in the BVH tree built on the cells of the sample grid:
+  //! if the sample is nearer than the solution, the iterations are restarted from
+  //! the sample as in Extrema_ExtAlgo_Tree algorithm.
+  //! The maximum distance is also searched if the flag requires it.
+  //! With Extrema_ExtAlgo_Grad algorithm the seed is ignored and the method
+  //! is equivalent to Perform (P).
+  Standard_EXPORT void Perform (const gp_Pnt&       P,
+                                const Standard_Real theU0,
+                                const Standard_Real theV0);
   
   Standard_EXPORT void SetFlag (const Extrema_ExtFlag F);
   
@@ -98,7 +114,13 @@ public:
 
 private:
   
+  //! Builds the BVH tree on the cells of the sample grid.
   Standard_EXPORT void BuildTree();
+
+  //! Searches the nearest and the farthest samples in the BVH tree
+  //! and starts the iterations from them.
+  //! The nearest sample is searched only if it is nearer than theMinSqDist.
+  void FindTreeSolutions (const gp_Pnt& P, const Standard_Real theMinSqDist);
   
   Standard_EXPORT void FindSolution (const gp_Pnt& P, const Extrema_POnSurfParams& theParams);
   
@@ -131,8 +153,10 @@ private:
   Standard_Real mytolv;
 
   Extrema_Array2OfPOnSurfParams myPoints;
-  Extrema_HUBTreeOfSphere mySphereUBTree;
-  Handle(Bnd_HArray1OfSphere) mySphereArray;
+  opencascade::handle<BVH_BoxSet<Standard_Real, 3, Standard_Integer> > myCellTree; //!< BVH tree on the cells of the sample grid
+  TColStd_Array1OfReal myTreeUParams;       //!< U parameters of the samples of the tree
+  TColStd_Array1OfReal myTreeVParams;       //!< V parameters of the samples of the tree
+  NCollection_Array2<gp_XYZ> myTreePoints;  //!< Samples of the tree
   Extrema_FuncPSNorm myF;
   const Adaptor3d_Surface* myS;
   Extrema_ExtFlag myFlag;
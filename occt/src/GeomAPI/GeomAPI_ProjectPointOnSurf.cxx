@@ -258,6 +258,17 @@ GeomAPI_ProjectPointOnSurf::GeomAPI_ProjectPointOnSurf()
   Init ();
 }
 //=======================================================================
+//function : Perform
+//purpose  : 
+//=======================================================================
+  void GeomAPI_ProjectPointOnSurf::Perform(const gp_Pnt&       P,
+                                           const Standard_Real theU0,
+                                           const Standard_Real theV0)
+{
+  myExtPS.Perform(P, theU0, theV0);
+  Init ();
+}
+//=======================================================================
 //function : IsDone
 //purpose  : 
 //=======================================================================
@@ -95,6 +95,16 @@ public:
 
   //! Performs the projection of a point on the current surface.
   Standard_EXPORT void Perform (const gp_Pnt& P);
+
+  //! Performs the projection of a point on the current surface
+  //! starting the search from the parameters (theU0, theV0),
+  //! e.g. the projection of the previous point of the sequence of close points.
+  //! The seed is used by Extrema_ExtAlgo_Tree algorithm only (see SetExtremaAlgo()).
+  //! The default Extrema_ExtAlgo_Grad algorithm searches all local extrema over
+  //! the whole sampling grid, ignores the seed and is equivalent to Perform (P).
+  Standard_EXPORT void Perform (const gp_Pnt&       P,
+                                const Standard_Real theU0,
+                                const Standard_Real theV0);
   
   Standard_EXPORT Standard_Boolean IsDone() const;
   
@@ -1289,6 +1289,97 @@ void GeomAdaptor_Curve::D1(const Standard_Real U, gp_Pnt& P, gp_Vec& V) const
 }
 }
 
+//=======================================================================
+//function : EvaluatePoints
+//purpose  : 
+//=======================================================================
+
+void GeomAdaptor_Curve::EvaluatePoints (const TColStd_Array1OfReal& theParameters,
+                                        TColgp_Array1OfPnt&         thePoints) const
+{
+  evaluatePoints (theParameters, thePoints, NULL);
+}
+
+//=======================================================================
+//function : EvaluatePoints
+//purpose  : 
+//=======================================================================
+
+void GeomAdaptor_Curve::EvaluatePoints (const TColStd_Array1OfReal& theParameters,
+                                        TColgp_Array1OfPnt&         thePoints,
+                                        TColgp_Array1OfVec&         theD1) const
+{
+  evaluatePoints (theParameters, thePoints, &theD1);
+}
+
+//=======================================================================
+//function : evaluatePoints
+//purpose  : 
+//=======================================================================
+
+void GeomAdaptor_Curve::evaluatePoints (const TColStd_Array1OfReal& theParameters,
+                                        TColgp_Array1OfPnt&         thePoints,
+                                        TColgp_Array1OfVec*         theD1) const
+{
+  if (theParameters.IsEmpty())
+  {
+    return;
+  }
+
+  switch (myTypeCurve)
+  {
+  case GeomAbs_BezierCurve:
+  {
+    Handle(Geom_BezierCurve) aBezier = Handle(Geom_BezierCurve)::DownCast(myCurve);
+    Standard_Integer aDeg = aBezier->Degree();
+    TColStd_Array1OfReal aFlatKnots(BSplCLib::FlatBezierKnots(aDeg), 1, 2 * (aDeg + 1));
+    if (myCurveCache.IsNull())
+      myCurveCache = new BSplCLib_Cache(aDeg, aBezier->IsPeriodic(), aFlatKnots,
+        aBezier->Poles(), aBezier->Weights());
+    myCurveCache->EvaluatePoints (theParameters, aFlatKnots, aBezier->Poles(), aBezier->Weights(),
+                                  thePoints, theD1);
+    return;
+  }
+
+  case GeomAbs_BSplineCurve:
+  {
+    if (myCurveCache.IsNull())
+      myCurveCache = new BSplCLib_Cache(myBSplineCurve->Degree(), myBSplineCurve->IsPeriodic(),
+        myBSplineCurve->KnotSequence(), myBSplineCurve->Poles(), myBSplineCurve->Weights());
+    myCurveCache->EvaluatePoints (theParameters, myBSplineCurve->KnotSequence(),
+                                  myBSplineCurve->Poles(), myBSplineCurve->Weights(),
+                                  thePoints, theD1);
+    // the values on the boundaries are computed on the bounding spans as in D0() and D1()
+    for (Standard_Integer anInd = 0; anInd < theParameters.Length(); ++anInd)
+    {
+      const Standard_Real aU = theParameters (theParameters.Lower() + anInd);
+      if (aU == myFirst || aU == myLast)
+      {
+        gp_Pnt& aPnt = thePoints (thePoints.Lower() + anInd);
+        if (theD1 != NULL)
+          D1 (aU, aPnt, theD1->ChangeValue (theD1->Lower() + anInd));
+        else
+          D0 (aU, aPnt);
+      }
+    }
+    return;
+  }
+
+  default:
+    break;
+  }
+
+  for (Standard_Integer anInd = 0; anInd < theParameters.Length(); ++anInd)
+  {
+    const Standard_Real aU = theParameters (theParameters.Lower() + anInd);
+    gp_Pnt& aPnt = thePoints (thePoints.Lower() + anInd);
+    if (theD1 != NULL)
+      D1 (aU, aPnt, theD1->ChangeValue (theD1->Lower() + anInd));
+    else
+      D0 (aU, aPnt);
+  }
+}
+
 //=======================================================================
 //function : D2
 //purpose  : 
@@ -24,6 +24,9 @@
 #include <GeomEvaluator_Curve.hxx>
 #include <Standard_NullObject.hxx>
 #include <Standard_ConstructionError.hxx>
+#include <TColgp_Array1OfPnt.hxx>
+#include <TColgp_Array1OfVec.hxx>
+#include <TColStd_Array1OfReal.hxx>
 
 DEFINE_STANDARD_HANDLE(GeomAdaptor_Curve, Adaptor3d_Curve)
 
@@ -123,6 +126,22 @@ public:
   //! derivatives are computed on the current interval.
   //! else the derivatives are computed on the basis curve.
   Standard_EXPORT void D1 (const Standard_Real U, gp_Pnt& P, gp_Vec& V) const Standard_OVERRIDE;
+
+  //! Computes the points of the given parameters on the curve.
+  //! For Bezier and B-spline curves the parameters are evaluated grouped
+  //! by the spans of the curve, so that the polynomial coefficients are
+  //! cached only once for each span containing the parameters.
+  //! The points are stored in the same order as the parameters.
+  Standard_EXPORT void EvaluatePoints (const TColStd_Array1OfReal& theParameters,
+                                       TColgp_Array1OfPnt&         thePoints) const;
+
+  //! Computes the points and the first derivatives of the given parameters on the curve.
+  //! The parameters are grouped by the spans of Bezier and B-spline curves as in the method above.
+  //! The values on the boundaries of the curve are computed as in D1().
+  //! The points and the derivatives are stored in the same order as the parameters.
+  Standard_EXPORT void EvaluatePoints (const TColStd_Array1OfReal& theParameters,
+                                       TColgp_Array1OfPnt&         thePoints,
+                                       TColgp_Array1OfVec&         theD1) const;
   
 
   //! Returns the point P of parameter U, the first and second
@@ -224,6 +243,11 @@ private:
   //! \param theParameter the value on the knot axis which identifies the caching span
   void RebuildCache (const Standard_Real theParameter) const;
 
+  //! Computes the points and optionally the first derivatives of the given parameters on the curve.
+  void evaluatePoints (const TColStd_Array1OfReal& theParameters,
+                       TColgp_Array1OfPnt&         thePoints,
+                       TColgp_Array1OfVec*         theD1) const;
+
 private:
 
   Handle(Geom_Curve) myCurve;
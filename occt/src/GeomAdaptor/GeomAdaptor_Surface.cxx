@@ -803,6 +803,164 @@ void GeomAdaptor_Surface::D1(const Standard_Real U,
   }
 }
 
+//=======================================================================
+//function : EvaluatePoints
+//purpose  : 
+//=======================================================================
+
+void GeomAdaptor_Surface::EvaluatePoints (const TColgp_Array1OfPnt2d& theUVs,
+                                          TColgp_Array1OfPnt&         thePoints) const
+{
+  evaluatePoints (theUVs, thePoints, NULL, NULL);
+}
+
+//=======================================================================
+//function : EvaluatePoints
+//purpose  : 
+//=======================================================================
+
+void GeomAdaptor_Surface::EvaluatePoints (const TColgp_Array1OfPnt2d& theUVs,
+                                          TColgp_Array1OfPnt&         thePoints,
+                                          TColgp_Array1OfVec&         theD1U,
+                                          TColgp_Array1OfVec&         theD1V) const
+{
+  evaluatePoints (theUVs, thePoints, &theD1U, &theD1V);
+}
+
+//=======================================================================
+//function : evaluatePoints
+//purpose  : 
+//=======================================================================
+
+void GeomAdaptor_Surface::evaluatePoints (const TColgp_Array1OfPnt2d& theUVs,
+                                          TColgp_Array1OfPnt&         thePoints,
+                                          TColgp_Array1OfVec*         theD1U,
+                                          TColgp_Array1OfVec*         theD1V) const
+{
+  if (theUVs.IsEmpty())
+  {
+    return;
+  }
+
+  switch (mySurfaceType)
+  {
+  case GeomAbs_BezierSurface:
+  {
+    Handle(Geom_BezierSurface) aBezier = Handle(Geom_BezierSurface)::DownCast(mySurface);
+    Standard_Integer aDegU = aBezier->UDegree();
+    Standard_Integer aDegV = aBezier->VDegree();
+    TColStd_Array1OfReal aFlatKnotsU(BSplCLib::FlatBezierKnots(aDegU), 1, 2 * (aDegU + 1));
+    TColStd_Array1OfReal aFlatKnotsV(BSplCLib::FlatBezierKnots(aDegV), 1, 2 * (aDegV + 1));
+    if (mySurfaceCache.IsNull())
+      mySurfaceCache = new BSplSLib_Cache(
+        aDegU, aBezier->IsUPeriodic(), aFlatKnotsU,
+        aDegV, aBezier->IsVPeriodic(), aFlatKnotsV, aBezier->Weights());
+    mySurfaceCache->EvaluatePoints (theUVs, aFlatKnotsU, aFlatKnotsV,
+                                    aBezier->Poles(), aBezier->Weights(),
+                                    thePoints, theD1U, theD1V);
+    return;
+  }
+
+  case GeomAbs_BSplineSurface:
+  {
+    if (mySurfaceCache.IsNull())
+      mySurfaceCache = new BSplSLib_Cache(
+        myBSplineSurface->UDegree(), myBSplineSurface->IsUPeriodic(), myBSplineSurface->UKnotSequence(),
+        myBSplineSurface->VDegree(), myBSplineSurface->IsVPeriodic(), myBSplineSurface->VKnotSequence(),
+        myBSplineSurface->Weights());
+    mySurfaceCache->EvaluatePoints (theUVs, myBSplineSurface->UKnotSequence(), myBSplineSurface->VKnotSequence(),
+                                    myBSplineSurface->Poles(), myBSplineSurface->Weights(),
+                                    thePoints, theD1U, theD1V);
+    if (theD1U != NULL)
+    {
+      // the derivatives on the boundaries are computed on the bounding spans as in D1()
+      for (Standard_Integer anInd = 0; anInd < theUVs.Length(); ++anInd)
+      {
+        const gp_Pnt2d& aUV = theUVs (theUVs.Lower() + anInd);
+        if (Abs (aUV.X() - myUFirst) <= myTolU || Abs (aUV.X() - myULast) <= myTolU
+         || Abs (aUV.Y() - myVFirst) <= myTolV || Abs (aUV.Y() - myVLast) <= myTolV)
+        {
+          D1 (aUV.X(), aUV.Y(), thePoints (thePoints.Lower() + anInd),
+              theD1U->ChangeValue (theD1U->Lower() + anInd), theD1V->ChangeValue (theD1V->Lower() + anInd));
+        }
+      }
+    }
+    return;
+  }
+
+  default:
+    break;
+  }
+
+  for (Standard_Integer anInd = 0; anInd < theUVs.Length(); ++anInd)
+  {
+    const gp_Pnt2d& aUV = theUVs (theUVs.Lower() + anInd);
+    gp_Pnt& aPnt = thePoints (thePoints.Lower() + anInd);
+    if (theD1U != NULL)
+      D1 (aUV.X(), aUV.Y(), aPnt, theD1U->ChangeValue (theD1U->Lower() + anInd), theD1V->ChangeValue (theD1V->Lower() + anInd));
+    else
+      D0 (aUV.X(), aUV.Y(), aPnt);
+  }
+}
+
+//=======================================================================
+//function : EvaluateGrid
+//purpose  : 
+//=======================================================================
+
+void GeomAdaptor_Surface::EvaluateGrid (const TColStd_Array1OfReal& theUs,
+                                        const TColStd_Array1OfReal& theVs,
+                                        TColgp_Array2OfPnt&         thePoints) const
+{
+  if (theUs.IsEmpty() || theVs.IsEmpty())
+  {
+    return;
+  }
+
+  switch (mySurfaceType)
+  {
+  case GeomAbs_BezierSurface:
+  {
+    Handle(Geom_BezierSurface) aBezier = Handle(Geom_BezierSurface)::DownCast(mySurface);
+    Standard_Integer aDegU = aBezier->UDegree();
+    Standard_Integer aDegV = aBezier->VDegree();
+    TColStd_Array1OfReal aFlatKnotsU(BSplCLib::FlatBezierKnots(aDegU), 1, 2 * (aDegU + 1));
+    TColStd_Array1OfReal aFlatKnotsV(BSplCLib::FlatBezierKnots(aDegV), 1, 2 * (aDegV + 1));
+    if (mySurfaceCache.IsNull())
+      mySurfaceCache = new BSplSLib_Cache(
+        aDegU, aBezier->IsUPeriodic(), aFlatKnotsU,
+        aDegV, aBezier->IsVPeriodic(), aFlatKnotsV, aBezier->Weights());
+    mySurfaceCache->EvaluateGrid (theUs, theVs, aFlatKnotsU, aFlatKnotsV,
+                                  aBezier->Poles(), aBezier->Weights(), thePoints);
+    return;
+  }
+
+  case GeomAbs_BSplineSurface:
+  {
+    if (mySurfaceCache.IsNull())
+      mySurfaceCache = new BSplSLib_Cache(
+        myBSplineSurface->UDegree(), myBSplineSurface->IsUPeriodic(), myBSplineSurface->UKnotSequence(),
+        myBSplineSurface->VDegree(), myBSplineSurface->IsVPeriodic(), myBSplineSurface->VKnotSequence(),
+        myBSplineSurface->Weights());
+    mySurfaceCache->EvaluateGrid (theUs, theVs, myBSplineSurface->UKnotSequence(), myBSplineSurface->VKnotSequence(),
+                                  myBSplineSurface->Poles(), myBSplineSurface->Weights(), thePoints);
+    return;
+  }
+
+  default:
+    break;
+  }
+
+  for (Standard_Integer anIndU = 0; anIndU < theUs.Length(); ++anIndU)
+  {
+    for (Standard_Integer anIndV = 0; anIndV < theVs.Length(); ++anIndV)
+    {
+      D0 (theUs (theUs.Lower() + anIndU), theVs (theVs.Lower() + anIndV),
+          thePoints (thePoints.LowerRow() + anIndU, thePoints.LowerCol() + anIndV));
+    }
+  }
+}
+
 //=======================================================================
 //function : D2
 //purpose  : 
@@ -23,6 +23,10 @@
 #include <GeomEvaluator_Surface.hxx>
 #include <Geom_Surface.hxx>
 #include <Standard_NullObject.hxx>
+#include <TColgp_Array1OfPnt.hxx>
+#include <TColgp_Array1OfPnt2d.hxx>
+#include <TColgp_Array1OfVec.hxx>
+#include <TColgp_Array2OfPnt.hxx>
 #include <TColStd_Array1OfReal.hxx>
 
 DEFINE_STANDARD_HANDLE(GeomAdaptor_Surface, Adaptor3d_Surface)
@@ -155,6 +159,31 @@ public:
   //! else the derivatives are computed on the basis surface.
   Standard_EXPORT void D1 (const Standard_Real U, const Standard_Real V, gp_Pnt& P, gp_Vec& D1U, gp_Vec& D1V) const Standard_OVERRIDE;
   
+  //! Computes the points of the given parameters on the surface.
+  //! For Bezier and B-spline surfaces the parameters are evaluated grouped
+  //! by the spans of the surface, so that the polynomial coefficients are
+  //! cached only once for each span containing the parameters.
+  //! The points are stored in the same order as the parameters.
+  Standard_EXPORT void EvaluatePoints (const TColgp_Array1OfPnt2d& theUVs,
+                                       TColgp_Array1OfPnt&         thePoints) const;
+
+  //! Computes the points and the first derivatives of the given parameters on the surface.
+  //! The parameters are grouped by the spans of Bezier and B-spline surfaces as in the method above.
+  //! The derivatives on the boundaries of the surface are computed as in D1().
+  //! The points and the derivatives are stored in the same order as the parameters.
+  Standard_EXPORT void EvaluatePoints (const TColgp_Array1OfPnt2d& theUVs,
+                                       TColgp_Array1OfPnt&         thePoints,
+                                       TColgp_Array1OfVec&         theD1U,
+                                       TColgp_Array1OfVec&         theD1V) const;
+
+  //! Computes the points of the surface in the nodes of the grid of parameters.
+  //! For Bezier and B-spline surfaces the polynomial coefficients are cached
+  //! only once for each pair of spans containing the nodes.
+  //! The rows and the columns of the points are stored in the order of U and V parameters.
+  Standard_EXPORT void EvaluateGrid (const TColStd_Array1OfReal& theUs,
+                                     const TColStd_Array1OfReal& theVs,
+                                     TColgp_Array2OfPnt&         thePoints) const;
+
   //! Computes   the point,  the  first  and  second
   //! derivatives on the surface.
   //!
@@ -260,6 +289,12 @@ private:
   //! \param theV second parameter to identify the span for caching
   Standard_EXPORT void RebuildCache (const Standard_Real theU, const Standard_Real theV) const;
 
+  //! Computes the points and optionally the first derivatives of the given parameters on the surface.
+  void evaluatePoints (const TColgp_Array1OfPnt2d& theUVs,
+                       TColgp_Array1OfPnt&         thePoints,
+                       TColgp_Array1OfVec*         theD1U,
+                       TColgp_Array1OfVec*         theD1V) const;
+
   protected:
 
   Handle(Geom_Surface) mySurface;
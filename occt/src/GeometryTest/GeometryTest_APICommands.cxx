@@ -83,7 +83,7 @@ static Standard_Integer proj (Draw_Interpretor& di, Standard_Integer n, const ch
 {
   if ( n < 5)
   {
-    Message::SendFail() << " Use proj curve/surf x y z [{extrema algo: g(grad)/t(tree)}|{u v}]";
+    Message::SendFail() << " Use proj curve/surf x y z [{extrema algo: g(grad)/t(tree)} [u v]]|[u v]";
     return 1;
   }
 
@@ -93,7 +93,7 @@ static Standard_Integer proj (Draw_Interpretor& di, Standard_Integer n, const ch
   Handle(Geom_Surface) GS;
   Extrema_ExtAlgo aProjAlgo = Extrema_ExtAlgo_Grad;
 
-  if (n == 6 && a[5][0] == 't')
+  if ((n == 6 || n == 8) && a[5][0] == 't')
     aProjAlgo = Extrema_ExtAlgo_Tree;
 
   if (GC.IsNull())
@@ -140,6 +140,29 @@ static Standard_Integer proj (Draw_Interpretor& di, Standard_Integer n, const ch
       aP.Parameter(UU, VV);
       showProjSolution(di, 1, P, aP.Value(), UU, VV, Standard_True);
     }
+    else if (n == 8)
+    {
+      // global search starting from the given parameters
+      Standard_Real U1, U2, V1, V2;
+      GS->Bounds(U1,U2,V1,V2);
+
+      GeomAPI_ProjectPointOnSurf proj;
+      proj.Init(GS,U1,U2,V1,V2,aProjAlgo);
+      proj.Perform(P, Draw::Atof(a[6]), Draw::Atof(a[7]));
+      if (!proj.IsDone())
+      {
+        di << "projection failed.";
+        return 0;
+      }
+
+      Standard_Real UU,VV;
+      for ( Standard_Integer i = 1; i <= proj.NbPoints(); i++)
+      {
+        gp_Pnt P1 = proj.Point(i);
+        proj.Parameters(i, UU, VV);
+        showProjSolution(di, i, P, P1, UU, VV, Standard_True);
+      }
+    }
   }
   else
   {
@@ -685,9 +708,11 @@ void GeometryTest::APICommands(Draw_Interpretor& theCommands)
 
   done = Standard_True;
 
-  theCommands.Add("proj", "proj curve/surf x y z [{extrema algo: g(grad)/t(tree)}|{u v}]\n"
+  theCommands.Add("proj", "proj curve/surf x y z [{extrema algo: g(grad)/t(tree)} [u v]]|[u v]\n"
                   "\t\tOptional parameters are relevant to surf only.\n"
-                  "\t\tIf initial {u v} are given then local extrema is called",__FILE__, proj);
+                  "\t\tIf initial {u v} are given then local extrema is called.\n"
+                  "\t\tIf initial {u v} are given after the algo then global extrema is called\n"
+                  "\t\tstarting from {u v}",__FILE__, proj);
 
   theCommands.Add("appro", "appro result nbpoint [curve]",__FILE__, appro);
   theCommands.Add("surfapp","surfapp result nbupoint nbvpoint x y z ....",
@@ -38,12 +38,17 @@
 #include <IntRes2d_IntersectionSegment.hxx>
 #include <Precision.hxx>
 #include <Standard_Type.hxx>
+#include <BVH_Traverse.hxx>
+
+#include <algorithm>
 #include <StdFail_UndefinedDerivative.hxx>
 #include <TColStd_ListIteratorOfListOfInteger.hxx>
 
 #include <stdio.h>
 IMPLEMENT_STANDARD_RTTIEXT(HLRBRep_Data,Standard_Transient)
 
+// statistics of the hiding, counted in debug mode only
+// as several data structures may be processed in parallel threads
 Standard_Integer nbOkIntersection;
 Standard_Integer nbPtIntersection;
 Standard_Integer nbSegIntersection;
@@ -794,6 +799,83 @@ void HLRBRep_Data::Update (const HLRAlgo_Projector& P)
   }
 }
 
+//! Set of the boxes of edges to be hidden.
+typedef BVH_BoxSet<Standard_Real, 3, Standard_Integer> HLRBRep_EdgeBoxSet;
+
+//=======================================================================
+//function : HLRBRep_ProjectedBox
+//purpose  : Returns the box of the quantized projected coordinates
+//           used by the BVH of edges: the first two directions in the
+//           projection plane and the depth.
+//=======================================================================
+
+static BVH_Box<Standard_Real, 3> HLRBRep_ProjectedBox
+  (const HLRAlgo_EdgesBlock::MinMaxIndices& theMinMax)
+{
+  HLRAlgo_EdgesBlock::MinMaxIndices aMin, aMax;
+  HLRAlgo::DecodeMinMax (theMinMax, aMin, aMax);
+  return BVH_Box<Standard_Real, 3> (BVH_Vec3d (aMin.Min[0], aMin.Min[1], aMin.Max[6]),
+                                    BVH_Vec3d (aMax.Min[0], aMax.Min[1], aMax.Max[6]));
+}
+
+//! Selector of the edges with boxes overlapping the box of a hiding face.
+class HLRBRep_EdgeBoxSelector :
+  public BVH_Traverse <Standard_Real, 3, HLRBRep_EdgeBoxSet, Standard_Boolean>
+{
+public:
+
+  //! Sets the box of the hiding face
+  HLRBRep_EdgeBoxSelector (const BVH_Box<Standard_Real, 3>& theBox,
+                           TColStd_Array1OfInteger& theIndices)
+  : myBox (theBox),
+    myIndices (theIndices),
+    myNbIndices (0)
+  {}
+
+  //! Returns the number of selected edges
+  Standard_Integer NbIndices() const
+  {
+    return myNbIndices;
+  }
+
+  //! Checks if the node should be rejected
+  virtual Standard_Boolean RejectNode (const BVH_Vec3d& theCMin,
+                                       const BVH_Vec3d& theCMax,
+                                       Standard_Boolean& theIsInside) const Standard_OVERRIDE
+  {
+    Standard_Boolean hasOverlap;
+    theIsInside = myBox.Contains (theCMin, theCMax, hasOverlap);
+    return !hasOverlap;
+  }
+
+  //! Checks if the metric of the node may be accepted
+  virtual Standard_Boolean AcceptMetric (const Standard_Boolean& theIsInside) const Standard_OVERRIDE
+  {
+    return theIsInside;
+  }
+
+  //! Accepts the edge with the given index
+  virtual Standard_Boolean Accept (const Standard_Integer theIndex,
+                                   const Standard_Boolean& theIsInside) Standard_OVERRIDE
+  {
+    if (theIsInside || !myBox.IsOut (myBVHSet->Box (theIndex)))
+    {
+      myIndices (++myNbIndices) = myBVHSet->Element (theIndex);
+      return Standard_True;
+    }
+    return Standard_False;
+  }
+
+private:
+
+  HLRBRep_EdgeBoxSelector& operator= (const HLRBRep_EdgeBoxSelector&);
+
+private:
+  BVH_Box<Standard_Real, 3> myBox;
+  TColStd_Array1OfInteger&  myIndices;
+  Standard_Integer          myNbIndices;
+};
+
 //=======================================================================
 //function : InitBoundSort
 //purpose  : 
@@ -805,6 +887,7 @@ HLRBRep_Data::InitBoundSort (const HLRAlgo_EdgesBlock::MinMaxIndices& MinMaxTot,
 			     const Standard_Integer e2)
 {
   myNbrSortEd = 0;
+  myEdgeBoxes.Clear();
   const HLRAlgo_EdgesBlock::MinMaxIndices& MinMaxShap = MinMaxTot;
 
   for (Standard_Integer e = e1; e <= e2; e++) {
@@ -826,11 +909,15 @@ HLRBRep_Data::InitBoundSort (const HLRAlgo_EdgesBlock::MinMaxIndices& MinMaxTot,
 	  ((MinMaxShap.Max[6] - myLEMinMax->Min[6]) & 0x80008000) == 0 &&
 	  ((myLEMinMax->Max[6] - MinMaxShap.Min[6]) & 0x80008000) == 0 &&
 	  ((MinMaxShap.Max[7] - myLEMinMax->Min[7]) & 0x80008000) == 0) {  //- rejection en z 
-	myNbrSortEd++;
-	myEdgeIndices(myNbrSortEd) = e;
+	myEdgeBoxes.Add(e, HLRBRep_ProjectedBox(*myLEMinMax));
       }
     }
   }
+
+  // the edges crossing a hiding face are selected with the BVH
+  // instead of the comparison of the face with all these edges
+  if (myEdgeBoxes.Size() > 0)
+    myEdgeBoxes.Build();
 }
 
 //=======================================================================
@@ -854,6 +941,25 @@ void HLRBRep_Data::InitEdge (const Standard_Integer FI,
   mySLProps.SetSurface(iFaceGeom);
   myIntersector.Load(iFaceGeom);
 
+  // select the edges with the projected boxes overlapping the one of
+  // the face; the order of the edges is kept to get the same result
+  // as with the comparison of the face with all edges
+  myNbrSortEd = 0;
+  if (myEdgeBoxes.Size() > 0) {
+    BVH_Box<Standard_Real, 3> aFaceBox = HLRBRep_ProjectedBox (*iFaceMinMax);
+    // as in NextEdge(), the edges are not rejected by the minimal depth of the face
+    BVH_Vec3d aFaceMin = aFaceBox.CornerMin();
+    aFaceMin.z() = -RealLast();
+    aFaceBox = BVH_Box<Standard_Real, 3> (aFaceMin, aFaceBox.CornerMax());
+
+    HLRBRep_EdgeBoxSelector aSelector (aFaceBox, myEdgeIndices);
+    aSelector.SetBVHSet (&myEdgeBoxes);
+    aSelector.Select();
+    myNbrSortEd = aSelector.NbIndices();
+    if (myNbrSortEd > 1)
+      std::sort (&myEdgeIndices (1), &myEdgeIndices (1) + myNbrSortEd);
+  }
+
 
   HLRBRep_Surface  *p1 = (HLRBRep_Surface*)iFaceGeom;
   const BRepAdaptor_Surface& bras=p1->Surface();
@@ -1128,7 +1234,9 @@ void HLRBRep_Data::NextInterference ()
 	      }
 	    }
 	    if (!rej) {
+#ifdef OCCT_DEBUG
 	      nbCal1Intersection++;
+#endif
 	      Standard_Boolean h1 = Standard_False;
 	      Standard_Boolean e1 = Standard_False;
 	      Standard_Boolean h2 = Standard_False;
@@ -1167,7 +1275,9 @@ void HLRBRep_Data::NextInterference ()
 	      iInterf = 1;
 	      
 	      if (myIntersected) {           // compute real intersection
+#ifdef OCCT_DEBUG
 		nbCal2Intersection++;
+#endif
 		
 		Standard_Real da1 = 0;
 		Standard_Real db1 = 0;
@@ -1214,7 +1324,9 @@ void HLRBRep_Data::NextInterference ()
 		    myNbPoints   = myIntersector.NbPoints();
 		    myNbSegments = myIntersector.NbSegments();
 		    if ((myNbSegments + myNbPoints) > 0) { 
+#ifdef OCCT_DEBUG
 		      nbOkIntersection++;
+#endif
 		    }
 		    else { 
 		      ((TableauRejection *)myReject)->
@@ -1235,8 +1347,10 @@ void HLRBRep_Data::NextInterference ()
 		  }
 		}
 	      }
+#ifdef OCCT_DEBUG
 	      nbPtIntersection  += myNbPoints;
 	      nbSegIntersection += myNbSegments;
+#endif
 	    }
 	  }
 	  else { 
@@ -1720,7 +1834,9 @@ HLRBRep_Data::Classify (const Standard_Integer E,
 {
   (void)E; // avoid compiler warning
 
+#ifdef OCCT_DEBUG
   nbClassification++;
+#endif
   HLRAlgo_EdgesBlock::MinMaxIndices VertMin, VertMax, MinMaxVert;
   Standard_Real TotMin[16],TotMax[16];
   
@@ -1891,7 +2007,9 @@ HLRBRep_Data::Classify (const Standard_Integer E,
     }
   }
 
+#ifdef OCCT_DEBUG
   nbCal3Intersection++;
+#endif
   gp_Pnt   PLim;
   gp_Pnt2d Psta;
   Psta = EC.Value  (sta);
@@ -1973,7 +2091,9 @@ TopAbs_State HLRBRep_Data::SimplClassify (const Standard_Integer /*E*/,
 					  const Standard_Real p1,
 					  const Standard_Real p2)
 {
+#ifdef OCCT_DEBUG
   nbClassification++;
+#endif
   HLRAlgo_EdgesBlock::MinMaxIndices VertMin, VertMax, MinMaxVert;
   Standard_Real TotMin[16],TotMax[16];
   
@@ -20,6 +20,7 @@
 #include <Standard.hxx>
 #include <Standard_Type.hxx>
 
+#include <BVH_BoxSet.hxx>
 #include <Standard_Integer.hxx>
 #include <TopTools_IndexedMapOfShape.hxx>
 #include <HLRBRep_Array1OfEData.hxx>
@@ -95,6 +96,8 @@ public:
     TopTools_IndexedMapOfShape& FaceMap();
   
   //! to compare with only non rejected edges.
+  //! The boxes of these edges are sorted in a BVH
+  //! used to select the edges crossing each hiding face.
   Standard_EXPORT void InitBoundSort (const HLRAlgo_EdgesBlock::MinMaxIndices& MinMaxTot, const Standard_Integer e1, const Standard_Integer e2);
   
   //! Begin an iteration only  on visible Edges
@@ -207,6 +210,7 @@ private:
   HLRBRep_Array1OfEData myEData;
   HLRBRep_Array1OfFData myFData;
   TColStd_Array1OfInteger myEdgeIndices;
+  BVH_BoxSet<Standard_Real, 3, Standard_Integer> myEdgeBoxes;
   Standard_ShortReal myToler;
   HLRAlgo_Projector myProj;
   HLRBRep_CLProps myLLProps;
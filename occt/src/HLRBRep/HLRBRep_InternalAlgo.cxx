@@ -22,6 +22,7 @@
 #include <HLRBRep_ShapeBounds.hxx>
 #include <HLRBRep_ShapeToHLR.hxx>
 #include <HLRTopoBRep_OutLiner.hxx>
+#include <OSD_Parallel.hxx>
 #include <Standard_Transient.hxx>
 #include <Standard_ErrorHandler.hxx>
 #include <Standard_OutOfRange.hxx>
@@ -653,6 +654,49 @@ void HLRBRep_InternalAlgo::Hide (const Standard_Integer I,
   }
 }
 
+namespace
+{
+  //! Functor hiding the DataStructures of independent algorithms.
+  class HLRBRep_HideFunctor
+  {
+  public:
+
+    HLRBRep_HideFunctor (const NCollection_Array1<Handle(HLRBRep_InternalAlgo)>& theAlgos)
+    : myAlgos (theAlgos)
+    {}
+
+    void operator() (const Standard_Integer theIndex) const
+    {
+      const Handle(HLRBRep_InternalAlgo)& anAlgo = myAlgos.Value (theIndex);
+      if (!anAlgo.IsNull())
+        anAlgo->Hide();
+    }
+
+  private:
+    HLRBRep_HideFunctor& operator= (const HLRBRep_HideFunctor&);
+
+  private:
+    const NCollection_Array1<Handle(HLRBRep_InternalAlgo)>& myAlgos;
+  };
+}
+
+//=======================================================================
+//function : Hide
+//purpose  : 
+//=======================================================================
+
+void HLRBRep_InternalAlgo::Hide
+  (const NCollection_Array1<Handle(HLRBRep_InternalAlgo)>& theAlgos,
+   const Standard_Boolean theIsParallel)
+{
+  // the hiding of each DataStructure is sequential: the hidden parts of
+  // an edge depend on the order of the hiding faces and the state of the
+  // iteration is kept in the DataStructure; the independent ones (views)
+  // are hidden in parallel threads
+  HLRBRep_HideFunctor aFunctor (theAlgos);
+  OSD_Parallel::For (theAlgos.Lower(), theAlgos.Upper() + 1, aFunctor, !theIsParallel);
+}
+
 //=======================================================================
 //function : HideSelected
 //purpose  : 
@@ -23,6 +23,7 @@
 #include <HLRAlgo_Projector.hxx>
 #include <HLRBRep_SeqOfShapeBounds.hxx>
 #include <BRepTopAdaptor_MapOfShapeTool.hxx>
+#include <NCollection_Array1.hxx>
 #include <Standard_Transient.hxx>
 #include <Standard_Integer.hxx>
 class HLRBRep_Data;
@@ -116,6 +117,15 @@ public:
   //! hide the Shape <S1> by the shape <S2>.
   Standard_EXPORT void Hide (const Standard_Integer I, const Standard_Integer J);
   
+  //! hide all the DataStructures of the  independent algorithms
+  //! <theAlgos>, e.g. of the different views of the same shapes.
+  //! The algorithms are processed in parallel threads if
+  //! <theIsParallel> is True, so they should not share their
+  //! DataStructure; Update() should be called for each of them
+  //! beforehand.
+  Standard_EXPORT static void Hide (const NCollection_Array1<Handle(HLRBRep_InternalAlgo)>& theAlgos,
+                                    const Standard_Boolean theIsParallel);
+  
   Standard_EXPORT void Debug (const Standard_Boolean deb);
   
   Standard_EXPORT Standard_Boolean Debug() const;
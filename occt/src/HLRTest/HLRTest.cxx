@@ -26,6 +26,11 @@
 #include <HLRTopoBRep_OutLiner.hxx>
 #include <TopoDS_Shape.hxx>
 #include <BRep_Builder.hxx>
+#include <gp.hxx>
+#include <NCollection_Array1.hxx>
+#include <NCollection_Sequence.hxx>
+#include <TCollection_AsciiString.hxx>
+#include <TopoDS_Compound.hxx>
 
 static Handle(HLRBRep_Algo) hider;
 #ifdef _WIN32
@@ -551,6 +556,92 @@ static Standard_Integer hlrin2d(Draw_Interpretor& , Standard_Integer n, const ch
   return 0;
 }
 
+//=======================================================================
+//function : hlrviews
+//purpose  : 
+//=======================================================================
+
+static Standard_Integer hlrviews (Draw_Interpretor& di, Standard_Integer n, const char** a)
+{
+  if (n < 6)
+  {
+    di << "Syntax error: wrong number of arguments\n";
+    return 1;
+  }
+
+  TopoDS_Shape aShape = DBRep::Get (a[2]);
+  if (aShape.IsNull())
+  {
+    di << "Syntax error: '" << a[2] << "' is not a shape\n";
+    return 1;
+  }
+
+  Standard_Boolean isParallel = Standard_False;
+  NCollection_Sequence<gp_Dir> aDirs;
+  for (Standard_Integer i = 3; i < n; ++i)
+  {
+    if (!strcasecmp (a[i], "-parallel"))
+    {
+      isParallel = Standard_True;
+    }
+    else if (i + 2 < n)
+    {
+      gp_Vec aVec (Draw::Atof (a[i]), Draw::Atof (a[i + 1]), Draw::Atof (a[i + 2]));
+      if (aVec.SquareMagnitude() < gp::Resolution())
+      {
+        di << "Syntax error: null view direction\n";
+        return 1;
+      }
+      aDirs.Append (gp_Dir (aVec));
+      i += 2;
+    }
+    else
+    {
+      di << "Syntax error at '" << a[i] << "'\n";
+      return 1;
+    }
+  }
+  if (aDirs.IsEmpty())
+  {
+    di << "Syntax error: no view direction\n";
+    return 1;
+  }
+
+  // the outlines are computed sequentially as the OutLiner updates the
+  // vertices of the shape, then the views are hidden together
+  NCollection_Array1<Handle(HLRBRep_InternalAlgo)> anAlgos (1, aDirs.Length());
+  for (Standard_Integer i = 1; i <= aDirs.Length(); ++i)
+  {
+    Handle(HLRBRep_Algo) anAlgo = new HLRBRep_Algo();
+    anAlgo->Add (aShape);
+    anAlgo->Projector (HLRAlgo_Projector (gp_Ax2 (gp::Origin(), aDirs (i))));
+    anAlgo->Update();
+    anAlgos (i) = anAlgo;
+  }
+  HLRBRep_InternalAlgo::Hide (anAlgos, isParallel);
+
+  for (Standard_Integer i = 1; i <= aDirs.Length(); ++i)
+  {
+    Handle(HLRBRep_Algo) anAlgo = Handle(HLRBRep_Algo)::DownCast (anAlgos (i));
+    HLRBRep_HLRToShape aToShape (anAlgo);
+
+    TopoDS_Compound aResult;
+    BRep_Builder aBB;
+    aBB.MakeCompound (aResult);
+    TopoDS_Shape aSharpEdges = aToShape.VCompound();
+    if (!aSharpEdges.IsNull())
+      aBB.Add (aResult, aSharpEdges);
+    TopoDS_Shape anOutLines = aToShape.OutLineVCompound();
+    if (!anOutLines.IsNull())
+      aBB.Add (aResult, anOutLines);
+
+    TCollection_AsciiString aName = TCollection_AsciiString (a[1]) + "_" + i;
+    DBRep::Set (aName.ToCString(), aResult);
+    di << aName << " ";
+  }
+  return 0;
+}
+
 //=======================================================================
 //function : Commands
 //purpose  : 
@@ -589,6 +680,13 @@ void HLRTest::Commands (Draw_Interpretor& theCommands)
   theCommands.Add("hlrin2d",
                   "hlrin2d res shape proj_X proj_Y proj_Z eye_x eye_y eye_z",
                   __FILE__, hlrin2d, g);
+
+  theCommands.Add("hlrviews",
+                  "hlrviews res shape [-parallel] proj_X proj_Y proj_Z [proj_X proj_Y proj_Z ...]"
+                  "\n\t\t: Computes the visible sharp edges and outlines of the shape"
+                  "\n\t\t: in several views (res_1, res_2, ...) hiding them together,"
+                  "\n\t\t: in parallel threads with -parallel option.",
+                  __FILE__, hlrviews, g);
   
   hider = new HLRBRep_Algo();
 }
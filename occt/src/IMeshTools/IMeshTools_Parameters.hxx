@@ -17,6 +17,7 @@
 #define _IMeshTools_Parameters_HeaderFile
 
 #include <IMeshTools_MeshAlgoType.hxx>
+#include <IMeshTools_TriangulationSink.hxx>
 #include <Precision.hxx>
 
 //! Structure storing meshing parameters
@@ -39,7 +40,8 @@ struct IMeshTools_Parameters {
     CleanModel (Standard_True),
     AdjustMinSize (Standard_False),
     ForceFaceDeflection (Standard_False),
-    AllowQualityDecrease (Standard_False)
+    AllowQualityDecrease (Standard_False),
+    CompactStorage (Standard_False)
   {
   }
 
@@ -104,6 +106,18 @@ struct IMeshTools_Parameters {
   //! Allows/forbids the decrease of the quality of the generated mesh
   //! over the existing one.
   Standard_Boolean                                 AllowQualityDecrease;
+
+  //! Produces triangulations in compact storage suitable for visualization only:
+  //! single precision nodes, UV nodes quantized into 16-bit integers and oct-encoded normals
+  //! (see Poly_Triangulation::Compact()).
+  //! Disabled by default.
+  Standard_Boolean                                 CompactStorage;
+
+  //! Receiver of triangulations of faces. When defined, triangulations are
+  //! streamed to it instead of being stored in the shape together with polygons
+  //! on triangulations, so the shape is not modified by the meshing.
+  //! Null by default.
+  Handle(IMeshTools_TriangulationSink)             TriangulationSink;
 };
 
 #endif
@@ -0,0 +1,59 @@
+// Created on: 2026-10-18
+//
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _IMeshTools_TriangulationSink_HeaderFile
+#define _IMeshTools_TriangulationSink_HeaderFile
+
+#include <Standard_Transient.hxx>
+#include <Standard_Type.hxx>
+
+class Poly_Triangulation;
+class TopLoc_Location;
+class TopoDS_Face;
+
+//! Interface class receiving triangulations of faces produced by meshing algorithm.
+//! When sink is defined in meshing parameters, the algorithm passes results
+//! to it instead of storing them in the shape, so that the shape is left untouched.
+class IMeshTools_TriangulationSink : public Standard_Transient
+{
+public:
+
+  //! Destructor.
+  virtual ~IMeshTools_TriangulationSink()
+  {
+  }
+
+  //! Receives triangulation of the face.
+  //! The method is called once per face definition (TShape) of the shape, and
+  //! can be called concurrently from different threads in parallel mode.
+  //! @param theFace face the triangulation has been built for.
+  //! @param theTriangulation triangulation of the face.
+  //! @param theLocation location to be applied to the nodes of triangulation
+  //!        to get them in the coordinate system of the meshed shape.
+  Standard_EXPORT virtual void Add (const TopoDS_Face&                theFace,
+                                    const Handle(Poly_Triangulation)& theTriangulation,
+                                    const TopLoc_Location&            theLocation) = 0;
+
+  DEFINE_STANDARD_RTTIEXT(IMeshTools_TriangulationSink, Standard_Transient)
+
+protected:
+
+  //! Constructor.
+  IMeshTools_TriangulationSink()
+  {
+  }
+};
+
+#endif
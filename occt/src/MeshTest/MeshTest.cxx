@@ -25,6 +25,7 @@
 #include <BRepBuilderAPI_MakePolygon.hxx>
 #include <BRepBuilderAPI_MakeVertex.hxx>
 #include <BRepLib.hxx>
+#include <BRepLib_ToolTriangulatedShape.hxx>
 #include <BRepMesh_IncrementalMesh.hxx>
 #include <BRepTest.hxx>
 #include <BRepTools.hxx>
@@ -35,13 +36,17 @@
 #include <Draw_Segment2D.hxx>
 #include <DrawTrSurf.hxx>
 #include <GeometryTest.hxx>
+#include <IMeshData_Face.hxx>
+#include <IMeshData_Model.hxx>
 #include <IMeshData_Status.hxx>
+#include <IMeshTools_TriangulationSink.hxx>
 #include <Message.hxx>
 #include <Message_ProgressRange.hxx>
 #include <OSD_OpenFile.hxx>
 #include <Poly_MergeNodesTool.hxx>
 #include <Poly_TriangulationParameters.hxx>
 #include <Prs3d_Drawer.hxx>
+#include <Standard_Mutex.hxx>
 #include <StdPrs_ToolTriangulatedShape.hxx>
 #include <TopExp_Explorer.hxx>
 #include <BRep_TEdge.hxx>
@@ -75,6 +80,36 @@ OSD_Chronometer chAdd11, chAdd12, chAdd2, chUpdate, chPointValid;
 OSD_Chronometer chIsos, chPointsOnIsos;
 #endif
 
+namespace
+{
+  //! Sink collecting statistics of triangulations streamed by incmesh -nostore.
+  class MeshTest_TriangulationCounter : public IMeshTools_TriangulationSink
+  {
+  public:
+    MeshTest_TriangulationCounter() : NbFaces (0), NbTriangles (0), NbNodes (0) {}
+
+    virtual void Add (const TopoDS_Face& ,
+                      const Handle(Poly_Triangulation)& theTriangulation,
+                      const TopLoc_Location& ) Standard_OVERRIDE
+    {
+      Standard_Mutex::Sentry aLock (myMutex);
+      ++NbFaces;
+      NbTriangles += theTriangulation->NbTriangles();
+      NbNodes     += theTriangulation->NbNodes();
+    }
+
+  public:
+    Standard_Integer NbFaces;
+    Standard_Integer NbTriangles;
+    Standard_Integer NbNodes;
+
+    DEFINE_STANDARD_RTTI_INLINE(MeshTest_TriangulationCounter, IMeshTools_TriangulationSink)
+
+  private:
+    Standard_Mutex myMutex;
+  };
+}
+
 //=======================================================================
 //function : incrementalmesh
 //purpose  : 
@@ -90,6 +125,7 @@ static Standard_Integer incrementalmesh (Draw_Interpretor& theDI,
   }
 
   TopoDS_ListOfShape aListOfShapes;
+  TopTools_ListOfShape aModifiedFaces;
   IMeshTools_Parameters aMeshParams;
   bool hasDefl = false, hasAngDefl = false, isPrsDefl = false;
 
@@ -132,6 +168,25 @@ static Standard_Integer incrementalmesh (Draw_Interpretor& theDI,
     {
       aMeshParams.AllowQualityDecrease = Draw::ParseOnOffNoIterator (theNbArgs, theArgVec, anArgIter);
     }
+    else if (aNameCase == "-compact")
+    {
+      aMeshParams.CompactStorage = Draw::ParseOnOffNoIterator (theNbArgs, theArgVec, anArgIter);
+    }
+    else if (aNameCase == "-nostore")
+    {
+      aMeshParams.TriangulationSink = new MeshTest_TriangulationCounter();
+    }
+    else if (aNameCase == "-modified"
+          && anArgIter + 1 < theNbArgs)
+    {
+      TopoDS_Shape aFace = DBRep::Get (theArgVec[++anArgIter], TopAbs_FACE);
+      if (aFace.IsNull())
+      {
+        theDI << "Syntax error: '" << theArgVec[anArgIter] << "' is not a face";
+        return 1;
+      }
+      aModifiedFaces.Append (aFace);
+    }
     else if (aNameCase == "-algo"
           && anArgIter + 1 < theNbArgs)
     {
@@ -282,8 +337,17 @@ static Standard_Integer incrementalmesh (Draw_Interpretor& theDI,
   BRepMesh_IncrementalMesh aMesher;
   aMesher.SetShape (aShape);
   aMesher.ChangeParameters() = aMeshParams;
+  aMesher.SetModifiedFaces (aModifiedFaces);
   aMesher.Perform (aContext, aProgress->Start());
 
+  if (Handle(MeshTest_TriangulationCounter) aCounter =
+        Handle(MeshTest_TriangulationCounter)::DownCast (aMeshParams.TriangulationSink))
+  {
+    theDI << "Streamed faces: " << aCounter->NbFaces
+          << " triangles: " << aCounter->NbTriangles
+          << " nodes: " << aCounter->NbNodes << "\n";
+  }
+
   theDI << "Meshing statuses: ";
   const Standard_Integer aStatus = aMesher.GetStatusFlags();
   if (aStatus == 0)
@@ -1003,6 +1067,169 @@ static Standard_Integer trianglesinfo (Draw_Interpretor& theDI, Standard_Integer
   return 0;
 }
 
+namespace
+{
+  //! Context of meshing recording the order of dispatching of faces instead of meshing them.
+  class MeshTest_DispatchOrderContext : public BRepMesh_Context
+  {
+  public:
+
+    virtual Standard_Boolean DiscretizeFaces (const Message_ProgressRange& ) Standard_OVERRIDE
+    {
+      IMeshData::VectorOfInteger anOrder;
+      BRepMesh_FaceDiscret::DispatchOrder (GetModel(), anOrder);
+      for (IMeshData::VectorOfInteger::Iterator anOrderIter (anOrder); anOrderIter.More(); anOrderIter.Next())
+      {
+        const IMeshData::IFaceHandle& aDFace = GetModel()->GetFace (anOrderIter.Value());
+        Faces.Append (aDFace->GetFace());
+        Costs.Append (BRepMesh_FaceDiscret::EstimateCost (aDFace));
+      }
+      return Standard_False;
+    }
+
+  public:
+    NCollection_Vector<TopoDS_Face>   Faces; //!< faces in order of dispatching
+    NCollection_Vector<Standard_Real> Costs; //!< estimated costs of the faces
+
+    DEFINE_STANDARD_RTTI_INLINE(MeshTest_DispatchOrderContext, BRepMesh_Context)
+  };
+}
+
+//=======================================================================
+//function : meshorder
+//purpose  : 
+//=======================================================================
+static Standard_Integer meshorder (Draw_Interpretor& theDI, Standard_Integer theNbArgs, const char** theArgVec)
+{
+  if (theNbArgs != 3)
+  {
+    theDI << "Syntax error: wrong number of arguments";
+    return 1;
+  }
+
+  TopoDS_Shape aShape = DBRep::Get (theArgVec[1]);
+  if (aShape.IsNull())
+  {
+    theDI << "Syntax error: '" << theArgVec[1] << "' is not a shape";
+    return 1;
+  }
+
+  Handle(MeshTest_DispatchOrderContext) aContext = new MeshTest_DispatchOrderContext();
+  BRepMesh_IncrementalMesh aMesher;
+  aMesher.SetShape (aShape);
+  aMesher.ChangeParameters().Deflection = Draw::Atof (theArgVec[2]);
+  aMesher.ChangeParameters().InParallel = Standard_True;
+  aMesher.Perform (aContext);
+
+  TopTools_IndexedMapOfShape aFaces;
+  TopExp::MapShapes (aShape, TopAbs_FACE, aFaces);
+  theDI << "Faces:";
+  for (NCollection_Vector<TopoDS_Face>::Iterator aFaceIter (aContext->Faces); aFaceIter.More(); aFaceIter.Next())
+  {
+    theDI << " " << aFaces.FindIndex (aFaceIter.Value());
+  }
+  theDI << "\nCosts:";
+  for (NCollection_Vector<Standard_Real>::Iterator aCostIter (aContext->Costs); aCostIter.More(); aCostIter.Next())
+  {
+    theDI << " " << aCostIter.Value();
+  }
+  theDI << "\n";
+  return 0;
+}
+
+//=======================================================================
+//function : tricompact
+//purpose  : 
+//=======================================================================
+static Standard_Integer tricompact (Draw_Interpretor& theDI, Standard_Integer theNbArgs, const char** theArgVec)
+{
+  if (theNbArgs != 3)
+  {
+    Message::SendFail ("Syntax error: wrong number of arguments");
+    return 1;
+  }
+
+  TopoDS_Shape aShape = DBRep::Get (theArgVec[1]);
+  TopoDS_Shape aRefShape = DBRep::Get (theArgVec[2]);
+  if (aShape.IsNull() || aRefShape.IsNull())
+  {
+    theDI << "Error: " << (aShape.IsNull() ? theArgVec[1] : theArgVec[2]) << " is not a shape\n";
+    return 1;
+  }
+
+  Standard_Integer aNbFaces = 0, aNbDoubleNodes = 0, aNbDoubleUVNodes = 0, aNbNotOctNormals = 0, aNbMismatches = 0;
+  Standard_Real aMaxNodeDev = 0.0, aMaxUVNodeDev = 0.0, aMaxNormalDev = 0.0;
+  TopExp_Explorer anExp (aShape, TopAbs_FACE), aRefExp (aRefShape, TopAbs_FACE);
+  for (; anExp.More() && aRefExp.More(); anExp.Next(), aRefExp.Next())
+  {
+    const TopoDS_Face& aFace = TopoDS::Face (anExp.Current());
+    const TopoDS_Face& aRefFace = TopoDS::Face (aRefExp.Current());
+    TopLoc_Location aLoc, aRefLoc;
+    const Handle(Poly_Triangulation)& aTri = BRep_Tool::Triangulation (aFace, aLoc);
+    const Handle(Poly_Triangulation)& aRefTri = BRep_Tool::Triangulation (aRefFace, aRefLoc);
+    if (aTri.IsNull() || aRefTri.IsNull())
+    {
+      continue;
+    }
+
+    ++aNbFaces;
+    if (aTri->IsDoublePrecision())
+    {
+      ++aNbDoubleNodes;
+    }
+    if (aTri->HasUVNodes() && !aTri->IsQuantizedUVNodes())
+    {
+      ++aNbDoubleUVNodes;
+    }
+    if (!aTri->IsOctEncodedNormals())
+    {
+      ++aNbNotOctNormals;
+    }
+    if (aTri->NbNodes() != aRefTri->NbNodes()
+     || aTri->HasUVNodes() != aRefTri->HasUVNodes())
+    {
+      ++aNbMismatches;
+      continue;
+    }
+
+    // the normals are computed from the surface and stored in the storage of each triangulation
+    if (!aTri->HasNormals())
+    {
+      BRepLib_ToolTriangulatedShape::ComputeNormals (aFace, aTri);
+    }
+    if (!aRefTri->HasNormals())
+    {
+      BRepLib_ToolTriangulatedShape::ComputeNormals (aRefFace, aRefTri);
+    }
+
+    for (Standard_Integer aNodeIter = 1; aNodeIter <= aTri->NbNodes(); ++aNodeIter)
+    {
+      aMaxNodeDev = Max (aMaxNodeDev, aTri->Node (aNodeIter).Distance (aRefTri->Node (aNodeIter)));
+      if (aTri->HasUVNodes())
+      {
+        aMaxUVNodeDev = Max (aMaxUVNodeDev, aTri->UVNode (aNodeIter).Distance (aRefTri->UVNode (aNodeIter)));
+      }
+
+      const gp_Dir aNorm = aTri->Normal (aNodeIter), aRefNorm = aRefTri->Normal (aNodeIter);
+      aMaxNormalDev = Max (aMaxNormalDev, aNorm.Angle (aRefNorm));
+    }
+  }
+  if (anExp.More() || aRefExp.More())
+  {
+    ++aNbMismatches;
+  }
+
+  theDI << "Faces: " << aNbFaces << "\n";
+  theDI << "Faces with double precision nodes: " << aNbDoubleNodes << "\n";
+  theDI << "Faces with not quantized UV nodes: " << aNbDoubleUVNodes << "\n";
+  theDI << "Faces with not oct-encoded normals: " << aNbNotOctNormals << "\n";
+  theDI << "Faces not matching the reference: " << aNbMismatches << "\n";
+  theDI << "Max node deviation: " << aMaxNodeDev << "\n";
+  theDI << "Max UV node deviation: " << aMaxUVNodeDev << "\n";
+  theDI << "Max normal deviation (deg): " << aMaxNormalDev * 180.0 / M_PI << "\n";
+  return 0;
+}
+
 //=======================================================================
 //function : veriftriangles
 //purpose  : 
@@ -1609,7 +1836,7 @@ void  MeshTest::Commands(Draw_Interpretor& theCommands)
     "\n\t\t:   [-algo {watson|delabella}]=watson"
     "\n\t\t:   [-di Value] [-ai Angle]=57.29"
     "\n\t\t:   [-int_vert_off {0|1}]=0 [-surf_def_off {0|1}]=0 [-adjust_min {0|1}]=0"
-    "\n\t\t:   [-force_face_def {0|1}]=0 [-decrease {0|1}]=0"
+    "\n\t\t:   [-force_face_def {0|1}]=0 [-decrease {0|1}]=0 [-compact {0|1}]=0 [-modified Face] [-nostore]"
     "\n\t\t: Builds triangular mesh for the shape."
     "\n\t\t:  LinDefl         linear deflection to control mesh quality;"
     "\n\t\t:  -angular        angular deflection for edges in deg (~28.64 deg = 0.5 rad by default);"
@@ -1629,7 +1856,12 @@ void  MeshTest::Commands(Draw_Interpretor& theCommands)
     "\n\t\t:  -adjust_min     enables local adjustment of min size depending on edge size (FALSE by default);"
     "\n\t\t:  -force_face_def disables usage of shape tolerances for computing face deflection (FALSE by default);"
     "\n\t\t:  -decrease       enforces the meshing of the shape even if current mesh satisfies the new criteria"
-    "\n\t\t:                  (FALSE by default).",
+    "\n\t\t:                  (FALSE by default);"
+    "\n\t\t:  -compact        stores triangulations with single precision nodes, quantized UV nodes"
+    "\n\t\t:                  and oct-encoded normals for visualization purposes (FALSE by default);"
+    "\n\t\t:  -modified       re-meshes only the given face of the shape keeping the mesh of"
+    "\n\t\t:                  the other faces; can be repeated to specify several faces;"
+    "\n\t\t:  -nostore        streams triangulations to a counting sink leaving the shape untouched.",
   __FILE__, incrementalmesh, g);
   theCommands.Add("tessellate","Builds triangular mesh for the surface, run w/o args for help",__FILE__, tessellate, g);
   theCommands.Add("MemLeakTest","MemLeakTest",__FILE__, MemLeakTest, g);
@@ -1639,6 +1871,18 @@ void  MeshTest::Commands(Draw_Interpretor& theCommands)
                   "trinfo shapeName [-lods], print triangles information on objects"
                   "\n\t\t: -lods Print detailed LOD information",
                   __FILE__,trianglesinfo,g);
+  theCommands.Add("meshorder",
+                  "meshorder shapeName LinDefl"
+                  "\n\t\t: Prints the indices of the faces (as in explode) in the order of dispatching"
+                  "\n\t\t: to the threads by parallel incmesh, and their estimated meshing costs.",
+                  __FILE__, meshorder, g);
+  theCommands.Add("tricompact",
+                  "tricompact shapeName refShapeName"
+                  "\n\t\t: Checks the compact storage of triangulations of the shape (see incmesh -compact)"
+                  "\n\t\t: and prints the deviations of nodes, UV nodes and normals from the triangulations"
+                  "\n\t\t: of the reference shape having the same faces and meshed with double precision."
+                  "\n\t\t: Missing normals are computed from the surfaces.",
+                  __FILE__, tricompact, g);
   theCommands.Add("veriftriangles","veriftriangles name, verif triangles",__FILE__,veriftriangles,g);
   theCommands.Add("wavefront","wavefront name",__FILE__, wavefront, g);
   theCommands.Add("triepoints", "triepoints shape1 [shape2 ...]",__FILE__, triedgepoints, g);
@@ -0,0 +1,443 @@
+// Created on: 2026-10-18
+//
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef NCollection_FlatBaseMap_HeaderFile
+#define NCollection_FlatBaseMap_HeaderFile
+
+#include <NCollection_BaseAllocator.hxx>
+#include <NCollection_DefineAlloc.hxx>
+#include <NCollection_DefaultHasher.hxx>
+#include <Standard_Integer.hxx>
+
+#include <utility>
+
+/**
+ * Purpose:     Base class of hash maps with open addressing
+ *              (NCollection_FlatMap, NCollection_FlatDataMap,
+ *              NCollection_FlatIndexedDataMap).
+ *
+ *              The nodes are stored directly in the table of slots,
+ *              without allocation of each node and without lists of
+ *              nodes in buckets. Collisions are resolved by linear
+ *              probing with Robin Hood ordering: the node inserted
+ *              farther from its home slot takes the place of the node
+ *              closer to its home slot, so that within a cluster the
+ *              nodes are ordered by their home slots and the search
+ *              stops as soon as a node closer to its home slot than
+ *              the searched key is met. Removal shifts the following
+ *              nodes of the cluster back, thus no tombstones are left.
+ *
+ *              The hash code of the key (Hasher::HashCode() with
+ *              IntegerLast() as upper bound) is kept in the slot, so
+ *              that the keys are compared only for matching hash codes
+ *              and the table is grown without hashing the keys again.
+ *              The number of slots is a power of two; the home slot is
+ *              defined by Fibonacci hashing of the hash code, which
+ *              spreads poorly distributed hash codes (e.g. sequential
+ *              integers) over the table.
+ *
+ *              Unlike NCollection_Map, references to the keys and items
+ *              are invalidated by insertion or removal of other keys,
+ *              and the order of iteration is different.
+ */
+template <class TheKeyType, class TheNodeType, class Hasher>
+class NCollection_FlatBaseMap
+{
+public:
+  //! Memory allocation
+  DEFINE_STANDARD_ALLOC
+  DEFINE_NCOLLECTION_ALLOC
+
+public:
+
+  //! Iterator over occupied slots of the table.
+  class BaseIterator
+  {
+  public:
+
+    //! Empty constructor
+    BaseIterator() : myMap (NULL), mySlot (0) {}
+
+    //! Constructor
+    BaseIterator (const NCollection_FlatBaseMap& theMap) : myMap (&theMap), mySlot (0) { skipEmpty(); }
+
+    //! Initialize
+    void Initialize (const NCollection_FlatBaseMap& theMap)
+    {
+      myMap  = &theMap;
+      mySlot = 0;
+      skipEmpty();
+    }
+
+    //! Reset
+    void Reset()
+    {
+      mySlot = 0;
+      skipEmpty();
+    }
+
+    //! Query if the end of collection is reached by iterator
+    Standard_Boolean More() const { return myMap != NULL && mySlot < myMap->myNbSlots; }
+
+    //! Make a step along the collection
+    void Next()
+    {
+      ++mySlot;
+      skipEmpty();
+    }
+
+    //! Performs comparison of two iterators.
+    Standard_Boolean IsEqual (const BaseIterator& theOther) const
+    {
+      return myMap == theOther.myMap
+          && mySlot == theOther.mySlot;
+    }
+
+  protected:
+
+    //! Returns the current node.
+    TheNodeType& node() const { return myMap->myCells[mySlot].Node; }
+
+  private:
+
+    //! Moves to the first occupied slot starting from the current one.
+    void skipEmpty()
+    {
+      if (myMap == NULL)
+      {
+        return;
+      }
+      while (mySlot < myMap->myNbSlots
+          && myMap->myCells[mySlot].Distance < 0)
+      {
+        ++mySlot;
+      }
+    }
+
+  private:
+    const NCollection_FlatBaseMap* myMap;
+    Standard_Integer               mySlot;
+  };
+
+public:
+
+  //! Returns number of slots in the table.
+  Standard_Integer NbBuckets() const { return myNbSlots; }
+
+  //! Returns number of keys in the map.
+  Standard_Integer Extent() const { return mySize; }
+
+  //! Returns TRUE if the map is empty.
+  Standard_Boolean IsEmpty() const { return mySize == 0; }
+
+  //! Returns the allocator of the table.
+  const Handle(NCollection_BaseAllocator)& Allocator() const { return myAllocator; }
+
+  //! Reserves the table for the given number of keys.
+  void ReSize (const Standard_Integer theNbKeys)
+  {
+    Standard_Integer aNbSlots = 8;
+    while (aNbSlots * 3 < (theNbKeys + 1) * 4)
+    {
+      aNbSlots *= 2;
+    }
+    if (aNbSlots > myNbSlots)
+    {
+      reallocate (aNbSlots);
+    }
+  }
+
+protected:
+
+  //! Slot of the table; the node is kept next to the hash code,
+  //! so that a probe touches a single cache line.
+  struct Cell
+  {
+    unsigned int     Hash;     //!< hash code of the key
+    Standard_Integer Distance; //!< distance from the home slot of the key, -1 for empty slot
+    union
+    {
+      TheNodeType    Node;     //!< node, constructed in occupied slots only
+    };
+
+    Cell() {}
+    ~Cell() {}
+  };
+
+protected:
+
+  //! Constructor
+  NCollection_FlatBaseMap (const Standard_Integer theNbKeys,
+                           const Handle(NCollection_BaseAllocator)& theAllocator)
+  : myAllocator (theAllocator.IsNull() ? NCollection_BaseAllocator::CommonBaseAllocator() : theAllocator),
+    myCells (NULL),
+    myNbSlots (0),
+    myShift (0),
+    mySize (0)
+  {
+    if (theNbKeys > 1)
+    {
+      ReSize (theNbKeys);
+    }
+  }
+
+  //! Destructor
+  ~NCollection_FlatBaseMap()
+  {
+    clearNodes (Standard_True);
+  }
+
+  //! Destroys the nodes and optionally releases the table.
+  void clearNodes (const Standard_Boolean theToReleaseMemory)
+  {
+    for (Standard_Integer aSlot = 0; aSlot < myNbSlots && mySize > 0; ++aSlot)
+    {
+      if (myCells[aSlot].Distance >= 0)
+      {
+        myCells[aSlot].Node.~TheNodeType();
+        myCells[aSlot].Distance = -1;
+        --mySize;
+      }
+    }
+    if (theToReleaseMemory && myCells != NULL)
+    {
+      myAllocator->Free (myCells);
+      myCells   = NULL;
+      myNbSlots = 0;
+      myShift   = 0;
+    }
+  }
+
+  //! Exchanges the tables and allocators of two maps.
+  void exchangeTables (NCollection_FlatBaseMap& theOther)
+  {
+    std::swap (myAllocator, theOther.myAllocator);
+    std::swap (myCells,     theOther.myCells);
+    std::swap (myNbSlots,   theOther.myNbSlots);
+    std::swap (myShift,     theOther.myShift);
+    std::swap (mySize,      theOther.mySize);
+  }
+
+  //! Returns the slot of the key or -1 if the key is not in the map.
+  Standard_Integer findSlot (const TheKeyType& theKey) const
+  {
+    if (mySize == 0)
+    {
+      return -1;
+    }
+
+    const unsigned int     aHash = hashCode (theKey);
+    const Standard_Integer aMask = myNbSlots - 1;
+    for (Standard_Integer aSlot = homeSlot (aHash), aDist = 0;; aSlot = (aSlot + 1) & aMask, ++aDist)
+    {
+      const Cell& aCell = myCells[aSlot];
+      if (aCell.Distance < aDist)
+      {
+        return -1;
+      }
+      if (aCell.Hash == aHash
+       && Hasher::IsEqual (aCell.Node.Key(), theKey))
+      {
+        return aSlot;
+      }
+    }
+  }
+
+  //! Searches the key without modifying the table.
+  //! @param theKey  [in]  key to search
+  //! @param theHash [out] hash code of the key
+  //! @param theSlot [out] slot of the key if found, or the slot to insert the key into
+  //! @param theDist [out] distance of the insertion slot from the home slot of the key
+  //! @return TRUE if the key has been found
+  Standard_Boolean lookupForInsertion (const TheKeyType& theKey,
+                                       unsigned int&     theHash,
+                                       Standard_Integer& theSlot,
+                                       Standard_Integer& theDist) const
+  {
+    theHash = hashCode (theKey);
+    theSlot = 0;
+    theDist = 0;
+    if (myNbSlots == 0)
+    {
+      return Standard_False;
+    }
+
+    const Standard_Integer aMask = myNbSlots - 1;
+    for (theSlot = homeSlot (theHash);; theSlot = (theSlot + 1) & aMask, ++theDist)
+    {
+      const Cell& aCell = myCells[theSlot];
+      if (aCell.Distance < theDist)
+      {
+        return Standard_False;
+      }
+      if (aCell.Hash == theHash
+       && Hasher::IsEqual (aCell.Node.Key(), theKey))
+      {
+        return Standard_True;
+      }
+    }
+  }
+
+  //! Moves the new node into the slot found by lookupForInsertion(), growing the table if it is full.
+  //! The node should be constructed before the call, since the growth invalidates
+  //! the references to the keys and items of the map passed as arguments.
+  //! @return the slot of inserted node
+  Standard_Integer addNode (TheNodeType&       theNode,
+                            const unsigned int theHash,
+                            Standard_Integer   theSlot,
+                            Standard_Integer   theDist)
+  {
+    if ((mySize + 1) * 4 > myNbSlots * 3)
+    {
+      reallocate (myNbSlots == 0 ? 8 : myNbSlots * 2);
+
+      // the key is absent, thus only the insertion slot is searched
+      const Standard_Integer aMask = myNbSlots - 1;
+      theSlot = homeSlot (theHash);
+      for (theDist = 0; myCells[theSlot].Distance >= theDist; theSlot = (theSlot + 1) & aMask, ++theDist) {}
+    }
+    return insertNode (theNode, theHash, theSlot, theDist);
+  }
+
+  //! Moves the node into the given slot of the table having a free slot;
+  //! the following nodes of the cluster are shifted forward by one slot.
+  //! @return the slot of inserted node (theSlot)
+  Standard_Integer insertNode (TheNodeType&           theNode,
+                               const unsigned int     theHash,
+                               const Standard_Integer theSlot,
+                               const Standard_Integer theDist)
+  {
+    const Standard_Integer aMask = myNbSlots - 1;
+    if (myCells[theSlot].Distance >= 0)
+    {
+      Standard_Integer anEmpty = theSlot;
+      do
+      {
+        anEmpty = (anEmpty + 1) & aMask;
+      }
+      while (myCells[anEmpty].Distance >= 0);
+
+      for (Standard_Integer aTo = anEmpty; aTo != theSlot;)
+      {
+        const Standard_Integer aFrom = (aTo - 1) & aMask;
+        moveCell (myCells[aTo], myCells[aFrom]);
+        myCells[aTo].Distance = myCells[aFrom].Distance + 1;
+        aTo = aFrom;
+      }
+    }
+
+    new (&myCells[theSlot].Node) TheNodeType (std::move (theNode));
+    myCells[theSlot].Hash     = theHash;
+    myCells[theSlot].Distance = theDist;
+    ++mySize;
+    return theSlot;
+  }
+
+  //! Removes the node from the slot;
+  //! the following nodes of the cluster are shifted back by one slot.
+  void removeSlot (Standard_Integer theSlot)
+  {
+    const Standard_Integer aMask = myNbSlots - 1;
+    myCells[theSlot].Node.~TheNodeType();
+    for (Standard_Integer aNext = (theSlot + 1) & aMask; myCells[aNext].Distance > 0; aNext = (aNext + 1) & aMask)
+    {
+      moveCell (myCells[theSlot], myCells[aNext]);
+      myCells[theSlot].Distance = myCells[aNext].Distance - 1;
+      theSlot = aNext;
+    }
+    myCells[theSlot].Distance = -1;
+    --mySize;
+  }
+
+  //! Returns the node in the slot.
+  TheNodeType& node (const Standard_Integer theSlot) const { return myCells[theSlot].Node; }
+
+private:
+
+  //! Moves the node and hash code from one cell into another (empty) one.
+  static void moveCell (Cell& theTo, Cell& theFrom)
+  {
+    new (&theTo.Node) TheNodeType (std::move (theFrom.Node));
+    theFrom.Node.~TheNodeType();
+    theTo.Hash = theFrom.Hash;
+  }
+
+  //! Returns the hash code of the key.
+  static unsigned int hashCode (const TheKeyType& theKey)
+  {
+    return (unsigned int )Hasher::HashCode (theKey, IntegerLast());
+  }
+
+  //! Returns the home slot for the hash code.
+  Standard_Integer homeSlot (const unsigned int theHash) const
+  {
+    return (Standard_Integer )((uint64_t(theHash) * UINT64_C(0x9E3779B97F4A7C15)) >> myShift);
+  }
+
+  //! Moves the nodes into the new table of given size (power of two).
+  void reallocate (const Standard_Integer theNbSlots)
+  {
+    Cell*                  anOldCells   = myCells;
+    const Standard_Integer anOldNbSlots = myNbSlots;
+
+    myCells = (Cell* )myAllocator->Allocate (sizeof(Cell) * size_t(theNbSlots));
+    for (Standard_Integer aSlot = 0; aSlot < theNbSlots; ++aSlot)
+    {
+      myCells[aSlot].Distance = -1;
+    }
+    myNbSlots = theNbSlots;
+    myShift   = 64;
+    for (Standard_Integer aNbSlots = theNbSlots; aNbSlots > 1; aNbSlots >>= 1)
+    {
+      --myShift;
+    }
+
+    mySize = 0;
+    const Standard_Integer aMask = myNbSlots - 1;
+    for (Standard_Integer anOldSlot = 0; anOldSlot < anOldNbSlots; ++anOldSlot)
+    {
+      Cell& anOldCell = anOldCells[anOldSlot];
+      if (anOldCell.Distance < 0)
+      {
+        continue;
+      }
+
+      // the keys are unique, thus only the insertion slot is searched
+      Standard_Integer aSlot = homeSlot (anOldCell.Hash), aDist = 0;
+      for (; myCells[aSlot].Distance >= aDist; aSlot = (aSlot + 1) & aMask, ++aDist) {}
+      insertNode (anOldCell.Node, anOldCell.Hash, aSlot, aDist);
+      anOldCell.Node.~TheNodeType();
+    }
+
+    if (anOldCells != NULL)
+    {
+      myAllocator->Free (anOldCells);
+    }
+  }
+
+private:
+  NCollection_FlatBaseMap (const NCollection_FlatBaseMap& );
+  NCollection_FlatBaseMap& operator= (const NCollection_FlatBaseMap& );
+
+protected:
+  Handle(NCollection_BaseAllocator) myAllocator; //!< allocator of the table
+  Cell*            myCells;   //!< slots of the table
+  Standard_Integer myNbSlots; //!< number of slots, power of two
+  Standard_Integer myShift;   //!< shift of the Fibonacci hash giving the home slot
+  Standard_Integer mySize;    //!< number of keys
+
+};
+
+#endif
@@ -0,0 +1,329 @@
+// Created on: 2026-10-18
+//
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef NCollection_FlatDataMap_HeaderFile
+#define NCollection_FlatDataMap_HeaderFile
+
+#include <NCollection_FlatBaseMap.hxx>
+#include <NCollection_StlIterator.hxx>
+
+#include <Standard_NoSuchObject.hxx>
+
+//! Node of NCollection_FlatDataMap.
+template <class TheKeyType, class TheItemType>
+class NCollection_FlatDataMapNode
+{
+public:
+  //! Constructor
+  NCollection_FlatDataMapNode (const TheKeyType& theKey, const TheItemType& theItem)
+  : myKey (theKey), myValue (theItem) {}
+
+  //! Key
+  const TheKeyType& Key() const { return myKey; }
+
+  //! Constant value access
+  const TheItemType& Value() const { return myValue; }
+
+  //! Variable value access
+  TheItemType& ChangeValue() { return myValue; }
+
+private:
+  TheKeyType  myKey;
+  TheItemType myValue;
+};
+
+/**
+ * Purpose:     The DataMap with open addressing; drop-in alternative
+ *              to NCollection_DataMap with the same interface.
+ *
+ *              The pairs of key and item are stored in a flat table
+ *              without allocation of a node per key. See
+ *              NCollection_FlatBaseMap for details of the hashing scheme.
+ *
+ *              The key and item types should be copy (or move)
+ *              constructible; the pairs are moved within the table on
+ *              insertion and removal of other keys, thus the pointers
+ *              returned by Seek(), Bound() etc. are valid only until
+ *              the next modification of the map. The order of
+ *              iteration differs from the one of NCollection_DataMap.
+ *
+ *              Insertion and iteration are faster than with
+ *              NCollection_DataMap, but the lookup is not: it takes about
+ *              the same time on large maps and is slower on small
+ *              maps fitting in the cache, where the probing loop costs
+ *              more than the access to a bucket.
+ */
+template <class TheKeyType,
+          class TheItemType,
+          class Hasher = NCollection_DefaultHasher<TheKeyType> >
+class NCollection_FlatDataMap : public NCollection_FlatBaseMap<TheKeyType, NCollection_FlatDataMapNode<TheKeyType, TheItemType>, Hasher>
+{
+public:
+  //! STL-compliant typedef for key type
+  typedef TheKeyType key_type;
+  //! STL-compliant typedef for value type
+  typedef TheItemType value_type;
+
+  //! Base class
+  typedef NCollection_FlatBaseMap<TheKeyType, NCollection_FlatDataMapNode<TheKeyType, TheItemType>, Hasher> base_type;
+
+  //! Node
+  typedef NCollection_FlatDataMapNode<TheKeyType, TheItemType> DataMapNode;
+
+public:
+
+  //! Implementation of the Iterator interface.
+  class Iterator : public base_type::BaseIterator
+  {
+  public:
+    //! Empty constructor
+    Iterator() {}
+
+    //! Constructor
+    Iterator (const NCollection_FlatDataMap& theMap) : base_type::BaseIterator (theMap) {}
+
+    //! Value inquiry
+    const TheItemType& Value() const
+    {
+      Standard_NoSuchObject_Raise_if (!this->More(), "NCollection_FlatDataMap::Iterator::Value");
+      return this->node().Value();
+    }
+
+    //! Value change access
+    TheItemType& ChangeValue() const
+    {
+      Standard_NoSuchObject_Raise_if (!this->More(), "NCollection_FlatDataMap::Iterator::ChangeValue");
+      return this->node().ChangeValue();
+    }
+
+    //! Key
+    const TheKeyType& Key() const
+    {
+      Standard_NoSuchObject_Raise_if (!this->More(), "NCollection_FlatDataMap::Iterator::Key");
+      return this->node().Key();
+    }
+  };
+
+  //! Shorthand for a regular iterator type.
+  typedef NCollection_StlIterator<std::forward_iterator_tag, Iterator, TheItemType, false> iterator;
+
+  //! Shorthand for a constant iterator type.
+  typedef NCollection_StlIterator<std::forward_iterator_tag, Iterator, TheItemType, true> const_iterator;
+
+  //! Returns an iterator pointing to the first element in the map.
+  iterator begin() const { return Iterator (*this); }
+
+  //! Returns an iterator referring to the past-the-end element in the map.
+  iterator end() const { return Iterator(); }
+
+  //! Returns a const iterator pointing to the first element in the map.
+  const_iterator cbegin() const { return Iterator (*this); }
+
+  //! Returns a const iterator referring to the past-the-end element in the map.
+  const_iterator cend() const { return Iterator(); }
+
+public:
+
+  //! Empty constructor.
+  NCollection_FlatDataMap() : base_type (1, Handle(NCollection_BaseAllocator)()) {}
+
+  //! Constructor
+  //! @param theNbBuckets expected number of keys
+  //! @param theAllocator allocator of the table
+  explicit NCollection_FlatDataMap (const Standard_Integer theNbBuckets,
+                                    const Handle(NCollection_BaseAllocator)& theAllocator = 0L)
+  : base_type (theNbBuckets, theAllocator) {}
+
+  //! Copy constructor
+  NCollection_FlatDataMap (const NCollection_FlatDataMap& theOther)
+  : base_type (theOther.Extent(), theOther.myAllocator)
+  {
+    *this = theOther;
+  }
+
+  //! Exchange the content of two maps without re-allocations.
+  //! Notice that allocators will be swapped as well!
+  void Exchange (NCollection_FlatDataMap& theOther)
+  {
+    this->exchangeTables (theOther);
+  }
+
+  //! Assignment.
+  //! This method does not change the internal allocator.
+  NCollection_FlatDataMap& Assign (const NCollection_FlatDataMap& theOther)
+  {
+    if (this == &theOther)
+    {
+      return *this;
+    }
+
+    Clear (Standard_False);
+    if (!theOther.IsEmpty())
+    {
+      this->ReSize (theOther.Extent());
+      for (Iterator anIter (theOther); anIter.More(); anIter.Next())
+      {
+        Bind (anIter.Key(), anIter.Value());
+      }
+    }
+    return *this;
+  }
+
+  //! Assignment operator
+  NCollection_FlatDataMap& operator= (const NCollection_FlatDataMap& theOther)
+  {
+    return Assign (theOther);
+  }
+
+  //! Bind binds Item to Key in map.
+  //! @param theKey  key to add/update
+  //! @param theItem new item; overrides value previously bound to the key, if any
+  //! @return Standard_True if Key was not bound already
+  Standard_Boolean Bind (const TheKeyType& theKey, const TheItemType& theItem)
+  {
+    unsigned int aHash = 0;
+    Standard_Integer aSlot = 0, aDist = 0;
+    if (this->lookupForInsertion (theKey, aHash, aSlot, aDist))
+    {
+      this->node (aSlot).ChangeValue() = theItem;
+      return Standard_False;
+    }
+
+    DataMapNode aNode (theKey, theItem);
+    this->addNode (aNode, aHash, aSlot, aDist);
+    return Standard_True;
+  }
+
+  //! Bound binds Item to Key in map. Returns modifiable Item
+  TheItemType* Bound (const TheKeyType& theKey, const TheItemType& theItem)
+  {
+    unsigned int aHash = 0;
+    Standard_Integer aSlot = 0, aDist = 0;
+    if (this->lookupForInsertion (theKey, aHash, aSlot, aDist))
+    {
+      this->node (aSlot).ChangeValue() = theItem;
+    }
+    else
+    {
+      DataMapNode aNode (theKey, theItem);
+      aSlot = this->addNode (aNode, aHash, aSlot, aDist);
+    }
+    return &this->node (aSlot).ChangeValue();
+  }
+
+  //! IsBound
+  Standard_Boolean IsBound (const TheKeyType& theKey) const
+  {
+    return this->findSlot (theKey) >= 0;
+  }
+
+  //! UnBind removes Item Key pair from map
+  Standard_Boolean UnBind (const TheKeyType& theKey)
+  {
+    const Standard_Integer aSlot = this->findSlot (theKey);
+    if (aSlot < 0)
+    {
+      return Standard_False;
+    }
+
+    this->removeSlot (aSlot);
+    return Standard_True;
+  }
+
+  //! Seek returns pointer to Item by Key. Returns
+  //! NULL is Key was not bound.
+  const TheItemType* Seek (const TheKeyType& theKey) const
+  {
+    const Standard_Integer aSlot = this->findSlot (theKey);
+    return aSlot >= 0 ? &this->node (aSlot).Value() : NULL;
+  }
+
+  //! Find returns the Item for Key. Raises if Key was not bound
+  const TheItemType& Find (const TheKeyType& theKey) const
+  {
+    const Standard_Integer aSlot = this->findSlot (theKey);
+    if (aSlot < 0)
+    {
+      throw Standard_NoSuchObject ("NCollection_FlatDataMap::Find");
+    }
+    return this->node (aSlot).Value();
+  }
+
+  //! Find Item for key with copying.
+  //! @return true if key was found
+  Standard_Boolean Find (const TheKeyType& theKey,
+                         TheItemType&      theValue) const
+  {
+    const Standard_Integer aSlot = this->findSlot (theKey);
+    if (aSlot < 0)
+    {
+      return Standard_False;
+    }
+
+    theValue = this->node (aSlot).Value();
+    return Standard_True;
+  }
+
+  //! operator ()
+  const TheItemType& operator() (const TheKeyType& theKey) const
+  {
+    return Find (theKey);
+  }
+
+  //! ChangeSeek returns modifiable pointer to Item by Key. Returns
+  //! NULL is Key was not bound.
+  TheItemType* ChangeSeek (const TheKeyType& theKey)
+  {
+    const Standard_Integer aSlot = this->findSlot (theKey);
+    return aSlot >= 0 ? &this->node (aSlot).ChangeValue() : NULL;
+  }
+
+  //! ChangeFind returns modifiable Item by Key. Raises if Key was not bound
+  TheItemType& ChangeFind (const TheKeyType& theKey)
+  {
+    const Standard_Integer aSlot = this->findSlot (theKey);
+    if (aSlot < 0)
+    {
+      throw Standard_NoSuchObject ("NCollection_FlatDataMap::Find");
+    }
+    return this->node (aSlot).ChangeValue();
+  }
+
+  //! operator ()
+  TheItemType& operator() (const TheKeyType& theKey)
+  {
+    return ChangeFind (theKey);
+  }
+
+  //! Clear data. If doReleaseMemory is false then the table
+  //! is not released and will be reused.
+  void Clear (const Standard_Boolean doReleaseMemory = Standard_True)
+  {
+    this->clearNodes (doReleaseMemory);
+  }
+
+  //! Clear data and reset allocator
+  void Clear (const Handle(NCollection_BaseAllocator)& theAllocator)
+  {
+    Clear();
+    this->myAllocator = (!theAllocator.IsNull() ? theAllocator :
+                         NCollection_BaseAllocator::CommonBaseAllocator());
+  }
+
+  //! Size
+  Standard_Integer Size() const { return this->Extent(); }
+};
+
+#endif
@@ -0,0 +1,512 @@
+// Created on: 2026-10-18
+//
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef NCollection_FlatIndexedDataMap_HeaderFile
+#define NCollection_FlatIndexedDataMap_HeaderFile
+
+#include <NCollection_FlatBaseMap.hxx>
+#include <NCollection_StlIterator.hxx>
+
+#include <Standard_DomainError.hxx>
+#include <Standard_NoSuchObject.hxx>
+#include <Standard_OutOfRange.hxx>
+
+//! Node of the hash table of NCollection_FlatIndexedDataMap.
+template <class TheKeyType>
+class NCollection_FlatIndexedDataMapNode
+{
+public:
+  //! Constructor
+  NCollection_FlatIndexedDataMapNode (const TheKeyType& theKey, const Standard_Integer theIndex)
+  : myKey (theKey), myIndex (theIndex) {}
+
+  //! Key
+  const TheKeyType& Key() const { return myKey; }
+
+  //! Variable key access
+  TheKeyType& ChangeKey() { return myKey; }
+
+  //! Index
+  Standard_Integer& Index() { return myIndex; }
+
+private:
+  TheKeyType       myKey;
+  Standard_Integer myIndex;
+};
+
+/**
+ * Purpose:     The IndexedDataMap with open addressing; drop-in
+ *              alternative to NCollection_IndexedDataMap with the same
+ *              interface.
+ *
+ *              The pairs of key and item are stored in a single array
+ *              in the order of their indices, and the hash table with
+ *              open addressing (see NCollection_FlatBaseMap) binds each
+ *              key to its index. Thus no node is allocated per key: the
+ *              access by index reads the array directly, and the search
+ *              of the key probes contiguous slots of the table only.
+ *              The price is a second copy of each key, kept in the table.
+ *
+ *              The order of iteration (by increasing indices) is the
+ *              same as for NCollection_IndexedDataMap. The key and item
+ *              types should be copy (or move) constructible and
+ *              assignable; the array is reallocated when it grows, thus
+ *              the references and pointers to keys and items (e.g.
+ *              returned by Seek() or ChangeFromIndex()) are valid only
+ *              until the next addition of a key.
+ */
+template <class TheKeyType,
+          class TheItemType,
+          class Hasher = NCollection_DefaultHasher<TheKeyType> >
+class NCollection_FlatIndexedDataMap : public NCollection_FlatBaseMap<TheKeyType, NCollection_FlatIndexedDataMapNode<TheKeyType>, Hasher>
+{
+public:
+  //! STL-compliant typedef for key type
+  typedef TheKeyType key_type;
+  //! STL-compliant typedef for value type
+  typedef TheItemType value_type;
+
+  //! Base class
+  typedef NCollection_FlatBaseMap<TheKeyType, NCollection_FlatIndexedDataMapNode<TheKeyType>, Hasher> base_type;
+
+  //! Node of the hash table
+  typedef NCollection_FlatIndexedDataMapNode<TheKeyType> IndexedDataMapNode;
+
+private:
+
+  //! Pair of key and item stored in the array.
+  struct Entry
+  {
+    TheKeyType  Key;
+    TheItemType Item;
+
+    Entry (const TheKeyType& theKey, const TheItemType& theItem) : Key (theKey), Item (theItem) {}
+  };
+
+public:
+
+  //! Implementation of the Iterator interface.
+  class Iterator
+  {
+  public:
+    //! Empty constructor
+    Iterator() : myMap (NULL), myIndex (0) {}
+
+    //! Constructor
+    Iterator (const NCollection_FlatIndexedDataMap& theMap)
+    : myMap ((NCollection_FlatIndexedDataMap* )&theMap),
+      myIndex (1) {}
+
+    //! Query if the end of collection is reached by iterator
+    Standard_Boolean More() const { return myMap != NULL && myIndex <= myMap->Extent(); }
+
+    //! Make a step along the collection
+    void Next() { ++myIndex; }
+
+    //! Value access
+    const TheItemType& Value() const
+    {
+      Standard_NoSuchObject_Raise_if (!More(), "NCollection_FlatIndexedDataMap::Iterator::Value");
+      return myMap->FindFromIndex (myIndex);
+    }
+
+    //! ChangeValue access
+    TheItemType& ChangeValue() const
+    {
+      Standard_NoSuchObject_Raise_if (!More(), "NCollection_FlatIndexedDataMap::Iterator::ChangeValue");
+      return myMap->ChangeFromIndex (myIndex);
+    }
+
+    //! Key
+    const TheKeyType& Key() const
+    {
+      Standard_NoSuchObject_Raise_if (!More(), "NCollection_FlatIndexedDataMap::Iterator::Key");
+      return myMap->FindKey (myIndex);
+    }
+
+    //! Performs comparison of two iterators.
+    Standard_Boolean IsEqual (const Iterator& theOther) const
+    {
+      return myMap == theOther.myMap
+          && myIndex == theOther.myIndex;
+    }
+
+  private:
+    NCollection_FlatIndexedDataMap* myMap;   //!< Iterated map
+    Standard_Integer                myIndex; //!< Current index
+  };
+
+  //! Shorthand for a regular iterator type.
+  typedef NCollection_StlIterator<std::forward_iterator_tag, Iterator, TheItemType, false> iterator;
+
+  //! Shorthand for a constant iterator type.
+  typedef NCollection_StlIterator<std::forward_iterator_tag, Iterator, TheItemType, true> const_iterator;
+
+  //! Returns an iterator pointing to the first element in the map.
+  iterator begin() const { return Iterator (*this); }
+
+  //! Returns an iterator referring to the past-the-end element in the map.
+  iterator end() const { return Iterator(); }
+
+  //! Returns a const iterator pointing to the first element in the map.
+  const_iterator cbegin() const { return Iterator (*this); }
+
+  //! Returns a const iterator referring to the past-the-end element in the map.
+  const_iterator cend() const { return Iterator(); }
+
+public:
+
+  //! Empty constructor.
+  NCollection_FlatIndexedDataMap()
+  : base_type (1, Handle(NCollection_BaseAllocator)()),
+    myEntries (NULL),
+    myCapacity (0) {}
+
+  //! Constructor
+  //! @param theNbBuckets expected number of keys
+  //! @param theAllocator allocator of the table and of the array
+  explicit NCollection_FlatIndexedDataMap (const Standard_Integer theNbBuckets,
+                                           const Handle(NCollection_BaseAllocator)& theAllocator = 0L)
+  : base_type (theNbBuckets, theAllocator),
+    myEntries (NULL),
+    myCapacity (0)
+  {
+    reserveEntries (theNbBuckets);
+  }
+
+  //! Copy constructor
+  NCollection_FlatIndexedDataMap (const NCollection_FlatIndexedDataMap& theOther)
+  : base_type (theOther.Extent(), theOther.myAllocator),
+    myEntries (NULL),
+    myCapacity (0)
+  {
+    *this = theOther;
+  }
+
+  //! Destructor
+  ~NCollection_FlatIndexedDataMap()
+  {
+    Clear();
+  }
+
+  //! Exchange the content of two maps without re-allocations.
+  //! Notice that allocators will be swapped as well!
+  void Exchange (NCollection_FlatIndexedDataMap& theOther)
+  {
+    this->exchangeTables (theOther);
+    std::swap (myEntries,  theOther.myEntries);
+    std::swap (myCapacity, theOther.myCapacity);
+  }
+
+  //! Assignment.
+  //! This method does not change the internal allocator.
+  NCollection_FlatIndexedDataMap& Assign (const NCollection_FlatIndexedDataMap& theOther)
+  {
+    if (this == &theOther)
+    {
+      return *this;
+    }
+
+    Clear (Standard_False);
+    if (!theOther.IsEmpty())
+    {
+      ReSize (theOther.Extent());
+      for (Standard_Integer anIndexIter = 1; anIndexIter <= theOther.Extent(); ++anIndexIter)
+      {
+        Add (theOther.FindKey (anIndexIter), theOther.FindFromIndex (anIndexIter));
+      }
+    }
+    return *this;
+  }
+
+  //! Assignment operator
+  NCollection_FlatIndexedDataMap& operator= (const NCollection_FlatIndexedDataMap& theOther)
+  {
+    return Assign (theOther);
+  }
+
+  //! Reserves the table and the array for the given number of keys.
+  void ReSize (const Standard_Integer theNbKeys)
+  {
+    base_type::ReSize (theNbKeys);
+    reserveEntries (theNbKeys);
+  }
+
+  //! Returns the Index of already bound Key or appends new Key with specified Item value.
+  //! @param theKey1 Key to search (and to bind, if it was not bound already)
+  //! @param theItem Item value to set for newly bound Key; ignored if Key was already bound
+  //! @return index of Key
+  Standard_Integer Add (const TheKeyType& theKey1, const TheItemType& theItem)
+  {
+    unsigned int aHash = 0;
+    Standard_Integer aSlot = 0, aDist = 0;
+    if (this->lookupForInsertion (theKey1, aHash, aSlot, aDist))
+    {
+      return this->node (aSlot).Index();
+    }
+
+    // the key and item are copied before the growth, which may release the arguments
+    const Standard_Integer aNewIndex = this->Extent() + 1;
+    Entry anEntry (theKey1, theItem);
+    IndexedDataMapNode aNode (theKey1, aNewIndex);
+    if (aNewIndex > myCapacity)
+    {
+      reserveEntries (myCapacity == 0 ? 8 : myCapacity * 2);
+    }
+    new (&myEntries[aNewIndex - 1]) Entry (std::move (anEntry));
+    this->addNode (aNode, aHash, aSlot, aDist);
+    return aNewIndex;
+  }
+
+  //! Contains
+  Standard_Boolean Contains (const TheKeyType& theKey1) const
+  {
+    return this->findSlot (theKey1) >= 0;
+  }
+
+  //! Substitute
+  void Substitute (const Standard_Integer theIndex,
+                   const TheKeyType&      theKey1,
+                   const TheItemType&     theItem)
+  {
+    Standard_OutOfRange_Raise_if (theIndex < 1 || theIndex > this->Extent(),
+                                  "NCollection_FlatIndexedDataMap::Substitute : "
+                                  "Index is out of range");
+
+    // check if theKey1 is not already in the map
+    unsigned int aHash = 0;
+    Standard_Integer aSlot = 0, aDist = 0;
+    if (this->lookupForInsertion (theKey1, aHash, aSlot, aDist))
+    {
+      if (this->node (aSlot).Index() != theIndex)
+      {
+        throw Standard_DomainError ("NCollection_FlatIndexedDataMap::Substitute : "
+                                    "Attempt to substitute existing key");
+      }
+      Entry anEntry (theKey1, theItem);
+      this->node (aSlot).ChangeKey() = anEntry.Key;
+      myEntries[theIndex - 1] = std::move (anEntry);
+      return;
+    }
+
+    // the key and item are copied before the removal of the old key, which may release the arguments
+    Entry anEntry (theKey1, theItem);
+    IndexedDataMapNode aNode (theKey1, theIndex);
+
+    // remove the old key and add the new one with the same index
+    this->removeSlot (this->findSlot (myEntries[theIndex - 1].Key));
+    myEntries[theIndex - 1] = std::move (anEntry);
+    this->lookupForInsertion (aNode.Key(), aHash, aSlot, aDist);
+    this->addNode (aNode, aHash, aSlot, aDist);
+  }
+
+  //! Swaps two elements with the given indices.
+  void Swap (const Standard_Integer theIndex1,
+             const Standard_Integer theIndex2)
+  {
+    Standard_OutOfRange_Raise_if (theIndex1 < 1 || theIndex1 > this->Extent()
+                               || theIndex2 < 1 || theIndex2 > this->Extent(), "NCollection_FlatIndexedDataMap::Swap");
+
+    if (theIndex1 == theIndex2)
+    {
+      return;
+    }
+
+    const Standard_Integer aSlot1 = this->findSlot (myEntries[theIndex1 - 1].Key);
+    const Standard_Integer aSlot2 = this->findSlot (myEntries[theIndex2 - 1].Key);
+    this->node (aSlot1).Index() = theIndex2;
+    this->node (aSlot2).Index() = theIndex1;
+    std::swap (myEntries[theIndex1 - 1], myEntries[theIndex2 - 1]);
+  }
+
+  //! RemoveLast
+  void RemoveLast()
+  {
+    const Standard_Integer aLastIndex = this->Extent();
+    Standard_OutOfRange_Raise_if (aLastIndex == 0, "NCollection_FlatIndexedDataMap::RemoveLast");
+
+    this->removeSlot (this->findSlot (myEntries[aLastIndex - 1].Key));
+    myEntries[aLastIndex - 1].~Entry();
+  }
+
+  //! Remove the key of the given index.
+  //! Caution! The index of the last key can be changed.
+  void RemoveFromIndex (const Standard_Integer theIndex)
+  {
+    const Standard_Integer aLastInd = this->Extent();
+    Standard_OutOfRange_Raise_if (theIndex < 1 || theIndex > aLastInd, "NCollection_FlatIndexedDataMap::Remove");
+    if (theIndex != aLastInd)
+    {
+      Swap (theIndex, aLastInd);
+    }
+    RemoveLast();
+  }
+
+  //! Remove the given key.
+  //! Caution! The index of the last key can be changed.
+  void RemoveKey (const TheKeyType& theKey1)
+  {
+    const Standard_Integer anIndToRemove = FindIndex (theKey1);
+    if (anIndToRemove > 0)
+    {
+      RemoveFromIndex (anIndToRemove);
+    }
+  }
+
+  //! FindKey
+  const TheKeyType& FindKey (const Standard_Integer theIndex) const
+  {
+    Standard_OutOfRange_Raise_if (theIndex < 1 || theIndex > this->Extent(), "NCollection_FlatIndexedDataMap::FindKey");
+    return myEntries[theIndex - 1].Key;
+  }
+
+  //! FindFromIndex
+  const TheItemType& FindFromIndex (const Standard_Integer theIndex) const
+  {
+    Standard_OutOfRange_Raise_if (theIndex < 1 || theIndex > this->Extent(), "NCollection_FlatIndexedDataMap::FindFromIndex");
+    return myEntries[theIndex - 1].Item;
+  }
+
+  //! operator ()
+  const TheItemType& operator() (const Standard_Integer theIndex) const { return FindFromIndex (theIndex); }
+
+  //! ChangeFromIndex
+  TheItemType& ChangeFromIndex (const Standard_Integer theIndex)
+  {
+    Standard_OutOfRange_Raise_if (theIndex < 1 || theIndex > this->Extent(), "NCollection_FlatIndexedDataMap::ChangeFromIndex");
+    return myEntries[theIndex - 1].Item;
+  }
+
+  //! operator ()
+  TheItemType& operator() (const Standard_Integer theIndex) { return ChangeFromIndex (theIndex); }
+
+  //! FindIndex
+  Standard_Integer FindIndex (const TheKeyType& theKey1) const
+  {
+    const Standard_Integer aSlot = this->findSlot (theKey1);
+    return aSlot >= 0 ? this->node (aSlot).Index() : 0;
+  }
+
+  //! FindFromKey
+  const TheItemType& FindFromKey (const TheKeyType& theKey1) const
+  {
+    const TheItemType* anItem = Seek (theKey1);
+    if (anItem == NULL)
+    {
+      throw Standard_NoSuchObject ("NCollection_FlatIndexedDataMap::FindFromKey");
+    }
+    return *anItem;
+  }
+
+  //! ChangeFromKey
+  TheItemType& ChangeFromKey (const TheKeyType& theKey1)
+  {
+    TheItemType* anItem = ChangeSeek (theKey1);
+    if (anItem == NULL)
+    {
+      throw Standard_NoSuchObject ("NCollection_FlatIndexedDataMap::ChangeFromKey");
+    }
+    return *anItem;
+  }
+
+  //! Seek returns pointer to Item by Key. Returns
+  //! NULL if Key was not found.
+  const TheItemType* Seek (const TheKeyType& theKey1) const
+  {
+    const Standard_Integer anIndex = FindIndex (theKey1);
+    return anIndex > 0 ? &myEntries[anIndex - 1].Item : NULL;
+  }
+
+  //! ChangeSeek returns modifiable pointer to Item by Key. Returns
+  //! NULL if Key was not found.
+  TheItemType* ChangeSeek (const TheKeyType& theKey1)
+  {
+    const Standard_Integer anIndex = FindIndex (theKey1);
+    return anIndex > 0 ? &myEntries[anIndex - 1].Item : NULL;
+  }
+
+  //! Find value for key with copying.
+  //! @return true if key was found
+  Standard_Boolean FindFromKey (const TheKeyType& theKey1,
+                                TheItemType&      theValue) const
+  {
+    const TheItemType* anItem = Seek (theKey1);
+    if (anItem == NULL)
+    {
+      return Standard_False;
+    }
+
+    theValue = *anItem;
+    return Standard_True;
+  }
+
+  //! Clear data. If doReleaseMemory is false then the table
+  //! and the array are not released and will be reused.
+  void Clear (const Standard_Boolean doReleaseMemory = Standard_True)
+  {
+    for (Standard_Integer anIndex = this->Extent(); anIndex >= 1; --anIndex)
+    {
+      myEntries[anIndex - 1].~Entry();
+    }
+    this->clearNodes (doReleaseMemory);
+    if (doReleaseMemory && myEntries != NULL)
+    {
+      this->myAllocator->Free (myEntries);
+      myEntries  = NULL;
+      myCapacity = 0;
+    }
+  }
+
+  //! Clear data and reset allocator
+  void Clear (const Handle(NCollection_BaseAllocator)& theAllocator)
+  {
+    Clear();
+    this->myAllocator = (!theAllocator.IsNull() ? theAllocator :
+                         NCollection_BaseAllocator::CommonBaseAllocator());
+  }
+
+  //! Size
+  Standard_Integer Size() const { return this->Extent(); }
+
+private:
+
+  //! Moves the pairs into the new array, if the current one is smaller than the given number of keys.
+  void reserveEntries (const Standard_Integer theNbKeys)
+  {
+    if (theNbKeys <= myCapacity)
+    {
+      return;
+    }
+
+    Entry* aNewEntries = (Entry* )this->myAllocator->Allocate (sizeof(Entry) * size_t(theNbKeys));
+    for (Standard_Integer anIndex = 0; anIndex < this->Extent(); ++anIndex)
+    {
+      new (&aNewEntries[anIndex]) Entry (std::move (myEntries[anIndex]));
+      myEntries[anIndex].~Entry();
+    }
+    if (myEntries != NULL)
+    {
+      this->myAllocator->Free (myEntries);
+    }
+    myEntries  = aNewEntries;
+    myCapacity = theNbKeys;
+  }
+
+private:
+  Entry*           myEntries;  //!< pairs of keys and items in the order of indices
+  Standard_Integer myCapacity; //!< number of allocated pairs
+};
+
+#endif
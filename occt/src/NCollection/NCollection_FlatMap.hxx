@@ -0,0 +1,497 @@
+// Created on: 2026-10-18
+//
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef NCollection_FlatMap_HeaderFile
+#define NCollection_FlatMap_HeaderFile
+
+#include <NCollection_FlatBaseMap.hxx>
+#include <NCollection_StlIterator.hxx>
+
+#include <Standard_NoSuchObject.hxx>
+
+//! Node of NCollection_FlatMap.
+template <class TheKeyType>
+class NCollection_FlatMapNode
+{
+public:
+  //! Constructor
+  explicit NCollection_FlatMapNode (const TheKeyType& theKey) : myKey (theKey) {}
+
+  //! Key
+  const TheKeyType& Key() const { return myKey; }
+
+private:
+  TheKeyType myKey;
+};
+
+/**
+ * Purpose:     Single hashed Map with open addressing; drop-in
+ *              alternative to NCollection_Map with the same interface.
+ *
+ *              The keys are stored in a flat table without allocation
+ *              of a node per key, thus the lookup does not follow the
+ *              pointers of lists of nodes. See NCollection_FlatBaseMap
+ *              for details of the hashing scheme.
+ *
+ *              The key type should be copy (or move) constructible;
+ *              the keys are moved within the table on insertion and
+ *              removal of other keys. The order of iteration differs
+ *              from the one of NCollection_Map.
+ *
+ *              Insertion and iteration are faster than with
+ *              NCollection_Map, but the lookup is not: it takes about
+ *              the same time on large maps and is slower on small
+ *              maps fitting in the cache, where the probing loop costs
+ *              more than the access to a bucket.
+ */
+template <class TheKeyType,
+          class Hasher = NCollection_DefaultHasher<TheKeyType> >
+class NCollection_FlatMap : public NCollection_FlatBaseMap<TheKeyType, NCollection_FlatMapNode<TheKeyType>, Hasher>
+{
+public:
+  //! STL-compliant typedef for key type
+  typedef TheKeyType key_type;
+
+  //! Base class
+  typedef NCollection_FlatBaseMap<TheKeyType, NCollection_FlatMapNode<TheKeyType>, Hasher> base_type;
+
+  //! Node
+  typedef NCollection_FlatMapNode<TheKeyType> MapNode;
+
+public:
+
+  //! Implementation of the Iterator interface.
+  class Iterator : public base_type::BaseIterator
+  {
+  public:
+    //! Empty constructor
+    Iterator() {}
+
+    //! Constructor
+    Iterator (const NCollection_FlatMap& theMap) : base_type::BaseIterator (theMap) {}
+
+    //! Value inquiry
+    const TheKeyType& Value() const
+    {
+      Standard_NoSuchObject_Raise_if (!this->More(), "NCollection_FlatMap::Iterator::Value");
+      return this->node().Key();
+    }
+
+    //! Key
+    const TheKeyType& Key() const
+    {
+      Standard_NoSuchObject_Raise_if (!this->More(), "NCollection_FlatMap::Iterator::Key");
+      return this->node().Key();
+    }
+  };
+
+  //! Shorthand for a constant iterator type.
+  typedef NCollection_StlIterator<std::forward_iterator_tag, Iterator, TheKeyType, true> const_iterator;
+
+  //! Returns a const iterator pointing to the first element in the map.
+  const_iterator cbegin() const { return Iterator (*this); }
+
+  //! Returns a const iterator referring to the past-the-end element in the map.
+  const_iterator cend() const { return Iterator(); }
+
+public:
+
+  //! Empty constructor.
+  NCollection_FlatMap() : base_type (1, Handle(NCollection_BaseAllocator)()) {}
+
+  //! Constructor
+  //! @param theNbBuckets expected number of keys
+  //! @param theAllocator allocator of the table
+  explicit NCollection_FlatMap (const Standard_Integer theNbBuckets,
+                                const Handle(NCollection_BaseAllocator)& theAllocator = 0L)
+  : base_type (theNbBuckets, theAllocator) {}
+
+  //! Copy constructor
+  NCollection_FlatMap (const NCollection_FlatMap& theOther)
+  : base_type (theOther.Extent(), theOther.myAllocator)
+  {
+    *this = theOther;
+  }
+
+  //! Exchange the content of two maps without re-allocations.
+  //! Notice that allocators will be swapped as well!
+  void Exchange (NCollection_FlatMap& theOther)
+  {
+    this->exchangeTables (theOther);
+  }
+
+  //! Assign.
+  //! This method does not change the internal allocator.
+  NCollection_FlatMap& Assign (const NCollection_FlatMap& theOther)
+  {
+    if (this == &theOther)
+    {
+      return *this;
+    }
+
+    Clear (Standard_False);
+    if (!theOther.IsEmpty())
+    {
+      this->ReSize (theOther.Extent());
+      for (Iterator anIter (theOther); anIter.More(); anIter.Next())
+      {
+        Add (anIter.Key());
+      }
+    }
+    return *this;
+  }
+
+  //! Assign operator
+  NCollection_FlatMap& operator= (const NCollection_FlatMap& theOther)
+  {
+    return Assign (theOther);
+  }
+
+  //! Add
+  Standard_Boolean Add (const TheKeyType& theKey)
+  {
+    unsigned int aHash = 0;
+    Standard_Integer aSlot = 0, aDist = 0;
+    if (this->lookupForInsertion (theKey, aHash, aSlot, aDist))
+    {
+      return Standard_False;
+    }
+
+    MapNode aNode (theKey);
+    this->addNode (aNode, aHash, aSlot, aDist);
+    return Standard_True;
+  }
+
+  //! Added: add a new key if not yet in the map, and return
+  //! reference to either newly added or previously existing object
+  const TheKeyType& Added (const TheKeyType& theKey)
+  {
+    unsigned int aHash = 0;
+    Standard_Integer aSlot = 0, aDist = 0;
+    if (!this->lookupForInsertion (theKey, aHash, aSlot, aDist))
+    {
+      MapNode aNode (theKey);
+      aSlot = this->addNode (aNode, aHash, aSlot, aDist);
+    }
+    return this->node (aSlot).Key();
+  }
+
+  //! Contains
+  Standard_Boolean Contains (const TheKeyType& theKey) const
+  {
+    return this->findSlot (theKey) >= 0;
+  }
+
+  //! Remove
+  Standard_Boolean Remove (const TheKeyType& theKey)
+  {
+    const Standard_Integer aSlot = this->findSlot (theKey);
+    if (aSlot < 0)
+    {
+      return Standard_False;
+    }
+
+    this->removeSlot (aSlot);
+    return Standard_True;
+  }
+
+  //! Clear data. If doReleaseMemory is false then the table
+  //! is not released and will be reused.
+  void Clear (const Standard_Boolean doReleaseMemory = Standard_True)
+  {
+    this->clearNodes (doReleaseMemory);
+  }
+
+  //! Clear data and reset allocator
+  void Clear (const Handle(NCollection_BaseAllocator)& theAllocator)
+  {
+    Clear();
+    this->myAllocator = (!theAllocator.IsNull() ? theAllocator :
+                         NCollection_BaseAllocator::CommonBaseAllocator());
+  }
+
+  //! Size
+  Standard_Integer Size() const { return this->Extent(); }
+
+public:
+  //!@name Boolean operations with maps as sets of keys
+  //!@{
+
+  //! @return true if two maps contains exactly the same keys
+  Standard_Boolean IsEqual (const NCollection_FlatMap& theOther) const
+  {
+    return this->Extent() == theOther.Extent()
+        && Contains (theOther);
+  }
+
+  //! @return true if this map contains ALL keys of another map.
+  Standard_Boolean Contains (const NCollection_FlatMap& theOther) const
+  {
+    if (this == &theOther
+     || theOther.IsEmpty())
+    {
+      return Standard_True;
+    }
+    else if (this->Extent() < theOther.Extent())
+    {
+      return Standard_False;
+    }
+
+    for (Iterator anIter (theOther); anIter.More(); anIter.Next())
+    {
+      if (!Contains (anIter.Key()))
+      {
+        return Standard_False;
+      }
+    }
+    return Standard_True;
+  }
+
+  //! Sets this Map to be the result of union (aka addition, fuse, merge, boolean OR) operation between two given Maps.
+  //! All previous content of this Map is cleared.
+  //! This map (result of the boolean operation) can also be passed as one of operands.
+  void Union (const NCollection_FlatMap& theLeft,
+              const NCollection_FlatMap& theRight)
+  {
+    if (&theLeft == &theRight)
+    {
+      Assign (theLeft);
+      return;
+    }
+
+    if (this != &theLeft
+     && this != &theRight)
+    {
+      Clear();
+    }
+
+    if (this != &theLeft)
+    {
+      for (Iterator anIter (theLeft); anIter.More(); anIter.Next())
+      {
+        Add (anIter.Key());
+      }
+    }
+    if (this != &theRight)
+    {
+      for (Iterator anIter (theRight); anIter.More(); anIter.Next())
+      {
+        Add (anIter.Key());
+      }
+    }
+  }
+
+  //! Apply to this Map the boolean operation union (aka addition, fuse, merge, boolean OR) with another (given) Map.
+  //! Returns True if contents of this map is changed.
+  Standard_Boolean Unite (const NCollection_FlatMap& theOther)
+  {
+    if (this == &theOther)
+    {
+      return Standard_False;
+    }
+
+    const Standard_Integer anOldExtent = this->Extent();
+    Union (*this, theOther);
+    return anOldExtent != this->Extent();
+  }
+
+  //! Returns true if this and theMap have common elements.
+  Standard_Boolean HasIntersection (const NCollection_FlatMap& theMap) const
+  {
+    const NCollection_FlatMap* aMap1 = this;
+    const NCollection_FlatMap* aMap2 = &theMap;
+    if (theMap.Size() < Size())
+    {
+      aMap1 = &theMap;
+      aMap2 = this;
+    }
+
+    for (Iterator anIter (*aMap1); anIter.More(); anIter.Next())
+    {
+      if (aMap2->Contains (anIter.Value()))
+      {
+        return Standard_True;
+      }
+    }
+    return Standard_False;
+  }
+
+  //! Sets this Map to be the result of intersection (aka multiplication, common, boolean AND) operation between two given Maps.
+  //! All previous content of this Map is cleared.
+  //! This same map (result of the boolean operation) can also be used as one of operands.
+  void Intersection (const NCollection_FlatMap& theLeft,
+                     const NCollection_FlatMap& theRight)
+  {
+    if (&theLeft == &theRight)
+    {
+      Assign (theLeft);
+      return;
+    }
+
+    if (this == &theLeft)
+    {
+      NCollection_FlatMap aCopy (1, this->myAllocator);
+      Exchange     (aCopy);
+      Intersection (aCopy, theRight);
+      return;
+    }
+    else if (this == &theRight)
+    {
+      NCollection_FlatMap aCopy (1, this->myAllocator);
+      Exchange     (aCopy);
+      Intersection (theLeft, aCopy);
+      return;
+    }
+
+    Clear();
+    const NCollection_FlatMap& aSmall = theLeft.Extent() < theRight.Extent() ? theLeft  : theRight;
+    const NCollection_FlatMap& aLarge = theLeft.Extent() < theRight.Extent() ? theRight : theLeft;
+    for (Iterator anIter (aSmall); anIter.More(); anIter.Next())
+    {
+      if (aLarge.Contains (anIter.Key()))
+      {
+        Add (anIter.Key());
+      }
+    }
+  }
+
+  //! Apply to this Map the intersection operation (aka multiplication, common, boolean AND) with another (given) Map.
+  //! Returns True if contents of this map is changed.
+  Standard_Boolean Intersect (const NCollection_FlatMap& theOther)
+  {
+    if (this == &theOther
+     || this->IsEmpty())
+    {
+      return Standard_False;
+    }
+
+    const Standard_Integer anOldExtent = this->Extent();
+    Intersection (*this, theOther);
+    return anOldExtent != this->Extent();
+  }
+
+  //! Sets this Map to be the result of subtraction (aka set-theoretic difference, relative complement,
+  //! exclude, cut, boolean NOT) operation between two given Maps.
+  //! All previous content of this Map is cleared.
+  void Subtraction (const NCollection_FlatMap& theLeft,
+                    const NCollection_FlatMap& theRight)
+  {
+    if (this == &theLeft)
+    {
+      Subtract (theRight);
+      return;
+    }
+    else if (this == &theRight)
+    {
+      NCollection_FlatMap aCopy (1, this->myAllocator);
+      Exchange    (aCopy);
+      Subtraction (theLeft, aCopy);
+      return;
+    }
+
+    Assign   (theLeft);
+    Subtract (theRight);
+  }
+
+  //! Apply to this Map the subtraction (aka set-theoretic difference, relative complement,
+  //! exclude, cut, boolean NOT) operation with another (given) Map.
+  //! Returns True if contents of this map is changed.
+  Standard_Boolean Subtract (const NCollection_FlatMap& theOther)
+  {
+    if (this == &theOther)
+    {
+      if (this->IsEmpty())
+      {
+        return Standard_False;
+      }
+
+      Clear();
+      return Standard_True;
+    }
+
+    const Standard_Integer anOldExtent = this->Extent();
+    for (Iterator anIter (theOther); anIter.More(); anIter.Next())
+    {
+      Remove (anIter.Key());
+    }
+    return anOldExtent != this->Extent();
+  }
+
+  //! Sets this Map to be the result of symmetric difference (aka exclusive disjunction, boolean XOR) operation between two given Maps.
+  //! All previous content of this Map is cleared.
+  //! This map (result of the boolean operation) can also be used as one of operands.
+  void Difference (const NCollection_FlatMap& theLeft,
+                   const NCollection_FlatMap& theRight)
+  {
+    if (&theLeft == &theRight)
+    {
+      Clear();
+      return;
+    }
+    else if (this == &theLeft)
+    {
+      NCollection_FlatMap aCopy (1, this->myAllocator);
+      Exchange   (aCopy);
+      Difference (aCopy, theRight);
+      return;
+    }
+    else if (this == &theRight)
+    {
+      NCollection_FlatMap aCopy (1, this->myAllocator);
+      Exchange   (aCopy);
+      Difference (theLeft, aCopy);
+      return;
+    }
+
+    Clear();
+    for (Iterator anIter (theLeft); anIter.More(); anIter.Next())
+    {
+      if (!theRight.Contains (anIter.Key()))
+      {
+        Add (anIter.Key());
+      }
+    }
+    for (Iterator anIter (theRight); anIter.More(); anIter.Next())
+    {
+      if (!theLeft.Contains (anIter.Key()))
+      {
+        Add (anIter.Key());
+      }
+    }
+  }
+
+  //! Apply to this Map the symmetric difference (aka exclusive disjunction, boolean XOR) operation with another (given) Map.
+  //! Returns True if contents of this map is changed.
+  Standard_Boolean Differ (const NCollection_FlatMap& theOther)
+  {
+    if (this == &theOther)
+    {
+      if (this->IsEmpty())
+      {
+        return Standard_False;
+      }
+      Clear();
+      return Standard_True;
+    }
+
+    const Standard_Integer anOldExtent = this->Extent();
+    Difference (*this, theOther);
+    return anOldExtent != this->Extent();
+  }
+
+  //!@}
+};
+
+#endif
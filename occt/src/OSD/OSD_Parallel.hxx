@@ -14,6 +14,7 @@
 #ifndef OSD_Parallel_HeaderFile
 #define OSD_Parallel_HeaderFile
 
+#include <OSD_TaskScheduler.hxx>
 #include <OSD_ThreadPool.hxx>
 #include <Standard_Type.hxx>
 #include <memory>
@@ -52,8 +53,12 @@
 //! (ForEach).
 //!
 //! Implementation uses TBB if OCCT is built with support of TBB; otherwise it
-//! uses ad-hoc parallelization tool. In general, if TBB is available, it is
-//! more efficient to use it directly instead of using OSD_Parallel.
+//! uses the work-stealing scheduler OSD_TaskScheduler, which executes the nested
+//! parallel loops by the same set of threads. The items of For() are started in order
+//! of their indices by at most OSD_ThreadPool::NbDefaultThreadsToLaunch() threads.
+//! The threads of the scheduler are not shared with OSD_ThreadPool, so that the code
+//! combining OSD_ThreadPool::Launcher with OSD_Parallel may use more threads than processors.
+//! In general, if TBB is available, it is more efficient to use it directly instead of using OSD_Parallel.
 
 class OSD_Parallel
 {
@@ -242,24 +247,6 @@ private:
     const Functor& myFunctor;
   };
 
-  //! Wrapper redirecting functor taking element index to functor taking also thread index.
-  template<class Functor>
-  class FunctorWrapperForThreadPool
-  {
-  public:
-    FunctorWrapperForThreadPool (const Functor& theFunctor) : myFunctor(theFunctor) {}
-
-    void operator() (int theThreadIndex, int theElemIndex) const
-    {
-      (void )theThreadIndex;
-      myFunctor (theElemIndex);
-    }
-  private:
-    FunctorWrapperForThreadPool (const FunctorWrapperForThreadPool&);
-    void operator= (const FunctorWrapperForThreadPool&);
-    const Functor& myFunctor;
-  };
-
 private:
 
   //! Simple primitive for parallelization of "foreach" loops, e.g.:
@@ -362,10 +349,9 @@ public: //! @name public methods
     }
     else if (ToUseOcctThreads())
     {
-      const Handle(OSD_ThreadPool)& aThreadPool = OSD_ThreadPool::DefaultPool();
-      OSD_ThreadPool::Launcher aPoolLauncher (*aThreadPool, aRange);
-      FunctorWrapperForThreadPool<Functor> aFunctor (theFunctor);
-      aPoolLauncher.Perform (theBegin, theEnd, aFunctor);
+      // the nested loops are executed by the same worker threads
+      const int aNbThreads = OSD_ThreadPool::DefaultPool()->NbDefaultThreadsToLaunch();
+      OSD_TaskScheduler::DefaultScheduler()->For (theBegin, theEnd, theFunctor, Max (aNbThreads, 1));
     }
     else
     {
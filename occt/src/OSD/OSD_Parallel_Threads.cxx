@@ -16,19 +16,18 @@
 
 #include <OSD_Parallel.hxx>
 
+#include <OSD_TaskScheduler.hxx>
 #include <OSD_ThreadPool.hxx>
 
-#include <NCollection_Array1.hxx>
 #include <Standard_Mutex.hxx>
-#include <OSD_Thread.hxx>
 
 namespace 
 {
   //! Class implementing tools for parallel processing 
-  //! using threads (when TBB is not available);
+  //! using OSD_TaskScheduler (when TBB is not available);
   //! it is derived from OSD_Parallel to get access to 
   //! Iterator and FunctorInterface nested types.
-  class OSD_Parallel_Threads : public OSD_ThreadPool, public OSD_Parallel
+  class OSD_Parallel_Threads : public OSD_Parallel
   {
   public:
     //! Auxiliary class which ensures exclusive
@@ -82,8 +81,8 @@ namespace
       mutable Standard_Mutex                 myMutex; //!< Access controller for the first non processed element.
     };
 
-    //! Auxiliary wrapper class for thread function.
-    class Task : public JobInterface
+    //! Task processing the items of the shared range until its end.
+    class Task : public OSD_TaskScheduler::Task
     {
     public: //! @name public methods
 
@@ -96,7 +95,7 @@ namespace
 
       //! Method is executed in the context of thread,
       //! so this method defines the main calculations.
-      virtual void Perform (int ) Standard_OVERRIDE
+      virtual void Perform() Standard_OVERRIDE
       {
         for (OSD_Parallel::UniversalIterator anIter = myRange.It(); anIter != myRange.End(); anIter = myRange.It())
         {
@@ -116,25 +115,6 @@ namespace
       const FunctorInterface& myPerformer; //!< Link on functor
       const Range& myRange; //!< Link on processed data block
     };
-
-    //! Launcher specialization.
-    class UniversalLauncher : public Launcher
-    {
-    public:
-      //! Constructor.
-      UniversalLauncher (OSD_ThreadPool& thePool, int theMaxThreads = -1)
-      : Launcher (thePool, theMaxThreads) {}
-
-      //! Primitive for parallelization of "for" loops.
-      void Perform (OSD_Parallel::UniversalIterator& theBegin,
-                    OSD_Parallel::UniversalIterator& theEnd,
-                    const OSD_Parallel::FunctorInterface& theFunctor)
-      {
-        Range aData (theBegin, theEnd);
-        Task aJob (theFunctor, aData);
-        perform (aJob);
-      }
-    };
   };
 }
 
@@ -147,10 +127,22 @@ void OSD_Parallel::forEachOcct (UniversalIterator& theBegin,
                                 const FunctorInterface& theFunctor,
                                 Standard_Integer theNbItems)
 {
-  const Handle(OSD_ThreadPool)& aThreadPool = OSD_ThreadPool::DefaultPool();
-  const Standard_Integer aNbThreads = theNbItems != -1 ? Min (theNbItems, aThreadPool->NbDefaultThreadsToLaunch()) : -1;
-  OSD_Parallel_Threads::UniversalLauncher aLauncher (*aThreadPool, aNbThreads);
-  aLauncher.Perform (theBegin, theEnd, theFunctor);
+  const Handle(OSD_TaskScheduler)& aScheduler = OSD_TaskScheduler::DefaultScheduler();
+  Standard_Integer aNbThreads = Min (OSD_ThreadPool::DefaultPool()->NbDefaultThreadsToLaunch(), aScheduler->NbThreads());
+  if (theNbItems != -1)
+  {
+    aNbThreads = Min (theNbItems, aNbThreads);
+  }
+
+  // each task takes the items one by one until the end of the range;
+  // the calling thread executes the tasks not taken by other threads
+  OSD_Parallel_Threads::Range aData (theBegin, theEnd);
+  OSD_TaskScheduler::TaskGroup aGroup (*aScheduler);
+  for (Standard_Integer aTaskIter = 0; aTaskIter < Max (aNbThreads, 1); ++aTaskIter)
+  {
+    aGroup.Spawn (new OSD_Parallel_Threads::Task (theFunctor, aData));
+  }
+  aGroup.Wait();
 }
 
 // Version of parallel executor used when TBB is not available
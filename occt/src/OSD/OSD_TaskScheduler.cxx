@@ -0,0 +1,595 @@
+// Created on: 2026-10-18
+//
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <OSD_TaskScheduler.hxx>
+
+#include <OSD.hxx>
+#include <OSD_Parallel.hxx>
+#include <OSD_Thread.hxx>
+#include <OSD_ThreadPool.hxx>
+#include <Standard_ErrorHandler.hxx>
+#include <Standard_ProgramError.hxx>
+#include <TCollection_AsciiString.hxx>
+
+#include <atomic>
+#include <thread>
+
+IMPLEMENT_STANDARD_RTTIEXT(OSD_TaskScheduler, Standard_Transient)
+
+namespace
+{
+  //! Initial capacity of the queue of the worker
+  static const int THE_QUEUE_INITIAL_SIZE = 256;
+
+  //! Number of attempts to find a task before the idle worker falls asleep
+  static const int THE_NB_SPINS_BEFORE_SLEEP = 64;
+
+  //! Context of the worker thread
+  struct WorkerContext
+  {
+    const OSD_TaskScheduler* Scheduler; //!< scheduler of the worker, NULL for other threads
+    int                      Index;     //!< index of the worker
+    bool                     ToCatchFpe;//!< current floating point exceptions mode of the worker
+  };
+
+  //! Context of the current thread
+  thread_local WorkerContext THE_WORKER_CONTEXT = { NULL, -1, false };
+}
+
+//! Worker thread with its queue of tasks.
+//!
+//! The queue is the double-ended queue of Chase and Lev (in the form for C11 memory model
+//! proposed by Le et al.): the owner pushes and pops the tasks at the bottom,
+//! other threads steal the tasks at the top. The circular buffer is grown by the owner;
+//! the old buffers may be read by the concurrent thieves, thus they are released by destructor.
+class OSD_TaskScheduler::Worker : public OSD_Thread
+{
+public:
+
+  //! Circular buffer of tasks.
+  struct Buffer
+  {
+    std::atomic<Task*>* Tasks; //!< array of tasks
+    int64_t             Mask;  //!< size of the array minus one (the size is power of 2)
+    Buffer*             Prev;  //!< previous (retired) buffer
+
+    Buffer (const int64_t theSize, Buffer* thePrev)
+    : Tasks (new std::atomic<Task*>[(size_t )theSize]), Mask (theSize - 1), Prev (thePrev) {}
+    ~Buffer() { delete[] Tasks; }
+
+    Task* Get (const int64_t theIndex) const { return Tasks[theIndex & Mask].load (std::memory_order_relaxed); }
+    void  Put (const int64_t theIndex, Task* theTask) { Tasks[theIndex & Mask].store (theTask, std::memory_order_relaxed); }
+  };
+
+public:
+
+  //! Constructor.
+  Worker (OSD_TaskScheduler* theScheduler, const int theIndex)
+  : myScheduler (theScheduler),
+    myIndex (theIndex),
+    myTop (0),
+    myBottom (0),
+    myBuffer (new Buffer (THE_QUEUE_INITIAL_SIZE, NULL)),
+    mySeed ((unsigned int )theIndex * 2654435761u + 1u)
+  {
+    SetFunction (&OSD_TaskScheduler::runWorker);
+  }
+
+  //! Destructor.
+  ~Worker()
+  {
+    for (Buffer* aBuffer = myBuffer.load (std::memory_order_relaxed); aBuffer != NULL;)
+    {
+      Buffer* aPrev = aBuffer->Prev;
+      delete aBuffer;
+      aBuffer = aPrev;
+    }
+  }
+
+  //! Returns the scheduler.
+  OSD_TaskScheduler* Scheduler() const { return myScheduler; }
+
+  //! Returns the index of the worker.
+  int Index() const { return myIndex; }
+
+  //! Returns TRUE if the queue looks empty.
+  bool IsEmpty() const
+  {
+    return myBottom.load (std::memory_order_relaxed) <= myTop.load (std::memory_order_relaxed);
+  }
+
+  //! Pushes the task to the bottom of the queue; called by the owner only.
+  void Push (Task* theTask)
+  {
+    const int64_t aBottom = myBottom.load (std::memory_order_relaxed);
+    const int64_t aTop    = myTop.load (std::memory_order_acquire);
+    Buffer* aBuffer = myBuffer.load (std::memory_order_relaxed);
+    if (aBottom - aTop > aBuffer->Mask)
+    {
+      Buffer* aNewBuffer = new Buffer (2 * (aBuffer->Mask + 1), aBuffer);
+      for (int64_t anIter = aTop; anIter < aBottom; ++anIter)
+      {
+        aNewBuffer->Put (anIter, aBuffer->Get (anIter));
+      }
+      myBuffer.store (aNewBuffer, std::memory_order_release);
+      aBuffer = aNewBuffer;
+    }
+    aBuffer->Put (aBottom, theTask);
+    std::atomic_thread_fence (std::memory_order_release);
+    myBottom.store (aBottom + 1, std::memory_order_relaxed);
+  }
+
+  //! Pops the task from the bottom of the queue; called by the owner only.
+  Task* Pop()
+  {
+    const int64_t aBottom = myBottom.load (std::memory_order_relaxed) - 1;
+    Buffer* aBuffer = myBuffer.load (std::memory_order_relaxed);
+    myBottom.store (aBottom, std::memory_order_relaxed);
+    std::atomic_thread_fence (std::memory_order_seq_cst);
+    int64_t aTop = myTop.load (std::memory_order_relaxed);
+    if (aTop > aBottom)
+    {
+      myBottom.store (aBottom + 1, std::memory_order_relaxed);
+      return NULL;
+    }
+
+    Task* aTask = aBuffer->Get (aBottom);
+    if (aTop == aBottom)
+    {
+      // the last task - compete with thieves
+      if (!myTop.compare_exchange_strong (aTop, aTop + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+      {
+        aTask = NULL;
+      }
+      myBottom.store (aBottom + 1, std::memory_order_relaxed);
+    }
+    return aTask;
+  }
+
+  //! Steals the task from the top of the queue; called by other threads.
+  Task* Steal()
+  {
+    int64_t aTop = myTop.load (std::memory_order_acquire);
+    std::atomic_thread_fence (std::memory_order_seq_cst);
+    const int64_t aBottom = myBottom.load (std::memory_order_acquire);
+    if (aTop >= aBottom)
+    {
+      return NULL;
+    }
+
+    Buffer* aBuffer = myBuffer.load (std::memory_order_acquire);
+    Task* aTask = aBuffer->Get (aTop);
+    if (!myTop.compare_exchange_strong (aTop, aTop + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+    {
+      return NULL;
+    }
+    return aTask;
+  }
+
+  //! Returns the pseudo-random number for choosing the victim.
+  unsigned int NextRandom()
+  {
+    mySeed ^= mySeed << 13;
+    mySeed ^= mySeed >> 17;
+    mySeed ^= mySeed << 5;
+    return mySeed;
+  }
+
+private:
+
+  Worker (const Worker& );
+  Worker& operator= (const Worker& );
+
+private:
+
+  OSD_TaskScheduler*   myScheduler; //!< scheduler of the worker
+  int                  myIndex;     //!< index of the worker
+  std::atomic<int64_t> myTop;       //!< index of the top of the queue (next task to steal)
+  std::atomic<int64_t> myBottom;    //!< index of the bottom of the queue (next free slot)
+  std::atomic<Buffer*> myBuffer;    //!< current buffer
+  unsigned int         mySeed;      //!< state of the random generator
+};
+
+//=======================================================================
+//function : IsStolen
+//purpose  :
+//=======================================================================
+bool OSD_TaskScheduler::Task::IsStolen() const
+{
+  return myGroup->Scheduler().CurrentWorker() != myOwner;
+}
+
+//=======================================================================
+//function : TaskGroup
+//purpose  :
+//=======================================================================
+OSD_TaskScheduler::TaskGroup::TaskGroup (OSD_TaskScheduler& theScheduler)
+: myScheduler (&theScheduler),
+  myNbPending (0),
+  myNbFailures (0),
+  myToCatchFpe (OSD::ToCatchFloatingSignals())
+{
+  //
+}
+
+//=======================================================================
+//function : ~TaskGroup
+//purpose  :
+//=======================================================================
+OSD_TaskScheduler::TaskGroup::~TaskGroup()
+{
+  wait (false);
+}
+
+//=======================================================================
+//function : Spawn
+//purpose  :
+//=======================================================================
+void OSD_TaskScheduler::TaskGroup::Spawn (Task* theTask)
+{
+  theTask->myGroup = this;
+  myNbPending.fetch_add (1, std::memory_order_relaxed);
+  myScheduler->spawn (theTask);
+}
+
+//=======================================================================
+//function : Wait
+//purpose  :
+//=======================================================================
+void OSD_TaskScheduler::TaskGroup::Wait()
+{
+  wait (true);
+}
+
+//=======================================================================
+//function : wait
+//purpose  :
+//=======================================================================
+void OSD_TaskScheduler::TaskGroup::wait (const bool theToThrow)
+{
+  const int aWorker = myScheduler->CurrentWorker();
+  // acquire ordering makes the results and failures of the completed tasks visible
+  while (myNbPending.load (std::memory_order_acquire) != 0)
+  {
+    if (Task* aTask = myScheduler->takeTask (aWorker))
+    {
+      myScheduler->execute (aTask);
+    }
+    else
+    {
+      // the remaining tasks are executed by other threads
+      std::this_thread::yield();
+    }
+  }
+
+  if (myNbFailures == 0
+  || !theToThrow)
+  {
+    return;
+  }
+
+  Handle(Standard_Failure) aFailure = myFailure;
+  const int aNbFailures = myNbFailures;
+  myFailure.Nullify();
+  myNbFailures = 0;
+  if (aNbFailures == 1)
+  {
+    aFailure->Reraise();
+  }
+
+  TCollection_AsciiString aFailures = TCollection_AsciiString ("Multiple exceptions:\n") + aFailure->GetMessageString();
+  throw Standard_ProgramError (aFailures.ToCString(), NULL);
+}
+
+//=======================================================================
+//function : addFailure
+//purpose  :
+//=======================================================================
+void OSD_TaskScheduler::TaskGroup::addFailure (const Handle(Standard_Failure)& theFailure)
+{
+  Standard_Mutex::Sentry aLock (myMutex);
+  if (++myNbFailures == 1)
+  {
+    myFailure = theFailure;
+    return;
+  }
+
+  TCollection_AsciiString aFailures (myFailure->GetMessageString());
+  aFailures += "\n";
+  aFailures += theFailure->GetMessageString();
+  myFailure = new Standard_ProgramError (aFailures.ToCString(), NULL);
+}
+
+//=======================================================================
+//function : DefaultScheduler
+//purpose  :
+//=======================================================================
+const Handle(OSD_TaskScheduler)& OSD_TaskScheduler::DefaultScheduler()
+{
+  static const Handle(OSD_TaskScheduler) THE_GLOBAL_SCHEDULER = new OSD_TaskScheduler (OSD_ThreadPool::DefaultPool()->NbThreads());
+  return THE_GLOBAL_SCHEDULER;
+}
+
+//=======================================================================
+//function : OSD_TaskScheduler
+//purpose  :
+//=======================================================================
+OSD_TaskScheduler::OSD_TaskScheduler (int theNbThreads)
+: myWorkers (NULL),
+  myNbWorkers (0),
+  myNbShared (0),
+  myWakeEvent (false),
+  myNbSleeping (0),
+  myToShutDown (false)
+{
+#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+  // threads are not available
+  (void )theNbThreads;
+#else
+  myNbWorkers = Max (0, (theNbThreads > 0 ? theNbThreads : OSD_Parallel::NbLogicalProcessors()) - 1);
+#endif
+  if (myNbWorkers == 0)
+  {
+    return;
+  }
+
+  myWorkers = new Worker*[myNbWorkers];
+  for (int aWorkerIter = 0; aWorkerIter < myNbWorkers; ++aWorkerIter)
+  {
+    myWorkers[aWorkerIter] = new Worker (this, aWorkerIter);
+  }
+  for (int aWorkerIter = 0; aWorkerIter < myNbWorkers; ++aWorkerIter)
+  {
+    myWorkers[aWorkerIter]->Run (myWorkers[aWorkerIter]);
+  }
+}
+
+//=======================================================================
+//function : ~OSD_TaskScheduler
+//purpose  :
+//=======================================================================
+OSD_TaskScheduler::~OSD_TaskScheduler()
+{
+  if (myNbWorkers == 0)
+  {
+    return;
+  }
+
+  myToShutDown = true;
+  myWakeEvent.Set();
+  for (int aWorkerIter = 0; aWorkerIter < myNbWorkers; ++aWorkerIter)
+  {
+    Standard_Address aResult = NULL;
+    myWorkers[aWorkerIter]->Wait (aResult);
+  }
+  for (int aWorkerIter = 0; aWorkerIter < myNbWorkers; ++aWorkerIter)
+  {
+    delete myWorkers[aWorkerIter];
+  }
+  delete[] myWorkers;
+}
+
+//=======================================================================
+//function : CurrentWorker
+//purpose  :
+//=======================================================================
+int OSD_TaskScheduler::CurrentWorker() const
+{
+  return THE_WORKER_CONTEXT.Scheduler == this ? THE_WORKER_CONTEXT.Index : -1;
+}
+
+//=======================================================================
+//function : spawn
+//purpose  :
+//=======================================================================
+void OSD_TaskScheduler::spawn (Task* theTask)
+{
+  const int aWorker = CurrentWorker();
+  theTask->myOwner = aWorker;
+  if (aWorker >= 0)
+  {
+    myWorkers[aWorker]->Push (theTask);
+  }
+  else
+  {
+    Standard_Mutex::Sentry aLock (mySharedMutex);
+    mySharedQueue.Append (theTask);
+    myNbShared.fetch_add (1);
+  }
+
+  // the task should be visible to the worker which has checked the queues before falling asleep
+  std::atomic_thread_fence (std::memory_order_seq_cst);
+  if (myNbSleeping.load() > 0)
+  {
+    myWakeEvent.Set();
+  }
+}
+
+//=======================================================================
+//function : takeTask
+//purpose  :
+//=======================================================================
+OSD_TaskScheduler::Task* OSD_TaskScheduler::takeTask (const int theWorker)
+{
+  if (theWorker >= 0)
+  {
+    if (Task* aTask = myWorkers[theWorker]->Pop())
+    {
+      return aTask;
+    }
+  }
+
+  if (myNbShared.load (std::memory_order_relaxed) > 0)
+  {
+    Standard_Mutex::Sentry aLock (mySharedMutex);
+    if (!mySharedQueue.IsEmpty())
+    {
+      Task* aTask = mySharedQueue.First();
+      mySharedQueue.RemoveFirst();
+      myNbShared.fetch_sub (1);
+      return aTask;
+    }
+  }
+
+  if (myNbWorkers == 0)
+  {
+    return NULL;
+  }
+
+  // steal from the workers starting from the random one
+  static thread_local unsigned int THE_EXTERNAL_SEED = 1u;
+  unsigned int aRandom = 0;
+  if (theWorker >= 0)
+  {
+    aRandom = myWorkers[theWorker]->NextRandom();
+  }
+  else
+  {
+    THE_EXTERNAL_SEED = THE_EXTERNAL_SEED * 1103515245u + 12345u;
+    aRandom = THE_EXTERNAL_SEED >> 8;
+  }
+
+  const int aStart = (int )(aRandom % (unsigned int )myNbWorkers);
+  for (int aVictimIter = 0; aVictimIter < myNbWorkers; ++aVictimIter)
+  {
+    const int aVictim = (aStart + aVictimIter) % myNbWorkers;
+    if (aVictim == theWorker
+     || myWorkers[aVictim]->IsEmpty())
+    {
+      continue;
+    }
+
+    if (Task* aTask = myWorkers[aVictim]->Steal())
+    {
+      return aTask;
+    }
+  }
+  return NULL;
+}
+
+//=======================================================================
+//function : execute
+//purpose  :
+//=======================================================================
+void OSD_TaskScheduler::execute (Task* theTask)
+{
+  TaskGroup* aGroup = theTask->myGroup;
+
+  // apply the mode of the thread which has created the group;
+  // the mode of the thread is restored afterwards, as the task may be nested
+  // into the task of another group waiting for completion of its own tasks;
+  // the mode is tracked by the workers and requested for other threads helping to execute the tasks
+  const bool isWorker = THE_WORKER_CONTEXT.Scheduler != NULL;
+  const bool aPrevFpe = isWorker ? THE_WORKER_CONTEXT.ToCatchFpe : OSD::ToCatchFloatingSignals();
+  const bool toSwitchFpe = aPrevFpe != aGroup->myToCatchFpe;
+  if (toSwitchFpe)
+  {
+    THE_WORKER_CONTEXT.ToCatchFpe = aGroup->myToCatchFpe;
+    OSD::SetThreadLocalSignal (OSD::SignalMode(), aGroup->myToCatchFpe);
+  }
+
+  try
+  {
+    OCC_CATCH_SIGNALS
+    theTask->Perform();
+  }
+  catch (Standard_Failure const& aFailure)
+  {
+    TCollection_AsciiString aMsg = TCollection_AsciiString (aFailure.DynamicType()->Name())
+                                 + ": " + aFailure.GetMessageString();
+    aGroup->addFailure (new Standard_ProgramError (aMsg.ToCString(), aFailure.GetStackString()));
+  }
+  catch (std::exception& anStdException)
+  {
+    TCollection_AsciiString aMsg = TCollection_AsciiString (typeid(anStdException).name())
+                                 + ": " + anStdException.what();
+    aGroup->addFailure (new Standard_ProgramError (aMsg.ToCString(), NULL));
+  }
+  catch (...)
+  {
+    aGroup->addFailure (new Standard_ProgramError ("Error: Unknown exception", NULL));
+  }
+
+  delete theTask;
+  if (toSwitchFpe)
+  {
+    THE_WORKER_CONTEXT.ToCatchFpe = aPrevFpe;
+    OSD::SetThreadLocalSignal (OSD::SignalMode(), aPrevFpe);
+  }
+
+  // the group may be destroyed by the waiting thread right after this point;
+  // release ordering publishes the results and failures of the task
+  aGroup->myNbPending.fetch_sub (1, std::memory_order_release);
+}
+
+//=======================================================================
+//function : performWorker
+//purpose  :
+//=======================================================================
+void OSD_TaskScheduler::performWorker (const int theWorker)
+{
+  THE_WORKER_CONTEXT.Scheduler  = this;
+  THE_WORKER_CONTEXT.Index      = theWorker;
+  THE_WORKER_CONTEXT.ToCatchFpe = false;
+  OSD::SetThreadLocalSignal (OSD::SignalMode(), false);
+
+  int aNbSpins = 0;
+  for (;;)
+  {
+    if (Task* aTask = takeTask (theWorker))
+    {
+      execute (aTask);
+      aNbSpins = 0;
+      continue;
+    }
+    if (myToShutDown)
+    {
+      return;
+    }
+    if (++aNbSpins < THE_NB_SPINS_BEFORE_SLEEP)
+    {
+      std::this_thread::yield();
+      continue;
+    }
+
+    // fall asleep; the queues are checked once more after announcing the sleep,
+    // so that the task spawned concurrently either is found or wakes up the worker
+    aNbSpins = 0;
+    myNbSleeping.fetch_add (1);
+    myWakeEvent.Reset();
+    if (Task* aTask = takeTask (theWorker))
+    {
+      myNbSleeping.fetch_sub (1);
+      execute (aTask);
+      continue;
+    }
+    if (!myToShutDown)
+    {
+      myWakeEvent.Wait();
+    }
+    myNbSleeping.fetch_sub (1);
+  }
+}
+
+//=======================================================================
+//function : runWorker
+//purpose  :
+//=======================================================================
+Standard_Address OSD_TaskScheduler::runWorker (Standard_Address theWorker)
+{
+  Worker* aWorker = static_cast<Worker*> (theWorker);
+  aWorker->Scheduler()->performWorker (aWorker->Index());
+  return NULL;
+}
@@ -0,0 +1,371 @@
+// Created on: 2026-10-18
+//
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _OSD_TaskScheduler_HeaderFile
+#define _OSD_TaskScheduler_HeaderFile
+
+#include <NCollection_List.hxx>
+#include <Standard_Condition.hxx>
+#include <Standard_DefineAlloc.hxx>
+#include <Standard_Failure.hxx>
+#include <Standard_Mutex.hxx>
+#include <Standard_Transient.hxx>
+
+#include <atomic>
+
+//! Scheduler of tasks executed by a fixed set of worker threads using work stealing.
+//!
+//! Each worker thread keeps its own double-ended queue of tasks (Chase-Lev deque):
+//! the tasks spawned by the worker are pushed into its queue and taken back in LIFO order,
+//! while the idle workers steal the oldest tasks from the queues of other workers.
+//! The tasks spawned by other threads are put into the shared queue of the scheduler.
+//!
+//! A thread waiting for completion of the group of tasks does not block,
+//! but executes the pending tasks (its own ones first), so that the nested parallel
+//! algorithms (e.g. parallel meshing of faces within the parallel Boolean operation)
+//! are executed by all worker threads without deadlocks and oversubscription.
+//! The calling thread participates in the execution, thus the scheduler
+//! with N threads has N - 1 worker threads.
+//!
+//! The parallel loops (For()) are processed by at most the requested number of tasks,
+//! which take the indices from the shared counter in increasing order by small chunks
+//! (one by one for the ranges of moderate size), so that the load is balanced
+//! for the items of different cost and the items sorted by decreasing cost are started first.
+//! The size of the chunk is proportional to the number of the remaining indices
+//! (guided scheduling), so that the last items are taken one by one
+//! and the threads finish together even if the cost of the items is very uneven.
+//!
+//! Exceptions raised by the tasks are caught and rethrown by TaskGroup::Wait()
+//! in the waiting thread, as by OSD_ThreadPool::Launcher.
+//!
+//! The scheduler is used by OSD_Parallel when OCCT threads are in use.
+//! The waiting threads never sleep on a condition, so that the scheduler can be used
+//! from the main thread of the Emscripten builds with pthreads.
+//!
+//! The worker threads of the scheduler are not shared with OSD_ThreadPool:
+//! the code running OSD_ThreadPool::Launcher concurrently with OSD_Parallel loops
+//! may use up to the sum of the threads of both.
+class OSD_TaskScheduler : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(OSD_TaskScheduler, Standard_Transient)
+public:
+
+  class TaskGroup;
+
+  //! Interface of the task executed by the scheduler.
+  class Task
+  {
+    friend class OSD_TaskScheduler;
+    friend class TaskGroup;
+  public:
+    DEFINE_STANDARD_ALLOC
+
+    //! Constructor.
+    Task() : myGroup (NULL), myOwner (-1) {}
+
+    //! Destructor.
+    virtual ~Task() {}
+
+    //! Performs the task; the task is destroyed by the scheduler after execution.
+    virtual void Perform() = 0;
+
+  protected:
+
+    //! Returns TRUE if the task is executed by the thread other than the one which has spawned it.
+    Standard_EXPORT bool IsStolen() const;
+
+    //! Returns the group of the task.
+    TaskGroup* Group() const { return myGroup; }
+
+  private:
+    TaskGroup* myGroup; //!< group of the task
+    int        myOwner; //!< index of the worker which has spawned the task, -1 for other threads
+  };
+
+  //! Group of tasks which can be waited for completion.
+  //! The group should not be destroyed before completion of its tasks;
+  //! the destructor waits for them.
+  class TaskGroup
+  {
+    friend class OSD_TaskScheduler;
+  public:
+
+    //! Creates the group of tasks executed by the given scheduler.
+    Standard_EXPORT TaskGroup (OSD_TaskScheduler& theScheduler);
+
+    //! Waits for completion of the tasks; the exceptions are not rethrown.
+    Standard_EXPORT ~TaskGroup();
+
+    //! Returns the scheduler of the group.
+    OSD_TaskScheduler& Scheduler() const { return *myScheduler; }
+
+    //! Spawns the task; the group takes the ownership of the task.
+    Standard_EXPORT void Spawn (Task* theTask);
+
+    //! Spawns the task calling the copy of the functor providing "void operator()() const".
+    template<typename Functor>
+    void Run (const Functor& theFunctor)
+    {
+      Spawn (new FunctorTask<Functor> (theFunctor));
+    }
+
+    //! Returns TRUE if all tasks of the group have been completed.
+    bool IsDone() const { return myNbPending.load (std::memory_order_acquire) == 0; }
+
+    //! Executes pending tasks until all tasks of the group have been completed.
+    //! Throws the exception caught in the tasks of the group.
+    Standard_EXPORT void Wait();
+
+  private:
+
+    //! Waits for completion of the tasks and optionally rethrows the exceptions.
+    void wait (const bool theToThrow);
+
+    //! Records the exception caught in the task.
+    void addFailure (const Handle(Standard_Failure)& theFailure);
+
+  private:
+
+    //! Task calling the functor.
+    template<typename Functor>
+    class FunctorTask : public Task
+    {
+    public:
+      FunctorTask (const Functor& theFunctor) : myFunctor (theFunctor) {}
+      virtual void Perform() Standard_OVERRIDE { myFunctor(); }
+    private:
+      Functor myFunctor;
+    };
+
+  private:
+    TaskGroup (const TaskGroup& );
+    TaskGroup& operator= (const TaskGroup& );
+
+  private:
+    OSD_TaskScheduler*       myScheduler; //!< scheduler executing the tasks
+    std::atomic<int>         myNbPending; //!< number of spawned and not completed tasks
+    int                      myNbFailures;//!< number of caught exceptions
+    Handle(Standard_Failure) myFailure;   //!< caught exception (combined if several)
+    Standard_Mutex           myMutex;     //!< mutex protecting the exceptions
+    bool                     myToCatchFpe;//!< floating point exceptions mode of the spawning thread
+  };
+
+  //! Result of the functor (providing "Result operator()() const") computed asynchronously.
+  //! The result is obtained by Get(), which executes pending tasks while waiting.
+  template<typename Result>
+  class Future
+  {
+  public:
+
+    //! Spawns the computation of the copy of the functor.
+    template<typename Functor>
+    Future (OSD_TaskScheduler& theScheduler, const Functor& theFunctor)
+    : myGroup (theScheduler),
+      myResult()
+    {
+      myGroup.Spawn (new ResultTask<Functor> (theFunctor, myResult));
+    }
+
+    //! Returns TRUE if the result has been computed.
+    bool IsReady() const { return myGroup.IsDone(); }
+
+    //! Waits for the result; throws the exception caught in the computation.
+    const Result& Get()
+    {
+      myGroup.Wait();
+      return myResult;
+    }
+
+  private:
+
+    //! Task computing the result.
+    template<typename Functor>
+    class ResultTask : public Task
+    {
+    public:
+      ResultTask (const Functor& theFunctor, Result& theResult) : myFunctor (theFunctor), myResult (theResult) {}
+      virtual void Perform() Standard_OVERRIDE { myResult = myFunctor(); }
+    private:
+      void operator= (const ResultTask& );
+    private:
+      Functor myFunctor;
+      Result& myResult;
+    };
+
+  private:
+    Future (const Future& );
+    Future& operator= (const Future& );
+
+  private:
+    TaskGroup myGroup;
+    Result    myResult;
+  };
+
+public:
+
+  //! Returns (or creates) the default scheduler.
+  //! The number of threads is taken from OSD_ThreadPool::DefaultPool() (OSD_ThreadPool::NbThreads())
+  //! when called first time and is not changed later; OSD_Parallel limits the number of threads
+  //! processing each loop by OSD_ThreadPool::NbDefaultThreadsToLaunch().
+  //! The threads of the scheduler are created in addition to the threads of OSD_ThreadPool.
+  Standard_EXPORT static const Handle(OSD_TaskScheduler)& DefaultScheduler();
+
+  //! Creates the scheduler.
+  //! @param theNbThreads number of threads including the calling one
+  //!                     (if -1 is specified then OSD_Parallel::NbLogicalProcessors() will be used)
+  Standard_EXPORT OSD_TaskScheduler (int theNbThreads = -1);
+
+  //! Stops the worker threads; should not be called while the tasks are executed.
+  Standard_EXPORT virtual ~OSD_TaskScheduler();
+
+  //! Returns the number of threads executing the tasks including the calling one; >= 1.
+  int NbThreads() const { return myNbWorkers + 1; }
+
+  //! Returns TRUE if at least 2 threads are available (including the calling one).
+  bool HasThreads() const { return myNbWorkers > 0; }
+
+  //! Returns index of the worker thread of this scheduler calling the method, -1 for other threads.
+  Standard_EXPORT int CurrentWorker() const;
+
+  //! Parallel loop, equivalent to:
+  //! @code
+  //!   for (int anIter = theBegin; anIter < theEnd; ++anIter) { theFunctor (anIter); }
+  //! @endcode
+  //! @param theBegin   the first index (inclusive)
+  //! @param theEnd     the last  index (exclusive)
+  //! @param theFunctor functor providing an interface "void operator(int theIndex) const"
+  //! The indices are handed out in increasing order, so that the items sorted by decreasing cost are started first.
+  //! @param theMaxConcurrency maximal number of threads processing the range, -1 means all threads
+  template<typename Functor>
+  void For (const int theBegin, const int theEnd, const Functor& theFunctor, const int theMaxConcurrency = -1)
+  {
+    const int aNbThreads = Min (theMaxConcurrency > 0 ? Min (theMaxConcurrency, NbThreads()) : NbThreads(),
+                                theEnd - theBegin);
+    if (aNbThreads < 2)
+    {
+      for (int anIter = theBegin; anIter < theEnd; ++anIter)
+      {
+        theFunctor (anIter);
+      }
+      return;
+    }
+
+    // the items are taken one by one unless the remaining part of the range is large
+    Range aRange (theBegin, theEnd, THE_NB_CHUNKS_PER_THREAD * aNbThreads);
+    TaskGroup aGroup (*this);
+    for (int aTaskIter = 0; aTaskIter < aNbThreads; ++aTaskIter)
+    {
+      aGroup.Spawn (new RangeTask<Functor> (theFunctor, aRange));
+    }
+    aGroup.Wait();
+  }
+
+private:
+
+  //! Number of chunks per thread the remaining part of the range of For() is divided into.
+  static const int THE_NB_CHUNKS_PER_THREAD = 256;
+
+  //! Range of indices shared by the tasks of For().
+  struct Range
+  {
+    std::atomic<int> Next;     //!< first index not taken yet
+    const int        End;      //!< the last index (exclusive)
+    const int        NbChunks; //!< number of chunks the remaining indices are divided into
+
+    Range (const int theBegin, const int theEnd, const int theNbChunks) : Next (theBegin), End (theEnd), NbChunks (theNbChunks) {}
+  };
+
+  //! Task processing the chunks of the shared range until its end.
+  template<typename Functor>
+  class RangeTask : public Task
+  {
+  public:
+    RangeTask (const Functor& theFunctor, Range& theRange)
+    : myFunctor (theFunctor), myRange (theRange) {}
+
+    virtual void Perform() Standard_OVERRIDE
+    {
+      int aBegin = myRange.Next.load (std::memory_order_relaxed);
+      for (;;)
+      {
+        if (aBegin >= myRange.End)
+        {
+          return;
+        }
+
+        // the chunk decreases with the remaining part of the range
+        const int anEnd = aBegin + Max (1, (myRange.End - aBegin) / myRange.NbChunks);
+        if (!myRange.Next.compare_exchange_weak (aBegin, anEnd, std::memory_order_relaxed))
+        {
+          continue;
+        }
+
+        for (int anIter = aBegin; anIter < anEnd; ++anIter)
+        {
+          myFunctor (anIter);
+        }
+        aBegin = myRange.Next.load (std::memory_order_relaxed);
+      }
+    }
+
+  private:
+    void operator= (const RangeTask& );
+
+  private:
+    const Functor& myFunctor;
+    Range&         myRange;
+  };
+
+private:
+
+  //! Worker thread with its queue of tasks (internal).
+  class Worker;
+
+  //! Puts the task into the queue of the calling worker or into the shared queue.
+  void spawn (Task* theTask);
+
+  //! Takes the task for execution by the given worker (-1 for other threads):
+  //! from its own queue, from the shared queue, or steals from other workers.
+  Task* takeTask (const int theWorker);
+
+  //! Executes the task and destroys it.
+  void execute (Task* theTask);
+
+  //! Main loop of the worker thread.
+  void performWorker (const int theWorker);
+
+  //! Thread function of workers.
+  static Standard_Address runWorker (Standard_Address theWorker);
+
+private:
+  OSD_TaskScheduler (const OSD_TaskScheduler& );
+  OSD_TaskScheduler& operator= (const OSD_TaskScheduler& );
+
+private:
+
+  Worker**               myWorkers;     //!< worker threads
+  int                    myNbWorkers;   //!< number of worker threads
+  NCollection_List<Task*> mySharedQueue; //!< queue of the tasks spawned by other threads
+  std::atomic<int>       myNbShared;    //!< number of tasks in the shared queue
+  Standard_Mutex         mySharedMutex; //!< mutex protecting the shared queue
+  Standard_Condition     myWakeEvent;   //!< event waking up the sleeping workers
+  std::atomic<int>       myNbSleeping;  //!< number of sleeping workers
+  std::atomic<bool>      myToShutDown;  //!< flag to stop the workers
+
+};
+
+DEFINE_STANDARD_HANDLE(OSD_TaskScheduler, Standard_Transient)
+
+#endif // _OSD_TaskScheduler_HeaderFile
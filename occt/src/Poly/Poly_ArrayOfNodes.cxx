@@ -59,3 +59,82 @@ Poly_ArrayOfNodes& Poly_ArrayOfNodes::Assign (const Poly_ArrayOfNodes& theOther)
   }
   return *this;
 }
+
+// =======================================================================
+// function : CopyToBatch
+// purpose  :
+// =======================================================================
+void Poly_ArrayOfNodes::CopyToBatch (gp_XYZBatch& theBatch,
+                                     Standard_Integer theFirst,
+                                     Standard_Integer theNbNodes) const
+{
+  Standard_OutOfRange_Raise_if (theFirst < 0 || theNbNodes < 0 || theFirst + theNbNodes > mySize,
+                                "Poly_ArrayOfNodes::CopyToBatch(), range is out of array");
+  theBatch.Resize (theNbNodes);
+  if (theNbNodes == 0)
+  {
+    return;
+  }
+
+  Standard_Real* anX = theBatch.ChangeX();
+  Standard_Real* anY = theBatch.ChangeY();
+  Standard_Real* aZ  = theBatch.ChangeZ();
+  if (IsDoublePrecision())
+  {
+    const gp_Pnt* aNodes = &NCollection_AliasedArray::Value<gp_Pnt> (theFirst);
+    for (Standard_Integer anIter = 0; anIter < theNbNodes; ++anIter)
+    {
+      const gp_XYZ& aNode = aNodes[anIter].XYZ();
+      anX[anIter] = aNode.X();
+      anY[anIter] = aNode.Y();
+      aZ [anIter] = aNode.Z();
+    }
+  }
+  else
+  {
+    const gp_Vec3f* aNodes = &NCollection_AliasedArray::Value<gp_Vec3f> (theFirst);
+    for (Standard_Integer anIter = 0; anIter < theNbNodes; ++anIter)
+    {
+      const gp_Vec3f& aNode = aNodes[anIter];
+      anX[anIter] = aNode.x();
+      anY[anIter] = aNode.y();
+      aZ [anIter] = aNode.z();
+    }
+  }
+}
+
+// =======================================================================
+// function : CopyFromBatch
+// purpose  :
+// =======================================================================
+void Poly_ArrayOfNodes::CopyFromBatch (const gp_XYZBatch& theBatch,
+                                       Standard_Integer theFirst)
+{
+  const Standard_Integer aNbNodes = theBatch.Size();
+  Standard_OutOfRange_Raise_if (theFirst < 0 || theFirst + aNbNodes > mySize,
+                                "Poly_ArrayOfNodes::CopyFromBatch(), range is out of array");
+  if (aNbNodes == 0)
+  {
+    return;
+  }
+
+  const Standard_Real* anX = theBatch.X();
+  const Standard_Real* anY = theBatch.Y();
+  const Standard_Real* aZ  = theBatch.Z();
+  if (IsDoublePrecision())
+  {
+    gp_Pnt* aNodes = &NCollection_AliasedArray::ChangeValue<gp_Pnt> (theFirst);
+    for (Standard_Integer anIter = 0; anIter < aNbNodes; ++anIter)
+    {
+      aNodes[anIter].SetCoord (anX[anIter], anY[anIter], aZ[anIter]);
+    }
+  }
+  else
+  {
+    gp_Vec3f* aNodes = &NCollection_AliasedArray::ChangeValue<gp_Vec3f> (theFirst);
+    for (Standard_Integer anIter = 0; anIter < aNbNodes; ++anIter)
+    {
+      aNodes[anIter].SetValues ((float )anX[anIter], (float )anY[anIter], (float )aZ[anIter]);
+    }
+  }
+}
@@ -17,6 +17,7 @@
 #include <NCollection_AliasedArray.hxx>
 #include <gp_Pnt.hxx>
 #include <gp_Vec3f.hxx>
+#include <gp_XYZBatch.hxx>
 #include <Standard_Macro.hxx>
 
 //! Defines an array of 3D nodes of single/double precision configurable at construction time.
@@ -109,6 +110,20 @@ public:
   //! operator[] - alias to Value
   gp_Pnt operator[] (Standard_Integer theIndex) const { return Value (theIndex); }
 
+public: //! @name conversion from/to batch of coordinates
+
+  //! Copies the nodes [theFirst, theFirst + theNbNodes) into the batch resized to theNbNodes elements.
+  Standard_EXPORT void CopyToBatch (gp_XYZBatch& theBatch,
+                                    Standard_Integer theFirst,
+                                    Standard_Integer theNbNodes) const;
+
+  //! Copies all nodes into the batch.
+  void CopyToBatch (gp_XYZBatch& theBatch) const { CopyToBatch (theBatch, 0, mySize); }
+
+  //! Sets the nodes starting from theFirst to the elements of the batch.
+  Standard_EXPORT void CopyFromBatch (const gp_XYZBatch& theBatch,
+                                      Standard_Integer theFirst = 0);
+
 };
 
 // =======================================================================
@@ -18,7 +18,9 @@
 // purpose  :
 // =======================================================================
 Poly_ArrayOfUVNodes::Poly_ArrayOfUVNodes (const Poly_ArrayOfUVNodes& theOther)
-: NCollection_AliasedArray (theOther)
+: NCollection_AliasedArray (theOther),
+  myQuantMin (theOther.myQuantMin),
+  myQuantStep (theOther.myQuantStep)
 {
   //
 }
@@ -47,11 +49,24 @@ Poly_ArrayOfUVNodes& Poly_ArrayOfUVNodes::Assign (const Poly_ArrayOfUVNodes& the
   {
     // fast copy
     NCollection_AliasedArray::Assign (theOther);
+    myQuantMin  = theOther.myQuantMin;
+    myQuantStep = theOther.myQuantStep;
     return *this;
   }
 
   // slow copy
   if (mySize != theOther.mySize) { throw Standard_DimensionMismatch ("Poly_ArrayOfUVNodes::Assign(), arrays have different sizes"); }
+  if (IsQuantized())
+  {
+    // quantize within the range of other nodes
+    Poly_ArrayOfUVNodes aCopy (theOther);
+    if (!aCopy.IsEmpty())
+    {
+      aCopy.Quantize();
+    }
+    return Move (aCopy);
+  }
+
   for (int anIter = 0; anIter < mySize; ++anIter)
   {
     const gp_Pnt2d aPnt = theOther.Value (anIter);
@@ -59,3 +74,36 @@ Poly_ArrayOfUVNodes& Poly_ArrayOfUVNodes::Assign (const Poly_ArrayOfUVNodes& the
   }
   return *this;
 }
+
+// =======================================================================
+// function : Quantize
+// purpose  :
+// =======================================================================
+void Poly_ArrayOfUVNodes::Quantize()
+{
+  if (IsQuantized()
+   || IsEmpty())
+  {
+    // the range of empty array is undefined
+    return;
+  }
+
+  gp_XY aMin = Value (0).XY(), aMax = aMin;
+  for (int anIter = 1; anIter < mySize; ++anIter)
+  {
+    const gp_XY aNode = Value (anIter).XY();
+    aMin.SetCoord (Min (aMin.X(), aNode.X()), Min (aMin.Y(), aNode.Y()));
+    aMax.SetCoord (Max (aMax.X(), aNode.X()), Max (aMax.Y(), aNode.Y()));
+  }
+
+  Poly_ArrayOfUVNodes aQuantized;
+  aQuantized.myStride    = (Standard_Integer )sizeof(QuantizedNode);
+  aQuantized.myQuantMin  = aMin;
+  aQuantized.myQuantStep = (aMax - aMin) / double(QuantizedNodeMax);
+  aQuantized.Resize (mySize, false);
+  for (int anIter = 0; anIter < mySize; ++anIter)
+  {
+    aQuantized.SetValue (anIter, Value (anIter));
+  }
+  Move (aQuantized);
+}
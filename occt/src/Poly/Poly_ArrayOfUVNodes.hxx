@@ -20,19 +20,23 @@
 #include <Standard_Macro.hxx>
 
 //! Defines an array of 2D nodes of single/double precision configurable at construction time.
+//! The nodes might be also quantized into 16-bit unsigned integers within the range
+//! of their values (see Quantize()) to reduce memory footprint of visualization meshes.
 class Poly_ArrayOfUVNodes : public NCollection_AliasedArray<>
 {
 public:
 
   //! Empty constructor of double-precision array.
-  Poly_ArrayOfUVNodes() : NCollection_AliasedArray ((Standard_Integer )sizeof(gp_Pnt2d))
+  Poly_ArrayOfUVNodes() : NCollection_AliasedArray ((Standard_Integer )sizeof(gp_Pnt2d)), myQuantMin (0.0, 0.0), myQuantStep (0.0, 0.0)
   {
     //
   }
 
   //! Constructor of double-precision array.
   Poly_ArrayOfUVNodes (Standard_Integer theLength)
-  : NCollection_AliasedArray ((Standard_Integer )sizeof(gp_Pnt2d), theLength)
+  : NCollection_AliasedArray ((Standard_Integer )sizeof(gp_Pnt2d), theLength),
+    myQuantMin (0.0, 0.0),
+    myQuantStep (0.0, 0.0)
   {
     //
   }
@@ -43,7 +47,9 @@ public:
   //! Constructor wrapping pre-allocated C-array of values without copying them.
   Poly_ArrayOfUVNodes (const gp_Pnt2d& theBegin,
                        Standard_Integer theLength)
-  : NCollection_AliasedArray (theBegin, theLength)
+  : NCollection_AliasedArray (theBegin, theLength),
+    myQuantMin (0.0, 0.0),
+    myQuantStep (0.0, 0.0)
   {
     //
   }
@@ -51,7 +57,9 @@ public:
   //! Constructor wrapping pre-allocated C-array of values without copying them.
   Poly_ArrayOfUVNodes (const gp_Vec2f& theBegin,
                        Standard_Integer theLength)
-  : NCollection_AliasedArray (theBegin, theLength)
+  : NCollection_AliasedArray (theBegin, theLength),
+    myQuantMin (0.0, 0.0),
+    myQuantStep (0.0, 0.0)
   {
     //
   }
@@ -62,6 +70,22 @@ public:
   //! Returns TRUE if array defines nodes with double precision.
   bool IsDoublePrecision() const { return myStride == (Standard_Integer )sizeof(gp_Pnt2d); }
 
+  //! Returns TRUE if array defines nodes quantized into 16-bit integers.
+  bool IsQuantized() const { return myStride == (Standard_Integer )sizeof(QuantizedNode); }
+
+  //! Returns the range of quantized nodes; the range is undefined for not quantized array.
+  void QuantizationRange (gp_Pnt2d& theMin, gp_Pnt2d& theMax) const
+  {
+    theMin.SetXY (myQuantMin);
+    theMax.SetXY (myQuantMin + myQuantStep * double(QuantizedNodeMax));
+  }
+
+  //! Converts the nodes into 16-bit integers quantized within the range of their values,
+  //! so that the precision of nodes is 1/65535 of the range.
+  //! The nodes set after quantization are clamped to this range.
+  //! Empty array is left unquantized.
+  Standard_EXPORT void Quantize();
+
   //! Sets if array should define nodes with double or single precision.
   //! Raises exception if array was already allocated.
   void SetDoublePrecision (bool theIsDouble)
@@ -79,6 +103,8 @@ public:
   Poly_ArrayOfUVNodes& Move (Poly_ArrayOfUVNodes& theOther)
   {
     NCollection_AliasedArray::Move (theOther);
+    myQuantMin  = theOther.myQuantMin;
+    myQuantStep = theOther.myQuantStep;
     return *this;
   }
 
@@ -87,7 +113,9 @@ public:
 
   //! Move constructor
   Poly_ArrayOfUVNodes (Poly_ArrayOfUVNodes&& theOther) Standard_Noexcept
-  : NCollection_AliasedArray (std::move (theOther))
+  : NCollection_AliasedArray (std::move (theOther)),
+    myQuantMin (theOther.myQuantMin),
+    myQuantStep (theOther.myQuantStep)
   {
     //
   }
@@ -109,6 +137,32 @@ public:
   //! operator[] - alias to Value
   gp_Pnt2d operator[] (Standard_Integer theIndex) const { return Value (theIndex); }
 
+private:
+
+  //! Quantized node.
+  typedef NCollection_Vec2<uint16_t> QuantizedNode;
+
+  //! Maximal value of quantized node component.
+  static const int QuantizedNodeMax = 65535;
+
+  //! Quantizes the value within the range.
+  static uint16_t quantize (double theValue, double theMin, double theStep)
+  {
+    if (theStep <= 0.0)
+    {
+      return 0;
+    }
+    const double aValue = (theValue - theMin) / theStep + 0.5;
+    return aValue <= 0.0
+         ? 0
+         : (aValue >= double(QuantizedNodeMax) ? uint16_t(QuantizedNodeMax) : uint16_t(aValue));
+  }
+
+private:
+
+  gp_XY myQuantMin;  //!< minimal values of quantized nodes
+  gp_XY myQuantStep; //!< quantization steps, 1/65535 of the range of nodes
+
 };
 
 // =======================================================================
@@ -121,6 +175,12 @@ inline gp_Pnt2d Poly_ArrayOfUVNodes::Value (Standard_Integer theIndex) const
   {
     return NCollection_AliasedArray::Value<gp_Pnt2d> (theIndex);
   }
+  else if (myStride == (Standard_Integer )sizeof(QuantizedNode))
+  {
+    const QuantizedNode& aNode = NCollection_AliasedArray::Value<QuantizedNode> (theIndex);
+    return gp_Pnt2d (myQuantMin.X() + myQuantStep.X() * double(aNode.x()),
+                     myQuantMin.Y() + myQuantStep.Y() * double(aNode.y()));
+  }
   else
   {
     const gp_Vec2f& aVec2 = NCollection_AliasedArray::Value<gp_Vec2f> (theIndex);
@@ -138,6 +198,12 @@ inline void Poly_ArrayOfUVNodes::SetValue (Standard_Integer theIndex, const gp_P
   {
     NCollection_AliasedArray::ChangeValue<gp_Pnt2d> (theIndex) = theValue;
   }
+  else if (myStride == (Standard_Integer )sizeof(QuantizedNode))
+  {
+    QuantizedNode& aNode = NCollection_AliasedArray::ChangeValue<QuantizedNode> (theIndex);
+    aNode.SetValues (quantize (theValue.X(), myQuantMin.X(), myQuantStep.X()),
+                     quantize (theValue.Y(), myQuantMin.Y(), myQuantStep.Y()));
+  }
   else
   {
     gp_Vec2f& aVec2 = NCollection_AliasedArray::ChangeValue<gp_Vec2f> (theIndex);
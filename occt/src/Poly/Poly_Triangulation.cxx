@@ -31,6 +31,7 @@ IMPLEMENT_STANDARD_RTTIEXT (Poly_Triangulation, Standard_Transient)
 Poly_Triangulation::Poly_Triangulation()
 : myCachedMinMax (NULL),
   myDeflection   (0),
+  myIsOctNormals (Standard_False),
   myPurpose      (Poly_MeshPurpose_NONE)
 {
   //
@@ -48,6 +49,7 @@ Poly_Triangulation::Poly_Triangulation (const Standard_Integer theNbNodes,
   myDeflection(0),
   myNodes     (theNbNodes),
   myTriangles (1, theNbTriangles),
+  myIsOctNormals (Standard_False),
   myPurpose   (Poly_MeshPurpose_NONE)
 {
   if (theHasUVNodes)
@@ -70,6 +72,7 @@ Poly_Triangulation::Poly_Triangulation (const TColgp_Array1OfPnt&    theNodes,
   myDeflection   (0),
   myNodes        (theNodes.Length()),
   myTriangles    (1, theTriangles.Length()),
+  myIsOctNormals (Standard_False),
   myPurpose      (Poly_MeshPurpose_NONE)
 {
   const Poly_ArrayOfNodes aNodeWrapper (theNodes.First(), theNodes.Length());
@@ -90,6 +93,7 @@ Poly_Triangulation::Poly_Triangulation (const TColgp_Array1OfPnt&    theNodes,
   myNodes        (theNodes.Length()),
   myTriangles    (1, theTriangles.Length()),
   myUVNodes      (theNodes.Length()),
+  myIsOctNormals (Standard_False),
   myPurpose      (Poly_MeshPurpose_NONE)
 {
   const Poly_ArrayOfNodes aNodeWrapper (theNodes.First(), theNodes.Length());
@@ -130,6 +134,8 @@ Poly_Triangulation::Poly_Triangulation (const Handle(Poly_Triangulation)& theTri
   myTriangles (theTriangulation->myTriangles),
   myUVNodes   (theTriangulation->myUVNodes),
   myNormals   (theTriangulation->myNormals),
+  myOctNormals(theTriangulation->myOctNormals),
+  myIsOctNormals(theTriangulation->myIsOctNormals),
   myPurpose   (theTriangulation->myPurpose)
 {
   SetCachedMinMax (theTriangulation->CachedMinMax());
@@ -181,6 +187,11 @@ void Poly_Triangulation::RemoveNormals()
     NCollection_Array1<gp_Vec3f> anEmpty;
     myNormals.Move (anEmpty);
   }
+  if (!myOctNormals.IsEmpty())
+  {
+    NCollection_Array1<OctNormal> anEmpty;
+    myOctNormals.Move (anEmpty);
+  }
 }
 
 //=======================================================================
@@ -268,10 +279,24 @@ Handle(TColgp_HArray1OfPnt2d) Poly_Triangulation::MapUVNodeArray() const
 //=======================================================================
 Handle(TShort_HArray1OfShortReal) Poly_Triangulation::MapNormalArray() const
 {
-  if (myNormals.IsEmpty())
+  if (!HasNormals())
   {
     return Handle(TShort_HArray1OfShortReal)();
   }
+  if (myIsOctNormals)
+  {
+    // decoded copy
+    Handle(TShort_HArray1OfShortReal) aCopy = new TShort_HArray1OfShortReal (1, 3 * NbNodes());
+    gp_Vec3f aNorm;
+    for (Standard_Integer aNodeIter = 1; aNodeIter <= NbNodes(); ++aNodeIter)
+    {
+      Normal (aNodeIter, aNorm);
+      aCopy->SetValue (aNodeIter * 3 - 2, aNorm.x());
+      aCopy->SetValue (aNodeIter * 3 - 1, aNorm.y());
+      aCopy->SetValue (aNodeIter * 3,     aNorm.z());
+    }
+    return aCopy;
+  }
 
   Handle(TShort_HArray1OfShortReal) anHArray = new TShort_HArray1OfShortReal();
   TShort_Array1OfShortReal anArray (*myNormals.First().GetData(), 1, 3 * NbNodes());
@@ -328,6 +353,10 @@ void Poly_Triangulation::ResizeNodes (Standard_Integer theNbNodes,
   {
     myNormals.Resize (0, theNbNodes - 1, theToCopyOld);
   }
+  if (!myOctNormals.IsEmpty())
+  {
+    myOctNormals.Resize (0, theNbNodes - 1, theToCopyOld);
+  }
 }
 
 // =======================================================================
@@ -358,12 +387,92 @@ void Poly_Triangulation::AddUVNodes()
 // =======================================================================
 void Poly_Triangulation::AddNormals()
 {
-  if (myNormals.IsEmpty() || myNormals.Size() != myNodes.Size())
+  if (myIsOctNormals)
+  {
+    if (myOctNormals.IsEmpty() || myOctNormals.Size() != myNodes.Size())
+    {
+      myOctNormals.Resize (0, myNodes.Size() - 1, false);
+    }
+  }
+  else if (myNormals.IsEmpty() || myNormals.Size() != myNodes.Size())
   {
     myNormals.Resize (0, myNodes.Size() - 1, false);
   }
 }
 
+// =======================================================================
+// function : SetOctEncodedNormals
+// purpose  :
+// =======================================================================
+void Poly_Triangulation::SetOctEncodedNormals (bool theToEncode)
+{
+  if (myIsOctNormals == theToEncode)
+  {
+    return;
+  }
+
+  if (theToEncode)
+  {
+    if (!myNormals.IsEmpty())
+    {
+      NCollection_Array1<OctNormal> anOctNormals (0, myNormals.Size() - 1);
+      for (Standard_Integer aNodeIter = 0; aNodeIter < myNormals.Size(); ++aNodeIter)
+      {
+        anOctNormals.SetValue (aNodeIter, EncodeOctNormal (myNormals.Value (aNodeIter)));
+      }
+      myOctNormals.Move (anOctNormals);
+      NCollection_Array1<gp_Vec3f> anEmpty;
+      myNormals.Move (anEmpty);
+    }
+  }
+  else if (!myOctNormals.IsEmpty())
+  {
+    NCollection_Array1<gp_Vec3f> aNormals (0, myOctNormals.Size() - 1);
+    for (Standard_Integer aNodeIter = 0; aNodeIter < myOctNormals.Size(); ++aNodeIter)
+    {
+      aNormals.SetValue (aNodeIter, DecodeOctNormal (myOctNormals.Value (aNodeIter)));
+    }
+    myNormals.Move (aNormals);
+    NCollection_Array1<OctNormal> anEmpty;
+    myOctNormals.Move (anEmpty);
+  }
+  myIsOctNormals = theToEncode;
+}
+
+// =======================================================================
+// function : Compact
+// purpose  :
+// =======================================================================
+void Poly_Triangulation::Compact()
+{
+  if (myNodes.IsDoublePrecision())
+  {
+    Poly_ArrayOfNodes aNodes;
+    aNodes.SetDoublePrecision (false);
+    if (!myNodes.IsEmpty())
+    {
+      aNodes.Resize (myNodes.Size(), false);
+      aNodes.Assign (myNodes);
+    }
+    myNodes.Move (aNodes);
+    if (HasCachedMinMax())
+    {
+      UpdateCachedMinMax();
+    }
+  }
+
+  if (!myUVNodes.IsEmpty())
+  {
+    myUVNodes.Quantize();
+  }
+  else if (myUVNodes.IsDoublePrecision())
+  {
+    myUVNodes.SetDoublePrecision (false);
+  }
+
+  SetOctEncodedNormals (true);
+}
+
 // =======================================================================
 // function : DumpJson
 // purpose  :
@@ -380,6 +489,8 @@ void Poly_Triangulation::DumpJson (Standard_OStream& theOStream, Standard_Intege
     OCCT_DUMP_FIELD_VALUE_NUMERICAL (theOStream, myUVNodes.Size())
   if (!myNormals.IsEmpty())
     OCCT_DUMP_FIELD_VALUE_NUMERICAL (theOStream, myNormals.Size())
+  if (!myOctNormals.IsEmpty())
+    OCCT_DUMP_FIELD_VALUE_NUMERICAL (theOStream, myOctNormals.Size())
   OCCT_DUMP_FIELD_VALUE_NUMERICAL (theOStream, myTriangles.Size())
   OCCT_DUMP_FIELD_VALUE_NUMERICAL (theOStream, myPurpose)
 
@@ -458,20 +569,17 @@ Standard_Boolean Poly_Triangulation::MinMax (Bnd_Box& theBox, const gp_Trsf& the
 // =======================================================================
 Bnd_Box Poly_Triangulation::computeBoundingBox (const gp_Trsf& theTrsf) const
 {
+  // the nodes are transformed and bounded in batches fitting into cache
+  const Standard_Integer aBatchSize = 4096;
+  gp_XYZBatch aBatch;
   Bnd_Box aBox;
-  if (theTrsf.Form() == gp_Identity)
+  for (Standard_Integer aFirstNode = 0; aFirstNode < NbNodes(); aFirstNode += aBatchSize)
   {
-    for (Standard_Integer aNodeIdx = 0; aNodeIdx < NbNodes(); aNodeIdx++)
-    {
-      aBox.Add (myNodes.Value (aNodeIdx));
-    }
-  }
-  else
-  {
-    for (Standard_Integer aNodeIdx = 0; aNodeIdx < NbNodes(); aNodeIdx++)
-    {
-      aBox.Add (myNodes.Value (aNodeIdx).Transformed (theTrsf));
-    }
+    myNodes.CopyToBatch (aBatch, aFirstNode, Min (aBatchSize, NbNodes() - aFirstNode));
+    aBatch.Transform (theTrsf);
+    gp_XYZ aMin, aMax;
+    aBatch.BoundingBox (aMin, aMax);
+    aBox.Update (aMin.X(), aMin.Y(), aMin.Z(), aMax.X(), aMax.Y(), aMax.Z());
   }
   return aBox;
 }
@@ -482,9 +590,15 @@ Bnd_Box Poly_Triangulation::computeBoundingBox (const gp_Trsf& theTrsf) const
 //=======================================================================
 void Poly_Triangulation::ComputeNormals()
 {
-  // zero values
+  // zero values; oct-encoded normals are accumulated into temporary array
   AddNormals();
-  myNormals.Init (gp_Vec3f (0.0f));
+  NCollection_Array1<gp_Vec3f> anAccNormals;
+  NCollection_Array1<gp_Vec3f>& aNormals = myIsOctNormals ? anAccNormals : myNormals;
+  if (myIsOctNormals)
+  {
+    anAccNormals.Resize (0, myNodes.Size() - 1, false);
+  }
+  aNormals.Init (gp_Vec3f (0.0f));
 
   Standard_Integer anElem[3] = {0, 0, 0};
   for (Poly_Array1OfTriangle::Iterator aTriIter (myTriangles); aTriIter.More(); aTriIter.Next())
@@ -500,17 +614,24 @@ void Poly_Triangulation::ComputeNormals()
     const gp_Vec3f aNorm3f = gp_Vec3f (float(aTriNorm.X()), float(aTriNorm.Y()), float(aTriNorm.Z()));
     for (Standard_Integer aNodeIter = 0; aNodeIter < 3; ++aNodeIter)
     {
-      myNormals.ChangeValue (anElem[aNodeIter] - 1) += aNorm3f;
+      aNormals.ChangeValue (anElem[aNodeIter] - 1) += aNorm3f;
     }
   }
 
   // Normalize all vectors
-  for (NCollection_Array1<gp_Vec3f>::Iterator aNodeIter (myNormals); aNodeIter.More(); aNodeIter.Next())
+  for (NCollection_Array1<gp_Vec3f>::Iterator aNodeIter (aNormals); aNodeIter.More(); aNodeIter.Next())
   {
     gp_Vec3f& aNorm3f = aNodeIter.ChangeValue();
     const float aMod = aNorm3f.Modulus();
     aNorm3f = aMod == 0.0f ? gp_Vec3f (0.0f, 0.0f, 1.0f) : (aNorm3f / aMod);
   }
+  if (myIsOctNormals)
+  {
+    for (Standard_Integer aNodeIter = 0; aNodeIter < aNormals.Size(); ++aNodeIter)
+    {
+      myOctNormals.SetValue (aNodeIter, EncodeOctNormal (aNormals.Value (aNodeIter)));
+    }
+  }
 }
 
 //=======================================================================
@@ -46,6 +46,7 @@ DEFINE_STANDARD_HANDLE(Poly_Triangulation, Standard_Transient)
 //! - An optional table of 2D nodes (2D points), parallel to the table of 3D nodes.
 //!   2D point are the (u, v) parameters of the corresponding 3D point on the surface approximated by the triangulation.
 //! - An optional table of 3D vectors, parallel to the table of 3D nodes, defining normals to the surface at specified 3D point.
+//!   Normals are stored as single precision vectors or oct-encoded into two 16-bit integers (see SetOctEncodedNormals()).
 //! - An optional deflection, which maximizes the distance from a point on the surface to the corresponding point on its approximate triangulation.
 //!
 //! In many cases, algorithms do not need to work with the exact representation of a surface.
@@ -123,7 +124,7 @@ public:
   Standard_Boolean HasUVNodes() const { return !myUVNodes.IsEmpty(); }
 
   //! Returns Standard_True if nodal normals are defined.
-  Standard_Boolean HasNormals() const { return !myNormals.IsEmpty(); }
+  Standard_Boolean HasNormals() const { return !myNormals.IsEmpty() || !myOctNormals.IsEmpty(); }
 
   //! Returns a node at the given index.
   //! @param[in] theIndex node index within [1, NbNodes()] range
@@ -172,7 +173,8 @@ public:
   //! @return normalized 3D vector defining a surface normal
   gp_Dir Normal (Standard_Integer theIndex) const
   {
-    const gp_Vec3f& aNorm = myNormals.Value (theIndex - 1);
+    gp_Vec3f aNorm;
+    Normal (theIndex, aNorm);
     return gp_Dir (aNorm.x(), aNorm.y(), aNorm.z());
   }
 
@@ -182,7 +184,9 @@ public:
   void Normal (Standard_Integer theIndex,
                gp_Vec3f& theVec3) const
   {
-    theVec3 = myNormals.Value (theIndex - 1);
+    theVec3 = myIsOctNormals
+            ? DecodeOctNormal (myOctNormals.Value (theIndex - 1))
+            : myNormals.Value (theIndex - 1);
   }
 
   //! Changes normal at the given index.
@@ -191,7 +195,14 @@ public:
   void SetNormal (const Standard_Integer theIndex,
                   const gp_Vec3f& theNormal)
   {
-    myNormals.SetValue (theIndex - 1, theNormal);
+    if (myIsOctNormals)
+    {
+      myOctNormals.SetValue (theIndex - 1, EncodeOctNormal (theNormal));
+    }
+    else
+    {
+      myNormals.SetValue (theIndex - 1, theNormal);
+    }
   }
 
   //! Changes normal at the given index.
@@ -283,6 +294,62 @@ public:
   //! Compute smooth normals by averaging triangle normals.
   Standard_EXPORT void ComputeNormals();
 
+public: //! @name compact storage for visualization meshes
+
+  //! Normal oct-encoded into two signed normalized 16-bit integers.
+  typedef NCollection_Vec2<int16_t> OctNormal;
+
+  //! Encodes the normalized vector by projecting it onto octahedron unfolded into a square;
+  //! the angular error of decoded normal does not exceed 0.005 degrees.
+  static OctNormal EncodeOctNormal (const gp_Vec3f& theNormal)
+  {
+    const float aSum = std::abs (theNormal.x()) + std::abs (theNormal.y()) + std::abs (theNormal.z());
+    if (aSum <= 0.0f)
+    {
+      return OctNormal (0, 0);
+    }
+
+    float aU = theNormal.x() / aSum, aV = theNormal.y() / aSum;
+    if (theNormal.z() < 0.0f)
+    {
+      const float aU0 = aU;
+      aU = (1.0f - std::abs (aV))  * (aU0 >= 0.0f ? 1.0f : -1.0f);
+      aV = (1.0f - std::abs (aU0)) * (aV  >= 0.0f ? 1.0f : -1.0f);
+    }
+    return OctNormal (int16_t(std::floor (aU * 32767.0f + 0.5f)),
+                      int16_t(std::floor (aV * 32767.0f + 0.5f)));
+  }
+
+  //! Decodes the normal encoded by EncodeOctNormal().
+  static gp_Vec3f DecodeOctNormal (const OctNormal& theNormal)
+  {
+    gp_Vec3f aVec (float(theNormal.x()) / 32767.0f, float(theNormal.y()) / 32767.0f, 0.0f);
+    aVec.z() = 1.0f - std::abs (aVec.x()) - std::abs (aVec.y());
+    if (aVec.z() < 0.0f)
+    {
+      const float aX0 = aVec.x();
+      aVec.x() = (1.0f - std::abs (aVec.y())) * (aX0      >= 0.0f ? 1.0f : -1.0f);
+      aVec.y() = (1.0f - std::abs (aX0))      * (aVec.y() >= 0.0f ? 1.0f : -1.0f);
+    }
+    return aVec.Normalized();
+  }
+
+  //! Returns TRUE if normals are stored oct-encoded into two 16-bit integers; FALSE by default.
+  bool IsOctEncodedNormals() const { return myIsOctNormals; }
+
+  //! Sets if normals should be stored oct-encoded into two 16-bit integers (4 bytes per normal instead of 12);
+  //! existing normals are converted.
+  Standard_EXPORT void SetOctEncodedNormals (bool theToEncode);
+
+  //! Returns TRUE if UV nodes are quantized into 16-bit integers; see Poly_ArrayOfUVNodes::Quantize().
+  bool IsQuantizedUVNodes() const { return myUVNodes.IsQuantized(); }
+
+  //! Converts the triangulation into compact storage suitable for visualization:
+  //! single precision 3D nodes, UV nodes quantized into 16-bit integers within their range
+  //! and oct-encoded normals (including normals added later).
+  //! Accessors Node(), UVNode() and Normal() return decoded values.
+  Standard_EXPORT void Compact();
+
 public:
 
   //! Returns the table of 3D points for read-only access or NULL if nodes array is undefined.
@@ -319,7 +386,7 @@ public:
   //! UBNode()/SetUVNode() should be used instead in portable code.
   Poly_ArrayOfUVNodes& InternalUVNodes() { return myUVNodes; }
 
-  //! Return an internal array of normals.
+  //! Return an internal array of normals, which is empty for oct-encoded normals.
   //! Normal()/SetNormal() should be used instead in portable code.
   NCollection_Array1<gp_Vec3f>& InternalNormals() { return myNormals; }
 
@@ -390,13 +457,15 @@ protected:
 
 protected:
 
-  Bnd_Box*                     myCachedMinMax;
-  Standard_Real                myDeflection;
-  Poly_ArrayOfNodes            myNodes;
-  Poly_Array1OfTriangle        myTriangles;
-  Poly_ArrayOfUVNodes          myUVNodes;
-  NCollection_Array1<gp_Vec3f> myNormals;
-  Poly_MeshPurpose             myPurpose;
+  Bnd_Box*                      myCachedMinMax;
+  Standard_Real                 myDeflection;
+  Poly_ArrayOfNodes             myNodes;
+  Poly_Array1OfTriangle         myTriangles;
+  Poly_ArrayOfUVNodes           myUVNodes;
+  NCollection_Array1<gp_Vec3f>  myNormals;
+  NCollection_Array1<OctNormal> myOctNormals;
+  Standard_Boolean              myIsOctNormals;
+  Poly_MeshPurpose              myPurpose;
 
   Handle(Poly_TriangulationParameters) myParams;
 };
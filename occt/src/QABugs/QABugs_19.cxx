@@ -36,7 +36,10 @@
 #include <Message_PrinterOStream.hxx>
 #include <NCollection_Handle.hxx>
 #include <NCollection_Map.hxx>
+#include <OSD.hxx>
 #include <OSD_Parallel.hxx>
+#include <OSD_TaskScheduler.hxx>
+#include <OSD_Thread.hxx>
 #include <OSD_PerfMeter.hxx>
 #include <OSD_Timer.hxx>
 #include <Precision.hxx>
@@ -2823,6 +2826,280 @@ static Standard_Integer OCC29935(Draw_Interpretor& ,
   return 0;
 }
 
+//! Counts the pairs of indices of the nested parallel loops divisible by 7.
+class ParallelTest_NestedSum
+{
+public:
+  ParallelTest_NestedSum (OSD_TaskScheduler& theScheduler, volatile int* theSum, int theNbInner)
+  : myScheduler (theScheduler), mySum (theSum), myNbInner (theNbInner), myOuter (-1) {}
+
+  void operator() (int theIndex) const
+  {
+    if (myOuter < 0)
+    {
+      // outer loop - spawn the inner one
+      ParallelTest_NestedSum anInner (myScheduler, mySum, myNbInner);
+      anInner.myOuter = theIndex;
+      myScheduler.For (0, myNbInner, anInner);
+      return;
+    }
+    if ((myOuter + theIndex) % 7 == 0)
+    {
+      Standard_Atomic_Increment (mySum);
+    }
+  }
+private:
+  OSD_TaskScheduler& myScheduler;
+  volatile int*      mySum;
+  int                myNbInner;
+  int                myOuter;
+};
+
+//! Raises the exception for one index.
+class ParallelTest_Failure
+{
+public:
+  void operator() (int theIndex) const
+  {
+    if (theIndex == 777)
+    {
+      throw Standard_ProgramError ("Error: index 777");
+    }
+  }
+};
+
+//! Records the threads processing the items and the maximal number of items processed simultaneously;
+//! the leading items are expensive.
+class ParallelTest_Dispatch
+{
+public:
+  ParallelTest_Dispatch (NCollection_Array1<Standard_ThreadId>& theThreads, int theNbExpensive,
+                         volatile int* theNbRunning, volatile int* theMaxRunning)
+  : myThreads (theThreads), myNbExpensive (theNbExpensive), myNbRunning (theNbRunning), myMaxRunning (theMaxRunning) {}
+
+  void operator() (int theIndex) const
+  {
+    const int aNbRunning = Standard_Atomic_Increment (myNbRunning);
+    for (int aMax = *myMaxRunning; aNbRunning > aMax; aMax = *myMaxRunning)
+    {
+      if (Standard_Atomic_CompareAndSwap (myMaxRunning, aMax, aNbRunning))
+      {
+        break;
+      }
+    }
+    myThreads.ChangeValue (theIndex) = OSD_Thread::Current();
+    OSD::MilliSecSleep (theIndex < myNbExpensive ? 100 : 1);
+    Standard_Atomic_Decrement (myNbRunning);
+  }
+private:
+  NCollection_Array1<Standard_ThreadId>& myThreads;
+  int           myNbExpensive;
+  volatile int* myNbRunning;
+  volatile int* myMaxRunning;
+};
+
+//! Counts the calls for each index.
+class ParallelTest_Coverage
+{
+public:
+  ParallelTest_Coverage (NCollection_Array1<int>& theCounters) : myCounters (theCounters) {}
+
+  void operator() (int theIndex) const
+  {
+    Standard_Atomic_Increment (&myCounters.ChangeValue (theIndex));
+  }
+private:
+  NCollection_Array1<int>& myCounters;
+};
+
+//! Counts the items processed not in the expected floating point exceptions mode.
+class ParallelTest_FpeMode
+{
+public:
+  ParallelTest_FpeMode (bool theToCatchFpe, volatile int* theNbWrong) : myToCatchFpe (theToCatchFpe), myNbWrong (theNbWrong) {}
+
+  void operator() (int ) const
+  {
+    if (OSD::ToCatchFloatingSignals() != myToCatchFpe)
+    {
+      Standard_Atomic_Increment (myNbWrong);
+    }
+    OSD::MilliSecSleep (1);
+  }
+private:
+  bool          myToCatchFpe;
+  volatile int* myNbWrong;
+};
+
+//! Thread other than the worker running the loops without floating point exceptions;
+//! while waiting it helps to execute the tasks of other threads.
+struct ParallelTest_FpeThread
+{
+  OSD_TaskScheduler* Scheduler;
+  volatile int*      NbWrong;
+  volatile int*      IsDone;
+
+  static Standard_Address Run (Standard_Address theData)
+  {
+    ParallelTest_FpeThread* aData = static_cast<ParallelTest_FpeThread*> (theData);
+    OSD::SetThreadLocalSignal (OSD::SignalMode(), false);
+    for (int aLoopIter = 0; aLoopIter < 20; ++aLoopIter)
+    {
+      aData->Scheduler->For (0, 40, ParallelTest_FpeMode (false, aData->NbWrong));
+    }
+    *aData->IsDone = 1;
+    return NULL;
+  }
+};
+
+//! Computes Fibonacci number recursively spawning the futures.
+class ParallelTest_Fibonacci
+{
+public:
+  ParallelTest_Fibonacci (OSD_TaskScheduler& theScheduler, int theN) : myScheduler (theScheduler), myN (theN) {}
+
+  int operator()() const
+  {
+    if (myN < 2)
+    {
+      return myN;
+    }
+    OSD_TaskScheduler::Future<int> aFuture (myScheduler, ParallelTest_Fibonacci (myScheduler, myN - 1));
+    const int aRes = ParallelTest_Fibonacci (myScheduler, myN - 2)();
+    return aRes + aFuture.Get();
+  }
+private:
+  OSD_TaskScheduler& myScheduler;
+  int myN;
+};
+
+//=======================================================================
+//function : QATaskScheduler
+//purpose  :
+//=======================================================================
+static Standard_Integer QATaskScheduler (Draw_Interpretor& theDI,
+                                         Standard_Integer  theArgc,
+                                         const char**      theArgv)
+{
+  Standard_Integer aNbThreads = 4;
+  if (theArgc == 3
+   && TCollection_AsciiString (theArgv[1]) == "-nbThreads")
+  {
+    aNbThreads = Draw::Atoi (theArgv[2]);
+  }
+  else if (theArgc != 1)
+  {
+    theDI << "Syntax error: wrong number of arguments";
+    return 1;
+  }
+
+  Handle(OSD_TaskScheduler) aScheduler = new OSD_TaskScheduler (aNbThreads);
+
+  // nested loops
+  const int aNbOuter = 100, aNbInner = 1000;
+  volatile int aSum = 0;
+  aScheduler->For (0, aNbOuter, ParallelTest_NestedSum (*aScheduler, &aSum, aNbInner));
+  int aSumRef = 0;
+  for (int anOuter = 0; anOuter < aNbOuter; ++anOuter)
+  {
+    for (int anInner = 0; anInner < aNbInner; ++anInner)
+    {
+      aSumRef += (anOuter + anInner) % 7 == 0 ? 1 : 0;
+    }
+  }
+  if (aSum != aSumRef)
+  {
+    theDI << "Error: nested loops computed " << aSum << " instead of " << aSumRef << "\n";
+  }
+
+  // exceptions
+  bool isCaught = false;
+  try
+  {
+    aScheduler->For (0, 10000, ParallelTest_Failure());
+  }
+  catch (Standard_Failure const& )
+  {
+    isCaught = true;
+  }
+  if (!isCaught)
+  {
+    theDI << "Error: exception has not been rethrown\n";
+  }
+
+  // the leading items are started first, each by its own thread
+  const int aNbItems = 64;
+  NCollection_Array1<Standard_ThreadId> aThreads (0, aNbItems - 1);
+  volatile int aNbRunning = 0, aMaxRunning = 0;
+  aScheduler->For (0, aNbItems, ParallelTest_Dispatch (aThreads, aScheduler->NbThreads(), &aNbRunning, &aMaxRunning));
+  NCollection_Map<Standard_ThreadId> aLeadThreads;
+  for (int anItemIter = 0; anItemIter < Min (aScheduler->NbThreads(), aNbItems); ++anItemIter)
+  {
+    aLeadThreads.Add (aThreads.Value (anItemIter));
+  }
+  if (aLeadThreads.Extent() != Min (aScheduler->NbThreads(), aNbItems))
+  {
+    theDI << "Error: " << aScheduler->NbThreads() << " leading expensive items are processed by "
+          << aLeadThreads.Extent() << " threads\n";
+  }
+
+  // limited number of threads
+  const int aMaxConcurrency = 2;
+  aNbRunning = 0;
+  aMaxRunning = 0;
+  aScheduler->For (0, aNbItems, ParallelTest_Dispatch (aThreads, 0, &aNbRunning, &aMaxRunning), aMaxConcurrency);
+  if (aMaxRunning > aMaxConcurrency)
+  {
+    theDI << "Error: " << aMaxRunning << " threads process the loop limited to " << aMaxConcurrency << " threads\n";
+  }
+
+  // large range taken by the chunks decreasing to the end
+  NCollection_Array1<int> aCounters (0, 1000002);
+  aCounters.Init (0);
+  aScheduler->For (aCounters.Lower(), aCounters.Upper() + 1, ParallelTest_Coverage (aCounters));
+  for (int anItemIter = aCounters.Lower(); anItemIter <= aCounters.Upper(); ++anItemIter)
+  {
+    if (aCounters.Value (anItemIter) != 1)
+    {
+      theDI << "Error: item " << anItemIter << " of the large range is processed " << aCounters.Value (anItemIter) << " times\n";
+      break;
+    }
+  }
+
+  // the tasks executed by another waiting thread keep the mode of the thread which has spawned them
+  // (checked on the platforms supporting floating point exceptions)
+  const bool toCatchFpe = OSD::ToCatchFloatingSignals();
+  OSD::SetThreadLocalSignal (OSD::SignalMode(), true);
+  if (OSD::ToCatchFloatingSignals())
+  {
+    volatile int aNbWrong = 0, aNbWrongOther = 0, isDone = 0;
+    ParallelTest_FpeThread aThreadData = { aScheduler.get(), &aNbWrongOther, &isDone };
+    OSD_Thread aThread (ParallelTest_FpeThread::Run);
+    aThread.Run (&aThreadData);
+    while (!isDone)
+    {
+      aScheduler->For (0, 200, ParallelTest_FpeMode (true, &aNbWrong));
+    }
+    aThread.Wait();
+    if (aNbWrong != 0
+     || aNbWrongOther != 0)
+    {
+      theDI << "Error: " << aNbWrong << " and " << aNbWrongOther << " items are processed in wrong floating point exceptions mode\n";
+    }
+  }
+  OSD::SetThreadLocalSignal (OSD::SignalMode(), toCatchFpe);
+
+  // futures
+  const int aFib = ParallelTest_Fibonacci (*aScheduler, 20)();
+  if (aFib != 6765)
+  {
+    theDI << "Error: futures computed " << aFib << " instead of 6765\n";
+  }
+
+  theDI << "Threads: " << aScheduler->NbThreads() << "\n";
+  return 0;
+}
+
 /*****************************************************************************/
 
 #include <GeomAPI_IntSS.hxx>
@@ -5369,6 +5646,7 @@ void QABugs::Commands_19(Draw_Interpretor& theCommands) {
   theCommands.Add ("OCC25043", "OCC25043 shape", __FILE__, OCC25043, group);
   theCommands.Add ("OCC24826,", "This test performs simple saxpy test using multiple threads.\n Usage: OCC24826 length", __FILE__, OCC24826, group);
   theCommands.Add ("OCC29935,", "This test performs product of two square matrices using multiple threads.\n Usage: OCC29935 size", __FILE__, OCC29935, group);
+  theCommands.Add ("QATaskScheduler", "Checks nested loops, dispatch order, concurrency limit, exceptions, floating point exceptions mode and futures of OSD_TaskScheduler.\n Usage: QATaskScheduler [-nbThreads N]", __FILE__, QATaskScheduler, group);
   theCommands.Add ("OCC24606", "OCC24606 : Tests ::FitAll for V3d view ('vfit' is for NIS view)", __FILE__, OCC24606, group);
   theCommands.Add ("OCC25202", "OCC25202 res shape numF1 face1 numF2 face2", __FILE__, OCC25202, group);
   theCommands.Add ("OCC7570", "OCC7570 shape", __FILE__, OCC7570, group);
@@ -4361,6 +4361,139 @@ static Standard_Integer QACheckBends(Draw_Interpretor& theDI,
 
 
 
+#include <gp_XYZBatch.hxx>
+#include <math_BullardGenerator.hxx>
+
+//! Returns TRUE if the values computed by batch and scalar operations are equal up to rounding.
+static Standard_Boolean isSameValue (const Standard_Real theBatch, const Standard_Real theScalar)
+{
+  return Abs (theBatch - theScalar) <= 1.e-14 * (1.0 + Abs (theScalar));
+}
+
+//! Returns TRUE if the element of batch is equal to the point up to rounding.
+static Standard_Boolean isSameXYZ (const gp_XYZBatch& theBatch, const Standard_Integer theIndex, const gp_XYZ& theXYZ)
+{
+  return isSameValue (theBatch.X()[theIndex], theXYZ.X())
+      && isSameValue (theBatch.Y()[theIndex], theXYZ.Y())
+      && isSameValue (theBatch.Z()[theIndex], theXYZ.Z());
+}
+
+//=======================================================================
+//function : QAXYZBatch
+//purpose  : Compares batch operations of gp_XYZBatch with operations on single points
+//=======================================================================
+static Standard_Integer QAXYZBatch (Draw_Interpretor& theDI,
+                                    Standard_Integer  theNArg,
+                                    const char**      theArgVal)
+{
+  if (theNArg > 2)
+  {
+    theDI << "Syntax error: wrong number of arguments";
+    return 1;
+  }
+
+  const Standard_Integer aNbPoints = theNArg == 2 ? Draw::Atoi (theArgVal[1]) : 1001;
+  if (aNbPoints < 1)
+  {
+    theDI << "Syntax error: wrong number of points";
+    return 1;
+  }
+
+  math_BullardGenerator aRandom;
+  TColgp_Array1OfPnt aPoints (1, aNbPoints);
+  for (TColgp_Array1OfPnt::Iterator aPntIter (aPoints); aPntIter.More(); aPntIter.Next())
+  {
+    aPntIter.ChangeValue().SetCoord (aRandom.NextReal() * 10.0 - 5.0, aRandom.NextReal() * 10.0 - 5.0, aRandom.NextReal() * 10.0 - 5.0);
+  }
+  aPoints.ChangeValue (aNbPoints).SetCoord (0.0, 0.0, 0.0);
+
+  gp_Trsf aTrsf, aScale;
+  aTrsf.SetRotation (gp_Ax1 (gp_Pnt (1.0, 2.0, 3.0), gp_Dir (1.0, 1.0, 0.3)), 0.7);
+  aScale.SetScale (gp_Pnt (3.0, 1.0, 2.0), 1.7);
+  aTrsf.Multiply (aScale);
+
+  // transformation and bounding box
+  gp_XYZBatch aBatch (aPoints);
+  aBatch.Transform (aTrsf);
+  Bnd_Box aBox;
+  for (Standard_Integer aPntIter = 0; aPntIter < aNbPoints; ++aPntIter)
+  {
+    const gp_Pnt aPnt = aPoints.Value (aPntIter + 1).Transformed (aTrsf);
+    aBox.Add (aPnt);
+    if (!isSameXYZ (aBatch, aPntIter, aPnt.XYZ()))
+    {
+      theDI << "Error: wrong transformation of point " << aPntIter << "\n";
+      break;
+    }
+  }
+  gp_XYZ aMin, aMax;
+  aBatch.BoundingBox (aMin, aMax);
+  if (!aBox.CornerMin().XYZ().IsEqual (aMin, Precision::Confusion())
+   || !aBox.CornerMax().XYZ().IsEqual (aMax, Precision::Confusion()))
+  {
+    theDI << "Error: wrong bounding box\n";
+  }
+
+  // distances
+  const gp_Pnt aTarget (0.3, 0.1, -0.2);
+  NCollection_Array1<Standard_Real> aDistances (0, aNbPoints - 1);
+  aBatch.Assign (aPoints);
+  aBatch.Distances (aTarget.XYZ(), &aDistances.ChangeFirst());
+  Standard_Integer aNearest = -1;
+  Standard_Real aMinSqDist = RealLast();
+  for (Standard_Integer aPntIter = 0; aPntIter < aNbPoints; ++aPntIter)
+  {
+    const gp_Pnt& aPnt = aPoints.Value (aPntIter + 1);
+    if (!isSameValue (aDistances.Value (aPntIter), aPnt.Distance (aTarget)))
+    {
+      theDI << "Error: wrong distance to point " << aPntIter << "\n";
+      break;
+    }
+    if (aPnt.SquareDistance (aTarget) < aMinSqDist)
+    {
+      aMinSqDist = aPnt.SquareDistance (aTarget);
+      aNearest = aPntIter;
+    }
+  }
+  Standard_Integer aBatchNearest = -1;
+  const Standard_Real aBatchMinSqDist = aBatch.MinSquareDistance (aTarget.XYZ(), aBatchNearest);
+  if (aBatchNearest != aNearest
+  || !isSameValue (aBatchMinSqDist, aMinSqDist))
+  {
+    theDI << "Error: wrong nearest point " << aBatchNearest << " instead of " << aNearest << "\n";
+  }
+
+  // cross products and normalization
+  gp_XYZBatch aCross (aNbPoints);
+  for (Standard_Integer aPntIter = 0; aPntIter < aNbPoints; ++aPntIter)
+  {
+    aCross.SetValue (aPntIter, gp_XYZ (aRandom.NextReal(), aRandom.NextReal(), aRandom.NextReal()));
+  }
+  gp_XYZBatch aNormals;
+  aNormals.Cross (aBatch, aCross);
+  const Standard_Integer aNbNull = aNormals.Normalize();
+  for (Standard_Integer aPntIter = 0; aPntIter < aNbPoints; ++aPntIter)
+  {
+    gp_XYZ aNormal = aPoints.Value (aPntIter + 1).XYZ().Crossed (aCross.Value (aPntIter));
+    if (aNormal.Modulus() > gp::Resolution())
+    {
+      aNormal.Normalize();
+    }
+    if (!isSameXYZ (aNormals, aPntIter, aNormal))
+    {
+      theDI << "Error: wrong normalized cross product " << aPntIter << "\n";
+      break;
+    }
+  }
+  if (aNbNull != 1)
+  {
+    theDI << "Error: wrong number of null vectors " << aNbNull << "\n";
+  }
+
+  theDI << "Points: " << aNbPoints << "\n";
+  return 0;
+}
+
 void QABugs::Commands_20(Draw_Interpretor& theCommands) {
   const char *group = "QABugs";
 
@@ -4467,5 +4600,9 @@ void QABugs::Commands_20(Draw_Interpretor& theCommands) {
     __FILE__,
     QACheckBends, group);
 
+  theCommands.Add ("QAXYZBatch",
+                   "QAXYZBatch [nbPoints=1001] : compares batch operations of gp_XYZBatch with operations on single points",
+                   __FILE__, QAXYZBatch, group);
+
   return;
 }
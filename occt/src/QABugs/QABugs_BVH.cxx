@@ -21,6 +21,7 @@
 
 #include <BRepBndLib.hxx>
 
+#include <BVH_BinnedBuilder.hxx>
 #include <BVH_Box.hxx>
 #include <BVH_DistanceField.hxx>
 #include <BVH_Geometry.hxx>
@@ -33,6 +34,8 @@
 #include <DBRep.hxx>
 #include <Draw.hxx>
 
+#include <math_BullardGenerator.hxx>
+
 #include <Precision.hxx>
 
 #include <TopExp.hxx>
@@ -45,6 +48,8 @@
 
 #include <TopTools_IndexedMapOfShape.hxx>
 
+#include <TColStd_PackedMapOfInteger.hxx>
+
 //=======================================================================
 //function : ShapeSelector
 //purpose : Implement the simplest shape's selector
@@ -603,12 +608,30 @@ static Standard_Integer QABVH_PairDistance (Draw_Interpretor& theDI,
                                             Standard_Integer theArgc,
                                             const char** theArgv)
 {
-  if (theArgc != 3)
+  if (theArgc < 3)
   {
     theDI.PrintHelp (theArgv[0]);
     return 1;
   }
 
+  Standard_Boolean isBinned = Standard_False, isParallel = Standard_False;
+  for (Standard_Integer anArgIter = 3; anArgIter < theArgc; ++anArgIter)
+  {
+    if (!strcmp (theArgv[anArgIter], "-binned"))
+    {
+      isBinned = Standard_True;
+    }
+    else if (!strcmp (theArgv[anArgIter], "-parallel"))
+    {
+      isParallel = Standard_True;
+    }
+    else
+    {
+      theDI << "Syntax error at '" << theArgv[anArgIter] << "'\n";
+      return 1;
+    }
+  }
+
   TopoDS_Shape aShape[2];
   // Get the first shape
   aShape[0] = DBRep::Get (theArgv [1]);
@@ -627,8 +650,12 @@ static Standard_Integer QABVH_PairDistance (Draw_Interpretor& theDI,
   }
 
   // Define BVH Builder
-  opencascade::handle <BVH_LinearBuilder <Standard_Real, 3> > aLBuilder =
-      new BVH_LinearBuilder <Standard_Real, 3>();
+  opencascade::handle <BVH_Builder <Standard_Real, 3> > aLBuilder;
+  if (isBinned)
+    aLBuilder = new BVH_BinnedBuilder <Standard_Real, 3> ();
+  else
+    aLBuilder = new BVH_LinearBuilder <Standard_Real, 3>();
+  aLBuilder->SetParallel (isParallel);
 
   // Create the ShapeSet
   opencascade::handle <BVH_BoxSet <Standard_Real, 3, Triangle> > aTriangleBoxSet[2];
@@ -814,6 +841,221 @@ static Standard_Integer QABVH_DistanceField (Draw_Interpretor& theDI,
   return 0;
 }
 
+//=======================================================================
+//function : BoxSelector
+//purpose : Selects the indices of the boxes interfering with the given box
+//=======================================================================
+class BoxSelector :
+  public BVH_Traverse <Standard_Real, 3, BVH_BoxSet <Standard_Real, 3, Standard_Integer>, Standard_Boolean>
+{
+public:
+  //! Constructor
+  BoxSelector (const BVH_Box <Standard_Real, 3>& theBox) : myBox (theBox) {}
+
+  //! Returns the selected elements
+  const TColStd_PackedMapOfInteger& Elements () const { return myElements; }
+
+public:
+
+  //! Defines the rules for node rejection by bounding box
+  virtual Standard_Boolean RejectNode (const BVH_Vec3d& theCornerMin,
+                                       const BVH_Vec3d& theCornerMax,
+                                       Standard_Boolean& theIsInside) const Standard_OVERRIDE
+  {
+    Standard_Boolean hasOverlap;
+    theIsInside = myBox.Contains (theCornerMin, theCornerMax, hasOverlap);
+    return !hasOverlap;
+  }
+
+  //! Defines the rules for leaf acceptance
+  virtual Standard_Boolean AcceptMetric (const Standard_Boolean& theIsInside) const Standard_OVERRIDE
+  {
+    return theIsInside;
+  }
+
+  //! Defines the rules for leaf acceptance
+  virtual Standard_Boolean Accept (const Standard_Integer theIndex,
+                                   const Standard_Boolean& theIsInside) Standard_OVERRIDE
+  {
+    if (theIsInside || !myBox.IsOut (myBVHSet->Box (theIndex)))
+    {
+      myElements.Add (myBVHSet->Element (theIndex));
+      return Standard_True;
+    }
+    return Standard_False;
+  }
+
+protected:
+
+  BVH_Box <Standard_Real, 3> myBox;        //!< Selection box
+  TColStd_PackedMapOfInteger myElements;   //!< Selected elements
+};
+
+//=======================================================================
+//function : QABVH_Refit
+//purpose : Checks the refitting of BVH after the boxes have been moved
+//=======================================================================
+static Standard_Integer QABVH_Refit (Draw_Interpretor& theDI,
+                                     Standard_Integer theArgc,
+                                     const char** theArgv)
+{
+  Standard_Integer aNbBoxes = 10000;
+  Standard_Boolean isBinned = Standard_False, isParallel = Standard_False;
+  for (Standard_Integer anArgIter = 1; anArgIter < theArgc; ++anArgIter)
+  {
+    if (!strcmp (theArgv[anArgIter], "-binned"))
+    {
+      isBinned = Standard_True;
+    }
+    else if (!strcmp (theArgv[anArgIter], "-parallel"))
+    {
+      isParallel = Standard_True;
+    }
+    else if (anArgIter == 1 && Draw::Atoi (theArgv[anArgIter]) > 0)
+    {
+      aNbBoxes = Draw::Atoi (theArgv[anArgIter]);
+    }
+    else
+    {
+      theDI << "Syntax error at '" << theArgv[anArgIter] << "'\n";
+      return 1;
+    }
+  }
+
+  // Define BVH Builder
+  opencascade::handle <BVH_Builder <Standard_Real, 3> > aBuilder;
+  if (isBinned)
+    aBuilder = new BVH_BinnedBuilder <Standard_Real, 3> ();
+  else
+    aBuilder = new BVH_LinearBuilder <Standard_Real, 3>();
+  aBuilder->SetParallel (isParallel);
+
+  // Random boxes in the unit cube and their displacements
+  math_BullardGenerator aRandom;
+  NCollection_Array1<BVH_Box <Standard_Real, 3> > aBoxes (0, aNbBoxes - 1), aMovedBoxes (0, aNbBoxes - 1);
+  opencascade::handle <BVH_BoxSet <Standard_Real, 3, Standard_Integer> > aBoxSet =
+    new BVH_BoxSet <Standard_Real, 3, Standard_Integer> (aBuilder);
+  for (Standard_Integer i = 0; i < aNbBoxes; ++i)
+  {
+    const BVH_Vec3d aMin (aRandom.NextReal(), aRandom.NextReal(), aRandom.NextReal());
+    const BVH_Vec3d aSize (0.01 * aRandom.NextReal(), 0.01 * aRandom.NextReal(), 0.01 * aRandom.NextReal());
+    const BVH_Vec3d aMove (0.2 * aRandom.NextReal() - 0.1, 0.2 * aRandom.NextReal() - 0.1, 0.2 * aRandom.NextReal() - 0.1);
+    aBoxes (i) = BVH_Box <Standard_Real, 3> (aMin, aMin + aSize);
+    aMovedBoxes (i) = BVH_Box <Standard_Real, 3> (aMin + aMove, aMin + aSize + aMove);
+    aBoxSet->Add (i, aBoxes (i));
+  }
+  aBoxSet->Build();
+
+  // Keep the topology of the built tree
+  const opencascade::handle <BVH_Tree <Standard_Real, 3> > aBVH = aBoxSet->BVH();
+  const Standard_Integer aNbNodes = aBVH->Length();
+  NCollection_Array1<BVH_Vec4i> aNodeInfos (0, aNbNodes - 1);
+  for (Standard_Integer aNode = 0; aNode < aNbNodes; ++aNode)
+  {
+    aNodeInfos (aNode) = aBVH->NodeInfoBuffer()[aNode];
+  }
+
+  // Move the boxes (the elements have been reordered by the construction) and refit the tree
+  for (Standard_Integer i = 0; i < aNbBoxes; ++i)
+  {
+    aBoxSet->SetBox (i, aMovedBoxes (aBoxSet->Element (i)));
+  }
+  aBoxSet->Refit();
+
+  // The tree should be updated in place, without the rebuilding
+  Standard_Boolean isSameTopology = aBoxSet->BVH() == aBVH && aBVH->Length() == aNbNodes;
+  for (Standard_Integer aNode = 0; isSameTopology && aNode < aNbNodes; ++aNode)
+  {
+    const BVH_Vec4i& anInfo = aBVH->NodeInfoBuffer()[aNode];
+    isSameTopology = anInfo.x() == aNodeInfos (aNode).x()
+                  && anInfo.y() == aNodeInfos (aNode).y()
+                  && anInfo.z() == aNodeInfos (aNode).z();
+  }
+  if (!isSameTopology)
+  {
+    theDI << "Error: the topology of BVH is changed by refitting\n";
+  }
+
+  // The box of each node should be the union of the boxes of its children or primitives
+  Standard_Integer aNbBadNodes = 0;
+  for (Standard_Integer aNode = 0; aNode < aBVH->Length(); ++aNode)
+  {
+    BVH_Box <Standard_Real, 3> aBox;
+    if (aBVH->IsOuter (aNode))
+    {
+      for (Standard_Integer anIdx = aBVH->BegPrimitive (aNode); anIdx <= aBVH->EndPrimitive (aNode); ++anIdx)
+      {
+        aBox.Combine (aBoxSet->Box (anIdx));
+      }
+    }
+    else
+    {
+      aBox.Combine (BVH_Box <Standard_Real, 3> (aBVH->MinPoint (aBVH->Child<0> (aNode)), aBVH->MaxPoint (aBVH->Child<0> (aNode))));
+      aBox.Combine (BVH_Box <Standard_Real, 3> (aBVH->MinPoint (aBVH->Child<1> (aNode)), aBVH->MaxPoint (aBVH->Child<1> (aNode))));
+    }
+
+    if ((aBox.CornerMin() - aBVH->MinPoint (aNode)).Modulus() > 0.
+     || (aBox.CornerMax() - aBVH->MaxPoint (aNode)).Modulus() > 0.)
+    {
+      ++aNbBadNodes;
+    }
+  }
+  if (aNbBadNodes > 0)
+  {
+    theDI << "Error: wrong bounds of " << aNbBadNodes << " nodes after refitting\n";
+  }
+
+  // The tree built anew on the moved boxes
+  opencascade::handle <BVH_BoxSet <Standard_Real, 3, Standard_Integer> > aNewBoxSet =
+    new BVH_BoxSet <Standard_Real, 3, Standard_Integer> (aBuilder);
+  for (Standard_Integer i = 0; i < aNbBoxes; ++i)
+  {
+    aNewBoxSet->Add (i, aMovedBoxes (i));
+  }
+  aNewBoxSet->Build();
+
+  // Selection by the refitted tree, by the new tree and by the brute force should be the same
+  const Standard_Integer aNbQueries = 100;
+  Standard_Integer aNbSelected = 0, aNbBadQueries = 0;
+  for (Standard_Integer aQuery = 0; aQuery < aNbQueries; ++aQuery)
+  {
+    const BVH_Vec3d aMin (1.2 * aRandom.NextReal() - 0.1, 1.2 * aRandom.NextReal() - 0.1, 1.2 * aRandom.NextReal() - 0.1);
+    const BVH_Box <Standard_Real, 3> aSelBox (aMin, aMin + BVH_Vec3d (0.1, 0.1, 0.1));
+
+    BoxSelector aSelector (aSelBox);
+    aSelector.SetBVHSet (aBoxSet.get());
+    aSelector.Select();
+
+    BoxSelector aNewSelector (aSelBox);
+    aNewSelector.SetBVHSet (aNewBoxSet.get());
+    aNewSelector.Select();
+
+    TColStd_PackedMapOfInteger anExpected;
+    for (Standard_Integer i = 0; i < aNbBoxes; ++i)
+    {
+      if (!aSelBox.IsOut (aMovedBoxes (i)))
+      {
+        anExpected.Add (i);
+      }
+    }
+
+    if (!aSelector.Elements().IsEqual (anExpected)
+     || !aNewSelector.Elements().IsEqual (anExpected))
+    {
+      ++aNbBadQueries;
+    }
+    aNbSelected += anExpected.Extent();
+  }
+  if (aNbBadQueries > 0)
+  {
+    theDI << "Error: wrong selection by " << aNbBadQueries << " queries after refitting\n";
+  }
+
+  theDI << "Nodes: " << aBVH->Length() << "\n";
+  theDI << "Selected: " << aNbSelected << "\n";
+  return 0;
+}
+
 //=======================================================================
 //function : Commands_BVH
 //purpose : BVH commands
@@ -836,10 +1078,19 @@ void QABugs::Commands_BVH (Draw_Interpretor& theCommands)
 
   theCommands.Add ("QABVH_PairDistance",
                    "Computes the distance between the meshes of the given shapes.\n"
-                   "Usage: QABVH_PairDistance shape1 shape2\n"
-                   "\tThe given shapes should contain triangulation\n",
+                   "Usage: QABVH_PairDistance shape1 shape2 [-binned] [-parallel]\n"
+                   "\tThe given shapes should contain triangulation\n"
+                   "\t-binned   : build BVH by binned SAH builder instead of linear one\n"
+                   "\t-parallel : build BVH in parallel\n",
                    __FILE__, QABVH_PairDistance, group);
 
+  theCommands.Add ("QABVH_Refit",
+                   "Checks the bounds of the nodes of BVH and the selection of boxes after the boxes have been moved and BVH refitted.\n"
+                   "Usage: QABVH_Refit [nbBoxes] [-binned] [-parallel]\n"
+                   "\t-binned   : use binned builder instead of linear one\n"
+                   "\t-parallel : build BVH in parallel\n",
+                   __FILE__, QABVH_Refit, group);
+
   theCommands.Add ("QABVH_DistanceField",
                    "Computes the distance field for a shape with triangulation\n"
                    "Usage: QABVH_DistanceField shape [nbSplit]\n",
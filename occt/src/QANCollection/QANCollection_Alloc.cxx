@@ -16,9 +16,15 @@
 #include <QANCollection.hxx>
 #include <Draw_Interpretor.hxx>
 
+#include <Draw.hxx>
 #include <NCollection_StdAllocator.hxx>
 #include <NCollection_IncAllocator.hxx>
+#include <OSD_Parallel.hxx>
+#include <OSD_Timer.hxx>
 #include <Standard_Assert.hxx>
+#include <Standard_MMgrOpt.hxx>
+#include <Standard_MMgrRaw.hxx>
+#include <Standard_MMgrThreadCache.hxx>
 
 #include <list>
 #include <vector>
@@ -120,11 +126,171 @@ static Standard_Integer QANColStdAllocator2(Draw_Interpretor& di, Standard_Integ
   return 0;
 }
 
+namespace
+{
+  //! Returns the size of the small block for the given index of allocation
+  //! (sizes of handled objects, shapes and nodes of collections are from 16 to 128 bytes).
+  static Standard_Size blockSize (const Standard_Integer theIndex)
+  {
+    return 8 + 8 * ((Standard_Size (theIndex) * 7919) % 16);
+  }
+
+  //! Allocates or frees the blocks of the slice of the array of pointers by the given memory manager.
+  //! The first word of each block is filled by its index and checked before deallocation.
+  struct QAMMgrFunctor
+  {
+    QAMMgrFunctor (Standard_MMgrRoot* theMMgr, std::vector<Standard_Address>& theBlocks,
+                   const Standard_Integer theNbSlices, const Standard_Boolean theToFree)
+    : myMMgr (theMMgr), myBlocks (&theBlocks), myNbSlices (theNbSlices), myToFree (theToFree), myNbErrors (0) {}
+
+    void operator() (const Standard_Integer theSlice) const
+    {
+      // the slices are freed in the reversed order to free the blocks in the threads other than allocating ones
+      const Standard_Integer aSlice = myToFree ? myNbSlices - 1 - theSlice : theSlice;
+      const Standard_Integer aSize  = Standard_Integer (myBlocks->size()) / myNbSlices;
+      for (Standard_Integer anIndex = aSlice * aSize; anIndex < (aSlice + 1) * aSize; ++anIndex)
+      {
+        Standard_Address& aBlock = (*myBlocks)[anIndex];
+        if (myToFree)
+        {
+          if (*(Standard_Integer*)aBlock != anIndex)
+          {
+            Standard_Atomic_Increment (&myNbErrors);
+          }
+          myMMgr->Free (aBlock);
+          aBlock = NULL;
+        }
+        else
+        {
+          aBlock = myMMgr->Allocate (blockSize (anIndex));
+          *(Standard_Integer*)aBlock = anIndex;
+        }
+      }
+    }
+
+    Standard_MMgrRoot*             myMMgr;
+    std::vector<Standard_Address>* myBlocks;
+    Standard_Integer               myNbSlices;
+    Standard_Boolean               myToFree;
+    mutable volatile Standard_Integer myNbErrors;
+  };
+
+  //! Runs the allocation benchmarks for the given memory manager,
+  //! prints the timings in milliseconds and returns the number of detected errors.
+  static Standard_Integer runMMgrPerf (Draw_Interpretor&      theDI,
+                                       Standard_MMgrRoot*     theMMgr,
+                                       const Standard_Integer theNbIters)
+  {
+    Standard_Integer aNbErrors = 0;
+    OSD_Timer aTimer;
+
+    // pairs of allocation and deallocation
+    aTimer.Start();
+    for (Standard_Integer anIter = 0; anIter < theNbIters; ++anIter)
+    {
+      Standard_Address aBlock = theMMgr->Allocate (blockSize (anIter));
+      *(Standard_Integer*)aBlock = anIter;
+      theMMgr->Free (aBlock);
+    }
+    aTimer.Stop();
+    theDI << " " << aTimer.ElapsedTime() * 1000.0;
+
+    // allocation of all blocks followed by deallocation in the other order
+    std::vector<Standard_Address> aBlocks (theNbIters);
+    aTimer.Reset();
+    aTimer.Start();
+    for (Standard_Integer anIter = 0; anIter < theNbIters; ++anIter)
+    {
+      aBlocks[anIter] = theMMgr->Allocate (blockSize (anIter));
+      *(Standard_Integer*)aBlocks[anIter] = anIter;
+    }
+    for (Standard_Integer anIter = 0; anIter < theNbIters; ++anIter)
+    {
+      const Standard_Integer anIndex = Standard_Integer ((Standard_Size (anIter) * 7919) % theNbIters);
+      if (aBlocks[anIndex] != NULL)
+      {
+        aNbErrors += (*(Standard_Integer*)aBlocks[anIndex] != anIndex ? 1 : 0);
+        theMMgr->Free (aBlocks[anIndex]);
+        aBlocks[anIndex] = NULL;
+      }
+    }
+    for (Standard_Integer anIter = 0; anIter < theNbIters; ++anIter)
+    {
+      theMMgr->Free (aBlocks[anIter]);
+      aBlocks[anIter] = NULL;
+    }
+    aTimer.Stop();
+    theDI << " " << aTimer.ElapsedTime() * 1000.0;
+
+    // parallel allocation and parallel deallocation of the blocks allocated in other threads
+    const Standard_Integer aNbSlices = 64;
+    aBlocks.resize (theNbIters - theNbIters % aNbSlices);
+    aTimer.Reset();
+    aTimer.Start();
+    QAMMgrFunctor anAllocator (theMMgr, aBlocks, aNbSlices, Standard_False);
+    OSD_Parallel::For (0, aNbSlices, anAllocator);
+    QAMMgrFunctor aDeallocator (theMMgr, aBlocks, aNbSlices, Standard_True);
+    OSD_Parallel::For (0, aNbSlices, aDeallocator);
+    aTimer.Stop();
+    theDI << " " << aTimer.ElapsedTime() * 1000.0 << "\n";
+    return aNbErrors + aDeallocator.myNbErrors;
+  }
+}
+
+//=======================================================================
+//function : QAMMgrPerf
+//purpose  : Compares the performance of the memory managers on small blocks
+//=======================================================================
+static Standard_Integer QAMMgrPerf (Draw_Interpretor& theDI,
+                                    Standard_Integer  theArgNb,
+                                    const char**      theArgVec)
+{
+  if (theArgNb > 2)
+  {
+    theDI << "Syntax error: wrong number of arguments\n";
+    return 1;
+  }
+  const Standard_Integer aNbIters = (theArgNb > 1) ? Draw::Atoi (theArgVec[1]) : 1000000;
+  if (aNbIters < 64)
+  {
+    theDI << "Syntax error: number of iterations should be not less than 64\n";
+    return 1;
+  }
+
+  Standard_Integer aNbErrors = 0;
+  theDI << "Time of " << aNbIters << " allocations of small blocks, ms (pairs, all-then-free, parallel cross-thread):\n";
+  {
+    Standard_MMgrRaw aMMgr (Standard_False);
+    theDI << "Standard_MMgrRaw:        ";
+    aNbErrors += runMMgrPerf (theDI, &aMMgr, aNbIters);
+  }
+  {
+    Standard_MMgrOpt aMMgr (Standard_False, Standard_False);
+    theDI << "Standard_MMgrOpt:        ";
+    aNbErrors += runMMgrPerf (theDI, &aMMgr, aNbIters);
+  }
+  {
+    Standard_MMgrThreadCache aMMgr (Standard_False);
+    theDI << "Standard_MMgrThreadCache:";
+    aNbErrors += runMMgrPerf (theDI, &aMMgr, aNbIters);
+  }
+  if (aNbErrors != 0)
+  {
+    theDI << "Error: " << aNbErrors << " blocks have been corrupted\n";
+  }
+  return 0;
+}
+
 void QANCollection::CommandsAlloc(Draw_Interpretor& theCommands) {
   const char *group = "QANCollection";
 
   theCommands.Add("QANColStdAllocator1", "QANColStdAllocator1", __FILE__, QANColStdAllocator1, group);
   theCommands.Add("QANColStdAllocator2", "QANColStdAllocator2", __FILE__, QANColStdAllocator2, group);
+  theCommands.Add("QAMMgrPerf",
+                  "QAMMgrPerf [nbIters=1000000]"
+                  "\n\t\t: Measures the time of allocation and deallocation of small blocks"
+                  "\n\t\t: by the memory managers Raw, Opt and ThreadCache.",
+                  __FILE__, QAMMgrPerf, group);
 
   return;
 }
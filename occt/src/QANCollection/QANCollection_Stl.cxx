@@ -19,6 +19,7 @@
 #endif
 
 #include <QANCollection.hxx>
+#include <Draw.hxx>
 #include <Draw_Interpretor.hxx>
 
 #include <NCollection_List.hxx>
@@ -28,7 +29,15 @@
 #include <NCollection_DataMap.hxx>
 #include <NCollection_IndexedMap.hxx>
 #include <NCollection_IndexedDataMap.hxx>
+#include <NCollection_FlatMap.hxx>
+#include <NCollection_FlatDataMap.hxx>
+#include <NCollection_FlatIndexedDataMap.hxx>
+#include <BRep_Builder.hxx>
+#include <TopoDS_Vertex.hxx>
+#include <TopTools_FlatMapOfShape.hxx>
+#include <TopTools_MapOfShape.hxx>
 #include <OSD_Timer.hxx>
+#include <Precision.hxx>
 #include <OSD_Parallel.hxx>
 
 #include <algorithm>
@@ -1197,6 +1206,185 @@ static Standard_Integer QANTestNCollectionPerformance (Draw_Interpretor& di, Sta
   return 0;
 }
 
+//! Adds the key into the set (or binds it to default item in the map) being measured.
+template<class K, class H> void flatMapTestAdd (NCollection_Map<K, H>& theMap, const K& theKey) { theMap.Add (theKey); }
+template<class K, class H> void flatMapTestAdd (NCollection_FlatMap<K, H>& theMap, const K& theKey) { theMap.Add (theKey); }
+template<class K, class I, class H> void flatMapTestAdd (NCollection_DataMap<K, I, H>& theMap, const K& theKey) { theMap.Bind (theKey, I()); }
+template<class K, class I, class H> void flatMapTestAdd (NCollection_FlatDataMap<K, I, H>& theMap, const K& theKey) { theMap.Bind (theKey, I()); }
+template<class K, class I, class H> void flatMapTestAdd (NCollection_IndexedDataMap<K, I, H>& theMap, const K& theKey) { theMap.Add (theKey, I()); }
+template<class K, class I, class H> void flatMapTestAdd (NCollection_FlatIndexedDataMap<K, I, H>& theMap, const K& theKey) { theMap.Add (theKey, I()); }
+
+//! Checks presence of the key in the set or map being measured.
+template<class K, class H> bool flatMapTestFind (const NCollection_Map<K, H>& theMap, const K& theKey) { return theMap.Contains (theKey); }
+template<class K, class H> bool flatMapTestFind (const NCollection_FlatMap<K, H>& theMap, const K& theKey) { return theMap.Contains (theKey); }
+template<class K, class I, class H> bool flatMapTestFind (const NCollection_DataMap<K, I, H>& theMap, const K& theKey) { return theMap.IsBound (theKey); }
+template<class K, class I, class H> bool flatMapTestFind (const NCollection_FlatDataMap<K, I, H>& theMap, const K& theKey) { return theMap.IsBound (theKey); }
+template<class K, class I, class H> bool flatMapTestFind (const NCollection_IndexedDataMap<K, I, H>& theMap, const K& theKey) { return theMap.Contains (theKey); }
+template<class K, class I, class H> bool flatMapTestFind (const NCollection_FlatIndexedDataMap<K, I, H>& theMap, const K& theKey) { return theMap.Contains (theKey); }
+
+//=======================================================================
+//function : MeasureMapPerformance
+//purpose  : Measures times of insertion of the keys, lookup of the keys
+//           in another order and iteration over the map
+//=======================================================================
+template<class MapType, class KeyType, class Hasher>
+Standard_Boolean MeasureMapPerformance (const std::vector<KeyType>& theKeys,
+                                        const std::vector<KeyType>& theLookup,
+                                        const Standard_Integer      theSize,
+                                        Standard_Real               theTimes[3])
+{
+  OSD_Timer aTimer;
+  Standard_Boolean aResult = Standard_True;
+
+  MapType aMap;
+  aTimer.Start();
+  for (Standard_Integer anIdx = 0; anIdx < theSize; ++anIdx)
+  {
+    flatMapTestAdd (aMap, theKeys[anIdx]);
+  }
+  aTimer.Stop();
+  theTimes[0] = aTimer.ElapsedTime();
+
+  aTimer.Reset();
+  aTimer.Start();
+  for (size_t anIdx = 0; anIdx < theLookup.size(); ++anIdx)
+  {
+    if (!flatMapTestFind (aMap, theLookup[anIdx]))
+    {
+      aResult = Standard_False;
+    }
+  }
+  aTimer.Stop();
+  theTimes[1] = aTimer.ElapsedTime();
+
+  aTimer.Reset();
+  aTimer.Start();
+  Standard_Integer aNbKeys = 0;
+  unsigned int aCheckSum = 0;
+  for (typename MapType::Iterator anIter (aMap); anIter.More(); anIter.Next(), ++aNbKeys)
+  {
+    aCheckSum += (unsigned int )Hasher::HashCode (anIter.Key(), IntegerLast());
+  }
+  aTimer.Stop();
+  theTimes[2] = aTimer.ElapsedTime();
+
+  return aResult
+      && aNbKeys == aMap.Extent()
+      && aCheckSum != 0;
+}
+
+//=======================================================================
+//function : TestPerformanceFlatMap
+//purpose  : Compares performance of NCollection map and its flat alternative
+//           for growing number of keys (from 1000 up to number of given keys)
+//=======================================================================
+template<class MapType, class FlatMapType, class KeyType, class Hasher>
+void TestPerformanceFlatMap (Draw_Interpretor& di,
+                             const std::vector<KeyType>& theKeys)
+{
+  static const char* THE_OPERATIONS[3] = { "insert", "lookup", "iterate" };
+
+  std::mt19937 aGenerator (1);
+  NCollection_Vector<Standard_Integer> aSizes;
+  NCollection_Vector<Standard_Real>    aTimes[6];
+  for (Standard_Integer aSize = 1000; aSize <= (Standard_Integer )theKeys.size(); aSize *= 10)
+  {
+    // look up the keys in random order, so that the nodes of NCollection map
+    // are not accessed in the order of their allocation
+    std::vector<KeyType> aLookup (theKeys.begin(), theKeys.begin() + aSize);
+    std::shuffle (aLookup.begin(), aLookup.end(), aGenerator);
+
+    Standard_Real aMapTimes[3], aFlatTimes[3];
+    if (!MeasureMapPerformance<MapType,     KeyType, Hasher> (theKeys, aLookup, aSize, aMapTimes)
+     || !MeasureMapPerformance<FlatMapType, KeyType, Hasher> (theKeys, aLookup, aSize, aFlatTimes))
+    {
+      di << "Error: wrong content of map of size " << aSize << "\n";
+      return;
+    }
+
+    aSizes.Append (aSize);
+    for (Standard_Integer anOper = 0; anOper < 3; ++anOper)
+    {
+      aTimes[anOper * 2    ].Append (aMapTimes [anOper]);
+      aTimes[anOper * 2 + 1].Append (aFlatTimes[anOper]);
+    }
+  }
+
+  for (Standard_Integer anOper = 0; anOper < 3; ++anOper)
+  {
+    di << "\n" << THE_OPERATIONS[anOper] << ":\n\n";
+    for (Standard_Integer anIter = 0; anIter < aSizes.Length(); ++anIter)
+    {
+      const Standard_Real aMapTime  = aTimes[anOper * 2    ].Value (anIter);
+      const Standard_Real aFlatTime = aTimes[anOper * 2 + 1].Value (anIter);
+      di << aSizes.Value (anIter) << "\t" << aMapTime << "\t" << aFlatTime << "\t"
+         << (aMapTime > 1e-16 ? aFlatTime / aMapTime : -1) << "\n";
+    }
+  }
+}
+
+//=======================================================================
+//function : QANTestNCollectionFlatMaps
+//purpose  :
+//=======================================================================
+static Standard_Integer QANTestNCollectionFlatMaps (Draw_Interpretor& di, Standard_Integer theArgNb, const char** theArgVec)
+{
+  if (theArgNb > 2)
+  {
+    di << "Syntax error: wrong number of arguments\n";
+    return 1;
+  }
+
+  const Standard_Integer aMaxSize = theArgNb > 1 ? Draw::Atoi (theArgVec[1]) : 10000000;
+  if (aMaxSize < 1000)
+  {
+    di << "Syntax error: number of keys should be at least 1000\n";
+    return 1;
+  }
+
+  di << "Testing performance (Size | NCollection time | Flat time | Flat/NCollection ratio)\n";
+
+  std::mt19937 aGenerator (1);
+  {
+    std::vector<Standard_Integer> aKeys (aMaxSize);
+    for (Standard_Integer anIdx = 0; anIdx < aMaxSize; ++anIdx)
+    {
+      aKeys[anIdx] = (Standard_Integer )(aGenerator() & 0x7FFFFFFF);
+    }
+
+    di << "\nNCollection_Map vs NCollection_FlatMap (Standard_Integer):\n";
+    TestPerformanceFlatMap<NCollection_Map<Standard_Integer>, NCollection_FlatMap<Standard_Integer>,
+                           Standard_Integer, NCollection_DefaultHasher<Standard_Integer> > (di, aKeys);
+
+    di << "\nNCollection_DataMap vs NCollection_FlatDataMap (Standard_Integer, Standard_Real):\n";
+    TestPerformanceFlatMap<NCollection_DataMap<Standard_Integer, Standard_Real>, NCollection_FlatDataMap<Standard_Integer, Standard_Real>,
+                           Standard_Integer, NCollection_DefaultHasher<Standard_Integer> > (di, aKeys);
+
+    di << "\nNCollection_IndexedDataMap vs NCollection_FlatIndexedDataMap (Standard_Integer, Standard_Real):\n";
+    TestPerformanceFlatMap<NCollection_IndexedDataMap<Standard_Integer, Standard_Real>, NCollection_FlatIndexedDataMap<Standard_Integer, Standard_Real>,
+                           Standard_Integer, NCollection_DefaultHasher<Standard_Integer> > (di, aKeys);
+  }
+
+  // shapes are heavy, thus their number is limited
+  {
+    const Standard_Integer aNbShapes = Min (aMaxSize, 1000000);
+    std::vector<TopoDS_Shape> aKeys (aNbShapes);
+    BRep_Builder aBuilder;
+    for (Standard_Integer anIdx = 0; anIdx < aNbShapes; ++anIdx)
+    {
+      TopoDS_Vertex aVertex;
+      aBuilder.MakeVertex (aVertex, gp_Pnt (anIdx, 0.0, 0.0), Precision::Confusion());
+      aKeys[anIdx] = aVertex;
+    }
+    std::shuffle (aKeys.begin(), aKeys.end(), aGenerator);
+
+    di << "\nTopTools_MapOfShape vs TopTools_FlatMapOfShape:\n";
+    TestPerformanceFlatMap<TopTools_MapOfShape, TopTools_FlatMapOfShape, TopoDS_Shape, TopTools_ShapeMapHasher> (di, aKeys);
+  }
+
+  return 0;
+}
+
 //=======================================================================
 //function : QANTestNCollectionIndexedMap
 //purpose  :
@@ -1463,5 +1651,15 @@ void QANCollection::CommandsStl (Draw_Interpretor& theCommands)
                    QANTestNCollectionIndexedDataMap,
                    aGroup);
 
+  theCommands.Add ("QANTestNCollectionFlatMaps",
+                   "QANTestNCollectionFlatMaps [maxNbKeys=10000000]"
+                   "\n\t\t: Compares insertion, lookup and iteration times of NCollection maps"
+                   "\n\t\t: and their open-addressing alternatives (NCollection_FlatMap, NCollection_FlatDataMap,"
+                   "\n\t\t: NCollection_FlatIndexedDataMap)"
+                   "\n\t\t: for 1000, 10000, ... maxNbKeys keys.",
+                   __FILE__,
+                   QANTestNCollectionFlatMaps,
+                   aGroup);
+
   return;
 }
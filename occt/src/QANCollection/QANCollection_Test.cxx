@@ -27,6 +27,10 @@
 
 #include <NCollection_Vector.hxx>
 #include <NCollection_IncAllocator.hxx>
+#include <NCollection_FlatMap.hxx>
+#include <NCollection_FlatDataMap.hxx>
+#include <NCollection_FlatIndexedDataMap.hxx>
+#include <TCollection_AsciiString.hxx>
 
 #define ItemType gp_Pnt
 #define Key1Type Standard_Real
@@ -1233,6 +1237,207 @@ static Standard_Integer QANColTestVec4 (Draw_Interpretor& theDI, Standard_Intege
   return 0;
 }
 
+//=======================================================================
+//function : QANColTestFlatMap
+//purpose  : Compares NCollection_FlatMap, NCollection_FlatDataMap and NCollection_FlatIndexedDataMap
+//           with NCollection_Map, NCollection_DataMap and NCollection_IndexedDataMap on random operations
+//=======================================================================
+static Standard_Integer QANColTestFlatMap (Draw_Interpretor& theDI, Standard_Integer theNbArgs, const char** )
+{
+  if (theNbArgs != 1)
+  {
+    theDI << "Syntax error: wrong number of arguments\n";
+    return 1;
+  }
+
+  Standard_Integer aNbErrors = 0;
+  NCollection_Map<Standard_Integer>     aMap;
+  NCollection_FlatMap<Standard_Integer> aFlatMap;
+  NCollection_DataMap<TCollection_AsciiString, Standard_Integer>     aDataMap;
+  NCollection_FlatDataMap<TCollection_AsciiString, Standard_Integer> aFlatDataMap;
+  srand (1);
+  for (Standard_Integer anIter = 0; anIter < 200000; ++anIter)
+  {
+    const Standard_Integer aKey = rand() % 3000;
+    const TCollection_AsciiString aKeyStr (aKey);
+    switch (rand() % 4)
+    {
+      case 0:
+      case 1:
+      {
+        aNbErrors += aMap.Add (aKey) != aFlatMap.Add (aKey) ? 1 : 0;
+        aNbErrors += aDataMap.Bind (aKeyStr, anIter) != aFlatDataMap.Bind (aKeyStr, anIter) ? 1 : 0;
+        break;
+      }
+      case 2:
+      {
+        aNbErrors += aMap.Remove (aKey) != aFlatMap.Remove (aKey) ? 1 : 0;
+        aNbErrors += aDataMap.UnBind (aKeyStr) != aFlatDataMap.UnBind (aKeyStr) ? 1 : 0;
+        break;
+      }
+      default:
+      {
+        aNbErrors += aMap.Contains (aKey) != aFlatMap.Contains (aKey) ? 1 : 0;
+        const Standard_Integer* anItem    = aDataMap.Seek (aKeyStr);
+        const Standard_Integer* aFlatItem  = aFlatDataMap.Seek (aKeyStr);
+        aNbErrors += (anItem == NULL) != (aFlatItem == NULL)
+                  || (anItem != NULL && *anItem != *aFlatItem) ? 1 : 0;
+        break;
+      }
+    }
+    aNbErrors += aMap.Extent() != aFlatMap.Extent()
+              || aDataMap.Extent() != aFlatDataMap.Extent() ? 1 : 0;
+  }
+  if (aNbErrors != 0)
+  {
+    theDI << "Error: " << aNbErrors << " mismatches of flat maps with NCollection_Map and NCollection_DataMap\n";
+  }
+
+  Standard_Integer aNbKeys = 0;
+  for (NCollection_FlatMap<Standard_Integer>::Iterator aMapIter (aFlatMap); aMapIter.More(); aMapIter.Next(), ++aNbKeys)
+  {
+    if (!aMap.Contains (aMapIter.Key()))
+    {
+      theDI << "Error: NCollection_FlatMap::Iterator returns unexpected key " << aMapIter.Key() << "\n";
+    }
+  }
+  if (aNbKeys != aMap.Extent())
+  {
+    theDI << "Error: NCollection_FlatMap::Iterator visits " << aNbKeys << " keys instead of " << aMap.Extent() << "\n";
+  }
+
+  Standard_Integer aSum = 0, aFlatSum = 0;
+  for (NCollection_DataMap<TCollection_AsciiString, Standard_Integer>::Iterator aMapIter (aDataMap); aMapIter.More(); aMapIter.Next())
+  {
+    aSum += aMapIter.Value();
+  }
+  NCollection_FlatDataMap<TCollection_AsciiString, Standard_Integer> aFlatDataMapCopy (aFlatDataMap);
+  for (NCollection_FlatDataMap<TCollection_AsciiString, Standard_Integer>::iterator anItemIter = aFlatDataMapCopy.begin();
+       anItemIter != aFlatDataMapCopy.end(); ++anItemIter)
+  {
+    aFlatSum += *anItemIter;
+  }
+  if (aSum != aFlatSum)
+  {
+    theDI << "Error: NCollection_FlatDataMap content differs from NCollection_DataMap\n";
+  }
+
+  // boolean operations
+  NCollection_FlatMap<Standard_Integer> aLeft, aRight, aResult;
+  for (Standard_Integer aKey = 0; aKey < 100; ++aKey)
+  {
+    aLeft .Add (aKey);
+    aRight.Add (aKey + 50);
+  }
+  aResult.Union (aLeft, aRight);
+  const Standard_Integer aNbUnion = aResult.Extent();
+  aResult.Intersection (aLeft, aRight);
+  const Standard_Integer aNbCommon = aResult.Extent();
+  aResult.Subtraction (aLeft, aRight);
+  const Standard_Integer aNbCut = aResult.Extent();
+  aResult.Difference (aLeft, aRight);
+  const Standard_Integer aNbXor = aResult.Extent();
+  if (aNbUnion != 150 || aNbCommon != 50 || aNbCut != 50 || aNbXor != 100
+  || !aResult.Contains (0) || aResult.Contains (50))
+  {
+    theDI << "Error: boolean operations on NCollection_FlatMap give wrong results\n";
+  }
+
+  // binding of the item referring into the same map, including growth of the table
+  NCollection_FlatDataMap<Standard_Integer, TCollection_AsciiString> aSelfMap;
+  aSelfMap.Bind (0, "item");
+  for (Standard_Integer aKey = 1; aKey < 100; ++aKey)
+  {
+    if (aKey % 2 == 0)
+    {
+      aSelfMap.Bind (aKey, aSelfMap.Find (aKey - 1));
+    }
+    else
+    {
+      aSelfMap.Bound (aKey, aSelfMap.Find (0));
+    }
+  }
+  for (Standard_Integer aKey = 0; aKey < 100; ++aKey)
+  {
+    if (aSelfMap.Find (aKey) != "item")
+    {
+      theDI << "Error: NCollection_FlatDataMap::Bind() of the item of the same map stores '" << aSelfMap.Find (aKey) << "'\n";
+      break;
+    }
+  }
+
+  // indexed maps, including the items passed from the same map
+  NCollection_IndexedDataMap<TCollection_AsciiString, Standard_Integer>     anIndexedMap;
+  NCollection_FlatIndexedDataMap<TCollection_AsciiString, Standard_Integer> aFlatIndexedMap;
+  aNbErrors = 0;
+  for (Standard_Integer anIter = 0; anIter < 100000; ++anIter)
+  {
+    const TCollection_AsciiString aKeyStr (rand() % 3000);
+    const Standard_Integer anIndex = anIndexedMap.IsEmpty() ? 0 : 1 + rand() % anIndexedMap.Extent();
+    switch (rand() % 6)
+    {
+      case 0:
+      case 1:
+      {
+        aNbErrors += anIndexedMap.Add (aKeyStr, anIter) != aFlatIndexedMap.Add (aKeyStr, anIter) ? 1 : 0;
+        break;
+      }
+      case 2:
+      {
+        anIndexedMap   .RemoveKey (aKeyStr);
+        aFlatIndexedMap.RemoveKey (aKeyStr);
+        break;
+      }
+      case 3:
+      {
+        if (anIndex != 0 && !anIndexedMap.Contains (aKeyStr))
+        {
+          anIndexedMap   .Substitute (anIndex, aKeyStr, anIter);
+          aFlatIndexedMap.Substitute (anIndex, aKeyStr, anIter);
+        }
+        break;
+      }
+      case 4:
+      {
+        if (anIndex != 0)
+        {
+          const Standard_Integer anIndex2 = 1 + rand() % anIndexedMap.Extent();
+          anIndexedMap   .Swap (anIndex, anIndex2);
+          aFlatIndexedMap.Swap (anIndex, anIndex2);
+        }
+        break;
+      }
+      default:
+      {
+        if (anIndex != 0)
+        {
+          // the item of the same map, released by the growth of the array
+          const TCollection_AsciiString aNewKey = aKeyStr + "+";
+          aNbErrors += anIndexedMap.Add (aNewKey, anIndexedMap.FindFromIndex (anIndex))
+                    != aFlatIndexedMap.Add (aNewKey, aFlatIndexedMap.FindFromIndex (anIndex)) ? 1 : 0;
+        }
+        break;
+      }
+    }
+    aNbErrors += anIndexedMap.Extent() != aFlatIndexedMap.Extent()
+              || anIndexedMap.FindIndex (aKeyStr) != aFlatIndexedMap.FindIndex (aKeyStr) ? 1 : 0;
+  }
+  NCollection_FlatIndexedDataMap<TCollection_AsciiString, Standard_Integer> aFlatIndexedMapCopy (aFlatIndexedMap);
+  for (Standard_Integer anIndex = 1; anIndex <= anIndexedMap.Extent(); ++anIndex)
+  {
+    aNbErrors += anIndexedMap.FindKey (anIndex) != aFlatIndexedMapCopy.FindKey (anIndex)
+              || anIndexedMap.FindFromIndex (anIndex) != aFlatIndexedMapCopy.FindFromIndex (anIndex)
+              || aFlatIndexedMapCopy.FindIndex (anIndexedMap.FindKey (anIndex)) != anIndex ? 1 : 0;
+  }
+  if (aNbErrors != 0)
+  {
+    theDI << "Error: " << aNbErrors << " mismatches of NCollection_FlatIndexedDataMap with NCollection_IndexedDataMap\n";
+  }
+
+  theDI << "Extent: " << aFlatMap.Extent() << " " << aFlatDataMap.Extent() << " " << aFlatIndexedMap.Extent() << "\n";
+  return 0;
+}
+
 //! Print file path flags deduced from path string.
 static Standard_Integer QAOsdPathType (Draw_Interpretor& theDI, Standard_Integer theNbArgs, const char** theArgVec)
 {
@@ -1358,6 +1563,7 @@ void QANCollection::CommandsTest(Draw_Interpretor& theCommands) {
   theCommands.Add("QANColTestVector",         "QANColTestVector",         __FILE__, QANColTestVector,         group);  
   theCommands.Add("QANColTestArrayMove",      "QANColTestArrayMove (is expected to give error)", __FILE__, QANColTestArrayMove, group);  
   theCommands.Add("QANColTestVec4",           "QANColTestVec4 test Vec4 implementation", __FILE__, QANColTestVec4, group);
+  theCommands.Add("QANColTestFlatMap",        "QANColTestFlatMap : compare NCollection_FlatMap, NCollection_FlatDataMap and NCollection_FlatIndexedDataMap with NCollection_Map, NCollection_DataMap and NCollection_IndexedDataMap", __FILE__, QANColTestFlatMap, group);
   theCommands.Add("QATestAtof", "QATestAtof [nbvalues [nbdigits [min [max]]]]", __FILE__, QATestAtof, group);
   theCommands.Add("QAOsdPathType",  "QAOsdPathType path : Print file path flags deduced from path string", __FILE__, QAOsdPathType, group);
   theCommands.Add("QAOsdPathPart",  "QAOsdPathPart path [-folder][-fileName] : Print file path part", __FILE__, QAOsdPathPart, group);
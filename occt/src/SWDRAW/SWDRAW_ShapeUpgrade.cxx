@@ -1328,7 +1328,7 @@ static Standard_Integer unifysamedom(Draw_Interpretor& di, Standard_Integer n, c
 {
   if (n < 3)
   {
-    di << "Use unifysamedom result shape [s1 s2 ...] [-f] [-e] [-nosafe] [+b] [+i] [-t val] [-a val]\n";
+    di << "Use unifysamedom result shape [s1 s2 ...] [-f] [-e] [-nosafe] [+b] [+i] [-t val] [-a val] [-parallel]\n";
     di << "options:\n";
     di << "s1 s2 ... to keep the given edges during unification of faces\n";
     di << "-f to switch off 'unify-faces' mode \n";
@@ -1338,6 +1338,7 @@ static Standard_Integer unifysamedom(Draw_Interpretor& di, Standard_Integer n, c
     di << "+i to switch on 'allow internal edges' mode\n";
     di << "-t val to set linear tolerance\n";
     di << "-a val to set angular tolerance (in degrees)\n";
+    di << "-parallel to analyze the surfaces of the faces in parallel threads\n";
     di << "'unify-faces' and 'unify-edges' modes are switched on by default";
     return 1;
   }
@@ -1352,6 +1353,7 @@ static Standard_Integer unifysamedom(Draw_Interpretor& di, Standard_Integer n, c
   Standard_Boolean anConBS = Standard_False;
   Standard_Boolean isAllowInternal = Standard_False;
   Standard_Boolean isSafeInputMode = Standard_True;
+  Standard_Boolean isParallel = Standard_False;
   Standard_Real aLinTol = Precision::Confusion();
   Standard_Real aAngTol = Precision::Angular();
   TopoDS_Shape aKeepShape;
@@ -1375,6 +1377,8 @@ static Standard_Integer unifysamedom(Draw_Interpretor& di, Standard_Integer n, c
           anConBS = Standard_True;
         else if (!strcmp(a[i], "+i"))
           isAllowInternal = Standard_True;
+        else if (!strcmp(a[i], "-parallel"))
+          isParallel = Standard_True;
         else if (!strcmp(a[i], "-t") || !strcmp(a[i], "-a"))
         {
           if (++i < n)
@@ -1399,6 +1403,7 @@ static Standard_Integer unifysamedom(Draw_Interpretor& di, Standard_Integer n, c
   Unifier().AllowInternalEdges(isAllowInternal);
   Unifier().SetLinearTolerance(aLinTol);
   Unifier().SetAngularTolerance(aAngTol);
+  Unifier().SetRunParallel(isParallel);
   Unifier().Build();
   TopoDS_Shape Result = Unifier().Shape();
 
@@ -1669,7 +1674,7 @@ static Standard_Integer reshape(Draw_Interpretor& /*theDI*/,
   theCommands.Add ("removeloc","result shape [remove_level(see ShapeEnum)]",__FILE__,removeloc,g);
   
   theCommands.Add ("unifysamedom",
-                   "unifysamedom result shape [s1 s2 ...] [-f] [-e] [-nosafe] [+b] [+i] [-t val] [-a val]",
+                   "unifysamedom result shape [s1 s2 ...] [-f] [-e] [-nosafe] [+b] [+i] [-t val] [-a val] [-parallel]",
                     __FILE__,unifysamedom,g);
 
   theCommands.Add ("copytranslate","result shape dx dy dz",__FILE__,copytranslate,g);
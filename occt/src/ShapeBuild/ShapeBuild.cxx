@@ -24,7 +24,6 @@
 //=======================================================================
 Handle(Geom_Plane) ShapeBuild::PlaneXOY()
 {
-  static Handle(Geom_Plane) xoy;
-  if (xoy.IsNull()) xoy = new Geom_Plane (0,0,1,0);
+  static const Handle(Geom_Plane) xoy = new Geom_Plane (0,0,1,0);
   return xoy;
 }
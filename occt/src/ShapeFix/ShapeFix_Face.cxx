@@ -156,6 +156,31 @@ void ShapeFix_Face::ClearModes()
   myFixPeriodicDegenerated   = -1;
 }
 
+//=======================================================================
+//function : CopyModes
+//purpose  : 
+//=======================================================================
+
+void ShapeFix_Face::CopyModes (const ShapeFix_Face& theOther)
+{
+  myFixWireMode              = theOther.myFixWireMode;
+  myFixOrientationMode       = theOther.myFixOrientationMode;
+  myFixAddNaturalBoundMode   = theOther.myFixAddNaturalBoundMode;
+  myFixMissingSeamMode       = theOther.myFixMissingSeamMode;
+  myFixSmallAreaWireMode     = theOther.myFixSmallAreaWireMode;
+  myRemoveSmallAreaFaceMode  = theOther.myRemoveSmallAreaFaceMode;
+  myFixIntersectingWiresMode = theOther.myFixIntersectingWiresMode;
+  myFixLoopWiresMode         = theOther.myFixLoopWiresMode;
+  myFixSplitFaceMode         = theOther.myFixSplitFaceMode;
+  myAutoCorrectPrecisionMode = theOther.myAutoCorrectPrecisionMode;
+  myFixPeriodicDegenerated   = theOther.myFixPeriodicDegenerated;
+
+  SetPrecision    (theOther.Precision());
+  SetMinTolerance (theOther.MinTolerance());
+  SetMaxTolerance (theOther.MaxTolerance());
+  myFixWire->CopyModes (*theOther.myFixWire);
+}
+
 //=======================================================================
 //function : SetMsgRegistrator
 //purpose  : 
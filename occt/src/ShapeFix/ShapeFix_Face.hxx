@@ -64,6 +64,10 @@ public:
   //! Sets all modes to default
   Standard_EXPORT virtual void ClearModes();
   
+  //! Copies all modes, precision and tolerances from another tool,
+  //! including the modes of its wire fixing tool
+  Standard_EXPORT void CopyModes (const ShapeFix_Face& theOther);
+  
   //! Loads a whole face already created, with its wires, sense and
   //! location
   Standard_EXPORT void Init (const TopoDS_Face& face);
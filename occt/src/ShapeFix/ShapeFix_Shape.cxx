@@ -336,6 +336,26 @@ void ShapeFix_Shape::SetMaxTolerance (const Standard_Real maxtol)
   ShapeFix_Root::SetMaxTolerance ( maxtol );
   myFixSolid->SetMaxTolerance ( maxtol );
 }
+//=======================================================================
+//function : SetRunParallel
+//purpose  : 
+//=======================================================================
+
+void ShapeFix_Shape::SetRunParallel (const Standard_Boolean theIsParallel)
+{
+  FixShellTool()->SetRunParallel (theIsParallel);
+}
+
+//=======================================================================
+//function : RunParallel
+//purpose  : 
+//=======================================================================
+
+Standard_Boolean ShapeFix_Shape::RunParallel() const
+{
+  return FixShellTool()->RunParallel();
+}
+
 //=======================================================================
 //function : Status
 //purpose  : 
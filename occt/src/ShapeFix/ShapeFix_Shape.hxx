@@ -129,6 +129,12 @@ public:
   //! after performing all fixes
     Standard_Integer& FixVertexTolMode();
 
+  //! Sets the flag of parallel fixing of faces of shells (see ShapeFix_Shell::SetRunParallel).
+  Standard_EXPORT void SetRunParallel (const Standard_Boolean theIsParallel);
+
+  //! Returns the flag of parallel fixing of faces of shells.
+  Standard_EXPORT Standard_Boolean RunParallel() const;
+
 
 
 
@@ -23,10 +23,15 @@
 #include <BRepBndLib.hxx>
 #include <Message_Msg.hxx>
 #include <Message_ProgressScope.hxx>
+#include <NCollection_Array1.hxx>
+#include <NCollection_Vector.hxx>
+#include <OSD_Parallel.hxx>
 #include <ShapeAnalysis_Shell.hxx>
 #include <ShapeBuild_ReShape.hxx>
+#include <ShapeExtend_BasicMsgRegistrator.hxx>
 #include <ShapeFix_Face.hxx>
 #include <ShapeFix_Shell.hxx>
+#include <Standard_Mutex.hxx>
 #include <Standard_Type.hxx>
 #include <TColStd_DataMapOfIntegerListOfInteger.hxx>
 #include <TColStd_MapOfInteger.hxx>
@@ -50,6 +55,192 @@
 
 IMPLEMENT_STANDARD_RTTIEXT(ShapeFix_Shell,ShapeFix_Root)
 
+namespace
+{
+  //! Recording context redirecting all requests to the shared context under lock.
+  //! Used for concurrent fixing of faces which do not share sub-shapes.
+  class ShapeFix_SharedReShape : public ShapeBuild_ReShape
+  {
+  public:
+    ShapeFix_SharedReShape (const Handle(ShapeBuild_ReShape)& theContext,
+                            Standard_Mutex& theMutex)
+    : myContext (theContext),
+      myMutex (theMutex)
+    {
+      //
+    }
+
+    virtual void Clear() Standard_OVERRIDE
+    {
+      Standard_Mutex::Sentry aLock (myMutex);
+      myContext->Clear();
+    }
+
+    virtual void Remove (const TopoDS_Shape& theShape) Standard_OVERRIDE
+    {
+      Standard_Mutex::Sentry aLock (myMutex);
+      myContext->Remove (theShape);
+    }
+
+    virtual void Replace (const TopoDS_Shape& theShape,
+                          const TopoDS_Shape& theNewShape) Standard_OVERRIDE
+    {
+      Standard_Mutex::Sentry aLock (myMutex);
+      myContext->Replace (theShape, theNewShape);
+    }
+
+    virtual Standard_Boolean IsRecorded (const TopoDS_Shape& theShape) const Standard_OVERRIDE
+    {
+      Standard_Mutex::Sentry aLock (myMutex);
+      return myContext->IsRecorded (theShape);
+    }
+
+    virtual TopoDS_Shape Value (const TopoDS_Shape& theShape) const Standard_OVERRIDE
+    {
+      Standard_Mutex::Sentry aLock (myMutex);
+      return myContext->Value (theShape);
+    }
+
+    virtual Standard_Integer Status (const TopoDS_Shape& theShape,
+                                     TopoDS_Shape& theNewShape,
+                                     const Standard_Boolean theLast) Standard_OVERRIDE
+    {
+      Standard_Mutex::Sentry aLock (myMutex);
+      return myContext->Status (theShape, theNewShape, theLast);
+    }
+
+    virtual Standard_Boolean Status (const ShapeExtend_Status theStatus) const Standard_OVERRIDE
+    {
+      Standard_Mutex::Sentry aLock (myMutex);
+      return myContext->Status (theStatus);
+    }
+
+    virtual TopoDS_Shape Apply (const TopoDS_Shape& theShape,
+                                const TopAbs_ShapeEnum theUntil,
+                                const Standard_Integer theBuildMode) Standard_OVERRIDE
+    {
+      Standard_Mutex::Sentry aLock (myMutex);
+      return myContext->Apply (theShape, theUntil, theBuildMode);
+    }
+
+    virtual TopoDS_Shape Apply (const TopoDS_Shape& theShape,
+                                const TopAbs_ShapeEnum theUntil = TopAbs_SHAPE) Standard_OVERRIDE
+    {
+      Standard_Mutex::Sentry aLock (myMutex);
+      return myContext->Apply (theShape, theUntil);
+    }
+
+    virtual Standard_Boolean& ModeConsiderLocation() Standard_OVERRIDE
+    {
+      return myContext->ModeConsiderLocation();
+    }
+
+  private:
+    Handle(ShapeBuild_ReShape) myContext;
+    Standard_Mutex&            myMutex;
+  };
+
+  //! Message registrator redirecting messages to the shared one under lock.
+  class ShapeFix_SharedMsgRegistrator : public ShapeExtend_BasicMsgRegistrator
+  {
+  public:
+    ShapeFix_SharedMsgRegistrator (const Handle(ShapeExtend_BasicMsgRegistrator)& theMsgReg,
+                                   Standard_Mutex& theMutex)
+    : myMsgReg (theMsgReg),
+      myMutex (theMutex)
+    {
+      //
+    }
+
+    virtual void Send (const Handle(Standard_Transient)& theObject,
+                       const Message_Msg& theMessage,
+                       const Message_Gravity theGravity) Standard_OVERRIDE
+    {
+      Standard_Mutex::Sentry aLock (myMutex);
+      myMsgReg->Send (theObject, theMessage, theGravity);
+    }
+
+    virtual void Send (const TopoDS_Shape& theShape,
+                       const Message_Msg& theMessage,
+                       const Message_Gravity theGravity) Standard_OVERRIDE
+    {
+      Standard_Mutex::Sentry aLock (myMutex);
+      myMsgReg->Send (theShape, theMessage, theGravity);
+    }
+
+    virtual void Send (const Message_Msg& theMessage,
+                       const Message_Gravity theGravity) Standard_OVERRIDE
+    {
+      Standard_Mutex::Sentry aLock (myMutex);
+      myMsgReg->Send (theMessage, theGravity);
+    }
+
+  private:
+    Handle(ShapeExtend_BasicMsgRegistrator) myMsgReg;
+    Standard_Mutex&                         myMutex;
+  };
+
+  //! Functor fixing faces of one pass, each one by its own copy of the face fixing tool.
+  class ShapeFix_FaceFixer
+  {
+  public:
+    ShapeFix_FaceFixer (const NCollection_Vector<TopoDS_Face>& theFaces,
+                        const Handle(ShapeFix_Face)& theFixFace,
+                        const Handle(ShapeBuild_ReShape)& theContext,
+                        const Handle(ShapeExtend_BasicMsgRegistrator)& theMsgReg,
+                        NCollection_Array1<Message_ProgressRange>& theRanges,
+                        NCollection_Array1<Standard_Boolean>& theIsDone)
+    : myFaces (theFaces),
+      myFixFace (theFixFace),
+      myContext (theContext),
+      myMsgReg (theMsgReg),
+      myRanges (theRanges),
+      myIsDone (theIsDone)
+    {
+      //
+    }
+
+    void operator() (const Standard_Integer theIndex) const
+    {
+      Message_ProgressRange& aRange = myRanges.ChangeValue (theIndex);
+      if (aRange.UserBreak())
+      {
+        return;
+      }
+
+      Handle(ShapeFix_Face) aFixFace = new ShapeFix_Face;
+      aFixFace->CopyModes (*myFixFace);
+      aFixFace->SetMsgRegistrator (myMsgReg);
+      aFixFace->SetContext (myContext);
+      aFixFace->Init (myFaces (theIndex));
+      myIsDone.ChangeValue (theIndex) = aFixFace->Perform();
+      aRange.Close();
+    }
+
+  private:
+    const NCollection_Vector<TopoDS_Face>&     myFaces;
+    Handle(ShapeFix_Face)                      myFixFace;
+    Handle(ShapeBuild_ReShape)                 myContext;
+    Handle(ShapeExtend_BasicMsgRegistrator)    myMsgReg;
+    NCollection_Array1<Message_ProgressRange>& myRanges;
+    NCollection_Array1<Standard_Boolean>&      myIsDone;
+  };
+
+  //! Collects edges and vertices of the face as location-free keys identifying their TShapes.
+  void collectFaceSubShapes (const TopoDS_Shape& theFace,
+                             TopTools_ListOfShape& theSubShapes)
+  {
+    for (TopExp_Explorer anExp (theFace, TopAbs_EDGE); anExp.More(); anExp.Next())
+    {
+      theSubShapes.Append (anExp.Current().Located (TopLoc_Location()));
+    }
+    for (TopExp_Explorer anExp (theFace, TopAbs_VERTEX); anExp.More(); anExp.Next())
+    {
+      theSubShapes.Append (anExp.Current().Located (TopLoc_Location()));
+    }
+  }
+}
+
 //=======================================================================
 //function : ShapeFix_Shell
 //purpose  : 
@@ -62,6 +253,7 @@ ShapeFix_Shell::ShapeFix_Shell()
   myFixFace = new ShapeFix_Face;
   myNbShells =0;
   myNonManifold = Standard_False;
+  myRunParallel = Standard_False;
 }
 
 //=======================================================================
@@ -77,6 +269,7 @@ ShapeFix_Shell::ShapeFix_Shell(const TopoDS_Shell& shape)
   myFixFace = new ShapeFix_Face;
   Init(shape);
   myNonManifold = Standard_False;
+  myRunParallel = Standard_False;
 }
 
 //=======================================================================
@@ -113,17 +306,28 @@ Standard_Boolean ShapeFix_Shell::Perform(const Message_ProgressRange& theProgres
     // Start progress scope (no need to check if progress exists -- it is safe)
     Message_ProgressScope aPS(theProgress, "Fixing face", aNbFaces);
 
-    for( TopoDS_Iterator iter(S); iter.More() && aPS.More(); iter.Next(), aPS.Next() )
-    { 
-      TopoDS_Shape sh = iter.Value();
-      TopoDS_Face tmpFace = TopoDS::Face(sh);
-      myFixFace->Init(tmpFace);
-      if ( myFixFace->Perform() )
+    if (myRunParallel && aNbFaces > 1)
+    {
+      if (fixFacesParallel (S, aPS))
       {
         status = Standard_True;
         myStatus |= ShapeExtend::EncodeStatus ( ShapeExtend_DONE1 );
       }
     }
+    else
+    {
+      for( TopoDS_Iterator iter(S); iter.More() && aPS.More(); iter.Next(), aPS.Next() )
+      { 
+        TopoDS_Shape sh = iter.Value();
+        TopoDS_Face tmpFace = TopoDS::Face(sh);
+        myFixFace->Init(tmpFace);
+        if ( myFixFace->Perform() )
+        {
+          status = Standard_True;
+          myStatus |= ShapeExtend::EncodeStatus ( ShapeExtend_DONE1 );
+        }
+      }
+    }
 
     // Halt algorithm in case of user's abort
     if ( !aPS.More() )
@@ -159,6 +363,82 @@ Standard_Boolean ShapeFix_Shell::Perform(const Message_ProgressRange& theProgres
   return status;
 }
 
+//=======================================================================
+//function : fixFacesParallel
+//purpose  : 
+//=======================================================================
+
+Standard_Boolean ShapeFix_Shell::fixFacesParallel (const TopoDS_Shape& theShell,
+                                                   Message_ProgressScope& thePS)
+{
+  Standard_Boolean isDone = Standard_False;
+
+  NCollection_Vector<TopoDS_Face> aQueue;
+  for (TopoDS_Iterator anIter (theShell); anIter.More(); anIter.Next())
+  {
+    aQueue.Append (TopoDS::Face (anIter.Value()));
+  }
+
+  Standard_Mutex aMutex;
+  Handle(ShapeBuild_ReShape) aContext = new ShapeFix_SharedReShape (Context(), aMutex);
+  Handle(ShapeExtend_BasicMsgRegistrator) aMsgReg =
+    new ShapeFix_SharedMsgRegistrator (MsgRegistrator(), aMutex);
+
+  while (!aQueue.IsEmpty() && thePS.More())
+  {
+    // Select the faces sharing no edges and vertices with each other in their
+    // current state, the rest is postponed to the next pass, so that the shared
+    // sub-shapes are modified by one face at a time and the next faces see the
+    // modifications through the context.
+    NCollection_Vector<TopoDS_Face> aPass, aPostponed;
+    TopTools_MapOfShape aUsedSubShapes;
+    for (NCollection_Vector<TopoDS_Face>::Iterator aFaceIter (aQueue); aFaceIter.More(); aFaceIter.Next())
+    {
+      const TopoDS_Face& aFace = aFaceIter.Value();
+      TopTools_ListOfShape aSubShapes;
+      collectFaceSubShapes (Context()->Apply (aFace), aSubShapes);
+
+      Standard_Boolean isFree = Standard_True;
+      for (TopTools_ListOfShape::Iterator aSubIter (aSubShapes); aSubIter.More() && isFree; aSubIter.Next())
+      {
+        isFree = !aUsedSubShapes.Contains (aSubIter.Value());
+      }
+
+      if (!isFree)
+      {
+        aPostponed.Append (aFace);
+        continue;
+      }
+
+      for (TopTools_ListOfShape::Iterator aSubIter (aSubShapes); aSubIter.More(); aSubIter.Next())
+      {
+        aUsedSubShapes.Add (aSubIter.Value());
+      }
+      aPass.Append (aFace);
+    }
+
+    const Standard_Integer aNbFaces = aPass.Length();
+    NCollection_Array1<Message_ProgressRange> aRanges (0, aNbFaces - 1);
+    NCollection_Array1<Standard_Boolean> anIsDone (0, aNbFaces - 1);
+    for (Standard_Integer anIndex = 0; anIndex < aNbFaces; ++anIndex)
+    {
+      aRanges.ChangeValue (anIndex) = thePS.Next();
+      anIsDone.ChangeValue (anIndex) = Standard_False;
+    }
+
+    ShapeFix_FaceFixer aFixer (aPass, myFixFace, aContext, aMsgReg, aRanges, anIsDone);
+    OSD_Parallel::For (0, aNbFaces, aFixer, aNbFaces < 2);
+
+    for (Standard_Integer anIndex = 0; anIndex < aNbFaces; ++anIndex)
+    {
+      isDone = isDone || anIsDone (anIndex);
+    }
+
+    aQueue = aPostponed;
+  }
+  return isDone;
+}
+
 //=======================================================================
 // function : GetFreeEdges
 // purpose  : 
@@ -26,6 +26,7 @@
 #include <Message_ProgressRange.hxx>
 
 class ShapeFix_Face;
+class Message_ProgressScope;
 class ShapeExtend_BasicMsgRegistrator;
 
 // resolve name collisions with X11 headers
@@ -120,6 +121,14 @@ public:
   //! Sets NonManifold flag
   Standard_EXPORT virtual void SetNonManifoldFlag(const Standard_Boolean isNonManifold);
 
+  //! Sets the flag of parallel fixing of faces, False by default.
+  //! In parallel mode faces are fixed concurrently by copies of FixFaceTool
+  //! in several passes; the faces fixed in one pass share no edges and vertices.
+  void SetRunParallel (const Standard_Boolean theIsParallel) { myRunParallel = theIsParallel; }
+
+  //! Returns the flag of parallel fixing of faces.
+  Standard_Boolean RunParallel() const { return myRunParallel; }
+
 
   DEFINE_STANDARD_RTTIEXT(ShapeFix_Shell,ShapeFix_Root)
 
@@ -134,9 +143,14 @@ protected:
   Standard_Integer myFixOrientationMode;
   Standard_Integer myNbShells;
   Standard_Boolean myNonManifold;
+  Standard_Boolean myRunParallel;
 
 private:
 
+  //! Fixes faces of the shell concurrently, returns True if some face has been fixed.
+  Standard_Boolean fixFacesParallel (const TopoDS_Shape& theShell,
+                                     Message_ProgressScope& thePS);
+
 
 
 
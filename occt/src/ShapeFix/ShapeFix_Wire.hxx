@@ -101,6 +101,9 @@ public:
   //! Sets all modes to default
   Standard_EXPORT void ClearModes();
   
+  //! Copies all modes and tail parameters from another tool
+  Standard_EXPORT void CopyModes (const ShapeFix_Wire& theOther);
+  
   //! Clears all statuses
   Standard_EXPORT void ClearStatuses();
   
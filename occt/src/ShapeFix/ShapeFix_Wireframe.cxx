@@ -42,7 +42,7 @@
 #include <TopoDS_Iterator.hxx>
 #include <TopoDS_Shape.hxx>
 #include <TopoDS_Vertex.hxx>
-#include <TopTools_DataMapOfShapeInteger.hxx>
+#include <TopTools_FlatDataMapOfShapeInteger.hxx>
 #include <TopTools_DataMapOfShapeListOfShape.hxx>
 #include <TopTools_DataMapOfShapeShape.hxx>
 #include <TopTools_ListOfShape.hxx>
@@ -489,7 +489,7 @@ Standard_Boolean ShapeFix_Wireframe::CheckSmallEdges(TopTools_MapOfShape& theSma
       Handle(ShapeExtend_WireData) aswd = new ShapeExtend_WireData(aW,Standard_True,Standard_False);
       SAW.Init(aswd,face,Precision());
       // pnd protection on seam edges
-      TopTools_DataMapOfShapeInteger EdgeMap;
+      TopTools_FlatDataMapOfShapeInteger EdgeMap;
       Standard_Integer i;
       for (i=1; i<=SAW.NbEdges(); i++) 
       {
@@ -540,7 +540,7 @@ Standard_Boolean ShapeFix_Wireframe::CheckSmallEdges(TopTools_MapOfShape& theSma
   for (TopExp_Explorer expw1(myShape,TopAbs_WIRE,TopAbs_FACE); expw1.More(); expw1.Next()) 
   {
     SAW.SetPrecision(Precision());
-    TopTools_DataMapOfShapeInteger EdgeMap;
+    TopTools_FlatDataMapOfShapeInteger EdgeMap;
     Standard_Integer i;
     TopoDS_Wire theWire=TopoDS::Wire(expw1.Current());
     TopTools_ListOfShape theEdgeList;
@@ -730,6 +730,7 @@ static Standard_Boolean fixshape (const Handle(ShapeProcess_Context)& context,
   sfs->FixShellTool()->FixFaceMode() = ctx->IntegerVal ( "FixFaceMode", -1 );
   sfs->FixShellTool()->SetNonManifoldFlag(ctx->IsNonManifold());
   sfs->FixShellTool()->FixOrientationMode() = ctx->IntegerVal("FixFaceOrientationMode", -1);
+  sfs->SetRunParallel (ctx->BooleanVal ("RunParallel", Standard_False));
 
   //parameters for ShapeFix_Face
   sff->FixWireMode()              = ctx->IntegerVal ( "FixWireMode", -1 );
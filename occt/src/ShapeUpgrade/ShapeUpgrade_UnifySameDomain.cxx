@@ -48,6 +48,8 @@
 #include <gp_Dir.hxx>
 #include <gp_Lin.hxx>
 #include <IntPatch_ImpImpIntersection.hxx>
+#include <NCollection_Array1.hxx>
+#include <OSD_Parallel.hxx>
 #include <ShapeAnalysis_Edge.hxx>
 #include <ShapeAnalysis_WireOrder.hxx>
 #include <ShapeAnalysis_Surface.hxx>
@@ -1155,27 +1157,31 @@ static Standard_Boolean AddOrdinaryEdges(TopTools_SequenceOfShape& edges,
   }
 
   Standard_Boolean isDropped = Standard_False;
-  //merge edges and drop seams
-  Standard_Integer i;
-  for (i = 1; i <= edges.Length(); i++) {
-    TopoDS_Shape current = edges(i);
+  //merge edges and drop seams in one pass, the kept edges are collected
+  //into the new sequence instead of removing the dropped ones one by one
+  TopTools_SequenceOfShape aKeptEdges;
+  for (TopTools_SequenceOfShape::Iterator anIt(edges); anIt.More(); anIt.Next()) {
+    const TopoDS_Shape& current = anIt.Value();
     if(aNewEdges.Contains(current)) {
 
       aNewEdges.RemoveKey(current);
-      edges.Remove(i);
       theRemovedEdges.Append(current);
-      i--;
 
       if(!isDropped) {
         isDropped = Standard_True;
-        anIndex = i;
+        anIndex = aKeptEdges.Length();
       }
     }
+    else
+      aKeptEdges.Append(current);
   }
 
   //add edges to the sequence
-  for (i = 1; i <= aNewEdges.Extent(); i++)
-    edges.Append(aNewEdges(i));
+  for (Standard_Integer i = 1; i <= aNewEdges.Extent(); i++)
+    aKeptEdges.Append(aNewEdges(i));
+
+  edges.Clear();
+  edges.Append(aKeptEdges);
 
   return isDropped;
 }
@@ -1320,12 +1326,92 @@ static Standard_Boolean GetNormalToSurface(const TopoDS_Face& theFace,
   return Standard_True;
 }
 
+namespace
+{
+  //! Data of the surface of the face computed once per face
+  //! and used to check if the faces lie on the same surface.
+  struct SurfaceSignature
+  {
+    Handle(Geom_Surface) Surface;    //!< surface of the face without rectangular trimming
+    gp_Pln               Plane;      //!< plane of the surface if it is planar
+    gp_Cylinder          Cylinder;   //!< cylinder of the surface if it is cylindrical
+    Standard_Boolean     IsPlanar;   //!< flag of the planar surface
+    Standard_Boolean     IsCylinder; //!< flag of the cylindrical surface
+    Standard_Boolean     IsComputed; //!< flag of the computed signature
+
+    SurfaceSignature()
+    : IsPlanar (Standard_False),
+      IsCylinder (Standard_False),
+      IsComputed (Standard_False)
+    {}
+  };
+
+  //! Computes the signature of the surface of the face.
+  void ComputeSignature (const TopoDS_Face& theFace,
+                         const Standard_Real theLinTol,
+                         SurfaceSignature& theSign)
+  {
+    theSign.Surface = ClearRts (BRep_Tool::Surface (theFace));
+
+    // all kinds of surfaces are checked, including b-spline and bezier
+    GeomLib_IsPlanarSurface aPlanarityChecker (theSign.Surface, theLinTol);
+    theSign.IsPlanar = aPlanarityChecker.IsPlanar();
+    if (theSign.IsPlanar)
+    {
+      theSign.Plane = aPlanarityChecker.Plan();
+    }
+    theSign.IsCylinder = getCylinder (theSign.Surface, theSign.Cylinder);
+    theSign.IsComputed = Standard_True;
+  }
+
+  //! Returns the signature of the surface of the face, computes it on the first request.
+  const SurfaceSignature& Signature (const TopoDS_Face& theFace,
+                                     const Standard_Real theLinTol,
+                                     SurfaceSignature& theSign)
+  {
+    if (!theSign.IsComputed)
+    {
+      ComputeSignature (theFace, theLinTol, theSign);
+    }
+    return theSign;
+  }
+
+  //! Functor computing the signatures of the surfaces of the faces in parallel threads.
+  class SurfaceSignatureFunctor
+  {
+  public:
+
+    SurfaceSignatureFunctor (const TopTools_IndexedMapOfShape& theFaces,
+                             const Standard_Real theLinTol,
+                             NCollection_Array1<SurfaceSignature>& theSigns)
+    : myFaces (theFaces),
+      myLinTol (theLinTol),
+      mySigns (theSigns)
+    {}
+
+    void operator() (const Standard_Integer theIndex) const
+    {
+      ComputeSignature (TopoDS::Face (myFaces (theIndex)), myLinTol, mySigns.ChangeValue (theIndex));
+    }
+
+  private:
+    SurfaceSignatureFunctor& operator= (const SurfaceSignatureFunctor&);
+
+  private:
+    const TopTools_IndexedMapOfShape&     myFaces;
+    const Standard_Real                   myLinTol;
+    NCollection_Array1<SurfaceSignature>& mySigns;
+  };
+}
+
 //=======================================================================
 //function : IsSameDomain
 //purpose  : 
 //=======================================================================
 static Standard_Boolean IsSameDomain(const TopoDS_Face& aFace,
                                      const TopoDS_Face& aCheckedFace,
+                                     SurfaceSignature& theSign1,
+                                     SurfaceSignature& theSign2,
                                      const Standard_Real theLinTol,
                                      const Standard_Real theAngTol,
                                      ShapeUpgrade_UnifySameDomain::DataMapOfFacePlane& theFacePlaneMap)
@@ -1340,43 +1426,32 @@ static Standard_Boolean IsSameDomain(const TopoDS_Face& aFace,
   if (S1 == S2 && L1 == L2)
     return Standard_True;
 
-  S1 = BRep_Tool::Surface(aFace);
-  S2 = BRep_Tool::Surface(aCheckedFace);
-
-  S1 = ClearRts(S1);
-  S2 = ClearRts(S2);
-
-  //Handle(Geom_OffsetSurface) aGOFS1, aGOFS2;
-  //aGOFS1 = Handle(Geom_OffsetSurface)::DownCast(S1);
-  //aGOFS2 = Handle(Geom_OffsetSurface)::DownCast(S2);
-  //if (!aGOFS1.IsNull()) S1 = aGOFS1->BasisSurface();
-  //if (!aGOFS2.IsNull()) S2 = aGOFS2->BasisSurface();
+  const SurfaceSignature& aSign1 = Signature(aFace, theLinTol, theSign1);
+  const SurfaceSignature& aSign2 = Signature(aCheckedFace, theLinTol, theSign2);
+  S1 = aSign1.Surface;
+  S2 = aSign2.Surface;
 
   // case of two planar surfaces:
   // all kinds of surfaces checked, including b-spline and bezier
-  GeomLib_IsPlanarSurface aPlanarityChecker1(S1, theLinTol);
-  if (aPlanarityChecker1.IsPlanar()) {
-    GeomLib_IsPlanarSurface aPlanarityChecker2(S2, theLinTol);
-    if (aPlanarityChecker2.IsPlanar()) {
-      gp_Pln aPln1 = aPlanarityChecker1.Plan();
-      gp_Pln aPln2 = aPlanarityChecker2.Plan();
-
-      if (aPln1.Position().Direction().IsParallel(aPln2.Position().Direction(), theAngTol) &&
-        aPln1.Distance(aPln2) < theLinTol)
-      {
-        Handle(Geom_Plane) aPlaneOfFaces;
-        if (theFacePlaneMap.IsBound(aFace))
-          aPlaneOfFaces = theFacePlaneMap(aFace);
-        else if (theFacePlaneMap.IsBound(aCheckedFace))
-          aPlaneOfFaces = theFacePlaneMap(aCheckedFace);
-        else
-          aPlaneOfFaces = new Geom_Plane(aPln1);
+  if (aSign1.IsPlanar && aSign2.IsPlanar) {
+    const gp_Pln& aPln1 = aSign1.Plane;
+    const gp_Pln& aPln2 = aSign2.Plane;
 
-        theFacePlaneMap.Bind(aFace, aPlaneOfFaces);
-        theFacePlaneMap.Bind(aCheckedFace, aPlaneOfFaces);
-        
-        return Standard_True;
-      }
+    if (aPln1.Position().Direction().IsParallel(aPln2.Position().Direction(), theAngTol) &&
+      aPln1.Distance(aPln2) < theLinTol)
+    {
+      Handle(Geom_Plane) aPlaneOfFaces;
+      if (theFacePlaneMap.IsBound(aFace))
+        aPlaneOfFaces = theFacePlaneMap(aFace);
+      else if (theFacePlaneMap.IsBound(aCheckedFace))
+        aPlaneOfFaces = theFacePlaneMap(aCheckedFace);
+      else
+        aPlaneOfFaces = new Geom_Plane(aPln1);
+
+      theFacePlaneMap.Bind(aFace, aPlaneOfFaces);
+      theFacePlaneMap.Bind(aCheckedFace, aPlaneOfFaces);
+      
+      return Standard_True;
     }
   }
 
@@ -1406,24 +1481,19 @@ static Standard_Boolean IsSameDomain(const TopoDS_Face& aFace,
 
   // case of two cylindrical surfaces, at least one of which is a swept surface
   // swept surfaces: SurfaceOfLinearExtrusion, SurfaceOfRevolution
-  if ((S1->IsKind(STANDARD_TYPE(Geom_CylindricalSurface)) ||
-       S1->IsKind(STANDARD_TYPE(Geom_SweptSurface))) &&
-      (S2->IsKind(STANDARD_TYPE(Geom_CylindricalSurface)) ||
-       S2->IsKind(STANDARD_TYPE(Geom_SweptSurface))))
-  {
-    gp_Cylinder aCyl1, aCyl2;
-    if (getCylinder(S1, aCyl1) && getCylinder(S2, aCyl2)) {
-      if (fabs(aCyl1.Radius() - aCyl2.Radius()) < theLinTol) {
-        gp_Dir aDir1 = aCyl1.Position().Direction();
-        gp_Dir aDir2 = aCyl2.Position().Direction();
-        if (aDir1.IsParallel(aDir2, Precision::Angular())) {
-          gp_Pnt aLoc1 = aCyl1.Location();
-          gp_Pnt aLoc2 = aCyl2.Location();
-          gp_Vec aVec12 (aLoc1, aLoc2);
-          if (aVec12.SquareMagnitude() < theLinTol*theLinTol ||
-              aVec12.IsParallel(aDir1, Precision::Angular())) {
-            return Standard_True;
-          }
+  if (aSign1.IsCylinder && aSign2.IsCylinder) {
+    const gp_Cylinder& aCyl1 = aSign1.Cylinder;
+    const gp_Cylinder& aCyl2 = aSign2.Cylinder;
+    if (fabs(aCyl1.Radius() - aCyl2.Radius()) < theLinTol) {
+      gp_Dir aDir1 = aCyl1.Position().Direction();
+      gp_Dir aDir2 = aCyl2.Position().Direction();
+      if (aDir1.IsParallel(aDir2, Precision::Angular())) {
+        gp_Pnt aLoc1 = aCyl1.Location();
+        gp_Pnt aLoc2 = aCyl2.Location();
+        gp_Vec aVec12 (aLoc1, aLoc2);
+        if (aVec12.SquareMagnitude() < theLinTol*theLinTol ||
+            aVec12.IsParallel(aDir1, Precision::Angular())) {
+          return Standard_True;
         }
       }
     }
@@ -2634,6 +2704,7 @@ ShapeUpgrade_UnifySameDomain::ShapeUpgrade_UnifySameDomain()
     myConcatBSplines (Standard_False),
     myAllowInternal (Standard_False),
     mySafeInputMode(Standard_True),
+    myRunParallel (Standard_False),
     myHistory(new BRepTools_History)
 {
   myContext = new ShapeBuild_ReShape;
@@ -2656,6 +2727,7 @@ ShapeUpgrade_UnifySameDomain::ShapeUpgrade_UnifySameDomain(const TopoDS_Shape& a
     myConcatBSplines (ConcatBSplines),
     myAllowInternal (Standard_False),
     mySafeInputMode (Standard_True),
+    myRunParallel (Standard_False),
     myShape (aShape),
     myHistory(new BRepTools_History)
 {
@@ -2816,6 +2888,21 @@ void ShapeUpgrade_UnifySameDomain::IntUnifyFaces(const TopoDS_Shape& theInpShape
   // map of processed shapes
   TopTools_MapOfShape aProcessed;
 
+  // analyze the surfaces of the faces once, instead of doing it
+  // for each pair of adjacent faces being checked for unification;
+  // the surfaces are analyzed on the first check of the face, or all
+  // at once in parallel threads in parallel mode
+  TopTools_IndexedMapOfShape aFaceMap;
+  TopExp::MapShapes(theInpShape, TopAbs_FACE, aFaceMap);
+  NCollection_Array1<SurfaceSignature> aSigns;
+  if (!aFaceMap.IsEmpty()) {
+    aSigns.Resize(1, aFaceMap.Extent(), Standard_False);
+    if (myRunParallel) {
+      SurfaceSignatureFunctor aFunctor(aFaceMap, myLinTol, aSigns);
+      OSD_Parallel::For(1, aFaceMap.Extent() + 1, aFunctor);
+    }
+  }
+
   // processing each face
   TopExp_Explorer exp;
   for (exp.Init(theInpShape, TopAbs_FACE); exp.More(); exp.Next()) {
@@ -2915,7 +3002,9 @@ void ShapeUpgrade_UnifySameDomain::IntUnifyFaces(const TopoDS_Shape& theInpShape
           }
         }
         //
-        if (IsSameDomain(aFace,aCheckedFace, myLinTol, myAngTol, myFacePlaneMap)) {
+        if (IsSameDomain(aFace, aCheckedFace,
+                         aSigns.ChangeValue(aFaceMap.FindIndex(aFace)), aSigns.ChangeValue(aFaceMap.FindIndex(aCheckedFace)),
+                         myLinTol, myAngTol, myFacePlaneMap)) {
 
           if (AddOrdinaryEdges(edges, aCheckedFace, dummy, RemovedEdges)) {
             // sequence edges is modified
@@ -130,6 +130,22 @@ public:
     myAngTol = (theValue < Precision::Angular() ? Precision::Angular() : theValue);
   }
 
+  //! Sets the flag of parallel analysis of the surfaces of the faces.
+  //! The surfaces are analyzed (e.g. checked for planarity) once per face,
+  //! on the first check of the face for unification; in parallel mode all
+  //! surfaces are analyzed before the unification in parallel threads.
+  //! The faces are unified sequentially in any mode. Default value is false.
+  void SetRunParallel(const Standard_Boolean theValue)
+  {
+    myRunParallel = theValue;
+  }
+
+  //! Returns the flag of parallel analysis of the surfaces of the faces.
+  Standard_Boolean RunParallel() const
+  {
+    return myRunParallel;
+  }
+
   //! Performs unification and builds the resulting shape.
   Standard_EXPORT void Build();
   
@@ -215,6 +231,7 @@ private:
   Standard_Boolean myConcatBSplines;
   Standard_Boolean myAllowInternal;
   Standard_Boolean mySafeInputMode;
+  Standard_Boolean myRunParallel;
   TopoDS_Shape myShape;
   Handle(ShapeBuild_ReShape) myContext;
   TopTools_MapOfShape myKeepShapes;
@@ -16,9 +16,11 @@
 
 
 #include <Standard.hxx>
+#include <Standard_ArenaScope.hxx>
 #include <Standard_MMgrOpt.hxx>
 #include <Standard_MMgrRaw.hxx>
 #include <Standard_MMgrTBBalloc.hxx>
+#include <Standard_MMgrThreadCache.hxx>
 #include <Standard_Assert.hxx>
 
 #include <stdlib.h>
@@ -46,6 +48,16 @@
 #define OCCT_MMGT_OPT_DEFAULT 0
 #endif
 
+// Default size (in megabytes) of memory pools of the thread-caching memory manager;
+// WebAssembly memory is reserved by big chunks to reduce the number of memory growths
+#ifndef OCCT_MMGT_RESERVE_DEFAULT
+#if defined(__EMSCRIPTEN__)
+#define OCCT_MMGT_RESERVE_DEFAULT 16
+#else
+#define OCCT_MMGT_RESERVE_DEFAULT 1
+#endif
+#endif
+
 //=======================================================================
 //class    : Standard_MMgrFactory 
 //purpose  : Container for pointer to memory manager;
@@ -166,6 +178,15 @@ Standard_MMgrFactory::Standard_MMgrFactory()
     case 2:  // TBB memory allocator
       myFMMgr = new Standard_MMgrTBBalloc (toClear);
       break;
+    case 3:  // OCCT memory allocator with per-thread caches
+    {
+      aVar = getenv ("MMGT_CELLSIZE");
+      Standard_Integer aCellSize   = (aVar ?  atoi (aVar) : 256);
+      aVar = getenv ("MMGT_RESERVE");
+      Standard_Integer aReserve    = (aVar ?  atoi (aVar) : OCCT_MMGT_RESERVE_DEFAULT);
+      myFMMgr = new Standard_MMgrThreadCache (toClear, aCellSize, (Standard_Size )aReserve * 1024 * 1024);
+      break;
+    }
     case 0:
     default: // system default memory allocator
       myFMMgr = new Standard_MMgrRaw (toClear);
@@ -237,6 +258,10 @@ Standard_MMgrRoot* Standard_MMgrFactory::GetMMgr()
 
 Standard_Address Standard::Allocate(const Standard_Size size)
 {
+  if (Standard_Address anArenaBlock = Standard_ArenaScope::Allocate (size))
+  {
+    return anArenaBlock;
+  }
   return Standard_MMgrFactory::GetMMgr()->Allocate(size);
 }
 
@@ -247,6 +272,12 @@ Standard_Address Standard::Allocate(const Standard_Size size)
 
 void Standard::Free (Standard_Address theStorage)
 {
+  // the blocks are looked up in the arena only while its chunks are alive
+  if (Standard_ArenaScope::hasChunks()
+   && Standard_ArenaScope::Free (theStorage))
+  {
+    return;
+  }
   Standard_MMgrFactory::GetMMgr()->Free(theStorage);
 }
 
@@ -258,6 +289,13 @@ void Standard::Free (Standard_Address theStorage)
 Standard_Address Standard::Reallocate (Standard_Address theStorage,
 				       const Standard_Size theSize)
 {
+  if (Standard_ArenaScope::hasChunks())
+  {
+    if (Standard_Address anArenaBlock = Standard_ArenaScope::Reallocate (theStorage, theSize))
+    {
+      return anArenaBlock;
+    }
+  }
   return Standard_MMgrFactory::GetMMgr()->Reallocate (theStorage, theSize);
 }
 
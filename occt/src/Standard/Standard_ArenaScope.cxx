@@ -0,0 +1,333 @@
+// Created on: 2026-10-18
+//
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <Standard_ArenaScope.hxx>
+
+#include <Standard.hxx>
+#include <Standard_Atomic.hxx>
+#include <Standard_Mutex.hxx>
+
+#include <stdlib.h>
+#include <string.h>
+
+// Size of the chunks of the arena; the chunks are aligned to their size,
+// so that the chunk of the block is found by masking of its address
+#define CHUNK_BITS 18
+#define CHUNK_SIZE ((Standard_Size)1 << CHUNK_BITS)
+
+// Size of the header of the chunk and of the header of each block keeping its size;
+// the blocks are aligned to 16 bytes
+#define HEADER_SIZE 16
+
+// Maximal size of the block (including its header) allocated in the arena
+#define MAX_BLOCK_SIZE (CHUNK_SIZE / 8)
+
+// Bias added to the counter of the live blocks of the chunk used for allocation,
+// so that the counter does not reach zero while the chunk is used
+#define LIVE_BIAS (1 << 30)
+
+// Map of the chunks: the flags of the registered chunks are indexed by the address
+// of the chunk shifted by CHUNK_BITS; the flags are kept in the leaves of
+// LEAF_SIZE elements allocated on demand.
+// Only the addresses below 2^(CHUNK_BITS + 2 * LEAF_BITS) are registered.
+#define LEAF_BITS 15
+#define LEAF_SIZE ((Standard_Size)1 << LEAF_BITS)
+
+namespace
+{
+  //! Header of the chunk of the arena
+  struct ChunkHeader
+  {
+    volatile int LiveCount; //!< number of live blocks, biased while the chunk is used for allocation
+  };
+
+  //! Active scope of the current thread
+  thread_local Standard_ArenaScope* THE_ACTIVE_SCOPE = NULL;
+
+  //! Leaves of the map of the registered chunks
+  volatile char* volatile THE_CHUNK_MAP[LEAF_SIZE];
+
+  //! Returns the mutex protecting the map of the chunks.
+  //! The mutex is constructed in the static storage (not by the memory manager)
+  //! and never destroyed since the blocks may be freed after destruction of static objects.
+  static Standard_Mutex& chunksMutex()
+  {
+    static union { char Buffer[sizeof(Standard_Mutex)]; double AlignDouble; void* AlignPtr; } aStorage;
+    static Standard_Mutex* aMutex = new (aStorage.Buffer) Standard_Mutex();
+    return *aMutex;
+  }
+
+  //! Returns TRUE if the address belongs to the chunk of the arena.
+  //! The map is read without locking: the flag of the chunk cannot change
+  //! while any of its blocks is alive.
+  static inline bool isArenaBlock (const void* theStorage)
+  {
+    const Standard_Size anIndex = (Standard_Size )theStorage >> CHUNK_BITS;
+    if ((anIndex >> (2 * LEAF_BITS)) != 0)
+    {
+      return false;
+    }
+    volatile char* aLeaf = THE_CHUNK_MAP[anIndex >> LEAF_BITS];
+    return aLeaf != NULL
+        && aLeaf[anIndex & (LEAF_SIZE - 1)] != 0;
+  }
+
+  //! Allocates and registers the new chunk, returns null in case of failure.
+  static char* allocateChunk()
+  {
+    char* aChunk = (char* )Standard::AllocateAligned (CHUNK_SIZE, CHUNK_SIZE);
+    if (aChunk == NULL)
+    {
+      return NULL;
+    }
+
+    const Standard_Size anIndex = (Standard_Size )aChunk >> CHUNK_BITS;
+    if ((anIndex >> (2 * LEAF_BITS)) != 0)
+    {
+      Standard::FreeAligned (aChunk);
+      return NULL;
+    }
+
+    {
+      Standard_Mutex::Sentry aSentry (chunksMutex());
+      volatile char* aLeaf = THE_CHUNK_MAP[anIndex >> LEAF_BITS];
+      if (aLeaf == NULL)
+      {
+        aLeaf = (volatile char* )calloc (LEAF_SIZE, 1);
+        if (aLeaf == NULL)
+        {
+          Standard::FreeAligned (aChunk);
+          return NULL;
+        }
+        THE_CHUNK_MAP[anIndex >> LEAF_BITS] = aLeaf;
+      }
+      aLeaf[anIndex & (LEAF_SIZE - 1)] = 1;
+    }
+
+    memset (aChunk, 0, CHUNK_SIZE);
+    ((ChunkHeader* )aChunk)->LiveCount = LIVE_BIAS;
+    return aChunk;
+  }
+
+  //! Unregisters and frees the chunk.
+  static void releaseChunk (char* theChunk)
+  {
+    const Standard_Size anIndex = (Standard_Size )theChunk >> CHUNK_BITS;
+    {
+      Standard_Mutex::Sentry aSentry (chunksMutex());
+      THE_CHUNK_MAP[anIndex >> LEAF_BITS][anIndex & (LEAF_SIZE - 1)] = 0;
+    }
+    Standard::FreeAligned (theChunk);
+  }
+
+  //! Adds the value to the counter of the live blocks of the chunk,
+  //! releases the chunk if the counter becomes zero.
+  //! @return TRUE if the chunk has been released
+  static bool addLiveCount (char* theChunk, const int theDelta)
+  {
+    volatile int* aCounter = &((ChunkHeader* )theChunk)->LiveCount;
+    int aValue = *aCounter;
+    while (!Standard_Atomic_CompareAndSwap (aCounter, aValue, aValue + theDelta))
+    {
+      aValue = *aCounter;
+    }
+    if (aValue + theDelta == 0)
+    {
+      releaseChunk (theChunk);
+      return true;
+    }
+    return false;
+  }
+}
+
+std::atomic<int> Standard_ArenaScope::myNbChunks (0);
+
+//=======================================================================
+//function : Standard_ArenaScope
+//purpose  :
+//=======================================================================
+
+Standard_ArenaScope::Standard_ArenaScope (const Standard_Boolean theToActivate,
+                                          const Standard_Size    theMaxSize)
+: myIsActive (Standard_False),
+  myMaxSize (theMaxSize),
+  myAllocatedSize (0),
+  myChunk (NULL),
+  myNextAddr (NULL),
+  myNbBlocks (0)
+{
+  if (theToActivate
+   && THE_ACTIVE_SCOPE == NULL)
+  {
+    myIsActive = Standard_True;
+    THE_ACTIVE_SCOPE = this;
+  }
+}
+
+//=======================================================================
+//function : ~Standard_ArenaScope
+//purpose  :
+//=======================================================================
+
+Standard_ArenaScope::~Standard_ArenaScope()
+{
+  if (myIsActive)
+  {
+    retireChunk();
+    THE_ACTIVE_SCOPE = NULL;
+  }
+}
+
+//=======================================================================
+//function : IsActiveInThread
+//purpose  :
+//=======================================================================
+
+Standard_Boolean Standard_ArenaScope::IsActiveInThread()
+{
+  return THE_ACTIVE_SCOPE != NULL;
+}
+
+//=======================================================================
+//function : RetainedSize
+//purpose  :
+//=======================================================================
+
+Standard_Size Standard_ArenaScope::RetainedSize()
+{
+  return (Standard_Size )myNbChunks.load (std::memory_order_relaxed) * CHUNK_SIZE;
+}
+
+//=======================================================================
+//function : retireChunk
+//purpose  :
+//=======================================================================
+
+void Standard_ArenaScope::retireChunk()
+{
+  if (myChunk == NULL)
+  {
+    return;
+  }
+
+  // apply the number of the allocated blocks and remove the bias at once
+  char* aChunk = myChunk;
+  const int aDelta = myNbBlocks - LIVE_BIAS;
+  myChunk    = NULL;
+  myNextAddr = NULL;
+  myNbBlocks = 0;
+  if (addLiveCount (aChunk, aDelta))
+  {
+    myNbChunks.fetch_sub (1, std::memory_order_relaxed);
+  }
+}
+
+//=======================================================================
+//function : allocate
+//purpose  :
+//=======================================================================
+
+Standard_Address Standard_ArenaScope::allocate (const Standard_Size theSize)
+{
+  const Standard_Size aBlockSize = ((theSize + 15) & ~(Standard_Size )15) + HEADER_SIZE;
+  if (aBlockSize > MAX_BLOCK_SIZE
+   || aBlockSize < theSize)
+  {
+    return NULL;
+  }
+
+  if (myChunk == NULL
+   || myNextAddr + aBlockSize > myChunk + CHUNK_SIZE)
+  {
+    retireChunk();
+    if (myMaxSize != 0
+     && myAllocatedSize + CHUNK_SIZE > myMaxSize)
+    {
+      return NULL;
+    }
+    myChunk = allocateChunk();
+    if (myChunk == NULL)
+    {
+      return NULL;
+    }
+    myNbChunks.fetch_add (1, std::memory_order_relaxed);
+    myNextAddr = myChunk + HEADER_SIZE;
+    myAllocatedSize += CHUNK_SIZE;
+  }
+
+  // the chunk is zeroed on creation, so that the new block is cleared as by the memory manager
+  *(Standard_Size* )myNextAddr = aBlockSize - HEADER_SIZE;
+  Standard_Address aStorage = myNextAddr + HEADER_SIZE;
+  myNextAddr += aBlockSize;
+  ++myNbBlocks;
+  return aStorage;
+}
+
+//=======================================================================
+//function : Allocate
+//purpose  :
+//=======================================================================
+
+Standard_Address Standard_ArenaScope::Allocate (const Standard_Size theSize)
+{
+  Standard_ArenaScope* aScope = THE_ACTIVE_SCOPE;
+  return aScope != NULL ? aScope->allocate (theSize) : NULL;
+}
+
+//=======================================================================
+//function : Free
+//purpose  :
+//=======================================================================
+
+Standard_Boolean Standard_ArenaScope::Free (const Standard_Address theStorage)
+{
+  if (!isArenaBlock (theStorage))
+  {
+    return Standard_False;
+  }
+
+  char* aChunk = (char* )((Standard_Size )theStorage & ~(CHUNK_SIZE - 1));
+  if (Standard_Atomic_Decrement (&((ChunkHeader* )aChunk)->LiveCount) == 0)
+  {
+    releaseChunk (aChunk);
+    myNbChunks.fetch_sub (1, std::memory_order_relaxed);
+  }
+  return Standard_True;
+}
+
+//=======================================================================
+//function : Reallocate
+//purpose  :
+//=======================================================================
+
+Standard_Address Standard_ArenaScope::Reallocate (const Standard_Address theStorage,
+                                                  const Standard_Size    theSize)
+{
+  if (!isArenaBlock (theStorage))
+  {
+    return NULL;
+  }
+
+  const Standard_Size aCapacity = *(Standard_Size* )((char* )theStorage - HEADER_SIZE);
+  if (theSize <= aCapacity)
+  {
+    return theStorage;
+  }
+
+  Standard_Address aNewStorage = Standard::Allocate (theSize);
+  memcpy (aNewStorage, theStorage, aCapacity);
+  Free (theStorage);
+  return aNewStorage;
+}
@@ -0,0 +1,130 @@
+// Created on: 2026-10-18
+//
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _Standard_ArenaScope_HeaderFile
+#define _Standard_ArenaScope_HeaderFile
+
+#include <Standard_TypeDef.hxx>
+
+#include <atomic>
+
+//! Scope of arena allocation in the current thread.
+//!
+//! While the scope is alive, the small memory blocks requested by Standard::Allocate()
+//! in the thread which has created the scope (including the handled objects, shapes,
+//! geometries and nodes of collections using the default allocator) are taken
+//! consecutively from big chunks of memory (arena) instead of the memory manager.
+//! Freeing of such block does not return it for reuse, but only decreases the counter
+//! of the live blocks of its chunk; the chunk is released at once when all its blocks
+//! are freed and the chunk is not used for allocation anymore.
+//! Thus the algorithms creating and destroying a lot of temporary objects avoid
+//! the cost of the individual calls to the memory manager, and release the memory
+//! of the temporary objects in bulk.
+//!
+//! The blocks may be freed in any thread and at any time, also after destruction of the scope:
+//! the objects escaping into the result of the algorithm keep their chunks alive.
+//! Note that this can retain memory of the temporary objects sharing the chunks with
+//! the long-living objects, thus the scope should be used for the algorithms whose
+//! temporary data considerably exceed the result.
+//! The total size of memory taken by the scope can be limited, the blocks exceeding
+//! the limit and the large blocks are allocated by the memory manager as usual.
+//!
+//! The scope created while another scope is active in the same thread does nothing,
+//! the blocks are allocated in the outer scope.
+//!
+//! Usage:
+//! @code
+//!   {
+//!     Standard_ArenaScope anArenaScope;
+//!     BRepAlgoAPI_Fuse aFuse (theShape1, theShape2);
+//!     aResult = aFuse.Shape();
+//!   }
+//! @endcode
+class Standard_ArenaScope
+{
+public:
+
+  //! Creates the scope in the current thread.
+  //! @param theToActivate flag allowing to create the inactive scope
+  //! @param theMaxSize    maximal total size of memory taken by the scope, 0 means unlimited
+  Standard_EXPORT Standard_ArenaScope (const Standard_Boolean theToActivate = Standard_True,
+                                       const Standard_Size    theMaxSize    = 0);
+
+  //! Deactivates the scope and releases the chunks whose blocks have been freed.
+  Standard_EXPORT ~Standard_ArenaScope();
+
+  //! Returns TRUE if the scope routes the allocations of the thread.
+  Standard_Boolean IsActive() const { return myIsActive; }
+
+  //! Returns the total size of memory taken by the scope.
+  Standard_Size AllocatedSize() const { return myAllocatedSize; }
+
+  //! Returns TRUE if some scope is active in the current thread.
+  Standard_EXPORT static Standard_Boolean IsActiveInThread();
+
+  //! Returns the total size of the chunks of all scopes which are still alive,
+  //! i.e. used for allocation by the active scopes or retained by the blocks not freed yet.
+  Standard_EXPORT static Standard_Size RetainedSize();
+
+public: //! @name Internal methods used by Standard::Allocate(), Standard::Free() and Standard::Reallocate()
+
+  //! Allocates the block in the active scope of the current thread.
+  //! Returns null if there is no active scope or the block should be allocated by the memory manager.
+  Standard_EXPORT static Standard_Address Allocate (const Standard_Size theSize);
+
+  //! Frees the block if it has been allocated in the arena.
+  //! Returns FALSE if the block has been allocated by the memory manager.
+  Standard_EXPORT static Standard_Boolean Free (const Standard_Address theStorage);
+
+  //! Reallocates the block if it has been allocated in the arena.
+  //! Returns null if the block has been allocated by the memory manager.
+  Standard_EXPORT static Standard_Address Reallocate (const Standard_Address theStorage,
+                                                      const Standard_Size    theSize);
+
+private:
+
+  //! Allocates the block in the scope, returns null if the block should be allocated by the memory manager.
+  Standard_Address allocate (const Standard_Size theSize);
+
+  //! Stops using the current chunk for allocation.
+  void retireChunk();
+
+private:
+
+  friend class Standard;
+
+  //! Returns TRUE if any chunk of the arena is alive in any thread;
+  //! otherwise Standard::Free() and Standard::Reallocate() skip the lookup of the block.
+  static Standard_Boolean hasChunks() { return myNbChunks.load (std::memory_order_relaxed) != 0; }
+
+private:
+
+  Standard_ArenaScope (const Standard_ArenaScope& );
+  Standard_ArenaScope& operator= (const Standard_ArenaScope& );
+
+private:
+
+  Standard_Boolean myIsActive;      //!< flag indicating that the scope routes the allocations
+  Standard_Size    myMaxSize;       //!< maximal total size of memory, 0 means unlimited
+  Standard_Size    myAllocatedSize; //!< total size of memory taken by the scope
+  char*            myChunk;         //!< current chunk
+  char*            myNextAddr;      //!< next free address in the current chunk
+  int              myNbBlocks;      //!< number of blocks allocated in the current chunk
+
+  static std::atomic<int> myNbChunks; //!< number of the registered chunks of all scopes
+
+};
+
+#endif // _Standard_ArenaScope_HeaderFile
@@ -0,0 +1,471 @@
+// Created on: 2026-10-18
+//
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <Standard_MMgrThreadCache.hxx>
+#include <Standard_OutOfMemory.hxx>
+
+#include <stdlib.h>
+#include <string.h>
+
+// Round size up to 16 bytes
+#define ROUNDUP16(size)    (((size) + 0xf) & ~(Standard_Size)0xf)
+
+// Get address of user area from block address, and vice-versa
+#define GET_USER(block)    (((Standard_Size*)(block)) + 1)
+#define GET_BLOCK(storage) (((Standard_Size*)(storage)) - 1)
+
+// Minimal index of the size class; the free block shall be able
+// to hold the links of FreeCell (note that 0 is reserved for large blocks)
+#define MIN_CLASS 2
+
+// Approximate size in bytes of the batch of blocks exchanged between
+// the thread cache and the shared lists
+#define BATCH_BYTES 4096
+
+//! Free block in the lists of free blocks.
+//! The first block of each batch in the shared lists keeps the link
+//! to the next batch and the number of blocks in its batch.
+struct Standard_MMgrThreadCache::FreeCell
+{
+  FreeCell*     Next;      //!< next free block of the same batch
+  FreeCell*     NextBatch; //!< first block of the next batch
+  Standard_Size NbCells;   //!< number of blocks in the batch
+};
+
+//! Cache of free blocks of the memory manager in one thread.
+//! The caches of all threads are registered in the global list,
+//! so that the memory manager could detach them on destruction.
+struct Standard_MMgrThreadCache::ThreadCache
+{
+  Standard_MMgrThreadCache* Owner;        //!< memory manager, null if it has been destroyed
+  ThreadCache*              NextInThread; //!< next cache of the same thread (for other memory managers)
+  ThreadCache*              PrevGlobal;   //!< previous cache in the global list
+  ThreadCache*              NextGlobal;   //!< next cache in the global list
+  FreeCell*                 Lists [Standard_MMgrThreadCache::THE_MAX_NB_CLASSES + 1]; //!< free blocks of each class
+  Standard_Size             Counts[Standard_MMgrThreadCache::THE_MAX_NB_CLASSES + 1]; //!< numbers of free blocks of each class
+};
+
+namespace
+{
+  //! Global list of the thread caches of all memory managers
+  Standard_MMgrThreadCache::ThreadCache* THE_CACHES = NULL;
+
+  //! Returns the mutex protecting the global list of the thread caches.
+  //! The mutex is constructed in the static storage (not by the memory manager)
+  //! and never destroyed since the threads may terminate after destruction of static objects.
+  static Standard_Mutex& cachesMutex()
+  {
+    static union { char Buffer[sizeof(Standard_Mutex)]; double AlignDouble; void* AlignPtr; } aStorage;
+    static Standard_Mutex* aMutex = new (aStorage.Buffer) Standard_Mutex();
+    return *aMutex;
+  }
+
+  //! Caches of the current thread
+  struct ThreadCaches
+  {
+    Standard_MMgrThreadCache::ThreadCache* First;      //!< the most recently used cache
+    bool                                   IsReleased; //!< flag indicating that the thread is being terminated
+  };
+
+  thread_local ThreadCaches THE_THREAD_CACHES = { NULL, false };
+
+  //! Returns the caches of the thread to the memory managers on termination of the thread
+  struct ThreadCachesReleaser
+  {
+    ~ThreadCachesReleaser()
+    {
+      Standard_Mutex::Sentry aSentry (cachesMutex());
+      for (Standard_MMgrThreadCache::ThreadCache* aCache = THE_THREAD_CACHES.First; aCache != NULL;)
+      {
+        Standard_MMgrThreadCache::ThreadCache* aNext = aCache->NextInThread;
+        if (aCache->Owner != NULL)
+        {
+          aCache->Owner->Purge (Standard_False);
+        }
+        if (aCache->PrevGlobal != NULL)
+          aCache->PrevGlobal->NextGlobal = aCache->NextGlobal;
+        else
+          THE_CACHES = aCache->NextGlobal;
+        if (aCache->NextGlobal != NULL)
+          aCache->NextGlobal->PrevGlobal = aCache->PrevGlobal;
+        free (aCache);
+        aCache = aNext;
+      }
+      THE_THREAD_CACHES.First = NULL;
+      THE_THREAD_CACHES.IsReleased = true;
+    }
+  };
+
+  thread_local ThreadCachesReleaser THE_THREAD_CACHES_RELEASER;
+}
+
+//=======================================================================
+//function : Standard_MMgrThreadCache
+//purpose  :
+//=======================================================================
+
+Standard_MMgrThreadCache::Standard_MMgrThreadCache (const Standard_Boolean theClear,
+                                                    const Standard_Size    theCellSize,
+                                                    const Standard_Size    thePoolSize)
+: myClear    (theClear),
+  myCellSize (ROUNDUP16(theCellSize)),
+  myPoolSize (ROUNDUP16(thePoolSize)),
+  myPools    (NULL),
+  myNextAddr (NULL),
+  myEndAddr  (NULL)
+{
+  if (myCellSize < (MIN_CLASS << 4))
+    myCellSize = MIN_CLASS << 4;
+  else if (myCellSize > (THE_MAX_NB_CLASSES << 4))
+    myCellSize = THE_MAX_NB_CLASSES << 4;
+  myNbClasses = myCellSize >> 4;
+  if (myPoolSize < BATCH_BYTES * 4)
+    myPoolSize = BATCH_BYTES * 4;
+
+  for (Standard_Size anIndex = 0; anIndex <= THE_MAX_NB_CLASSES; ++anIndex)
+  {
+    const Standard_Size aNbCells = BATCH_BYTES / ((anIndex > 0 ? anIndex : 1) << 4);
+    myBatchSizes[anIndex] = (aNbCells > 8 ? aNbCells : 8);
+    myBatches[anIndex] = NULL;
+  }
+}
+
+//=======================================================================
+//function : ~Standard_MMgrThreadCache
+//purpose  :
+//=======================================================================
+
+Standard_MMgrThreadCache::~Standard_MMgrThreadCache()
+{
+  {
+    // detach the caches of all threads, their blocks belong to the pools released below
+    Standard_Mutex::Sentry aSentry (cachesMutex());
+    for (ThreadCache* aCache = THE_CACHES; aCache != NULL; aCache = aCache->NextGlobal)
+    {
+      if (aCache->Owner == this)
+      {
+        aCache->Owner = NULL;
+      }
+    }
+  }
+
+  while (myPools != NULL)
+  {
+    Standard_Size* aNext = (Standard_Size*)myPools[0];
+    free (myPools);
+    myPools = aNext;
+  }
+}
+
+//=======================================================================
+//function : threadCache
+//purpose  :
+//=======================================================================
+
+inline Standard_MMgrThreadCache::ThreadCache* Standard_MMgrThreadCache::threadCache()
+{
+  ThreadCache* aCache = THE_THREAD_CACHES.First;
+  return aCache != NULL && aCache->Owner == this ? aCache : findThreadCache();
+}
+
+//=======================================================================
+//function : findThreadCache
+//purpose  :
+//=======================================================================
+
+Standard_MMgrThreadCache::ThreadCache* Standard_MMgrThreadCache::findThreadCache()
+{
+  if (THE_THREAD_CACHES.IsReleased)
+  {
+    return NULL;
+  }
+
+  // move the cache of this memory manager to the head of the list of the thread
+  for (ThreadCache* aPrev = THE_THREAD_CACHES.First; aPrev != NULL; aPrev = aPrev->NextInThread)
+  {
+    ThreadCache* aCache = aPrev->NextInThread;
+    if (aCache != NULL && aCache->Owner == this)
+    {
+      aPrev->NextInThread = aCache->NextInThread;
+      aCache->NextInThread = THE_THREAD_CACHES.First;
+      THE_THREAD_CACHES.First = aCache;
+      return aCache;
+    }
+  }
+
+  // the thread cache is not allocated by the memory manager itself
+  ThreadCache* aCache = (ThreadCache*)calloc (1, sizeof(ThreadCache));
+  if (aCache == NULL)
+  {
+    return NULL;
+  }
+
+  // make sure that the caches will be returned on termination of the thread
+  (void)&THE_THREAD_CACHES_RELEASER;
+
+  aCache->Owner = this;
+  {
+    Standard_Mutex::Sentry aSentry (cachesMutex());
+    aCache->NextGlobal = THE_CACHES;
+    if (THE_CACHES != NULL)
+      THE_CACHES->PrevGlobal = aCache;
+    THE_CACHES = aCache;
+  }
+  aCache->NextInThread = THE_THREAD_CACHES.First;
+  THE_THREAD_CACHES.First = aCache;
+  return aCache;
+}
+
+//=======================================================================
+//function : takeBatch
+//purpose  :
+//=======================================================================
+
+Standard_MMgrThreadCache::FreeCell* Standard_MMgrThreadCache::takeBatch (const Standard_Size theIndex,
+                                                                         Standard_Size&      theNbCells)
+{
+  Standard_Mutex::Sentry aSentry (myMutex);
+  FreeCell* aBatch = myBatches[theIndex];
+  if (aBatch != NULL)
+  {
+    myBatches[theIndex] = aBatch->NextBatch;
+    theNbCells = aBatch->NbCells;
+    return aBatch;
+  }
+
+  // carve the new blocks from the active pool
+  const Standard_Size aRoundSize = theIndex << 4;
+  const Standard_Size aNbCells   = myBatchSizes[theIndex];
+  if (myNextAddr == NULL || (Standard_Size)(myEndAddr - myNextAddr) < aRoundSize * aNbCells)
+  {
+    // the rest of the active pool is lost
+    Standard_Size* aPool = (Standard_Size*)malloc (myPoolSize);
+    if (aPool == NULL)
+      throw Standard_OutOfMemory("Standard_MMgrThreadCache::Allocate(): malloc failed");
+    aPool[0] = (Standard_Size)myPools;
+    myPools = aPool;
+    // keep the user area of the blocks aligned as the block header
+    myNextAddr = (char*)aPool + 16;
+    myEndAddr  = (char*)aPool + myPoolSize;
+  }
+
+  aBatch = (FreeCell*)myNextAddr;
+  FreeCell* aCell = aBatch;
+  for (Standard_Size i = 1; i < aNbCells; ++i)
+  {
+    FreeCell* aNext = (FreeCell*)((char*)aCell + aRoundSize);
+    aCell->Next = aNext;
+    aCell = aNext;
+  }
+  aCell->Next = NULL;
+  myNextAddr += aRoundSize * aNbCells;
+  theNbCells = aNbCells;
+  return aBatch;
+}
+
+//=======================================================================
+//function : putBatch
+//purpose  :
+//=======================================================================
+
+void Standard_MMgrThreadCache::putBatch (const Standard_Size theIndex,
+                                         FreeCell*           theBatch,
+                                         const Standard_Size theNbCells)
+{
+  theBatch->NbCells = theNbCells;
+  Standard_Mutex::Sentry aSentry (myMutex);
+  theBatch->NextBatch = myBatches[theIndex];
+  myBatches[theIndex] = theBatch;
+}
+
+//=======================================================================
+//function : flushCache
+//purpose  :
+//=======================================================================
+
+void Standard_MMgrThreadCache::flushCache (ThreadCache* theCache)
+{
+  for (Standard_Size anIndex = MIN_CLASS; anIndex <= myNbClasses; ++anIndex)
+  {
+    if (theCache->Lists[anIndex] != NULL)
+    {
+      putBatch (anIndex, theCache->Lists[anIndex], theCache->Counts[anIndex]);
+      theCache->Lists[anIndex]  = NULL;
+      theCache->Counts[anIndex] = 0;
+    }
+  }
+}
+
+//=======================================================================
+//function : Allocate
+//purpose  :
+//=======================================================================
+
+Standard_Address Standard_MMgrThreadCache::Allocate (const Standard_Size theSize)
+{
+  // the size is rounded up to 16 bytes including the header
+  const Standard_Size aRoundSize = ROUNDUP16(theSize + sizeof(Standard_Size));
+  if (aRoundSize > myCellSize)
+  {
+    // large block is allocated directly
+    Standard_Size* aBlock = (Standard_Size*)(myClear ? calloc (aRoundSize, sizeof(char)) :
+                                                       malloc (aRoundSize));
+    if (aBlock == NULL)
+      throw Standard_OutOfMemory("Standard_MMgrThreadCache::Allocate(): malloc failed");
+    aBlock[0] = 0;
+    return GET_USER(aBlock);
+  }
+
+  const Standard_Size anIndex = (aRoundSize >> 4) < MIN_CLASS ? MIN_CLASS : (aRoundSize >> 4);
+  FreeCell* aCell = NULL;
+  ThreadCache* aCache = threadCache();
+  if (aCache != NULL)
+  {
+    aCell = aCache->Lists[anIndex];
+    if (aCell == NULL)
+    {
+      aCell = takeBatch (anIndex, aCache->Counts[anIndex]);
+    }
+    aCache->Lists[anIndex] = aCell->Next;
+    --aCache->Counts[anIndex];
+  }
+  else
+  {
+    // the thread is being terminated, the block is taken from the shared lists
+    Standard_Size aNbCells = 0;
+    aCell = takeBatch (anIndex, aNbCells);
+    if (aNbCells > 1)
+    {
+      putBatch (anIndex, aCell->Next, aNbCells - 1);
+    }
+  }
+
+  Standard_Size* aBlock = (Standard_Size*)aCell;
+  aBlock[0] = anIndex;
+  Standard_Address aStorage = GET_USER(aBlock);
+  if (myClear)
+  {
+    memset (aStorage, 0, (anIndex << 4) - sizeof(Standard_Size));
+  }
+  return aStorage;
+}
+
+//=======================================================================
+//function : Free
+//purpose  :
+//=======================================================================
+
+void Standard_MMgrThreadCache::Free (Standard_Address theStorage)
+{
+  if (theStorage == NULL)
+  {
+    return;
+  }
+
+  Standard_Size* aBlock = GET_BLOCK(theStorage);
+  const Standard_Size anIndex = aBlock[0];
+  if (anIndex == 0)
+  {
+    free (aBlock);
+    return;
+  }
+
+  FreeCell* aCell = (FreeCell*)aBlock;
+  ThreadCache* aCache = threadCache();
+  if (aCache == NULL)
+  {
+    aCell->Next = NULL;
+    putBatch (anIndex, aCell, 1);
+    return;
+  }
+
+  aCell->Next = aCache->Lists[anIndex];
+  aCache->Lists[anIndex] = aCell;
+  if (++aCache->Counts[anIndex] < 2 * myBatchSizes[anIndex])
+  {
+    return;
+  }
+
+  // give the batch of the most recently freed blocks to the shared lists
+  // (the rest of the list is kept as more likely to be in the processor cache)
+  const Standard_Size aNbCells = myBatchSizes[anIndex];
+  FreeCell* aLast = aCell;
+  for (Standard_Size i = 1; i < aNbCells; ++i)
+  {
+    aLast = aLast->Next;
+  }
+  aCache->Lists[anIndex] = aLast->Next;
+  aCache->Counts[anIndex] -= aNbCells;
+  aLast->Next = NULL;
+  putBatch (anIndex, aCell, aNbCells);
+}
+
+//=======================================================================
+//function : Reallocate
+//purpose  :
+//=======================================================================
+
+Standard_Address Standard_MMgrThreadCache::Reallocate (Standard_Address    theStorage,
+                                                       const Standard_Size theSize)
+{
+  if (theStorage == NULL)
+  {
+    return Allocate (theSize);
+  }
+
+  Standard_Size* aBlock = GET_BLOCK(theStorage);
+  const Standard_Size anIndex = aBlock[0];
+  if (anIndex == 0)
+  {
+    // large block remains large
+    const Standard_Size aRoundSize = ROUNDUP16(theSize + sizeof(Standard_Size));
+    Standard_Size* aNewBlock = (Standard_Size*)realloc (aBlock, aRoundSize);
+    if (aNewBlock == NULL)
+      throw Standard_OutOfMemory("Standard_MMgrThreadCache::Reallocate(): realloc failed");
+    // Note that it is not possible to ensure that additional memory
+    // allocated by realloc will be cleared (so as to satisfy myClear mode)
+    return GET_USER(aNewBlock);
+  }
+
+  const Standard_Size anOldSize = (anIndex << 4) - sizeof(Standard_Size);
+  if (theSize <= anOldSize)
+  {
+    return theStorage;
+  }
+
+  Standard_Address aNewStorage = Allocate (theSize);
+  memcpy (aNewStorage, theStorage, anOldSize);
+  Free (theStorage);
+  return aNewStorage;
+}
+
+//=======================================================================
+//function : Purge
+//purpose  :
+//=======================================================================
+
+Standard_Integer Standard_MMgrThreadCache::Purge (Standard_Boolean )
+{
+  ThreadCache* aCache = THE_THREAD_CACHES.IsReleased ? NULL : THE_THREAD_CACHES.First;
+  for (; aCache != NULL; aCache = aCache->NextInThread)
+  {
+    if (aCache->Owner == this)
+    {
+      flushCache (aCache);
+      break;
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,121 @@
+// Created on: 2026-10-18
+//
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _Standard_MMgrThreadCache_HeaderFile
+#define _Standard_MMgrThreadCache_HeaderFile
+
+#include <Standard_MMgrRoot.hxx>
+#include <Standard_Mutex.hxx>
+
+/**
+* @brief Open CASCADE memory manager with per-thread caches of small blocks.
+*
+* The behaviour is different for memory blocks of different sizes:
+*
+* - Small blocks with size (including 8 bytes of the block header) less than
+*   or equal to theCellSize are distributed into size classes with granularity
+*   of 16 bytes. Each thread keeps its own lists of free blocks of each class,
+*   so that allocation and deallocation of small blocks do not need any locking.
+*   The blocks are exchanged between the thread caches and the shared lists
+*   of the memory manager by batches: a thread takes a batch of blocks when its
+*   list is empty and gives a batch back when its list becomes too long, so that
+*   the blocks freed in a thread other than the allocating one are reused without
+*   unbounded growth of the cache. When a thread exits, all blocks of its cache
+*   are returned to the shared lists.
+*   New small blocks are carved from memory pools of thePoolSize bytes, which
+*   are not returned to the system until destruction of the memory manager.
+*   Big pools reduce the number of requests to the system, which is especially
+*   expensive for WebAssembly builds where each request may grow the linear memory.
+*
+* - Large blocks are allocated and freed directly by malloc() and free().
+*
+* Note that 8 bytes are added at the beginning of each memory block to hold
+* the index of its size class.
+*/
+class Standard_MMgrThreadCache : public Standard_MMgrRoot
+{
+public:
+
+  //! Constructor. If theClear is True, the allocated memory will be nullified.
+  //! For description of other parameters, see description of the class above.
+  Standard_EXPORT Standard_MMgrThreadCache (const Standard_Boolean theClear    = Standard_True,
+                                            const Standard_Size    theCellSize = 256,
+                                            const Standard_Size    thePoolSize = 1024 * 1024);
+
+  //! Frees all memory pools allocated for small blocks.
+  //! The memory manager should not be used by any thread after its destruction.
+  Standard_EXPORT virtual ~Standard_MMgrThreadCache();
+
+  //! Allocate theSize bytes; see class description above
+  Standard_EXPORT virtual Standard_Address Allocate (const Standard_Size theSize);
+
+  //! Reallocate previously allocated thePtr to a new size; new address is returned.
+  //! In case that thePtr is null, the function behaves exactly as Allocate.
+  Standard_EXPORT virtual Standard_Address Reallocate (Standard_Address    thePtr,
+                                                       const Standard_Size theSize);
+
+  //! Free previously allocated block.
+  //! Small blocks are kept in the cache of the calling thread.
+  Standard_EXPORT virtual void Free (Standard_Address thePtr);
+
+  //! Returns the free small blocks cached by the calling thread to the shared lists,
+  //! so that they can be reused by other threads.
+  //! Always returns 0 since the memory pools are not released to the system.
+  Standard_EXPORT virtual Standard_Integer Purge (Standard_Boolean isDestroyed);
+
+public:
+
+  //! Maximal number of size classes of small blocks
+  static const Standard_Size THE_MAX_NB_CLASSES = 64;
+
+  //! Free block in the lists of free blocks
+  struct FreeCell;
+
+  //! Cache of free blocks of the memory manager in one thread (internal)
+  struct ThreadCache;
+
+protected:
+
+  //! Returns the cache of the calling thread, null if the thread is being terminated.
+  inline ThreadCache* threadCache();
+
+  //! Searches or creates the cache of the calling thread.
+  ThreadCache* findThreadCache();
+
+  //! Takes the batch of free blocks of the given class from the shared lists
+  //! or carves new blocks from the memory pool.
+  FreeCell* takeBatch (const Standard_Size theIndex, Standard_Size& theNbCells);
+
+  //! Puts the chain of free blocks of the given class into the shared lists.
+  void putBatch (const Standard_Size theIndex, FreeCell* theBatch, const Standard_Size theNbCells);
+
+  //! Moves all free blocks of the thread cache into the shared lists.
+  void flushCache (ThreadCache* theCache);
+
+protected:
+
+  Standard_Boolean myClear;                              //!< option to clear allocated memory
+  Standard_Size    myCellSize;                           //!< maximal size of small blocks including header
+  Standard_Size    myNbClasses;                          //!< index of the last size class
+  Standard_Size    myBatchSizes[THE_MAX_NB_CLASSES + 1]; //!< numbers of blocks exchanged at once for each class
+  FreeCell*        myBatches[THE_MAX_NB_CLASSES + 1];    //!< shared lists of batches of free blocks of each class
+  Standard_Size    myPoolSize;                           //!< size of memory pools for small blocks
+  Standard_Size*   myPools;                              //!< list of memory pools for small blocks
+  char*            myNextAddr;                           //!< next free address in the active memory pool
+  char*            myEndAddr;                            //!< end of the active memory pool
+  Standard_Mutex   myMutex;                              //!< mutex to protect shared lists and pools
+};
+
+#endif
@@ -0,0 +1,516 @@
+// Created on: 2026-10-18
+//
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <TopExp_ShapeIndex.hxx>
+
+#include <Standard_NullObject.hxx>
+#include <Standard_ProgramError.hxx>
+#include <TopAbs.hxx>
+#include <TopoDS_Iterator.hxx>
+#include <TopoDS_TShape.hxx>
+#include <TopTools_ListOfShape.hxx>
+
+IMPLEMENT_STANDARD_RTTIEXT(TopExp_ShapeIndex, Standard_Transient)
+
+namespace
+{
+  //! Number of the indices kept in the cache.
+  static const Standard_Integer THE_CACHE_SIZE = 8;
+
+  //! Cache of the indices of the recently indexed TShapes, the most recent first.
+  //! The TShapes are not referenced, so that the cache does not keep them alive;
+  //! the index found by the address of the TShape is validated by TopExp_ShapeIndex::isUpToDate().
+  struct ShapeIndexCache
+  {
+    Standard_Mutex            Mutex;
+    const TopoDS_TShape*      TShapes[THE_CACHE_SIZE];
+    Handle(TopExp_ShapeIndex) Indices[THE_CACHE_SIZE];
+
+    ShapeIndexCache()
+    {
+      for (Standard_Integer i = 0; i < THE_CACHE_SIZE; ++i)
+      {
+        TShapes[i] = NULL;
+      }
+    }
+
+    //! Returns the position of the TShape in the cache, -1 if absent.
+    Standard_Integer Find (const TopoDS_TShape* theTShape) const
+    {
+      for (Standard_Integer i = 0; i < THE_CACHE_SIZE; ++i)
+      {
+        if (TShapes[i] == theTShape)
+        {
+          return i;
+        }
+      }
+      return -1;
+    }
+
+    //! Moves the entry at the given position (the last one if -1) to the front of the cache.
+    void MoveToFront (const Standard_Integer thePos)
+    {
+      Standard_Integer aPos = thePos >= 0 ? thePos : THE_CACHE_SIZE - 1;
+      const TopoDS_TShape* aTShape = TShapes[aPos];
+      Handle(TopExp_ShapeIndex) anIndex = Indices[aPos];
+      for (; aPos > 0; --aPos)
+      {
+        TShapes[aPos] = TShapes[aPos - 1];
+        Indices[aPos] = Indices[aPos - 1];
+      }
+      TShapes[0] = aTShape;
+      Indices[0] = anIndex;
+    }
+
+    //! Removes the entry at the given position.
+    void Remove (Standard_Integer thePos)
+    {
+      for (; thePos < THE_CACHE_SIZE - 1; ++thePos)
+      {
+        TShapes[thePos] = TShapes[thePos + 1];
+        Indices[thePos] = Indices[thePos + 1];
+      }
+      TShapes[THE_CACHE_SIZE - 1] = NULL;
+      Indices[THE_CACHE_SIZE - 1].Nullify();
+    }
+  };
+
+  //! Returns the cache of indices.
+  static ShapeIndexCache& shapeIndexCache()
+  {
+    static ShapeIndexCache THE_CACHE;
+    return THE_CACHE;
+  }
+
+  //! Fills the table from the pairs (key, value) of indices grouping the values by keys.
+  //! The order of the values of each key is kept.
+  static void fillTable (const Standard_Integer                      theNbKeys,
+                         const NCollection_Vector<Standard_Integer>& thePairs,
+                         NCollection_Array1<Standard_Integer>&       theOffsets,
+                         NCollection_Array1<Standard_Integer>&       theValues)
+  {
+    const Standard_Integer aNbValues = thePairs.Length() / 2;
+    theOffsets.Resize (1, theNbKeys + 1, Standard_False);
+    theOffsets.Init (0);
+    for (Standard_Integer i = 0; i < aNbValues; ++i)
+    {
+      ++theOffsets (thePairs (2 * i) + 1);
+    }
+    theOffsets (1) = 1;
+    for (Standard_Integer i = 2; i <= theNbKeys + 1; ++i)
+    {
+      theOffsets (i) += theOffsets (i - 1);
+    }
+
+    NCollection_Array1<Standard_Integer> aPos (1, theNbKeys);
+    for (Standard_Integer i = 1; i <= theNbKeys; ++i)
+    {
+      aPos (i) = theOffsets (i);
+    }
+    if (aNbValues == 0)
+    {
+      return;
+    }
+    theValues.Resize (1, aNbValues, Standard_False);
+    for (Standard_Integer i = 0; i < aNbValues; ++i)
+    {
+      theValues (aPos (thePairs (2 * i))++) = thePairs (2 * i + 1);
+    }
+  }
+
+  //! Appends to the list the indices of all distinct sub-shapes of the shape
+  //! in the order of the depth-first exploration. The found shapes are marked
+  //! in <theMarks> by <theMark>.
+  static void collectSubShapes (const TopExp_ShapeIndex::Table&        theChildren,
+                                const Standard_Integer                 theIndex,
+                                const Standard_Integer                 theMark,
+                                NCollection_Array1<Standard_Integer>&  theMarks,
+                                NCollection_Vector<Standard_Integer>&  theSubShapes)
+  {
+    const Standard_Integer aNbChildren = theChildren.Size (theIndex);
+    for (Standard_Integer i = 1; i <= aNbChildren; ++i)
+    {
+      const Standard_Integer aChild = theChildren.Value (theIndex, i);
+      if (theMarks (aChild) != theMark)
+      {
+        theMarks (aChild) = theMark;
+        theSubShapes.Append (aChild);
+        collectSubShapes (theChildren, aChild, theMark, theMarks, theSubShapes);
+      }
+    }
+  }
+}
+
+//=======================================================================
+//function : Get
+//purpose  :
+//=======================================================================
+Handle(TopExp_ShapeIndex) TopExp_ShapeIndex::Get (const TopoDS_Shape& theShape)
+{
+  if (theShape.IsNull())
+  {
+    return Handle(TopExp_ShapeIndex)();
+  }
+
+  const TopoDS_TShape* aTShape = theShape.TShape().get();
+  ShapeIndexCache& aCache = shapeIndexCache();
+  Handle(TopExp_ShapeIndex) anIndex;
+  {
+    Standard_Mutex::Sentry aSentry (aCache.Mutex);
+    const Standard_Integer aPos = aCache.Find (aTShape);
+    if (aPos >= 0)
+    {
+      anIndex = aCache.Indices[aPos];
+    }
+  }
+
+  // Validate or build the index out of the lock
+  if (!anIndex.IsNull()
+    && anIndex->isUpToDate (theShape))
+  {
+    Standard_Mutex::Sentry aSentry (aCache.Mutex);
+    const Standard_Integer aPos = aCache.Find (aTShape);
+    if (aPos >= 0 && aCache.Indices[aPos] == anIndex)
+    {
+      aCache.MoveToFront (aPos);
+    }
+    return anIndex;
+  }
+
+  anIndex = new TopExp_ShapeIndex (theShape);
+
+  Standard_Mutex::Sentry aSentry (aCache.Mutex);
+  const Standard_Integer aPos = aCache.Find (aTShape);
+  if (aPos >= 0)
+  {
+    aCache.Remove (aPos);
+  }
+  aCache.MoveToFront (-1);
+  aCache.TShapes[0] = aTShape;
+  aCache.Indices[0] = anIndex;
+  return anIndex;
+}
+
+//=======================================================================
+//function : Release
+//purpose  :
+//=======================================================================
+void TopExp_ShapeIndex::Release (const TopoDS_Shape& theShape)
+{
+  ShapeIndexCache& aCache = shapeIndexCache();
+  Standard_Mutex::Sentry aSentry (aCache.Mutex);
+  if (theShape.IsNull())
+  {
+    for (Standard_Integer i = 0; i < THE_CACHE_SIZE; ++i)
+    {
+      aCache.TShapes[i] = NULL;
+      aCache.Indices[i].Nullify();
+    }
+    return;
+  }
+
+  const Standard_Integer aPos = aCache.Find (theShape.TShape().get());
+  if (aPos >= 0)
+  {
+    aCache.Remove (aPos);
+  }
+}
+
+//=======================================================================
+//function : TopExp_ShapeIndex
+//purpose  :
+//=======================================================================
+TopExp_ShapeIndex::TopExp_ShapeIndex (const TopoDS_Shape& theShape)
+: myTShape (theShape.TShape().get()),
+  myRootType (TopAbs_SHAPE)
+{
+  if (theShape.IsNull())
+  {
+    throw Standard_NullObject ("TopExp_ShapeIndex: the shape is null");
+  }
+  myRootType = theShape.ShapeType();
+  for (Standard_Integer i = 0; i < TopAbs_SHAPE; ++i)
+  {
+    myHasAncestors[i] = Standard_False;
+  }
+
+  // Number the sub-shapes in the depth-first order.
+  // The shape itself is not kept to avoid the cyclic reference of its TShape.
+  const TopoDS_Shape aRoot = theShape.Located (TopLoc_Location()).Oriented (TopAbs_FORWARD);
+  NCollection_Vector<TopoDS_Shape> aShapes;
+  NCollection_Vector<Standard_Integer> aLinks, aLinkOrientations;
+  aShapes.Append (TopoDS_Shape());
+  add (aRoot, 1, aShapes, aLinks, aLinkOrientations);
+
+  const Standard_Integer aNbShapes = aShapes.Length();
+  myShapes.Resize (1, aNbShapes, Standard_False);
+  NCollection_Vector<Standard_Integer> aTypes;
+  for (Standard_Integer i = 1; i <= aNbShapes; ++i)
+  {
+    myShapes (i) = aShapes (i - 1);
+    if (i != 1 && ShapeType (i) == TopAbs_COMPOUND)
+    {
+      // TopExp_Explorer does not look for the compounds inside the found ones
+      continue;
+    }
+    aTypes.Append (ShapeType (i) + 1);
+    aTypes.Append (i);
+  }
+
+  fillTable (TopAbs_SHAPE + 1, aTypes, myTypes.myOffsets, myTypes.myValues);
+  fillTable (aNbShapes, aLinks, myChildren.myOffsets, myChildren.myValues);
+  fillTable (aNbShapes, aLinkOrientations, myChildOrientations.myOffsets, myChildOrientations.myValues);
+}
+
+//=======================================================================
+//function : add
+//purpose  :
+//=======================================================================
+void TopExp_ShapeIndex::add (const TopoDS_Shape&                   theShape,
+                             const Standard_Integer                theIndex,
+                             NCollection_Vector<TopoDS_Shape>&     theShapes,
+                             NCollection_Vector<Standard_Integer>& theLinks,
+                             NCollection_Vector<Standard_Integer>& theLinkOrientations)
+{
+  for (TopoDS_Iterator anIt (theShape); anIt.More(); anIt.Next())
+  {
+    const TopoDS_Shape& aSubShape = anIt.Value();
+    const Standard_Integer* pIndex = myIndices.Seek (aSubShape);
+    const Standard_Integer aSubIndex = pIndex ? *pIndex : theShapes.Length() + 1;
+    theLinks.Append (theIndex);
+    theLinks.Append (aSubIndex);
+    theLinkOrientations.Append (theIndex);
+    theLinkOrientations.Append (aSubShape.Orientation());
+    if (!pIndex)
+    {
+      myIndices.Bind (aSubShape, aSubIndex);
+      theShapes.Append (aSubShape);
+      add (aSubShape, aSubIndex, theShapes, theLinks, theLinkOrientations);
+    }
+  }
+}
+
+//=======================================================================
+//function : checkShape
+//purpose  :
+//=======================================================================
+void TopExp_ShapeIndex::checkShape (const TopoDS_Shape& theShape) const
+{
+  (void )theShape;
+  Standard_ProgramError_Raise_if (theShape.TShape().get() != myTShape,
+                                  "TopExp_ShapeIndex: the shape does not share the indexed TShape");
+}
+
+//=======================================================================
+//function : isUpToDate
+//purpose  :
+//=======================================================================
+Standard_Boolean TopExp_ShapeIndex::isUpToDate (const TopoDS_Shape& theShape) const
+{
+  if (theShape.TShape().get() != myTShape
+   || theShape.ShapeType() != myRootType)
+  {
+    return Standard_False;
+  }
+
+  // The sub-shapes may be modified in place at any depth, so the children of each indexed shape
+  // are compared with the indexed ones; the shapes contained several times are checked once.
+  // The indexed sub-shapes keep their TShapes alive, so that the same addresses mean the same sub-shapes,
+  // and the index remains valid for the new TShape allocated at the address of the indexed one
+  // if all its sub-shapes are the same.
+  const TopoDS_Shape aRoot = theShape.Located (TopLoc_Location()).Oriented (TopAbs_FORWARD);
+  const Standard_Integer aNbShapes = Extent();
+  for (Standard_Integer anIndex = 1; anIndex <= aNbShapes; ++anIndex)
+  {
+    const TopoDS_Shape& aShape = anIndex == 1 ? aRoot : myShapes (anIndex);
+    const Standard_Integer aNbChildren = myChildren.Size (anIndex);
+    if (aShape.TShape()->NbChildren() != aNbChildren)
+    {
+      return Standard_False;
+    }
+
+    Standard_Integer aRank = 1;
+    for (TopoDS_Iterator anIt (aShape); anIt.More(); anIt.Next(), ++aRank)
+    {
+      // the sub-shape is indexed with the orientation of its first occurrence
+      if (!anIt.Value().IsSame (myShapes (myChildren.Value (anIndex, aRank)))
+        || anIt.Value().Orientation() != myChildOrientations.Value (anIndex, aRank))
+      {
+        return Standard_False;
+      }
+    }
+  }
+  return Standard_True;
+}
+
+//=======================================================================
+//function : Shape
+//purpose  :
+//=======================================================================
+TopoDS_Shape TopExp_ShapeIndex::Shape (const TopoDS_Shape&    theShape,
+                                       const Standard_Integer theIndex) const
+{
+  checkShape (theShape);
+  if (theIndex == 1)
+  {
+    return theShape;
+  }
+
+  TopoDS_Shape aSubShape = myShapes (theIndex);
+  if (!theShape.Location().IsIdentity())
+  {
+    aSubShape.Move (theShape.Location(), Standard_False);
+  }
+  if (theShape.Orientation() != TopAbs_FORWARD)
+  {
+    aSubShape.Orientation (TopAbs::Compose (aSubShape.Orientation(), theShape.Orientation()));
+  }
+  return aSubShape;
+}
+
+//=======================================================================
+//function : FindIndex
+//purpose  :
+//=======================================================================
+Standard_Integer TopExp_ShapeIndex::FindIndex (const TopoDS_Shape& theShape,
+                                               const TopoDS_Shape& theSubShape) const
+{
+  checkShape (theShape);
+  if (theSubShape.IsNull())
+  {
+    return 0;
+  }
+  if (theSubShape.TShape() == theShape.TShape())
+  {
+    return theSubShape.Location() == theShape.Location() ? 1 : 0;
+  }
+
+  const Standard_Integer* pIndex = NULL;
+  if (theShape.Location().IsIdentity())
+  {
+    pIndex = myIndices.Seek (theSubShape);
+  }
+  else
+  {
+    const TopoDS_Shape aSubShape = theSubShape.Located (theSubShape.Location().Predivided (theShape.Location()),
+                                                        Standard_False);
+    pIndex = myIndices.Seek (aSubShape);
+  }
+  return pIndex ? *pIndex : 0;
+}
+
+//=======================================================================
+//function : Ancestors
+//purpose  :
+//=======================================================================
+const TopExp_ShapeIndex::Table& TopExp_ShapeIndex::Ancestors (const TopAbs_ShapeEnum theType) const
+{
+  Standard_ProgramError_Raise_if (theType == TopAbs_SHAPE, "TopExp_ShapeIndex::Ancestors: wrong type");
+
+  Standard_Mutex::Sentry aSentry (myMutex);
+  Table& anAncestors = myAncestors[theType];
+  if (myHasAncestors[theType])
+  {
+    return anAncestors;
+  }
+
+  // Collect the pairs (sub-shape, ancestor) exploring each ancestor
+  const Standard_Integer aNbShapes = Extent();
+  NCollection_Array1<Standard_Integer> aMarks (1, aNbShapes);
+  aMarks.Init (0);
+  NCollection_Vector<Standard_Integer> aSubShapes;
+  NCollection_Vector<Standard_Integer> aPairs;
+  const Standard_Integer aNbAncestors = NbShapes (theType);
+  for (Standard_Integer i = 1; i <= aNbAncestors; ++i)
+  {
+    const Standard_Integer anAncestor = Index (theType, i);
+    aSubShapes.Clear();
+    collectSubShapes (myChildren, anAncestor, anAncestor, aMarks, aSubShapes);
+    for (NCollection_Vector<Standard_Integer>::Iterator anIt (aSubShapes); anIt.More(); anIt.Next())
+    {
+      aPairs.Append (anIt.Value());
+      aPairs.Append (anAncestor);
+    }
+  }
+
+  fillTable (aNbShapes, aPairs, anAncestors.myOffsets, anAncestors.myValues);
+  myHasAncestors[theType] = Standard_True;
+  return anAncestors;
+}
+
+//=======================================================================
+//function : MapShapes
+//purpose  :
+//=======================================================================
+void TopExp_ShapeIndex::MapShapes (const TopoDS_Shape&         theShape,
+                                   const TopAbs_ShapeEnum      theType,
+                                   TopTools_IndexedMapOfShape& theMap) const
+{
+  const Standard_Integer aNb = NbShapes (theType);
+  for (Standard_Integer i = 1; i <= aNb; ++i)
+  {
+    theMap.Add (Shape (theShape, Index (theType, i)));
+  }
+}
+
+//=======================================================================
+//function : MapShapesAndAncestors
+//purpose  :
+//=======================================================================
+void TopExp_ShapeIndex::MapShapesAndAncestors (const TopoDS_Shape&                        theShape,
+                                               const TopAbs_ShapeEnum                     theTS,
+                                               const TopAbs_ShapeEnum                     theTA,
+                                               TopTools_IndexedDataMapOfShapeListOfShape& theMap) const
+{
+  const TopTools_ListOfShape anEmptyList;
+  NCollection_Array1<Standard_Integer> aMarks (1, Extent());
+  aMarks.Init (0);
+  NCollection_Vector<Standard_Integer> aSubShapes;
+
+  // visit ancestors
+  const Standard_Integer aNbAncestors = NbShapes (theTA);
+  for (Standard_Integer i = 1; i <= aNbAncestors; ++i)
+  {
+    const Standard_Integer anAncestorIndex = Index (theTA, i);
+    const TopoDS_Shape anAncestor = Shape (theShape, anAncestorIndex);
+    aSubShapes.Clear();
+    collectSubShapes (myChildren, anAncestorIndex, anAncestorIndex, aMarks, aSubShapes);
+    for (NCollection_Vector<Standard_Integer>::Iterator anIt (aSubShapes); anIt.More(); anIt.Next())
+    {
+      if (ShapeType (anIt.Value()) != theTS)
+      {
+        continue;
+      }
+      const TopoDS_Shape aSubShape = Shape (theShape, anIt.Value());
+      Standard_Integer anIndex = theMap.FindIndex (aSubShape);
+      if (anIndex == 0)
+      {
+        anIndex = theMap.Add (aSubShape, anEmptyList);
+      }
+      theMap (anIndex).Append (anAncestor);
+    }
+  }
+
+  // visit shapes not under ancestors
+  const Standard_Integer aNbSubShapes = NbShapes (theTS);
+  for (Standard_Integer i = 1; i <= aNbSubShapes; ++i)
+  {
+    const TopoDS_Shape aSubShape = Shape (theShape, Index (theTS, i));
+    if (!theMap.Contains (aSubShape))
+    {
+      theMap.Add (aSubShape, anEmptyList);
+    }
+  }
+}
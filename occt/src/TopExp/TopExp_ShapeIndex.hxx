@@ -0,0 +1,200 @@
+// Created on: 2026-10-18
+//
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _TopExp_ShapeIndex_HeaderFile
+#define _TopExp_ShapeIndex_HeaderFile
+
+#include <NCollection_Array1.hxx>
+#include <NCollection_DataMap.hxx>
+#include <NCollection_Vector.hxx>
+#include <Standard_Mutex.hxx>
+#include <Standard_Transient.hxx>
+#include <TopAbs_ShapeEnum.hxx>
+#include <TopoDS_Shape.hxx>
+#include <TopTools_IndexedDataMapOfShapeListOfShape.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+#include <TopTools_ShapeMapHasher.hxx>
+
+class TopoDS_TShape;
+
+//! Immutable index of the sub-shapes of the shape.
+//!
+//! The index numbers all distinct sub-shapes (in the sense of IsSame()) of the shape
+//! in the order of their first appearance in the depth-first exploration of the shape,
+//! i.e. in the order of TopExp::MapShapes(). The shape itself has the index 1.
+//! The shapes of each type, the direct children of each shape and, on demand,
+//! the ancestors of the given type of each shape are kept in compressed tables
+//! of integer indices, so that repeated interrogations of the same shape do not
+//! need to explore the shape and to hash its sub-shapes again.
+//! As with TopExp_Explorer, the compounds contained in other compounds are indexed
+//! but not listed among the shapes of type TopAbs_COMPOUND.
+//!
+//! The index is built for the TShape of the shape, the sub-shapes are stored
+//! relatively to the TShape (with identity location and forward orientation of the shape).
+//! The methods returning the sub-shapes take the shape itself to apply its location and
+//! orientation, they may be used for any shape sharing the TShape.
+//!
+//! The index returned by Get() is kept in a small cache of the recently indexed TShapes
+//! shared by all threads; the TShapes themselves are not modified.
+//! Before reuse, the sub-shapes of the cached index are compared with the current sub-shapes
+//! of the TShape at all levels (e.g. adding an edge to a wire of the indexed solid is detected),
+//! and the index is rebuilt if they differ. This check visits each indexed sub-shape once
+//! without hashing, so it is much cheaper than the building of the index.
+//! The cached index keeps its sub-shapes alive until it is replaced by other shapes or released.
+//! The index can be used from several threads simultaneously.
+class TopExp_ShapeIndex : public Standard_Transient
+{
+public:
+
+  //! Compressed table of the lists of indices of the shapes.
+  class Table
+  {
+  public:
+
+    //! Returns the number of values for the shape with the given index.
+    Standard_Integer Size (const Standard_Integer theIndex) const
+    {
+      return myOffsets (theIndex + 1) - myOffsets (theIndex);
+    }
+
+    //! Returns the value with the given rank (from 1 to Size()) for the shape with the given index.
+    Standard_Integer Value (const Standard_Integer theIndex, const Standard_Integer theRank) const
+    {
+      return myValues (myOffsets (theIndex) + theRank - 1);
+    }
+
+  private:
+
+    friend class TopExp_ShapeIndex;
+
+    NCollection_Array1<Standard_Integer> myOffsets; //!< Positions of the lists in the values, indexed from 1 to NbShapes + 1
+    NCollection_Array1<Standard_Integer> myValues;  //!< Concatenated lists of values
+  };
+
+public:
+
+  //! Returns the cached index of the TShape of the shape,
+  //! builds and caches the index if it is absent or outdated.
+  Standard_EXPORT static Handle(TopExp_ShapeIndex) Get (const TopoDS_Shape& theShape);
+
+  //! Removes the index of the TShape of the shape from the cache,
+  //! or all cached indices if the shape is null.
+  Standard_EXPORT static void Release (const TopoDS_Shape& theShape);
+
+  //! Builds the index of the sub-shapes of the given shape.
+  //! The index is not cached.
+  Standard_EXPORT TopExp_ShapeIndex (const TopoDS_Shape& theShape);
+
+public: //! @name Interrogation
+
+  //! Returns the number of indexed shapes including the shape itself.
+  Standard_Integer Extent() const { return myShapes.Length(); }
+
+  //! Returns the type of the shape with the given index.
+  TopAbs_ShapeEnum ShapeType (const Standard_Integer theIndex) const
+  {
+    return theIndex == 1 ? myRootType : myShapes (theIndex).ShapeType();
+  }
+
+  //! Returns the number of sub-shapes of the given type (including the shape itself).
+  Standard_Integer NbShapes (const TopAbs_ShapeEnum theType) const
+  {
+    return myTypes.Size (theType + 1);
+  }
+
+  //! Returns the index of the sub-shape of the given type with the given rank (from 1 to NbShapes()).
+  Standard_Integer Index (const TopAbs_ShapeEnum theType,
+                          const Standard_Integer theRank) const
+  {
+    return myTypes.Value (theType + 1, theRank);
+  }
+
+  //! Returns the sub-shape with the given index of the given shape.
+  //! The shape should share the TShape for which the index is built.
+  Standard_EXPORT TopoDS_Shape Shape (const TopoDS_Shape&    theShape,
+                                      const Standard_Integer theIndex) const;
+
+  //! Returns the index of the sub-shape of the given shape, 0 if it is not found.
+  //! The shape should share the TShape for which the index is built.
+  Standard_EXPORT Standard_Integer FindIndex (const TopoDS_Shape& theShape,
+                                              const TopoDS_Shape& theSubShape) const;
+
+  //! Returns the table of the indices of the direct sub-shapes of each shape.
+  //! The sub-shapes are listed as many times as they are contained in the shape.
+  const Table& Children() const { return myChildren; }
+
+  //! Returns the table of the indices of the ancestors of the given type of each shape.
+  //! Each ancestor is listed once. The table is built on the first request.
+  Standard_EXPORT const Table& Ancestors (const TopAbs_ShapeEnum theType) const;
+
+public: //! @name Filling the maps
+
+  //! Stores in the map all the sub-shapes of the given type of the given shape
+  //! in the order of TopExp::MapShapes().
+  //! The shape should share the TShape for which the index is built.
+  Standard_EXPORT void MapShapes (const TopoDS_Shape&         theShape,
+                                  const TopAbs_ShapeEnum      theType,
+                                  TopTools_IndexedMapOfShape& theMap) const;
+
+  //! Stores in the map all the sub-shapes of the type <theTS> of the given shape and
+  //! binds them with the lists of their ancestors of the type <theTA>, as TopExp::MapShapesAndAncestors().
+  //! Contrary to TopExp::MapShapesAndAncestors() each ancestor is listed once.
+  //! The shape should share the TShape for which the index is built.
+  Standard_EXPORT void MapShapesAndAncestors (const TopoDS_Shape&                        theShape,
+                                              const TopAbs_ShapeEnum                     theTS,
+                                              const TopAbs_ShapeEnum                     theTA,
+                                              TopTools_IndexedDataMapOfShapeListOfShape& theMap) const;
+
+  DEFINE_STANDARD_RTTIEXT(TopExp_ShapeIndex, Standard_Transient)
+
+private:
+
+  //! Adds the sub-shapes of the shape with the given index recursively,
+  //! the pairs of indices of the shape and its children are appended to <theLinks>,
+  //! the pairs of the index of the shape and the orientations of its children to <theLinkOrientations>.
+  void add (const TopoDS_Shape&                    theShape,
+            const Standard_Integer                 theIndex,
+            NCollection_Vector<TopoDS_Shape>&      theShapes,
+            NCollection_Vector<Standard_Integer>&  theLinks,
+            NCollection_Vector<Standard_Integer>&  theLinkOrientations);
+
+  //! Checks that the shape shares the indexed TShape.
+  void checkShape (const TopoDS_Shape& theShape) const;
+
+  //! Returns TRUE if the sub-shapes of the TShape of the shape at all levels
+  //! are the same as at the time of building of the index.
+  Standard_Boolean isUpToDate (const TopoDS_Shape& theShape) const;
+
+private:
+
+  typedef NCollection_DataMap<TopoDS_Shape, Standard_Integer, TopTools_ShapeMapHasher> DataMapOfShapeInteger;
+
+private:
+
+  const TopoDS_TShape*               myTShape;     //!< Indexed TShape (not referenced to keep the cache from holding it)
+  TopAbs_ShapeEnum                   myRootType;   //!< Type of the indexed TShape
+  NCollection_Array1<TopoDS_Shape>   myShapes;     //!< Sub-shapes relative to the TShape, the first one (the shape itself) is null
+  DataMapOfShapeInteger              myIndices;    //!< Indices of the sub-shapes
+  Table                              myTypes;      //!< Indices of the shapes of each type
+  Table                              myChildren;   //!< Indices of the direct sub-shapes
+  Table                              myChildOrientations; //!< Orientations of the direct sub-shapes
+  mutable Table                      myAncestors[TopAbs_SHAPE]; //!< Indices of the ancestors of each type
+  mutable Standard_Boolean           myHasAncestors[TopAbs_SHAPE];
+  mutable Standard_Mutex             myMutex;
+};
+
+DEFINE_STANDARD_HANDLE(TopExp_ShapeIndex, Standard_Transient)
+
+#endif // _TopExp_ShapeIndex_HeaderFile
@@ -29,7 +29,8 @@ TopLoc_ItemLocation::TopLoc_ItemLocation
    const Standard_Integer P) :
   myDatum(D),
   myPower(P),
-  myTrsf (D->Transformation().Powered (P))
+  myTrsf (D->Transformation().Powered (P)),
+  myHash (0)
 {
 }
 
@@ -37,6 +37,8 @@ class TopLoc_Datum3D;
 //! * The exponent of the elementary Datum.
 //!
 //! * The transformation associated to the composition.
+//!
+//! * The hash code of the composition.
 class TopLoc_ItemLocation 
 {
 public:
@@ -69,6 +71,7 @@ private:
   Handle(TopLoc_Datum3D) myDatum;
   Standard_Integer myPower;
   gp_Trsf myTrsf;
+  unsigned int myHash;
 
 
 };
@@ -18,6 +18,7 @@
 
 
 #include <gp_Trsf.hxx>
+#include <NCollection_LocalArray.hxx>
 #include <Standard_Dump.hxx>
 #include <TopLoc_Datum3D.hxx>
 #include <TopLoc_Location.hxx>
@@ -105,20 +106,35 @@ TopLoc_Location TopLoc_Location::Multiplied(const TopLoc_Location& Other) const
   
   if (IsIdentity()) return Other;
   if (Other.IsIdentity()) return *this;
-  
-  // prepend the queue of Other
-  TopLoc_Location result = Multiplied(Other.NextLocation());
-  // does the head of Other cancel the head of result
-
-  Standard_Integer p = Other.FirstPower();
-  if (!result.IsIdentity()) {
-    if (Other.FirstDatum() == result.FirstDatum()) {
-      p += result.FirstPower();
-      result.myItems.ToTail();
+
+  // collect the items of Other to prepend them starting from the queue
+  Standard_Integer aNbItems = 0;
+  for (const TopLoc_Location* aLoc = &Other; !aLoc->IsIdentity(); aLoc = &aLoc->NextLocation())
+  {
+    ++aNbItems;
+  }
+  NCollection_LocalArray<const TopLoc_ItemLocation*, 16> anItems (aNbItems);
+  aNbItems = 0;
+  for (const TopLoc_Location* aLoc = &Other; !aLoc->IsIdentity(); aLoc = &aLoc->NextLocation())
+  {
+    anItems[aNbItems++] = &aLoc->myItems.Value();
+  }
+
+  TopLoc_Location result = *this;
+  for (Standard_Integer anIter = aNbItems - 1; anIter >= 0; --anIter)
+  {
+    // does the head of Other cancel the head of result
+    const TopLoc_ItemLocation& anItem = *anItems[anIter];
+    Standard_Integer p = anItem.myPower;
+    if (!result.IsIdentity()) {
+      if (anItem.myDatum == result.FirstDatum()) {
+        p += result.FirstPower();
+        result.myItems.ToTail();
+      }
     }
+    if (p != 0)
+      result.myItems.Construct(TopLoc_ItemLocation(anItem.myDatum,p));
   }
-  if (p != 0)
-    result.myItems.Construct(TopLoc_ItemLocation(Other.FirstDatum(),p));
   return result;
 }
 
@@ -172,31 +188,9 @@ TopLoc_Location TopLoc_Location::Powered (const Standard_Integer pwr) const
 //=======================================================================
 Standard_Integer TopLoc_Location::HashCode (const Standard_Integer theUpperBound) const
 {
-  // the HashCode computed for a Location is the bitwise exclusive or
-  // of values computed for each element of the list
-  // to compute this value, the depth of the element is computed 
-  // the depth is the position of the element in the list
-  // this depth is multiplied by 3
-  // each element is an elementary Datum raised to a Power
-  // the Power is bitwise left shifted by depth
-  // this is added to the HashCode of the Datum
-  // this value is biwise rotated by depth
-  // the use of depth avoids getting the same result for two permutated lists.
-
-  Standard_Integer           depth = 0;
-  unsigned int               h     = 0;
-  TopLoc_SListOfItemLocation items = myItems;
-  while (items.More())
-  {
-    depth += 3;
-    unsigned int           i             = ::HashCode (items.Value().myDatum, theUpperBound);
-    const Standard_Integer aClampedDepth = depth % 32;
-    unsigned int           j             = ((i + items.Value().myPower) << aClampedDepth);
-    j                                    = j >> (32 - aClampedDepth) | j << aClampedDepth;
-    h ^= j;
-    items.Next ();
-  }
-  return ::HashCode (h, theUpperBound);
+  // the hash code of the composition is computed on construction of each item of the list
+  // from the datum and the power of the item and the hash code of its tail
+  return ::HashCode (IsIdentity() ? 0u : myItems.Value().myHash, theUpperBound);
 }
 
 //=======================================================================
@@ -205,17 +199,23 @@ Standard_Integer TopLoc_Location::HashCode (const Standard_Integer theUpperBound
 //=======================================================================
 
 // two locations are Equal if the Items have the same LocalValues and Powers
-// this is a recursive function to test it
 
 Standard_Boolean TopLoc_Location::IsEqual (const TopLoc_Location& Other) const
 {
-  const void** p = (const void**) &myItems;
-  const void** q = (const void**) &Other.myItems;
-  if (*p            == *q                  ) {return Standard_True ; }
-  if (IsIdentity()  || Other.IsIdentity()  ) {return Standard_False; }
-  if (FirstDatum()  != Other.FirstDatum()  ) {return Standard_False; }
-  if (FirstPower()  != Other.FirstPower()  ) {return Standard_False; }
-  else { return NextLocation() == Other.NextLocation();}
+  const TopLoc_Location* aLoc1 = this;
+  const TopLoc_Location* aLoc2 = &Other;
+  for (;;)
+  {
+    const void** p = (const void**) &aLoc1->myItems;
+    const void** q = (const void**) &aLoc2->myItems;
+    if (*p                        == *q                              ) {return Standard_True ; }
+    if (aLoc1->IsIdentity()       || aLoc2->IsIdentity()             ) {return Standard_False; }
+    if (aLoc1->myItems.Value().myHash != aLoc2->myItems.Value().myHash) {return Standard_False; }
+    if (aLoc1->FirstDatum()       != aLoc2->FirstDatum()             ) {return Standard_False; }
+    if (aLoc1->FirstPower()       != aLoc2->FirstPower()             ) {return Standard_False; }
+    aLoc1 = &aLoc1->NextLocation();
+    aLoc2 = &aLoc2->NextLocation();
+  }
 }
 
 //=======================================================================
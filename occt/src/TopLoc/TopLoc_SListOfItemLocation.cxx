@@ -16,6 +16,7 @@
 
 
 #include <Standard_NoSuchObject.hxx>
+#include <TopLoc_Datum3D.hxx>
 #include <TopLoc_ItemLocation.hxx>
 #include <TopLoc_SListNodeOfItemLocation.hxx>
 #include <TopLoc_SListOfItemLocation.hxx>
@@ -28,10 +29,17 @@ TopLoc_SListOfItemLocation::TopLoc_SListOfItemLocation(const TopLoc_ItemLocation
 				     const TopLoc_SListOfItemLocation& aTail) : 
        myNode(new TopLoc_SListNodeOfItemLocation(anItem,aTail))
 {
+  // the hash code of the composition is computed from the hash code of the tail,
+  // the datum and the power; the rotation makes it depend on the order of the items
+  TopLoc_ItemLocation& anItemValue = myNode->Value();
+  unsigned int aHash = static_cast<unsigned int> (::HashCode (anItemValue.myDatum, IntegerLast()))
+                     + static_cast<unsigned int> (anItemValue.myPower) * 2654435761u;
   if (!myNode->Tail().IsEmpty()) {
-    const gp_Trsf& aT = myNode->Tail().Value().myTrsf;
-    myNode->Value().myTrsf.PreMultiply (aT);
+    const TopLoc_ItemLocation& aTailValue = myNode->Tail().Value();
+    anItemValue.myTrsf.PreMultiply (aTailValue.myTrsf);
+    aHash ^= (aTailValue.myHash << 5) | (aTailValue.myHash >> 27);
   }
+  anItemValue.myHash = aHash;
 }
 
 //=======================================================================
@@ -0,0 +1,29 @@
+// Created on: 2026-10-18
+//
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+
+#ifndef TopTools_FlatDataMapOfShapeInteger_HeaderFile
+#define TopTools_FlatDataMapOfShapeInteger_HeaderFile
+
+#include <TopoDS_Shape.hxx>
+#include <Standard_Integer.hxx>
+#include <TopTools_ShapeMapHasher.hxx>
+#include <NCollection_FlatDataMap.hxx>
+
+//! Map of shapes to integers with open addressing, alternative to TopTools_DataMapOfShapeInteger.
+//! It is faster to fill and to iterate, but not to look up (see NCollection_FlatDataMap);
+//! the order of iteration differs from TopTools_DataMapOfShapeInteger.
+typedef NCollection_FlatDataMap<TopoDS_Shape,Standard_Integer,TopTools_ShapeMapHasher> TopTools_FlatDataMapOfShapeInteger;
+typedef NCollection_FlatDataMap<TopoDS_Shape,Standard_Integer,TopTools_ShapeMapHasher>::Iterator TopTools_FlatDataMapIteratorOfFlatDataMapOfShapeInteger;
+
+#endif
@@ -0,0 +1,608 @@
+// Created on: 2026-10-18
+//
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <gp_XYZBatch.hxx>
+
+#include <gp_Trsf.hxx>
+#include <Standard.hxx>
+#include <Standard_OutOfMemory.hxx>
+
+#include <cmath>
+
+#if defined(__AVX__)
+  #include <immintrin.h>
+  #define GP_XYZBATCH_AVX
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+  #include <emmintrin.h>
+  #define GP_XYZBATCH_SSE2
+#elif defined(__wasm_simd128__)
+  #include <wasm_simd128.h>
+  #define GP_XYZBATCH_SIMD128
+#endif
+
+namespace
+{
+  //! Maximal number of values in SIMD register; the capacity of the batch is multiple of it
+  static const Standard_Integer THE_MAX_WIDTH = 4;
+
+  //! Alignment of the arrays of components
+  static const Standard_Size THE_ALIGNMENT = 32;
+
+  //! Operations on single value, used for processing of the elements remaining after SIMD loop.
+  //! Min() and Max() return the second argument if any of them is NaN, as SSE instructions.
+  struct ScalarPack
+  {
+    typedef Standard_Real Type;
+    typedef bool          Mask;
+    enum { Width = 1 };
+
+    static Type Load  (const Standard_Real* theData) { return *theData; }
+    static void Store (Standard_Real* theData, const Type theValue) { *theData = theValue; }
+    static Type Set   (const Standard_Real theValue) { return theValue; }
+    static Type Add   (const Type theA, const Type theB) { return theA + theB; }
+    static Type Sub   (const Type theA, const Type theB) { return theA - theB; }
+    static Type Mul   (const Type theA, const Type theB) { return theA * theB; }
+    static Type Div   (const Type theA, const Type theB) { return theA / theB; }
+    static Type Min   (const Type theA, const Type theB) { return theA < theB ? theA : theB; }
+    static Type Max   (const Type theA, const Type theB) { return theA > theB ? theA : theB; }
+    static Type Sqrt  (const Type theA)                  { return std::sqrt (theA); }
+    static Mask Greater (const Type theA, const Type theB) { return theA > theB; }
+    static Type Select  (const Mask theMask, const Type theA, const Type theB) { return theMask ? theA : theB; }
+  };
+
+#if defined(GP_XYZBATCH_AVX)
+  //! Operations on 4 values in AVX register.
+  struct SimdPack
+  {
+    typedef __m256d Type;
+    typedef __m256d Mask;
+    enum { Width = 4 };
+
+    static Type Load  (const Standard_Real* theData) { return _mm256_loadu_pd (theData); }
+    static void Store (Standard_Real* theData, const Type theValue) { _mm256_storeu_pd (theData, theValue); }
+    static Type Set   (const Standard_Real theValue) { return _mm256_set1_pd (theValue); }
+    static Type Add   (const Type theA, const Type theB) { return _mm256_add_pd (theA, theB); }
+    static Type Sub   (const Type theA, const Type theB) { return _mm256_sub_pd (theA, theB); }
+    static Type Mul   (const Type theA, const Type theB) { return _mm256_mul_pd (theA, theB); }
+    static Type Div   (const Type theA, const Type theB) { return _mm256_div_pd (theA, theB); }
+    static Type Min   (const Type theA, const Type theB) { return _mm256_min_pd (theA, theB); }
+    static Type Max   (const Type theA, const Type theB) { return _mm256_max_pd (theA, theB); }
+    static Type Sqrt  (const Type theA)                  { return _mm256_sqrt_pd (theA); }
+    static Mask Greater (const Type theA, const Type theB) { return _mm256_cmp_pd (theA, theB, _CMP_GT_OQ); }
+    static Type Select  (const Mask theMask, const Type theA, const Type theB) { return _mm256_blendv_pd (theB, theA, theMask); }
+  };
+#elif defined(GP_XYZBATCH_SSE2)
+  //! Operations on 2 values in SSE2 register.
+  struct SimdPack
+  {
+    typedef __m128d Type;
+    typedef __m128d Mask;
+    enum { Width = 2 };
+
+    static Type Load  (const Standard_Real* theData) { return _mm_loadu_pd (theData); }
+    static void Store (Standard_Real* theData, const Type theValue) { _mm_storeu_pd (theData, theValue); }
+    static Type Set   (const Standard_Real theValue) { return _mm_set1_pd (theValue); }
+    static Type Add   (const Type theA, const Type theB) { return _mm_add_pd (theA, theB); }
+    static Type Sub   (const Type theA, const Type theB) { return _mm_sub_pd (theA, theB); }
+    static Type Mul   (const Type theA, const Type theB) { return _mm_mul_pd (theA, theB); }
+    static Type Div   (const Type theA, const Type theB) { return _mm_div_pd (theA, theB); }
+    static Type Min   (const Type theA, const Type theB) { return _mm_min_pd (theA, theB); }
+    static Type Max   (const Type theA, const Type theB) { return _mm_max_pd (theA, theB); }
+    static Type Sqrt  (const Type theA)                  { return _mm_sqrt_pd (theA); }
+    static Mask Greater (const Type theA, const Type theB) { return _mm_cmpgt_pd (theA, theB); }
+    static Type Select  (const Mask theMask, const Type theA, const Type theB)
+    {
+      return _mm_or_pd (_mm_and_pd (theMask, theA), _mm_andnot_pd (theMask, theB));
+    }
+  };
+#elif defined(GP_XYZBATCH_SIMD128)
+  //! Operations on 2 values in WebAssembly SIMD128 register.
+  struct SimdPack
+  {
+    typedef v128_t Type;
+    typedef v128_t Mask;
+    enum { Width = 2 };
+
+    static Type Load  (const Standard_Real* theData) { return wasm_v128_load (theData); }
+    static void Store (Standard_Real* theData, const Type theValue) { wasm_v128_store (theData, theValue); }
+    static Type Set   (const Standard_Real theValue) { return wasm_f64x2_splat (theValue); }
+    static Type Add   (const Type theA, const Type theB) { return wasm_f64x2_add (theA, theB); }
+    static Type Sub   (const Type theA, const Type theB) { return wasm_f64x2_sub (theA, theB); }
+    static Type Mul   (const Type theA, const Type theB) { return wasm_f64x2_mul (theA, theB); }
+    static Type Div   (const Type theA, const Type theB) { return wasm_f64x2_div (theA, theB); }
+    static Type Min   (const Type theA, const Type theB) { return wasm_f64x2_pmin (theB, theA); }
+    static Type Max   (const Type theA, const Type theB) { return wasm_f64x2_pmax (theB, theA); }
+    static Type Sqrt  (const Type theA)                  { return wasm_f64x2_sqrt (theA); }
+    static Mask Greater (const Type theA, const Type theB) { return wasm_f64x2_gt (theA, theB); }
+    static Type Select  (const Mask theMask, const Type theA, const Type theB) { return wasm_v128_bitselect (theA, theB, theMask); }
+  };
+#else
+  typedef ScalarPack SimdPack;
+#endif
+
+  //! Performs the kernel on the elements [0, theNb):
+  //! by SIMD instructions on the most of elements, and by scalar code on the remaining ones.
+  template<class Kernel>
+  static void performKernel (Kernel& theKernel, const Standard_Integer theNb)
+  {
+    const Standard_Integer aNbSimd = theNb - theNb % (Standard_Integer )SimdPack::Width;
+    theKernel.template Perform<SimdPack>   (0, aNbSimd);
+    theKernel.template Perform<ScalarPack> (aNbSimd, theNb);
+  }
+
+  //! Kernel transforming the points by the matrix, scale factor and translation.
+  struct TransformKernel
+  {
+    Standard_Real* X;
+    Standard_Real* Y;
+    Standard_Real* Z;
+    Standard_Real  Matrix[3][3];
+    Standard_Real  Scale;
+    Standard_Real  Translation[3];
+
+    template<class Pack>
+    void Perform (const Standard_Integer theFrom, const Standard_Integer theTo)
+    {
+      typedef typename Pack::Type Type;
+      const Type aM11 = Pack::Set (Matrix[0][0]), aM12 = Pack::Set (Matrix[0][1]), aM13 = Pack::Set (Matrix[0][2]);
+      const Type aM21 = Pack::Set (Matrix[1][0]), aM22 = Pack::Set (Matrix[1][1]), aM23 = Pack::Set (Matrix[1][2]);
+      const Type aM31 = Pack::Set (Matrix[2][0]), aM32 = Pack::Set (Matrix[2][1]), aM33 = Pack::Set (Matrix[2][2]);
+      const Type aScale = Pack::Set (Scale);
+      const Type aTx = Pack::Set (Translation[0]), aTy = Pack::Set (Translation[1]), aTz = Pack::Set (Translation[2]);
+      for (Standard_Integer anIter = theFrom; anIter < theTo; anIter += Pack::Width)
+      {
+        const Type aX = Pack::Load (X + anIter);
+        const Type aY = Pack::Load (Y + anIter);
+        const Type aZ = Pack::Load (Z + anIter);
+        const Type aResX = Pack::Add (Pack::Add (Pack::Mul (aM11, aX), Pack::Mul (aM12, aY)), Pack::Mul (aM13, aZ));
+        const Type aResY = Pack::Add (Pack::Add (Pack::Mul (aM21, aX), Pack::Mul (aM22, aY)), Pack::Mul (aM23, aZ));
+        const Type aResZ = Pack::Add (Pack::Add (Pack::Mul (aM31, aX), Pack::Mul (aM32, aY)), Pack::Mul (aM33, aZ));
+        Pack::Store (X + anIter, Pack::Add (Pack::Mul (aResX, aScale), aTx));
+        Pack::Store (Y + anIter, Pack::Add (Pack::Mul (aResY, aScale), aTy));
+        Pack::Store (Z + anIter, Pack::Add (Pack::Mul (aResZ, aScale), aTz));
+      }
+    }
+  };
+
+  //! Kernel translating the points.
+  struct TranslateKernel
+  {
+    Standard_Real* X;
+    Standard_Real* Y;
+    Standard_Real* Z;
+    Standard_Real  Translation[3];
+
+    template<class Pack>
+    void Perform (const Standard_Integer theFrom, const Standard_Integer theTo)
+    {
+      typedef typename Pack::Type Type;
+      const Type aTx = Pack::Set (Translation[0]), aTy = Pack::Set (Translation[1]), aTz = Pack::Set (Translation[2]);
+      for (Standard_Integer anIter = theFrom; anIter < theTo; anIter += Pack::Width)
+      {
+        Pack::Store (X + anIter, Pack::Add (Pack::Load (X + anIter), aTx));
+        Pack::Store (Y + anIter, Pack::Add (Pack::Load (Y + anIter), aTy));
+        Pack::Store (Z + anIter, Pack::Add (Pack::Load (Z + anIter), aTz));
+      }
+    }
+  };
+
+  //! Kernel computing minimal and maximal coordinates.
+  struct BoundsKernel
+  {
+    const Standard_Real* X;
+    const Standard_Real* Y;
+    const Standard_Real* Z;
+    Standard_Real Min[3];
+    Standard_Real Max[3];
+
+    template<class Pack>
+    void Perform (const Standard_Integer theFrom, const Standard_Integer theTo)
+    {
+      typedef typename Pack::Type Type;
+      Type aMinX = Pack::Set (Min[0]), aMinY = Pack::Set (Min[1]), aMinZ = Pack::Set (Min[2]);
+      Type aMaxX = Pack::Set (Max[0]), aMaxY = Pack::Set (Max[1]), aMaxZ = Pack::Set (Max[2]);
+      for (Standard_Integer anIter = theFrom; anIter < theTo; anIter += Pack::Width)
+      {
+        const Type aX = Pack::Load (X + anIter);
+        const Type aY = Pack::Load (Y + anIter);
+        const Type aZ = Pack::Load (Z + anIter);
+        aMinX = Pack::Min (aX, aMinX); aMaxX = Pack::Max (aX, aMaxX);
+        aMinY = Pack::Min (aY, aMinY); aMaxY = Pack::Max (aY, aMaxY);
+        aMinZ = Pack::Min (aZ, aMinZ); aMaxZ = Pack::Max (aZ, aMaxZ);
+      }
+
+      Standard_Real aLanes[6][Pack::Width];
+      Pack::Store (aLanes[0], aMinX); Pack::Store (aLanes[1], aMinY); Pack::Store (aLanes[2], aMinZ);
+      Pack::Store (aLanes[3], aMaxX); Pack::Store (aLanes[4], aMaxY); Pack::Store (aLanes[5], aMaxZ);
+      for (int aLaneIter = 0; aLaneIter < Pack::Width; ++aLaneIter)
+      {
+        for (int aDim = 0; aDim < 3; ++aDim)
+        {
+          Min[aDim] = ScalarPack::Min (aLanes[aDim][aLaneIter],     Min[aDim]);
+          Max[aDim] = ScalarPack::Max (aLanes[aDim + 3][aLaneIter], Max[aDim]);
+        }
+      }
+    }
+  };
+
+  //! Kernel computing square distances (or distances) to the point.
+  struct DistanceKernel
+  {
+    const Standard_Real* X;
+    const Standard_Real* Y;
+    const Standard_Real* Z;
+    Standard_Real*       Result;
+    Standard_Real        Point[3];
+    bool                 ToSqrt;
+
+    template<class Pack>
+    void Perform (const Standard_Integer theFrom, const Standard_Integer theTo)
+    {
+      typedef typename Pack::Type Type;
+      const Type aPx = Pack::Set (Point[0]), aPy = Pack::Set (Point[1]), aPz = Pack::Set (Point[2]);
+      for (Standard_Integer anIter = theFrom; anIter < theTo; anIter += Pack::Width)
+      {
+        const Type aDx = Pack::Sub (Pack::Load (X + anIter), aPx);
+        const Type aDy = Pack::Sub (Pack::Load (Y + anIter), aPy);
+        const Type aDz = Pack::Sub (Pack::Load (Z + anIter), aPz);
+        const Type aSqDist = Pack::Add (Pack::Add (Pack::Mul (aDx, aDx), Pack::Mul (aDy, aDy)), Pack::Mul (aDz, aDz));
+        Pack::Store (Result + anIter, ToSqrt ? Pack::Sqrt (aSqDist) : aSqDist);
+      }
+    }
+  };
+
+  //! Kernel searching for the nearest element to the point.
+  //! The minimal square distance is computed for blocks of elements,
+  //! and the index is searched within the block only when the block improves the minimum.
+  struct NearestKernel
+  {
+    const Standard_Real* X;
+    const Standard_Real* Y;
+    const Standard_Real* Z;
+    Standard_Real        Point[3];
+    Standard_Real        MinSqDist;
+    Standard_Integer     MinIndex;
+
+    //! Number of elements in the block, multiple of any SIMD width
+    enum { BlockSize = 256 };
+
+    template<class Pack>
+    typename Pack::Type squareDistance (const Standard_Integer theIndex,
+                                        const typename Pack::Type& thePx,
+                                        const typename Pack::Type& thePy,
+                                        const typename Pack::Type& thePz) const
+    {
+      typedef typename Pack::Type Type;
+      const Type aDx = Pack::Sub (Pack::Load (X + theIndex), thePx);
+      const Type aDy = Pack::Sub (Pack::Load (Y + theIndex), thePy);
+      const Type aDz = Pack::Sub (Pack::Load (Z + theIndex), thePz);
+      return Pack::Add (Pack::Add (Pack::Mul (aDx, aDx), Pack::Mul (aDy, aDy)), Pack::Mul (aDz, aDz));
+    }
+
+    template<class Pack>
+    void Perform (const Standard_Integer theFrom, const Standard_Integer theTo)
+    {
+      typedef typename Pack::Type Type;
+      const Type aPx = Pack::Set (Point[0]), aPy = Pack::Set (Point[1]), aPz = Pack::Set (Point[2]);
+      Standard_Real aLanes[Pack::Width];
+      for (Standard_Integer aBlockStart = theFrom; aBlockStart < theTo; aBlockStart += BlockSize)
+      {
+        const Standard_Integer aBlockEnd = Min (aBlockStart + (Standard_Integer )BlockSize, theTo);
+        Type aMin = Pack::Set (MinSqDist);
+        for (Standard_Integer anIter = aBlockStart; anIter < aBlockEnd; anIter += Pack::Width)
+        {
+          aMin = Pack::Min (squareDistance<Pack> (anIter, aPx, aPy, aPz), aMin);
+        }
+
+        Pack::Store (aLanes, aMin);
+        Standard_Real aBlockMin = MinSqDist;
+        for (int aLaneIter = 0; aLaneIter < Pack::Width; ++aLaneIter)
+        {
+          aBlockMin = ScalarPack::Min (aLanes[aLaneIter], aBlockMin);
+        }
+        if (!(aBlockMin < MinSqDist))
+        {
+          continue;
+        }
+
+        // find the first element of the block with the minimal distance
+        for (Standard_Integer anIter = aBlockStart; anIter < aBlockEnd; anIter += Pack::Width)
+        {
+          Pack::Store (aLanes, squareDistance<Pack> (anIter, aPx, aPy, aPz));
+          for (int aLaneIter = 0; aLaneIter < Pack::Width; ++aLaneIter)
+          {
+            if (aLanes[aLaneIter] == aBlockMin)
+            {
+              MinSqDist = aBlockMin;
+              MinIndex  = anIter + aLaneIter;
+              anIter    = aBlockEnd;
+              break;
+            }
+          }
+        }
+      }
+    }
+  };
+
+  //! Kernel computing cross products.
+  struct CrossKernel
+  {
+    const Standard_Real* LeftX;
+    const Standard_Real* LeftY;
+    const Standard_Real* LeftZ;
+    const Standard_Real* RightX;
+    const Standard_Real* RightY;
+    const Standard_Real* RightZ;
+    Standard_Real*       X;
+    Standard_Real*       Y;
+    Standard_Real*       Z;
+
+    template<class Pack>
+    void Perform (const Standard_Integer theFrom, const Standard_Integer theTo)
+    {
+      typedef typename Pack::Type Type;
+      for (Standard_Integer anIter = theFrom; anIter < theTo; anIter += Pack::Width)
+      {
+        const Type aLx = Pack::Load (LeftX  + anIter), aLy = Pack::Load (LeftY  + anIter), aLz = Pack::Load (LeftZ  + anIter);
+        const Type aRx = Pack::Load (RightX + anIter), aRy = Pack::Load (RightY + anIter), aRz = Pack::Load (RightZ + anIter);
+        Pack::Store (X + anIter, Pack::Sub (Pack::Mul (aLy, aRz), Pack::Mul (aLz, aRy)));
+        Pack::Store (Y + anIter, Pack::Sub (Pack::Mul (aLz, aRx), Pack::Mul (aLx, aRz)));
+        Pack::Store (Z + anIter, Pack::Sub (Pack::Mul (aLx, aRy), Pack::Mul (aLy, aRx)));
+      }
+    }
+  };
+
+  //! Kernel normalizing the vectors.
+  struct NormalizeKernel
+  {
+    Standard_Real* X;
+    Standard_Real* Y;
+    Standard_Real* Z;
+    Standard_Real  NbNull;
+
+    template<class Pack>
+    void Perform (const Standard_Integer theFrom, const Standard_Integer theTo)
+    {
+      typedef typename Pack::Type Type;
+      const Type aResolution = Pack::Set (gp::Resolution());
+      const Type aZero = Pack::Set (0.0), anOne = Pack::Set (1.0);
+      Type aNbNull = aZero;
+      for (Standard_Integer anIter = theFrom; anIter < theTo; anIter += Pack::Width)
+      {
+        const Type aX = Pack::Load (X + anIter);
+        const Type aY = Pack::Load (Y + anIter);
+        const Type aZ = Pack::Load (Z + anIter);
+        const Type aModulus = Pack::Sqrt (Pack::Add (Pack::Add (Pack::Mul (aX, aX), Pack::Mul (aY, aY)), Pack::Mul (aZ, aZ)));
+        const typename Pack::Mask isValid = Pack::Greater (aModulus, aResolution);
+        Pack::Store (X + anIter, Pack::Select (isValid, Pack::Div (aX, aModulus), aX));
+        Pack::Store (Y + anIter, Pack::Select (isValid, Pack::Div (aY, aModulus), aY));
+        Pack::Store (Z + anIter, Pack::Select (isValid, Pack::Div (aZ, aModulus), aZ));
+        aNbNull = Pack::Add (aNbNull, Pack::Select (isValid, aZero, anOne));
+      }
+
+      Standard_Real aLanes[Pack::Width];
+      Pack::Store (aLanes, aNbNull);
+      for (int aLaneIter = 0; aLaneIter < Pack::Width; ++aLaneIter)
+      {
+        NbNull += aLanes[aLaneIter];
+      }
+    }
+  };
+}
+
+//=======================================================================
+//function : ~gp_XYZBatch
+//purpose  :
+//=======================================================================
+gp_XYZBatch::~gp_XYZBatch()
+{
+  Standard::FreeAligned (myData);
+}
+
+//=======================================================================
+//function : Resize
+//purpose  :
+//=======================================================================
+void gp_XYZBatch::Resize (const Standard_Integer theSize)
+{
+  Standard_OutOfRange_Raise_if (theSize < 0, "gp_XYZBatch::Resize() - negative size");
+  if (theSize > myCapacity)
+  {
+    const Standard_Integer aCapacity = (theSize + THE_MAX_WIDTH - 1) / THE_MAX_WIDTH * THE_MAX_WIDTH;
+    Standard_Real* aData = (Standard_Real* )Standard::AllocateAligned (3 * (Standard_Size )aCapacity * sizeof(Standard_Real), THE_ALIGNMENT);
+    if (aData == NULL)
+    {
+      throw Standard_OutOfMemory ("gp_XYZBatch::Resize() - out of memory");
+    }
+    Standard::FreeAligned (myData);
+    myData     = aData;
+    myCapacity = aCapacity;
+  }
+  mySize = theSize;
+}
+
+//=======================================================================
+//function : Assign
+//purpose  :
+//=======================================================================
+void gp_XYZBatch::Assign (const gp_Pnt* thePoints, const Standard_Integer theNbPoints)
+{
+  Resize (theNbPoints);
+  Standard_Real* anX = ChangeX();
+  Standard_Real* anY = ChangeY();
+  Standard_Real* aZ  = ChangeZ();
+  for (Standard_Integer anIter = 0; anIter < theNbPoints; ++anIter)
+  {
+    const gp_XYZ& aCoord = thePoints[anIter].XYZ();
+    anX[anIter] = aCoord.X();
+    anY[anIter] = aCoord.Y();
+    aZ [anIter] = aCoord.Z();
+  }
+}
+
+//=======================================================================
+//function : CopyTo
+//purpose  :
+//=======================================================================
+void gp_XYZBatch::CopyTo (gp_Pnt* thePoints) const
+{
+  const Standard_Real* anX = X();
+  const Standard_Real* anY = Y();
+  const Standard_Real* aZ  = Z();
+  for (Standard_Integer anIter = 0; anIter < mySize; ++anIter)
+  {
+    thePoints[anIter].SetCoord (anX[anIter], anY[anIter], aZ[anIter]);
+  }
+}
+
+//=======================================================================
+//function : Transform
+//purpose  :
+//=======================================================================
+void gp_XYZBatch::Transform (const gp_Trsf& theTrsf)
+{
+  if (theTrsf.Form() == gp_Identity)
+  {
+    return;
+  }
+
+  const gp_XYZ& aLoc = theTrsf.TranslationPart();
+  if (theTrsf.Form() == gp_Translation)
+  {
+    TranslateKernel aKernel = { ChangeX(), ChangeY(), ChangeZ(), { aLoc.X(), aLoc.Y(), aLoc.Z() } };
+    performKernel (aKernel, mySize);
+    return;
+  }
+
+  // same sequence of operations as gp_Trsf::Transforms()
+  TransformKernel aKernel;
+  aKernel.X = ChangeX();
+  aKernel.Y = ChangeY();
+  aKernel.Z = ChangeZ();
+  const gp_Mat& aMat = theTrsf.HVectorialPart();
+  for (int aRow = 0; aRow < 3; ++aRow)
+  {
+    for (int aCol = 0; aCol < 3; ++aCol)
+    {
+      aKernel.Matrix[aRow][aCol] = aMat.Value (aRow + 1, aCol + 1);
+    }
+    aKernel.Translation[aRow] = aLoc.Coord (aRow + 1);
+  }
+  aKernel.Scale = theTrsf.ScaleFactor();
+  performKernel (aKernel, mySize);
+}
+
+//=======================================================================
+//function : Multiply
+//purpose  :
+//=======================================================================
+void gp_XYZBatch::Multiply (const gp_Mat& theMatrix)
+{
+  TransformKernel aKernel;
+  aKernel.X = ChangeX();
+  aKernel.Y = ChangeY();
+  aKernel.Z = ChangeZ();
+  for (int aRow = 0; aRow < 3; ++aRow)
+  {
+    for (int aCol = 0; aCol < 3; ++aCol)
+    {
+      aKernel.Matrix[aRow][aCol] = theMatrix.Value (aRow + 1, aCol + 1);
+    }
+    aKernel.Translation[aRow] = 0.0;
+  }
+  aKernel.Scale = 1.0;
+  performKernel (aKernel, mySize);
+}
+
+//=======================================================================
+//function : BoundingBox
+//purpose  :
+//=======================================================================
+Standard_Boolean gp_XYZBatch::BoundingBox (gp_XYZ& theMin,
+                                           gp_XYZ& theMax) const
+{
+  if (mySize == 0)
+  {
+    return Standard_False;
+  }
+
+  const Standard_Real aLast = RealLast();
+  BoundsKernel aKernel = { X(), Y(), Z(), { aLast, aLast, aLast }, { -aLast, -aLast, -aLast } };
+  performKernel (aKernel, mySize);
+  theMin.SetCoord (aKernel.Min[0], aKernel.Min[1], aKernel.Min[2]);
+  theMax.SetCoord (aKernel.Max[0], aKernel.Max[1], aKernel.Max[2]);
+  return Standard_True;
+}
+
+//=======================================================================
+//function : SquareDistances
+//purpose  :
+//=======================================================================
+void gp_XYZBatch::SquareDistances (const gp_XYZ& thePoint,
+                                   Standard_Real* theDistances) const
+{
+  DistanceKernel aKernel = { X(), Y(), Z(), theDistances, { thePoint.X(), thePoint.Y(), thePoint.Z() }, false };
+  performKernel (aKernel, mySize);
+}
+
+//=======================================================================
+//function : Distances
+//purpose  :
+//=======================================================================
+void gp_XYZBatch::Distances (const gp_XYZ& thePoint,
+                             Standard_Real* theDistances) const
+{
+  DistanceKernel aKernel = { X(), Y(), Z(), theDistances, { thePoint.X(), thePoint.Y(), thePoint.Z() }, true };
+  performKernel (aKernel, mySize);
+}
+
+//=======================================================================
+//function : MinSquareDistance
+//purpose  :
+//=======================================================================
+Standard_Real gp_XYZBatch::MinSquareDistance (const gp_XYZ& thePoint,
+                                              Standard_Integer& theIndex) const
+{
+  NearestKernel aKernel = { X(), Y(), Z(), { thePoint.X(), thePoint.Y(), thePoint.Z() }, RealLast(), -1 };
+  performKernel (aKernel, mySize);
+  theIndex = aKernel.MinIndex;
+  return aKernel.MinSqDist;
+}
+
+//=======================================================================
+//function : Cross
+//purpose  :
+//=======================================================================
+void gp_XYZBatch::Cross (const gp_XYZBatch& theLeft,
+                         const gp_XYZBatch& theRight)
+{
+  Standard_DimensionMismatch_Raise_if (theLeft.Size() != theRight.Size(), "gp_XYZBatch::Cross() - batches of different size");
+  Resize (theLeft.Size());
+  CrossKernel aKernel = { theLeft.X(),  theLeft.Y(),  theLeft.Z(),
+                          theRight.X(), theRight.Y(), theRight.Z(),
+                          ChangeX(), ChangeY(), ChangeZ() };
+  performKernel (aKernel, mySize);
+}
+
+//=======================================================================
+//function : Normalize
+//purpose  :
+//=======================================================================
+Standard_Integer gp_XYZBatch::Normalize()
+{
+  NormalizeKernel aKernel = { ChangeX(), ChangeY(), ChangeZ(), 0.0 };
+  performKernel (aKernel, mySize);
+  return (Standard_Integer )aKernel.NbNull;
+}
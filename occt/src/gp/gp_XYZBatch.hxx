@@ -0,0 +1,184 @@
+// Created on: 2026-10-18
+//
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _gp_XYZBatch_HeaderFile
+#define _gp_XYZBatch_HeaderFile
+
+#include <gp_XYZ.hxx>
+#include <Standard_DefineAlloc.hxx>
+#include <Standard_DimensionMismatch.hxx>
+#include <TColgp_Array1OfPnt.hxx>
+
+class gp_Trsf;
+
+//! Batch of 3D coordinates (points or vectors) stored as structure of arrays:
+//! X, Y and Z components of all elements are kept in three separate aligned arrays.
+//!
+//! The batch operations (transformation, bounding box, distances, cross products, normalization)
+//! process several elements at once using SIMD instructions available at compilation time
+//! (SSE2 or AVX on x86, SIMD128 on WebAssembly), and scalar code otherwise.
+//! The results are the same as of the corresponding operations of gp_XYZ applied to each element
+//! (up to rounding when the compiler contracts the scalar operations).
+//!
+//! The elements are indexed from 0.
+//! The arrays of points (TColgp_Array1OfPnt, Poly_ArrayOfNodes) are converted into the batch
+//! and back by Assign() and CopyTo(), so that the algorithms processing many points
+//! can adopt the batch operations locally.
+class gp_XYZBatch
+{
+public:
+
+  DEFINE_STANDARD_ALLOC
+
+  //! Creates an empty batch.
+  gp_XYZBatch() : myData (NULL), mySize (0), myCapacity (0) {}
+
+  //! Creates the batch of the given size; the elements are not initialized.
+  explicit gp_XYZBatch (const Standard_Integer theSize)
+  : myData (NULL), mySize (0), myCapacity (0)
+  {
+    Resize (theSize);
+  }
+
+  //! Creates the batch from the array of points.
+  explicit gp_XYZBatch (const TColgp_Array1OfPnt& thePoints)
+  : myData (NULL), mySize (0), myCapacity (0)
+  {
+    Assign (thePoints);
+  }
+
+  //! Destructor.
+  Standard_EXPORT ~gp_XYZBatch();
+
+  //! Returns the number of elements.
+  Standard_Integer Size() const { return mySize; }
+
+  //! Returns TRUE if the batch is empty.
+  Standard_Boolean IsEmpty() const { return mySize == 0; }
+
+  //! Sets the number of elements; the memory is reallocated only when the capacity is exceeded,
+  //! the elements are not preserved in this case.
+  Standard_EXPORT void Resize (const Standard_Integer theSize);
+
+  //! Returns the array of X components.
+  const Standard_Real* X() const { return myData; }
+
+  //! Returns the array of Y components.
+  const Standard_Real* Y() const { return myData + myCapacity; }
+
+  //! Returns the array of Z components.
+  const Standard_Real* Z() const { return myData + 2 * myCapacity; }
+
+  //! Returns the modifiable array of X components.
+  Standard_Real* ChangeX() { return myData; }
+
+  //! Returns the modifiable array of Y components.
+  Standard_Real* ChangeY() { return myData + myCapacity; }
+
+  //! Returns the modifiable array of Z components.
+  Standard_Real* ChangeZ() { return myData + 2 * myCapacity; }
+
+  //! Returns the element.
+  gp_XYZ Value (const Standard_Integer theIndex) const
+  {
+    Standard_OutOfRange_Raise_if (theIndex < 0 || theIndex >= mySize, "gp_XYZBatch::Value() - index is out of range");
+    return gp_XYZ (X()[theIndex], Y()[theIndex], Z()[theIndex]);
+  }
+
+  //! Sets the element.
+  void SetValue (const Standard_Integer theIndex, const gp_XYZ& theValue)
+  {
+    Standard_OutOfRange_Raise_if (theIndex < 0 || theIndex >= mySize, "gp_XYZBatch::SetValue() - index is out of range");
+    ChangeX()[theIndex] = theValue.X();
+    ChangeY()[theIndex] = theValue.Y();
+    ChangeZ()[theIndex] = theValue.Z();
+  }
+
+public: //! @name conversion from/to arrays of points
+
+  //! Fills the batch by the points; the batch is resized to the number of points.
+  Standard_EXPORT void Assign (const gp_Pnt* thePoints, const Standard_Integer theNbPoints);
+
+  //! Fills the batch by the points of the array; the batch is resized to the length of the array.
+  void Assign (const TColgp_Array1OfPnt& thePoints)
+  {
+    Assign (thePoints.IsEmpty() ? NULL : &thePoints.First(), thePoints.Length());
+  }
+
+  //! Copies the elements into the array of Size() points.
+  Standard_EXPORT void CopyTo (gp_Pnt* thePoints) const;
+
+  //! Copies the elements into the array of points of the same length.
+  void CopyTo (TColgp_Array1OfPnt& thePoints) const
+  {
+    Standard_DimensionMismatch_Raise_if (thePoints.Length() != mySize, "gp_XYZBatch::CopyTo() - wrong length of array");
+    if (mySize != 0)
+    {
+      CopyTo (&thePoints.ChangeFirst());
+    }
+  }
+
+public: //! @name batch operations
+
+  //! Transforms the elements as points (see gp_Pnt::Transform()).
+  Standard_EXPORT void Transform (const gp_Trsf& theTrsf);
+
+  //! Multiplies the elements by the matrix (see gp_XYZ::Multiply()).
+  Standard_EXPORT void Multiply (const gp_Mat& theMatrix);
+
+  //! Computes the minimal and maximal coordinates of the elements.
+  //! Returns FALSE if the batch is empty.
+  Standard_EXPORT Standard_Boolean BoundingBox (gp_XYZ& theMin,
+                                                gp_XYZ& theMax) const;
+
+  //! Computes the square distances between the elements and the point
+  //! into the array of Size() values.
+  Standard_EXPORT void SquareDistances (const gp_XYZ& thePoint,
+                                        Standard_Real* theDistances) const;
+
+  //! Computes the distances between the elements and the point
+  //! into the array of Size() values.
+  Standard_EXPORT void Distances (const gp_XYZ& thePoint,
+                                  Standard_Real* theDistances) const;
+
+  //! Returns the minimal square distance between the elements and the point
+  //! and the index of the first nearest element; returns -1 as index for the empty batch.
+  Standard_EXPORT Standard_Real MinSquareDistance (const gp_XYZ& thePoint,
+                                                   Standard_Integer& theIndex) const;
+
+  //! Computes the cross products of the elements of two batches of the same size (see gp_XYZ::Cross());
+  //! this batch is resized to their size and may be one of them.
+  Standard_EXPORT void Cross (const gp_XYZBatch& theLeft,
+                              const gp_XYZBatch& theRight);
+
+  //! Normalizes the elements (see gp_XYZ::Normalize()).
+  //! The elements with modulus not greater than gp::Resolution() are left unchanged.
+  //! Returns the number of such elements.
+  Standard_EXPORT Standard_Integer Normalize();
+
+private:
+
+  gp_XYZBatch (const gp_XYZBatch& );
+  gp_XYZBatch& operator= (const gp_XYZBatch& );
+
+private:
+
+  Standard_Real*   myData;     //!< components: X, Y and Z arrays of myCapacity values each
+  Standard_Integer mySize;     //!< number of elements
+  Standard_Integer myCapacity; //!< number of allocated elements, multiple of the maximal SIMD width
+
+};
+
+#endif // _gp_XYZBatch_HeaderFile
@@ -1,9 +1,18 @@
+# Usage: init-cmake.sh [--mmgr-thread-cache]
+#   --mmgr-thread-cache  use the thread-caching memory manager (MMGT_OPT=3)
+#                        by default instead of the standard one
+MMGT_CXX_FLAGS=""
+if [ "$1" = "--mmgr-thread-cache" ]; then
+  MMGT_CXX_FLAGS="-DOCCT_MMGT_OPT_DEFAULT=3"
+fi
+
 cd /build/
 
 emcmake cmake \
   -DCMAKE_SUPPRESS_REGENERATION:BOOL=ON  \
   -DBUILD_USE_PCH:BOOLEAN=OFF \
   -DUSE_TBB:BOOLEAN=OFF \
+  ${MMGT_CXX_FLAGS:+"-DCMAKE_CXX_FLAGS=$MMGT_CXX_FLAGS"} \
   -DUSE_TCL:BOOLEAN=OFF \
   -DUSE_FREETYPE:BOOLEAN=OFF \
   -DBUILD_LIBRARY_TYPE=Static \
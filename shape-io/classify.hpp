@@ -6,6 +6,9 @@
 #include <TopoDS_Shape.hxx>
 #include <ShapeAnalysis_Edge.hxx>
 #include <BOPTools_AlgoTools2D.hxx>
+#include <GeomAdaptor_Surface.hxx>
+#include <TColgp_Array1OfPnt.hxx>
+#include <TColgp_Array1OfPnt2d.hxx>
 
 
 namespace e0 {
@@ -18,13 +21,11 @@ namespace e0 {
   static const int LOGICAL_CLASSIFICATION_ALL = 1;
   static const int LOGICAL_CLASSIFICATION_PARTIAL = 2;
 
-  int classifyPointToFace(const TopoDS_Face& face, const gp_Pnt& p3d, float tol = -1) {
-    Handle(Geom_Surface) surf = BRep_Tool::Surface(TopoDS::Face(face));
-    if (tol < 0) {
-        tol = BRep_Tool::Tolerance(face);        
+  // classifies the point already projected by proj on the surface of the face
+  int classifyProjectionToFace(const TopoDS_Face& face, const GeomAPI_ProjectPointOnSurf& proj, float tol) {
+    if (proj.NbPoints() == 0) {
+      return GEOM_CLASSIFICATION_UNRELATED;
     }
-    
-    GeomAPI_ProjectPointOnSurf proj(p3d, surf);
 
     if (proj.LowerDistance() <= tol) {
         Standard_Real u, v;
@@ -45,6 +46,16 @@ namespace e0 {
     }    
   }
 
+  int classifyPointToFace(const TopoDS_Face& face, const gp_Pnt& p3d, float tol = -1) {
+    Handle(Geom_Surface) surf = BRep_Tool::Surface(TopoDS::Face(face));
+    if (tol < 0) {
+        tol = BRep_Tool::Tolerance(face);        
+    }
+    
+    GeomAPI_ProjectPointOnSurf proj(p3d, surf);
+    return classifyProjectionToFace(face, proj, tol);
+  }
+
   int classifyFaceToFace(const TopoDS_Face& face1, const TopoDS_Face& face2, float tol = -1) {
 
     if (tol < 0) {
@@ -65,9 +76,17 @@ namespace e0 {
     Standard_Integer nnn = aTr->NbTriangles(); 
     Standard_Integer nt,n1,n2,n3; 
 
+    if (nnn == 0) {
+      // no triangles to classify, the arrays below cannot be empty
+      return LOGICAL_CLASSIFICATION_UNRELATED;
+    }
+
     bool wasMatch = false;
     bool wasMissMatch = false;
 
+    // evaluate the centroids of all triangles at once, grouped by the surface spans
+    TColgp_Array1OfPnt2d centroidUVs(1, nnn);
+    TColgp_Array1OfPnt evalPoints(1, nnn);
     for( nt = 1 ; nt < nnn+1 ; nt++) { 
       // takes the node indices of each triangle in n1,n2,n3: 
       triangles(nt).Get(n1,n2,n3); 
@@ -76,11 +95,34 @@ namespace e0 {
       gp_Pnt2d uv2 = aTr->UVNode(n2);
       gp_Pnt2d uv3 = aTr->UVNode(n3);
 
-      gp_Pnt2d centroidUV = gp_Pnt2d((uv1.X()+uv2.X()+uv3.X())/3, (uv1.Y()+uv2.Y()+uv3.Y())/3);
+      centroidUVs(nt) = gp_Pnt2d((uv1.X()+uv2.X()+uv3.X())/3, (uv1.Y()+uv2.Y()+uv3.Y())/3);
+    }
+    GeomAdaptor_Surface(surface).EvaluatePoints(centroidUVs, evalPoints);
+
+    // the centroids of neighbouring triangles are close, so each one is projected
+    // starting from the projection of the previous one by the tree algorithm
+    Handle(Geom_Surface) surface1 = BRep_Tool::Surface(face1);
+    Standard_Real umin, umax, vmin, vmax;
+    surface1->Bounds(umin, umax, vmin, vmax);
+    GeomAPI_ProjectPointOnSurf proj;
+    proj.Init(surface1, umin, umax, vmin, vmax, Extrema_ExtAlgo_Tree);
+    bool hasSeed = false;
+    Standard_Real u0 = 0., v0 = 0.;
+
+    for( nt = 1 ; nt < nnn+1 ; nt++) { 
+      const gp_Pnt& evalPoint = evalPoints(nt);
 
-      gp_Pnt evalPoint = surface->Value(centroidUV.X(), centroidUV.Y());
+      if (hasSeed) {
+        proj.Perform(evalPoint, u0, v0);
+      } else {
+        proj.Perform(evalPoint);
+      }
+      hasSeed = proj.NbPoints() > 0;
+      if (hasSeed) {
+        proj.LowerDistanceParameters(u0, v0);
+      }
 
-      auto pfClassification = classifyPointToFace(face1, evalPoint, tol);
+      auto pfClassification = classifyProjectionToFace(face1, proj, tol);
 
       switch (pfClassification) {
         case GEOM_CLASSIFICATION_BOUNDS:
@@ -13,6 +13,10 @@
 #include <TopLoc_Location.hxx>
 #include <Poly_Triangulation.hxx>
 #include <TColgp_Array1OfPnt.hxx>
+#include <TColgp_Array1OfPnt2d.hxx>
+#include <TColgp_Array1OfVec.hxx>
+#include <gp_XYZBatch.hxx>
+#include <GeomAdaptor_Surface.hxx>
 #include <BRepMesh_IncrementalMesh.hxx>
 #include <Geom_Surface.hxx>
 #include "data.hpp"
@@ -40,34 +44,77 @@ void writeFaceTessellation(const Handle(Poly_Triangulation)& aTr,
   Standard_Integer nnn = aTr->NbTriangles();
   bool isPlane = aSurface->IsKind("Geom_Plane");
 
-  // Pre-transform points with bounds checking
-  std::vector<gp_Pnt> transformedPoints;
-  transformedPoints.reserve(aTr->NbNodes());
-  for(Standard_Integer i = 1; i <= aTr->NbNodes(); i++) {
-    if (i > aTr->NbNodes()) break;  // Extra safety check
-    transformedPoints.push_back(aTr->Node(i).Transformed(aLocation));
+  // Pre-transform points in one batch
+  const gp_Trsf& aTrsf = aLocation.Transformation();
+  std::vector<gp_Pnt> transformedPoints(aTr->NbNodes());
+  {
+    gp_XYZBatch aNodes;
+    aTr->InternalNodes().CopyToBatch(aNodes);
+    aNodes.Transform(aTrsf);
+    aNodes.CopyTo(transformedPoints.data());
   }
 
   // Pre-compute normals with bounds checking
   std::vector<gp_Vec> normals;
+  std::vector<Standard_Integer> failedNormals;
   if (!isPlane) {
     normals.reserve(aTr->NbNodes());
+
+    // Evaluate the derivatives of all nodes at once, grouped by the surface spans
+    const Standard_Integer aNbNodes = aTr->NbNodes();
+    TColgp_Array1OfPnt2d uvs(1, aNbNodes);
+    TColgp_Array1OfPnt pnts(1, aNbNodes);
+    TColgp_Array1OfVec d1us(1, aNbNodes), d1vs(1, aNbNodes);
+    bool isEvaluated = aTr->HasUVNodes();
+    if (isEvaluated) {
+      try {
+        for (Standard_Integer i = 1; i <= aNbNodes; i++) {
+          uvs(i) = aTr->UVNode(i);
+        }
+        GeomAdaptor_Surface(aSurface).EvaluatePoints(uvs, pnts, d1us, d1vs);
+      } catch (Standard_Failure const&) {
+        isEvaluated = false;  // Evaluate the nodes one by one
+      }
+    }
+
     for(Standard_Integer i = 1; i <= aTr->NbNodes(); i++) {
       if (i > aTr->NbNodes()) break;  // Extra safety check
       try {
-        gp_Pnt2d uv = aTr->UVNode(i);
-        gp_Pnt dummy;
         gp_Vec d1u, d1v;
-        aSurface->D1(uv.X(), uv.Y(), dummy, d1u, d1v);
+        if (isEvaluated) {
+          d1u = d1us(i);
+          d1v = d1vs(i);
+        } else {
+          gp_Pnt2d uv = aTr->UVNode(i);
+          gp_Pnt dummy;
+          aSurface->D1(uv.X(), uv.Y(), dummy, d1u, d1v);
+        }
         gp_Vec normal = d1u.Crossed(d1v);
         if (normal.Magnitude() > Precision::Confusion()) {
           normal.Multiply(1.0 / normal.Magnitude());
         } else {
           normal = gp_Vec(0, 0, 1);  // Default normal if calculation fails
         }
-        normals.push_back(normal.Transformed(aLocation));
+        normals.push_back(normal);
       } catch (Standard_Failure const&) {
         normals.push_back(gp_Vec(0, 0, 1));  // Default normal on failure
+        failedNormals.push_back(i - 1);
+      }
+    }
+
+    // Transform the normals in one batch, the defaults of failed nodes are kept
+    if (aTrsf.Form() != gp_Identity) {
+      const Standard_Integer aNbNormals = (Standard_Integer)normals.size();
+      gp_XYZBatch aNormals(aNbNormals);
+      for (Standard_Integer i = 0; i < aNbNormals; i++) {
+        aNormals.SetValue(i, normals[i].XYZ());
+      }
+      aNormals.Multiply(aTrsf.VectorialPart());
+      for (Standard_Integer i = 0; i < aNbNormals; i++) {
+        normals[i] = gp_Vec(aNormals.Value(i));
+      }
+      for (Standard_Integer i : failedNormals) {
+        normals[i] = gp_Vec(0, 0, 1);
       }
     }
   }
@@ -209,16 +256,37 @@ DATA interrogate(const TopoDS_Shape& aShape, Standard_Real aDeflection = 15,
   return out;
 }
 
+// Meshing parameters shared by the full and the incremental update of tessellation
+static IMeshTools_Parameters TessellationParameters(double deflection) {
+  IMeshTools_Parameters aParams;
+  aParams.Deflection = deflection;
+  aParams.Relative   = Standard_True;  // relative
+  aParams.Angle      = 0.5;            // angular deflection
+  aParams.InParallel = Standard_False; // parallel
+  return aParams;
+}
+
 void UpdateTessellation(TopoDS_Shape& shape, double deflection) {
   // Clean existing triangulation
   BRepTools::Clean(shape);
   
   // Perform incremental meshing with optimized parameters
-  BRepMesh_IncrementalMesh mesher(shape, deflection, 
-    Standard_True,   // relative
-    0.5,             // angular deflection
-    Standard_False   // parallel
-  );
+  BRepMesh_IncrementalMesh mesher;
+  mesher.SetShape(shape);
+  mesher.ChangeParameters() = TessellationParameters(deflection);
+  mesher.Perform();
+}
+
+// Re-meshes only faces modified by the last operation, keeping the mesh of
+// untouched faces and discretization of edges shared with them.
+// Uses the same meshing parameters as the full update above.
+void UpdateTessellation(const TopoDS_Shape& shape, double deflection,
+                        const TopTools_ListOfShape& modifiedFaces) {
+  BRepMesh_IncrementalMesh mesher;
+  mesher.SetShape(shape);
+  mesher.ChangeParameters() = TessellationParameters(deflection);
+  mesher.SetModifiedFaces(modifiedFaces);
+  mesher.Perform();
 }
 
 } // namespace io
@@ -80,6 +80,20 @@ extern "C" {
     e0::io::UpdateTessellation(*shape, deflection);
   }
 
+  EMSCRIPTEN_KEEPALIVE
+  void UpdateFacesTessellation(int shapePtr, int* facePtrs, int nbFaces, double deflection) {
+    TopoDS_Shape* shape = reinterpret_cast<TopoDS_Shape*>(shapePtr);
+    TopTools_ListOfShape modifiedFaces;
+    for (int i = 0; i < nbFaces; i++) {
+      modifiedFaces.Append(*reinterpret_cast<TopoDS_Face*>(facePtrs[i]));
+    }
+    try {
+      e0::io::UpdateTessellation(*shape, deflection, modifiedFaces);
+    } catch (Standard_Failure const& anException) {
+      std::cerr << "ERROR: " << anException.GetMessageString() << std::endl;
+    }
+  }
+
   EMSCRIPTEN_KEEPALIVE
   void SetLocation(const char* shapeName, float mx0, float mx1, float mx2, float mx3, float mx4, float mx5, float mx6, float mx7, float mx8, float mx9, float mx10, float mx11) {
     try {